@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/byte_order.hpp"
+#include "ravennakit/core/format.hpp"
+
+#include <catch2/catch_all.hpp>
+#include <nanobench.h>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+/// Divisible by 2, 3 and 4, and larger than the caches.
+constexpr size_t k_buffer_size = 6 * 1024 * 1024;
+
+/**
+ * The nested loop swap_bytes used before it was vectorized, kept as a baseline.
+ */
+void swap_bytes_nested_loop(uint8_t* data, const size_t size, const size_t stride) {
+    for (size_t i = 0; i < size; i += stride) {
+        for (size_t j = 0; j < stride / 2; ++j) {
+            std::swap(data[i + j], data[i + stride - j - 1]);
+        }
+    }
+}
+
+}  // namespace
+
+TEST_CASE("swap_bytes Benchmark") {
+    std::vector<uint8_t> src(k_buffer_size);
+    std::iota(src.begin(), src.end(), uint8_t {0});
+    std::vector<uint8_t> dst(k_buffer_size);
+
+    for (const size_t stride : {2u, 3u, 4u}) {
+        ankerl::nanobench::Bench b;
+        b.title(fmt::format("swap_bytes {} byte samples ({} MiB)", stride, k_buffer_size / 1024 / 1024))
+            .warmup(10)
+            .relative(true)
+            .minEpochIterations(20)
+            .batch(k_buffer_size)
+            .unit("byte")
+            .performanceCounters(true);
+
+        b.run("Nested loop, in place", [&] {
+            swap_bytes_nested_loop(dst.data(), dst.size(), stride);
+            ankerl::nanobench::doNotOptimizeAway(dst.data());
+        });
+
+        b.run("swap_bytes, in place", [&] {
+            rav::swap_bytes(dst.data(), dst.size(), stride);
+            ankerl::nanobench::doNotOptimizeAway(dst.data());
+        });
+
+        b.run("memcpy + nested loop", [&] {
+            std::memcpy(dst.data(), src.data(), src.size());
+            swap_bytes_nested_loop(dst.data(), dst.size(), stride);
+            ankerl::nanobench::doNotOptimizeAway(dst.data());
+        });
+
+        b.run("memcpy + swap_bytes", [&] {
+            std::memcpy(dst.data(), src.data(), src.size());
+            rav::swap_bytes(dst.data(), dst.size(), stride);
+            ankerl::nanobench::doNotOptimizeAway(dst.data());
+        });
+
+        b.run("swap_bytes_copy", [&] {
+            rav::swap_bytes_copy(src.data(), dst.data(), src.size(), stride);
+            ankerl::nanobench::doNotOptimizeAway(dst.data());
+        });
+
+        b.run("memcpy only (reference)", [&] {
+            std::memcpy(dst.data(), src.data(), src.size());
+            ankerl::nanobench::doNotOptimizeAway(dst.data());
+        });
+    }
+}
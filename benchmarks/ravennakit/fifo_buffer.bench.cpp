@@ -0,0 +1,410 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/containers/fifo_buffer.hpp"
+#include "ravennakit/core/format.hpp"
+
+#include <catch2/catch_all.hpp>
+#include <nanobench.h>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * The Spsc strategy as it was before the locks became allocation free: a std::function commit per operation and both
+ * timestamps sharing a cache line. Kept here to have a baseline to compare against.
+ */
+struct LegacySpsc {
+    static constexpr bool k_single_consumer = true;
+
+    struct Lock {
+        rav::Fifo::Position position {};
+
+        Lock() = default;
+
+        explicit Lock(std::function<void()>&& commit) : commit_(commit) {}
+
+        explicit operator bool() const {
+            return commit_ != nullptr;
+        }
+
+        void commit() const {
+            if (commit_)
+                commit_();
+        }
+
+      private:
+        std::function<void()> commit_;
+    };
+
+    Lock prepare_for_write(const size_t number_of_elements) {
+        if (write_ts_.load() - read_ts_.load() + number_of_elements > capacity_) {
+            return {};
+        }
+        Lock write_lock([this, number_of_elements] {
+            write_ts_.fetch_add(number_of_elements);
+        });
+        write_lock.position.update(write_ts_, capacity_, number_of_elements);
+        return write_lock;
+    }
+
+    Lock prepare_for_read(const size_t number_of_elements) {
+        if (write_ts_.load() - read_ts_.load() < number_of_elements) {
+            return {};
+        }
+        Lock read_lock([this, number_of_elements] {
+            read_ts_.fetch_add(number_of_elements);
+        });
+        read_lock.position.update(read_ts_, capacity_, number_of_elements);
+        return read_lock;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return write_ts_.load() - read_ts_.load();
+    }
+
+    void resize(const size_t capacity) {
+        reset();
+        capacity_ = capacity;
+    }
+
+    void reset() {
+        read_ts_ = 0;
+        write_ts_ = 0;
+    }
+
+  private:
+    std::atomic<size_t> read_ts_ = 0;
+    std::atomic<size_t> write_ts_ = 0;
+    size_t capacity_ = 0;
+};
+
+/**
+ * The Mpsc strategy as it was before it became lock free: producers serialize on a mutex which is held by the lock until
+ * it goes out of scope.
+ */
+struct LegacyMpsc {
+    static constexpr bool k_single_consumer = true;
+
+    struct Lock {
+        rav::Fifo::Position position {};
+
+        Lock() = default;
+
+        explicit Lock(std::function<void()>&& commit) : commit_(commit) {}
+
+        explicit Lock(std::function<void()>&& commit, std::unique_lock<std::mutex>&& unique_lock) :
+            commit_(commit), lock_(std::move(unique_lock)) {}
+
+        explicit operator bool() const {
+            return commit_ != nullptr;
+        }
+
+        void commit() const {
+            if (commit_)
+                commit_();
+        }
+
+      private:
+        std::function<void()> commit_;
+        std::unique_lock<std::mutex> lock_;
+    };
+
+    Lock prepare_for_write(const size_t number_of_elements) {
+        std::unique_lock guard(mutex_);
+        if (write_ts_.load() - read_ts_.load() + number_of_elements > capacity_) {
+            return {};
+        }
+        Lock write_lock(
+            [this, number_of_elements] {
+                write_ts_.fetch_add(number_of_elements);
+            },
+            std::move(guard)
+        );
+        write_lock.position.update(write_ts_, capacity_, number_of_elements);
+        return write_lock;
+    }
+
+    Lock prepare_for_read(const size_t number_of_elements) {
+        if (write_ts_.load() - read_ts_.load() < number_of_elements) {
+            return {};
+        }
+        Lock read_lock([this, number_of_elements] {
+            read_ts_.fetch_add(number_of_elements);
+        });
+        read_lock.position.update(read_ts_, capacity_, number_of_elements);
+        return read_lock;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return write_ts_.load() - read_ts_.load();
+    }
+
+    void resize(const size_t capacity) {
+        reset();
+        capacity_ = capacity;
+    }
+
+    void reset() {
+        read_ts_ = 0;
+        write_ts_ = 0;
+    }
+
+  private:
+    std::atomic<size_t> read_ts_ = 0;
+    std::atomic<size_t> write_ts_ = 0;
+    size_t capacity_ = 0;
+    std::mutex mutex_;
+};
+
+template<size_t Size>
+struct Element {
+    std::array<uint8_t, Size> data {};
+};
+
+constexpr size_t k_capacity = 256;
+
+template<size_t Size>
+void run_single_thread_benchmark() {
+    ankerl::nanobench::Bench b;
+    b.title(fmt::format("FifoBuffer single thread push/pop ({} bytes)", Size))
+        .warmup(100)
+        .relative(true)
+        .minEpochIterations(100'000)
+        .performanceCounters(true);
+
+    const Element<Size> element {};
+
+    rav::FifoBuffer<Element<Size>, LegacySpsc> legacy(k_capacity);
+    b.run("LegacySpsc push + pop", [&] {
+        std::ignore = legacy.push(element);
+        ankerl::nanobench::doNotOptimizeAway(legacy.pop());
+    });
+
+    rav::FifoBuffer<Element<Size>, rav::Fifo::Spsc> spsc(k_capacity);
+    b.run("Spsc push + pop", [&] {
+        std::ignore = spsc.push(element);
+        ankerl::nanobench::doNotOptimizeAway(spsc.pop());
+    });
+
+    b.run("Spsc push + try_peek + consume", [&] {
+        std::ignore = spsc.push(element);
+        ankerl::nanobench::doNotOptimizeAway(spsc.try_peek()->data[0]);
+        spsc.consume();
+    });
+
+    rav::FifoBuffer<Element<Size>, LegacyMpsc> legacy_mpsc(k_capacity);
+    b.run("LegacyMpsc push + pop", [&] {
+        std::ignore = legacy_mpsc.push(element);
+        ankerl::nanobench::doNotOptimizeAway(legacy_mpsc.pop());
+    });
+
+    rav::FifoBuffer<Element<Size>, rav::Fifo::Mpsc> mpsc(k_capacity);
+    b.run("Mpsc push + pop", [&] {
+        std::ignore = mpsc.push(element);
+        ankerl::nanobench::doNotOptimizeAway(mpsc.pop());
+    });
+
+    rav::FifoBuffer<Element<Size>, rav::Fifo::Mpmc> mpmc(k_capacity);
+    b.run("Mpmc push + pop", [&] {
+        std::ignore = mpmc.push(element);
+        ankerl::nanobench::doNotOptimizeAway(mpmc.pop());
+    });
+}
+
+template<class F, size_t Size>
+void run_producers_and_consumer(ankerl::nanobench::Bench& b, const std::string& name, const size_t num_producers = 1) {
+    rav::FifoBuffer<Element<Size>, F> buffer(k_capacity);
+    std::atomic keep_going = true;
+
+    std::vector<std::thread> producers;
+    for (size_t i = 0; i < num_producers; ++i) {
+        producers.emplace_back([&] {
+            const Element<Size> element {};
+            while (keep_going.load(std::memory_order_relaxed)) {
+                if (!buffer.push(element)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    b.run(name, [&] {
+        while (true) {
+            if constexpr (F::k_single_consumer) {
+                if (auto* element = buffer.try_peek()) {
+                    ankerl::nanobench::doNotOptimizeAway(element->data[0]);
+                    buffer.consume();
+                    return;
+                }
+            } else {
+                if (auto element = buffer.pop()) {
+                    ankerl::nanobench::doNotOptimizeAway(element->data[0]);
+                    return;
+                }
+            }
+        }
+    });
+
+    keep_going = false;
+    for (auto& producer : producers) {
+        producer.join();
+    }
+}
+
+template<size_t Size>
+void run_two_thread_benchmark() {
+    ankerl::nanobench::Bench b;
+    b.title(fmt::format("FifoBuffer producer and consumer thread ({} bytes)", Size))
+        .warmup(100)
+        .relative(true)
+        .minEpochIterations(100'000)
+        .performanceCounters(true);
+
+    run_producers_and_consumer<LegacySpsc, Size>(b, "LegacySpsc");
+    run_producers_and_consumer<rav::Fifo::Spsc, Size>(b, "Spsc");
+}
+
+template<size_t Size>
+void run_contention_benchmark(const size_t num_producers) {
+    ankerl::nanobench::Bench b;
+    b.title(fmt::format("FifoBuffer {} producers and a consumer thread ({} bytes)", num_producers, Size))
+        .warmup(100)
+        .relative(true)
+        .minEpochIterations(100'000)
+        .performanceCounters(true);
+
+    run_producers_and_consumer<LegacyMpsc, Size>(b, "LegacyMpsc", num_producers);
+    run_producers_and_consumer<rav::Fifo::Mpsc, Size>(b, "Mpsc", num_producers);
+    run_producers_and_consumer<rav::Fifo::Mpmc, Size>(b, "Mpmc", num_producers);
+}
+
+template<size_t Size>
+void run_batch_benchmark(const size_t batch_size) {
+    ankerl::nanobench::Bench b;
+    b.title(fmt::format("FifoBuffer batches of {} ({} bytes)", batch_size, Size))
+        .warmup(100)
+        .relative(true)
+        .minEpochIterations(10'000)
+        .batch(batch_size)
+        .unit("element")
+        .performanceCounters(true);
+
+    const Element<Size> element {};
+    rav::FifoBuffer<Element<Size>, rav::Fifo::Spsc> buffer(k_capacity);
+
+    b.run("push + try_peek + consume per element", [&] {
+        for (size_t i = 0; i < batch_size; ++i) {
+            std::ignore = buffer.push(element);
+        }
+        for (size_t i = 0; i < batch_size; ++i) {
+            ankerl::nanobench::doNotOptimizeAway(buffer.try_peek()->data[0]);
+            buffer.consume();
+        }
+    });
+
+    b.run("write_reserve + read_available per batch", [&] {
+        const auto slots = buffer.write_reserve(batch_size);
+        for (size_t i = 0; i < slots.size(); ++i) {
+            slots[i] = element;
+        }
+        buffer.commit_write(slots.size());
+
+        const auto available = buffer.read_available();
+        for (size_t i = 0; i < available.size(); ++i) {
+            ankerl::nanobench::doNotOptimizeAway(available[i].data[0]);
+        }
+        buffer.commit_read(available.size());
+    });
+}
+
+template<size_t Size>
+void run_two_thread_batch_benchmark() {
+    ankerl::nanobench::Bench b;
+    b.title(fmt::format("FifoBuffer producer and batch consumer thread ({} bytes)", Size))
+        .warmup(100)
+        .relative(true)
+        .minEpochIterations(100'000)
+        .performanceCounters(true);
+
+    run_producers_and_consumer<rav::Fifo::Spsc, Size>(b, "Spsc try_peek + consume");
+
+    rav::FifoBuffer<Element<Size>, rav::Fifo::Spsc> buffer(k_capacity);
+    std::atomic keep_going = true;
+
+    std::thread producer([&] {
+        const Element<Size> element {};
+        while (keep_going.load(std::memory_order_relaxed)) {
+            if (!buffer.push(element)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // Every run consumes one element, but synchronizes with the producer only once per batch
+    size_t index = 0;
+    auto available = buffer.read_available();
+    b.run("Spsc read_available + commit_read", [&] {
+        while (index == available.size()) {
+            buffer.commit_read(available.size());
+            available = buffer.read_available();
+            index = 0;
+        }
+        ankerl::nanobench::doNotOptimizeAway(available[index++].data[0]);
+    });
+
+    keep_going = false;
+    producer.join();
+}
+
+}  // namespace
+
+TEST_CASE("FifoBuffer batch Benchmark") {
+    for (const size_t batch_size : {1u, 4u, 16u, 64u}) {
+        run_batch_benchmark<64>(batch_size);
+        run_batch_benchmark<1500>(batch_size);
+    }
+
+    run_two_thread_batch_benchmark<64>();
+    run_two_thread_batch_benchmark<1500>();
+}
+
+TEST_CASE("FifoBuffer Benchmark") {
+    run_single_thread_benchmark<8>();
+    run_single_thread_benchmark<64>();
+    run_single_thread_benchmark<1500>();
+
+    run_two_thread_benchmark<8>();
+    run_two_thread_benchmark<64>();
+    run_two_thread_benchmark<1500>();
+}
+
+TEST_CASE("FifoBuffer contention Benchmark") {
+    for (const size_t num_producers : {1u, 2u, 4u, 8u}) {
+        run_contention_benchmark<64>(num_producers);
+    }
+}
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/math/histogram.hpp"
+#include "ravennakit/core/math/interval_stats.hpp"
+
+#include <catch2/catch_all.hpp>
+#include <nanobench.h>
+
+TEST_CASE("Histogram Benchmark") {
+    ankerl::nanobench::Bench b;
+    b.title("Histogram Benchmark").warmup(100).relative(true).minEpochIterations(100'000).performanceCounters(true);
+
+    rav::IntervalStats stats;
+    uint64_t value = 1'000'000;
+    b.run("IntervalStats update", [&] {
+        stats.update(static_cast<double>(value) / 1'000'000.0);
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        value = 900'000 + (value >> 44);
+    });
+
+    rav::Histogram histogram;
+    b.run("Histogram record", [&] {
+        histogram.record(value);
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        value = 900'000 + (value >> 44);
+    });
+
+    b.run("Histogram snapshot", [&] {
+        ankerl::nanobench::doNotOptimizeAway(histogram.snapshot().value_at_percentile(99.9));
+    });
+}
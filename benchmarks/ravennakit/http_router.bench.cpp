@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/net/http/http_router.hpp"
+
+#include <catch2/catch_all.hpp>
+#include <nanobench.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace {
+
+using verb = boost::beast::http::verb;
+using Handler = std::function<void()>;
+
+/// The routes registered by rav::nmos::Node.
+const std::vector<std::pair<verb, std::string_view>> k_nmos_routes {
+    {verb::get, "/"},
+    {verb::get, "/x-nmos"},
+    {verb::get, "/x-nmos/node"},
+    {verb::get, "/x-nmos/node/{version}"},
+    {verb::get, "/x-nmos/node/{version}/self"},
+    {verb::get, "/x-nmos/node/{version}/devices"},
+    {verb::get, "/x-nmos/node/{version}/devices/{device_id}"},
+    {verb::get, "/x-nmos/node/{version}/flows"},
+    {verb::get, "/x-nmos/node/{version}/flows/{flow_id}"},
+    {verb::get, "/x-nmos/node/{version}/receivers"},
+    {verb::get, "/x-nmos/node/{version}/receivers/{receiver_id}"},
+    {verb::options, "/x-nmos/node/{version}/receivers/{receiver_id}/target"},
+    {verb::get, "/x-nmos/node/{version}/senders"},
+    {verb::get, "/x-nmos/node/{version}/senders/{sender_id}"},
+    {verb::get, "/x-nmos/node/{version}/sources"},
+    {verb::get, "/x-nmos/node/{version}/sources/{source_id}"},
+    {verb::get, "/x-nmos/connection"},
+    {verb::get, "/x-nmos/connection/{version}"},
+    {verb::get, "/x-nmos/connection/{version}/bulk"},
+    {verb::get, "/x-nmos/connection/{version}/single"},
+    {verb::get, "/x-nmos/connection/{version}/bulk/receivers"},
+    {verb::options, "/x-nmos/connection/{version}/bulk/receivers"},
+    {verb::get, "/x-nmos/connection/{version}/single/receivers"},
+    {verb::get, "/x-nmos/connection/{version}/single/receivers/{receiver_id}"},
+    {verb::get, "/x-nmos/connection/{version}/single/receivers/{receiver_id}/staged"},
+    {verb::options, "/x-nmos/connection/{version}/single/receivers/{receiver_id}/staged"},
+    {verb::patch, "/x-nmos/connection/{version}/single/receivers/{receiver_id}/staged"},
+    {verb::get, "/x-nmos/connection/{version}/single/receivers/{receiver_id}/active"},
+    {verb::get, "/x-nmos/connection/{version}/single/receivers/{receiver_id}/constraints"},
+    {verb::get, "/x-nmos/connection/{version}/single/receivers/{receiver_id}/transporttype"},
+    {verb::get, "/x-nmos/connection/{version}/bulk/senders"},
+    {verb::options, "/x-nmos/connection/{version}/bulk/senders"},
+    {verb::get, "/x-nmos/connection/{version}/single/senders"},
+    {verb::get, "/x-nmos/connection/{version}/single/senders/{sender_id}"},
+    {verb::options, "/x-nmos/connection/{version}/single/senders/{sender_id}/staged"},
+    {verb::get, "/x-nmos/connection/{version}/single/senders/{sender_id}/staged"},
+    {verb::patch, "/x-nmos/connection/{version}/single/senders/{sender_id}/staged"},
+    {verb::get, "/x-nmos/connection/{version}/single/senders/{sender_id}/active"},
+    {verb::get, "/x-nmos/connection/{version}/single/senders/{sender_id}/constraints"},
+    {verb::get, "/x-nmos/connection/{version}/single/senders/{sender_id}/transportfile"},
+    {verb::get, "/x-nmos/connection/{version}/single/senders/{sender_id}/transporttype"},
+    {verb::get, "/**"},
+};
+
+/// A mix of requests as a controller would send them.
+const std::vector<std::pair<verb, std::string_view>> k_requests {
+    {verb::get, "/x-nmos/node/v1.3/self"},
+    {verb::get, "/x-nmos/node/v1.3/devices"},
+    {verb::get, "/x-nmos/node/v1.3/receivers/3b8be755-08ff-452b-b217-c9151eb21193"},
+    {verb::get, "/x-nmos/node/v1.3/senders/7a8fd2a8-8d3b-4b4e-9d1a-5e5d0c0a9a61"},
+    {verb::get, "/x-nmos/connection/v1.1/single/receivers/3b8be755-08ff-452b-b217-c9151eb21193/staged"},
+    {verb::patch, "/x-nmos/connection/v1.1/single/receivers/3b8be755-08ff-452b-b217-c9151eb21193/staged"},
+    {verb::get, "/x-nmos/connection/v1.1/single/senders/7a8fd2a8-8d3b-4b4e-9d1a-5e5d0c0a9a61/transportfile"},
+    {verb::get, "/x-nmos/connection/v1.1/single/senders/7a8fd2a8-8d3b-4b4e-9d1a-5e5d0c0a9a61/transporttype"},
+    {verb::get, "/favicon.ico"},
+};
+
+/**
+ * The router as it was before routes were compiled into a trie: a linear scan running PathMatcher on every pattern.
+ * Kept here to have a baseline to compare against.
+ */
+class LinearRouter {
+  public:
+    void insert(const verb method, const std::string_view pattern, Handler handler) {
+        routes_.push_back({method, std::string(pattern), std::move(handler)});
+    }
+
+    Handler* match(const verb method, const std::string_view path, rav::PathMatcher::Parameters* parameters) {
+        for (auto& route : routes_) {
+            if (route.method == method) {
+                auto match_result = rav::PathMatcher::match(path, route.pattern, parameters);
+                if (match_result.has_value() && match_result.value()) {
+                    return &route.handler;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+  private:
+    struct Route {
+        verb method {};
+        std::string pattern;
+        Handler handler;
+    };
+
+    std::vector<Route> routes_;
+};
+
+template<class Router>
+void run_requests(Router& router) {
+    for (const auto& [method, path] : k_requests) {
+        rav::PathMatcher::Parameters parameters;
+        auto* handler = router.match(method, path, &parameters);
+        ankerl::nanobench::doNotOptimizeAway(handler);
+        ankerl::nanobench::doNotOptimizeAway(parameters);
+    }
+}
+
+}  // namespace
+
+TEST_CASE("HttpRouter Benchmark") {
+    rav::HttpRouter<Handler> trie_router;
+    LinearRouter linear_router;
+    for (const auto& [method, pattern] : k_nmos_routes) {
+        trie_router.insert(method, pattern, [] {});
+        linear_router.insert(method, pattern, [] {});
+    }
+
+    ankerl::nanobench::Bench b;
+    b.title("HttpRouter NMOS routes")
+        .warmup(100)
+        .relative(true)
+        .minEpochIterations(10'000)
+        .batch(k_requests.size())
+        .unit("request")
+        .performanceCounters(true);
+
+    b.run("Linear PathMatcher scan", [&] {
+        run_requests(linear_router);
+    });
+
+    b.run("HttpRouter (trie)", [&] {
+        run_requests(trie_router);
+    });
+}
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/math/sliding_stats.hpp"
+#include "ravennakit/core/net/http/http_server.hpp"
+
+#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/http.hpp>
+#include <catch2/catch_all.hpp>
+#include <nanobench.h>
+
+#include <atomic>
+#include <thread>
+
+namespace {
+
+constexpr size_t k_num_load_clients = 4;
+constexpr auto k_timer_interval = std::chrono::milliseconds(1);
+
+/**
+ * A synchronous keep-alive client, used both as load generator and to measure the request latency.
+ */
+class BlockingClient {
+  public:
+    explicit BlockingClient(const boost::asio::ip::tcp::endpoint& endpoint) : stream_(io_context_) {
+        stream_.connect(endpoint);
+    }
+
+    bool get(const std::string_view target) {
+        rav::HttpServer::Request request {boost::beast::http::verb::get, target, 11};
+        request.set(boost::beast::http::field::host, "127.0.0.1");
+        boost::system::error_code ec;
+        boost::beast::http::write(stream_, request, ec);
+        if (ec) {
+            return false;
+        }
+        rav::HttpServer::Response response;
+        boost::beast::http::read(stream_, buffer_, response, ec);
+        return !ec && response.result() == boost::beast::http::status::ok;
+    }
+
+  private:
+    boost::asio::io_context io_context_;
+    boost::beast::tcp_stream stream_;
+    boost::beast::flat_buffer buffer_;
+};
+
+/**
+ * Measures how late a periodic timer fires on the io_context. Everything else which shares the io_context with the
+ * server (PTP, RTSP, DNS-SD and the NMOS timers) is delayed by the same amount.
+ */
+class TimerLatenessProbe {
+  public:
+    explicit TimerLatenessProbe(boost::asio::io_context& io_context) : timer_(io_context) {
+        schedule();
+    }
+
+    void stop() {
+        stopped_ = true;
+        timer_.cancel();
+    }
+
+    [[nodiscard]] const rav::SlidingStats& get_stats() const {
+        return stats_;
+    }
+
+  private:
+    boost::asio::steady_timer timer_;
+    rav::SlidingStats stats_ {10'000};
+    bool stopped_ = false;
+
+    void schedule() {
+        timer_.expires_after(k_timer_interval);
+        timer_.async_wait([this](const boost::system::error_code& ec) {
+            if (ec || stopped_) {
+                return;
+            }
+            const auto lateness = std::chrono::steady_clock::now() - timer_.expiry();
+            stats_.add(static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(lateness).count()));
+            schedule();
+        });
+    }
+};
+
+}  // namespace
+
+TEST_CASE("rav::HttpServer worker threads Benchmark") {
+    ankerl::nanobench::Bench bench;
+    bench.title("HttpServer request latency under load").unit("request").minEpochIterations(500).warmup(50);
+
+    const std::string body(4096, 'x');  // Roughly the size of a cached NMOS collection
+
+    for (const size_t num_worker_threads : {size_t {0}, size_t {2}}) {
+        boost::asio::io_context io_context;
+        rav::HttpServer server(io_context);
+        server.get(
+            "/x-nmos/node/v1.3/senders",
+            [&body](const rav::HttpServer::Request&, rav::HttpServer::Response& res, rav::PathMatcher::Parameters&) {
+                res.result(boost::beast::http::status::ok);
+                res.body() = body;
+                res.prepare_payload();
+            }
+        );
+        server.set_worker_threads(num_worker_threads);
+        REQUIRE(!server.start("127.0.0.1", 0).has_error());
+        const boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address("127.0.0.1"), server.get_local_endpoint().port());
+
+        TimerLatenessProbe probe(io_context);
+        auto work_guard = boost::asio::make_work_guard(io_context);
+        std::thread io_thread([&io_context] {
+            io_context.run();
+        });
+
+        std::atomic<bool> keep_going {true};
+        std::atomic<size_t> num_load_requests {0};
+        std::vector<std::thread> load_generators;
+        for (size_t i = 0; i < k_num_load_clients; ++i) {
+            load_generators.emplace_back([&] {
+                BlockingClient client(endpoint);
+                while (keep_going && client.get("/x-nmos/node/v1.3/senders")) {
+                    ++num_load_requests;
+                }
+            });
+        }
+
+        BlockingClient client(endpoint);
+        bench.run(fmt::format("GET with {} worker threads", num_worker_threads), [&] {
+            ankerl::nanobench::doNotOptimizeAway(client.get("/x-nmos/node/v1.3/senders"));
+        });
+
+        keep_going = false;
+        for (auto& thread : load_generators) {
+            thread.join();
+        }
+
+        boost::asio::post(io_context, [&] {
+            probe.stop();
+            server.stop();
+            work_guard.reset();
+        });
+        io_thread.join();
+
+        const auto& stats = probe.get_stats();
+        fmt::println(
+            "{} worker threads: {} load requests, io_context timer lateness (us): mean {:.1f}, median {:.1f}, max {:.1f}",
+            num_worker_threads, num_load_requests.load(), stats.mean(), stats.median(), stats.max()
+        );
+    }
+}
@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/json_writer.hpp"
+#include "ravennakit/nmos/models/nmos_flow_audio_raw.hpp"
+#include "ravennakit/nmos/models/nmos_receiver_audio.hpp"
+#include "ravennakit/nmos/models/nmos_sender.hpp"
+#include "ravennakit/nmos/models/nmos_source_audio.hpp"
+#include "ravennakit/ravenna/ravenna_sender.hpp"
+
+#include <boost/uuid/random_generator.hpp>
+#include <catch2/catch_all.hpp>
+#include <nanobench.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<size_t> g_num_allocations {0};
+
+constexpr size_t k_num_streams = 500;
+
+/**
+ * The resources of a large node, serialized as one document like a full listing or an autosave would.
+ */
+struct NodeSnapshot {
+    std::vector<rav::nmos::SourceAudio> sources;
+    std::vector<rav::nmos::FlowAudioRaw> flows;
+    std::vector<rav::nmos::Sender> senders;
+    std::vector<rav::nmos::ReceiverAudio> receivers;
+    std::vector<rav::RavennaSender::Configuration> sender_configurations;
+};
+
+void tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv, const NodeSnapshot& snapshot) {
+    jv = {
+        {"sources", boost::json::value_from(snapshot.sources)},
+        {"flows", boost::json::value_from(snapshot.flows)},
+        {"senders", boost::json::value_from(snapshot.senders)},
+        {"receivers", boost::json::value_from(snapshot.receivers)},
+        {"sender_configurations", boost::json::value_from(snapshot.sender_configurations)},
+    };
+}
+
+void tag_invoke(const rav::JsonWriteTag&, rav::JsonWriter& writer, const NodeSnapshot& snapshot) {
+    writer.begin_object();
+    writer.member("sources", snapshot.sources);
+    writer.member("flows", snapshot.flows);
+    writer.member("senders", snapshot.senders);
+    writer.member("receivers", snapshot.receivers);
+    writer.member("sender_configurations", snapshot.sender_configurations);
+    writer.end_object();
+}
+
+NodeSnapshot make_snapshot(const size_t num_streams) {
+    boost::uuids::random_generator generator;
+    const auto device_id = generator();
+
+    NodeSnapshot snapshot;
+    for (size_t i = 0; i < num_streams; ++i) {
+        auto& source = snapshot.sources.emplace_back();
+        source.id = generator();
+        source.version = {1700000000, static_cast<uint32_t>(i)};
+        source.label = fmt::format("Source {}", i);
+        source.device_id = device_id;
+        source.channels = {{"Left"}, {"Right"}};
+
+        auto& flow = snapshot.flows.emplace_back();
+        flow.id = generator();
+        flow.label = fmt::format("Flow {}", i);
+        flow.source_id = source.id;
+        flow.device_id = device_id;
+        flow.sample_rate = {48000, 1};
+        flow.media_type = "audio/L24";
+        flow.bit_depth = 24;
+
+        auto& sender = snapshot.senders.emplace_back();
+        sender.id = generator();
+        sender.label = fmt::format("Sender {}", i);
+        sender.device_id = device_id;
+        sender.flow_id = flow.id;
+        sender.transport = "urn:x-nmos:transport:rtp.mcast";
+        sender.interface_bindings = {"eth0", "eth1"};
+
+        auto& receiver = snapshot.receivers.emplace_back();
+        receiver.id = generator();
+        receiver.label = fmt::format("Receiver {}", i);
+        receiver.device_id = device_id;
+        receiver.transport = "urn:x-nmos:transport:rtp";
+        receiver.interface_bindings = {"eth0", "eth1"};
+        receiver.caps.media_types = {"audio/L16", "audio/L24"};
+
+        auto& configuration = snapshot.sender_configurations.emplace_back();
+        configuration.session_name = fmt::format("Session {}", i);
+        configuration.destinations.push_back(
+            {0, {boost::asio::ip::make_address_v4(0xef000000 + static_cast<uint32_t>(i)), 5004}, true}
+        );
+        configuration.ttl = 15;
+        configuration.payload_type = 98;
+        configuration.audio_format = {
+            rav::AudioFormat::ByteOrder::be, rav::AudioEncoding::pcm_s24, rav::AudioFormat::ChannelOrdering::interleaved, 48000, 2
+        };
+        configuration.packet_time = rav::aes67::PacketTime::ms_1();
+        configuration.enabled = true;
+    }
+    return snapshot;
+}
+
+}  // namespace
+
+// Replaces the global allocation functions to count the number of allocations per snapshot.
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic ignored "-Wmismatched-new-delete"  // operator new below allocates with malloc
+#endif
+
+void* operator new(const std::size_t size) {
+    g_num_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+TEST_CASE("JsonWriter Benchmark") {
+    const auto snapshot = make_snapshot(k_num_streams);
+    const auto expected = boost::json::serialize(boost::json::value_from(snapshot));
+    REQUIRE(rav::serialize_json(snapshot) == expected);
+
+    ankerl::nanobench::Bench b;
+    b.title(fmt::format("Serializing a node snapshot with {} streams ({} bytes)", k_num_streams, expected.size()))
+        .warmup(2)
+        .minEpochIterations(10)
+        .batch(expected.size())
+        .unit("byte")
+        .relative(true)
+        .performanceCounters(true);
+
+    auto count_allocations = [](const char* name, auto&& fn) {
+        const auto before = g_num_allocations.load(std::memory_order_relaxed);
+        fn();
+        fmt::println("{}: {} allocations", name, g_num_allocations.load(std::memory_order_relaxed) - before);
+    };
+
+    auto via_dom = [&] {
+        auto json = boost::json::serialize(boost::json::value_from(snapshot));
+        ankerl::nanobench::doNotOptimizeAway(json);
+    };
+
+    auto via_writer = [&] {
+        auto json = rav::serialize_json(snapshot);
+        ankerl::nanobench::doNotOptimizeAway(json);
+    };
+
+    std::string reused;
+    auto via_writer_reused = [&] {
+        reused.clear();
+        rav::serialize_json(snapshot, reused);
+        ankerl::nanobench::doNotOptimizeAway(reused);
+    };
+
+    b.run("boost::json::value_from + serialize", via_dom);
+    b.run("JsonWriter", via_writer);
+    b.run("JsonWriter (reused string)", via_writer_reused);
+
+    count_allocations("boost::json::value_from + serialize", via_dom);
+    count_allocations("JsonWriter", via_writer);
+    count_allocations("JsonWriter (reused string)", via_writer_reused);
+}
@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/nmos/nmos_node.hpp"
+
+#include <catch2/catch_all.hpp>
+#include <nanobench.h>
+
+namespace {
+
+constexpr size_t k_num_senders = 200;
+
+/**
+ * A local stand-in for a registry which answers every request asynchronously and counts the posted resources.
+ */
+class StandInRegistryClient final: public rav::HttpClientBase {
+  public:
+    size_t num_resource_posts = 0;
+
+    explicit StandInRegistryClient(boost::asio::io_context& io_context) : io_context_(io_context) {}
+
+    void set_host(const boost::urls::url&) override {}
+
+    void set_host(std::string_view) override {}
+
+    void set_host(std::string_view, std::string_view) override {}
+
+    void request_async(
+        const rav::http::verb method, const std::string_view target, std::string, std::string_view, ResponseCallback callback
+    ) override {
+        auto status = rav::http::status::ok;
+        if (method == rav::http::verb::post && target.find("/resource") != std::string_view::npos) {
+            num_resource_posts++;
+            status = rav::http::status::created;
+        }
+        boost::asio::post(io_context_, [status, callback = std::move(callback)] {
+            rav::http::response<rav::http::string_body> res;
+            res.result(status);
+            callback({res});
+        });
+    }
+
+    void get_async(const std::string_view target, ResponseCallback callback) override {
+        request_async(rav::http::verb::get, target, {}, {}, std::move(callback));
+    }
+
+    void post_async(const std::string_view target, std::string body, ResponseCallback callback, const std::string_view content_type)
+        override {
+        request_async(rav::http::verb::post, target, std::move(body), content_type, std::move(callback));
+    }
+
+    void delete_async(const std::string_view target, ResponseCallback callback) override {
+        request_async(rav::http::verb::delete_, target, {}, {}, std::move(callback));
+    }
+
+    void cancel_outstanding_requests() override {}
+
+    [[nodiscard]] const std::string& get_host() const override {
+        return host_;
+    }
+
+    [[nodiscard]] const std::string& get_service() const override {
+        return host_;
+    }
+
+  private:
+    boost::asio::io_context& io_context_;
+    std::string host_ = "127.0.0.1";
+};
+
+class NullRegistryBrowser final: public rav::nmos::RegistryBrowserBase {
+  public:
+    void start(rav::nmos::OperationMode, rav::nmos::ApiVersion) override {}
+
+    void stop() override {}
+
+    [[nodiscard]] std::optional<rav::dnssd::ServiceDescription> find_most_suitable_registry() const override {
+        return std::nullopt;
+    }
+};
+
+}  // namespace
+
+TEST_CASE("nmos::Node registry sync Benchmark") {
+    boost::asio::io_context io_context;
+    rav::ptp::Instance ptp_instance(io_context);
+
+    auto registry_client = std::make_unique<StandInRegistryClient>(io_context);
+    auto* registry = registry_client.get();
+    rav::nmos::Node node(io_context, ptp_instance, std::make_unique<NullRegistryBrowser>(), std::move(registry_client));
+
+    rav::nmos::Device device;
+    device.id = boost::uuids::random_generator()();
+    REQUIRE(node.add_or_update_device(&device));
+
+    std::vector<std::unique_ptr<rav::nmos::Sender>> senders;
+    for (size_t i = 0; i < k_num_senders; ++i) {
+        auto& sender = senders.emplace_back(std::make_unique<rav::nmos::Sender>());
+        sender->id = boost::uuids::random_generator()();
+        sender->device_id = device.id;
+        REQUIRE(node.add_or_update_sender(sender.get()));
+    }
+
+    rav::nmos::Node::Configuration config;
+    config.id = boost::uuids::random_generator()();
+    config.operation_mode = rav::nmos::OperationMode::manual;
+    config.registry_address = "http://127.0.0.1:8080";
+    config.enabled = true;
+    REQUIRE(node.set_configuration(config, true));
+
+    while (node.get_status() != rav::nmos::Node::Status::registered) {
+        io_context.run_one_for(std::chrono::milliseconds(100));
+    }
+
+    size_t num_iterations = 0;
+    const auto num_posts_before = registry->num_resource_posts;
+
+    ankerl::nanobench::Bench b;
+    b.title(fmt::format("Bulk reconfiguration of {} senders", k_num_senders))
+        .warmup(1)
+        .minEpochIterations(5)
+        .batch(k_num_senders)
+        .unit("sender")
+        .performanceCounters(true);
+
+    b.run("Update all senders and sync with registry", [&] {
+        const auto expected_posts = registry->num_resource_posts + k_num_senders;
+        for (auto& sender : senders) {
+            std::ignore = node.add_or_update_sender(sender.get());
+        }
+        while (registry->num_resource_posts < expected_posts) {
+            io_context.run_one_for(std::chrono::milliseconds(100));
+        }
+        num_iterations++;
+    });
+
+    // Changes are coalesced, so every sender is posted once per reconfiguration
+    CHECK(registry->num_resource_posts - num_posts_before == num_iterations * k_num_senders);
+
+    node.stop();
+}
+
+TEST_CASE("nmos::Node find_sender Benchmark") {
+    ankerl::nanobench::Bench b;
+    b.title("Sender lookup by id").relative(false).performanceCounters(true);
+
+    for (const size_t num_senders : {10, 100, 1000, 5000}) {
+        boost::asio::io_context io_context;
+        rav::ptp::Instance ptp_instance(io_context);
+        rav::nmos::Node node(io_context, ptp_instance);
+
+        rav::nmos::Device device;
+        device.id = boost::uuids::random_generator()();
+        REQUIRE(node.add_or_update_device(&device));
+
+        std::vector<std::unique_ptr<rav::nmos::Sender>> senders;
+        for (size_t i = 0; i < num_senders; ++i) {
+            auto& sender = senders.emplace_back(std::make_unique<rav::nmos::Sender>());
+            sender->id = boost::uuids::random_generator()();
+            sender->device_id = device.id;
+            REQUIRE(node.add_or_update_sender(sender.get()));
+        }
+
+        size_t i = 0;
+        b.run(fmt::format("{} senders", num_senders), [&] {
+            auto* sender = node.find_sender(senders[i++ % senders.size()]->id);
+            ankerl::nanobench::doNotOptimizeAway(sender);
+        });
+    }
+}
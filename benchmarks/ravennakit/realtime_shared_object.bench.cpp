@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/sync/multi_version_realtime_shared_object.hpp"
+#include "ravennakit/core/sync/realtime_shared_object.hpp"
+
+#include <catch2/catch_all.hpp>
+#include <nanobench.h>
+#include <thread>
+
+namespace {
+
+using Value = std::array<uint64_t, 8>;
+
+/**
+ * Runs given function on a background thread which holds realtime access for a short moment, over and over.
+ */
+template<class Object>
+class BusyReader {
+  public:
+    explicit BusyReader(Object& object) :
+        thread_([this, &object] {
+            while (keep_going_.load(std::memory_order_relaxed)) {
+                const auto guard = object.access_realtime();
+                ankerl::nanobench::doNotOptimizeAway((*guard)[0]);
+            }
+        }) {}
+
+    ~BusyReader() {
+        keep_going_ = false;
+        thread_.join();
+    }
+
+  private:
+    std::atomic<bool> keep_going_ {true};
+    std::thread thread_;
+};
+
+/**
+ * Updates given object over and over on a background thread.
+ */
+template<class Object>
+class BusyWriter {
+  public:
+    explicit BusyWriter(Object& object) :
+        thread_([this, &object] {
+            Value value {};
+            while (keep_going_.load(std::memory_order_relaxed)) {
+                value[0]++;
+                std::ignore = object.update(value);
+                std::this_thread::yield();
+            }
+        }) {}
+
+    ~BusyWriter() {
+        keep_going_ = false;
+        thread_.join();
+    }
+
+  private:
+    std::atomic<bool> keep_going_ {true};
+    std::thread thread_;
+};
+
+}  // namespace
+
+TEST_CASE("RealtimeSharedObject Benchmark") {
+    rav::RealtimeSharedObject<Value> single;
+    rav::MultiVersionRealtimeSharedObject<Value> multi;
+
+    {
+        ankerl::nanobench::Bench b;
+        b.title("RealtimeSharedObject access").warmup(100).relative(true).minEpochIterations(100'000).performanceCounters(true);
+
+        b.run("RealtimeSharedObject::access_realtime", [&] {
+            const auto guard = single.access_realtime();
+            ankerl::nanobench::doNotOptimizeAway((*guard)[0]);
+        });
+
+        b.run("MultiVersionRealtimeSharedObject::access_realtime", [&] {
+            const auto guard = multi.access_realtime();
+            ankerl::nanobench::doNotOptimizeAway((*guard)[0]);
+        });
+    }
+
+    {
+        ankerl::nanobench::Bench b;
+        b.title("RealtimeSharedObject access while updating").warmup(100).relative(true).minEpochIterations(100'000).performanceCounters(true);
+
+        {
+            BusyWriter writer(single);
+            b.run("RealtimeSharedObject::access_realtime", [&] {
+                const auto guard = single.access_realtime();
+                ankerl::nanobench::doNotOptimizeAway(guard.get());
+            });
+        }
+
+        {
+            BusyWriter writer(multi);
+            b.run("MultiVersionRealtimeSharedObject::access_realtime", [&] {
+                const auto guard = multi.access_realtime();
+                ankerl::nanobench::doNotOptimizeAway((*guard)[0]);
+            });
+        }
+    }
+
+    {
+        ankerl::nanobench::Bench b;
+        b.title("RealtimeSharedObject update").warmup(100).relative(true).minEpochIterations(10'000).performanceCounters(true);
+
+        Value value {};
+        b.run("RealtimeSharedObject::update", [&] {
+            value[0]++;
+            ankerl::nanobench::doNotOptimizeAway(single.update(value));
+        });
+
+        b.run("MultiVersionRealtimeSharedObject::update", [&] {
+            value[0]++;
+            ankerl::nanobench::doNotOptimizeAway(multi.update(value));
+        });
+    }
+
+    {
+        // The single version update has to wait whenever the reader holds on to the value
+        ankerl::nanobench::Bench b;
+        b.title("RealtimeSharedObject update while reading").warmup(100).relative(true).minEpochIterations(1'000).performanceCounters(true);
+
+        Value value {};
+        {
+            BusyReader reader(single);
+            b.run("RealtimeSharedObject::update", [&] {
+                value[0]++;
+                ankerl::nanobench::doNotOptimizeAway(single.update(value));
+            });
+        }
+
+        {
+            BusyReader reader(multi);
+            b.run("MultiVersionRealtimeSharedObject::update", [&] {
+                value[0]++;
+                ankerl::nanobench::doNotOptimizeAway(multi.update(value));
+            });
+        }
+    }
+}
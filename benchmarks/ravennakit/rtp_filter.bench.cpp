@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/rtp/detail/rtp_filter.hpp"
+
+#include <catch2/catch_all.hpp>
+#include <nanobench.h>
+
+TEST_CASE("rtp::Filter Benchmark") {
+    const auto connection_address = boost::asio::ip::make_address("239.3.8.1");
+
+    for (const uint32_t num_entries : {1u, 2u, 4u, 8u, 16u, 32u, 64u}) {
+        ankerl::nanobench::Bench b;
+        b.title(fmt::format("rtp::Filter Benchmark ({} entries)", num_entries))
+            .warmup(100)
+            .relative(true)
+            .minEpochIterations(100'000)
+            .performanceCounters(true);
+
+        rav::rtp::Filter filter(connection_address);
+        for (uint32_t i = 0; i < num_entries; ++i) {
+            filter.add_filter(boost::asio::ip::address_v4(0xc0a80100 + i), rav::sdp::FilterMode::include);
+        }
+        const rav::rtp::CompiledFilter compiled(filter);
+
+        // Cycle through included sources and one which isn't included, which is the worst case for the linear scan
+        std::vector<boost::asio::ip::address> sources;
+        for (uint32_t i = 0; i <= num_entries; ++i) {
+            sources.emplace_back(boost::asio::ip::address_v4(0xc0a80100 + i));
+        }
+
+        size_t i = 0;
+        b.run("Filter::is_valid_source", [&] {
+            ankerl::nanobench::doNotOptimizeAway(filter.is_valid_source(connection_address, sources[i++ % sources.size()]));
+        });
+
+        i = 0;
+        b.run("CompiledFilter::is_valid_source", [&] {
+            ankerl::nanobench::doNotOptimizeAway(compiled.is_valid_source(connection_address, sources[i++ % sources.size()]));
+        });
+    }
+}
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/string.hpp"
+#include "ravennakit/sdp/sdp_diff.hpp"
+#include "ravennakit/sdp/sdp_session_description.hpp"
+
+#include <catch2/catch_all.hpp>
+#include <nanobench.h>
+
+TEST_CASE("sdp Benchmark") {
+    const std::string sdp_text =
+        "v=0\r\n"
+        "o=- 13 0 IN IP4 192.168.16.51\r\n"
+        "s=Anubis Combo LR\r\n"
+        "c=IN IP4 239.1.16.51/15\r\n"
+        "t=0 0\r\n"
+        "a=clock-domain:PTPv2 0\r\n"
+        "a=ts-refclk:ptp=IEEE1588-2008:30-D6-59-FF-FE-01-DB-72:0\r\n"
+        "a=mediaclk:direct=0\r\n"
+        "m=audio 5004 RTP/AVP 98\r\n"
+        "c=IN IP4 239.1.16.51/15\r\n"
+        "a=rtpmap:98 L16/48000/2\r\n"
+        "a=source-filter: incl IN IP4 239.1.16.51 192.168.16.51\r\n"
+        "a=clock-domain:PTPv2 0\r\n"
+        "a=sync-time:0\r\n"
+        "a=framecount:48\r\n"
+        "a=palign:0\r\n"
+        "a=ptime:1\r\n"
+        "a=ts-refclk:ptp=IEEE1588-2008:30-D6-59-FF-FE-01-DB-72:0\r\n"
+        "a=mediaclk:direct=0\r\n"
+        "a=recvonly\r\n";
+
+    // Re-announcements of the same session, unchanged and with only the origin version bumped
+    const auto unchanged_text = sdp_text;
+    const auto reannounced_text = rav::string_replace(sdp_text, "o=- 13 0", "o=- 13 1");
+
+    ankerl::nanobench::Bench b;
+    b.title("sdp Benchmark").warmup(100).relative(true).minEpochIterations(10'000).performanceCounters(true);
+
+    b.run("parse_session_description", [&] {
+        ankerl::nanobench::doNotOptimizeAway(rav::sdp::parse_session_description(sdp_text));
+    });
+
+    b.run("diff (unchanged)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(rav::sdp::diff(sdp_text, unchanged_text));
+    });
+
+    b.run("diff (metadata)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(rav::sdp::diff(sdp_text, reannounced_text));
+    });
+}
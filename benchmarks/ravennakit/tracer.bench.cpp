@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/util/tracer.hpp"
+
+#include <catch2/catch_all.hpp>
+#include <nanobench.h>
+
+TEST_CASE("Tracer Benchmark") {
+    ankerl::nanobench::Bench b;
+    b.title("Tracer Benchmark").warmup(100).relative(true).minEpochIterations(100'000).performanceCounters(true);
+
+    rav::Tracer::prepare_thread();
+
+    rav::Tracer::set_enabled(false);
+    b.run("Zone (disabled)", [] {
+        RAV_TRACE_ZONE("zone");
+    });
+
+    rav::Tracer::set_enabled(true);
+    b.run("Zone (enabled)", [] {
+        RAV_TRACE_ZONE("zone");
+    });
+
+    double value = 0.0;
+    b.run("Plot (enabled)", [&] {
+        RAV_TRACE_PLOT("plot", value);
+        value += 1.0;
+    });
+
+    rav::Tracer::set_enabled(false);
+    rav::Tracer::clear();
+}
@@ -26,6 +26,7 @@
 
 #include "ravennakit/core/math/fraction.hpp"
 #include "ravennakit/core/json.hpp"
+#include "ravennakit/core/json_writer.hpp"
 
 #include <cstdint>
 #include <cmath>
@@ -138,6 +139,13 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     jv = {packet_time.fraction.numerator, packet_time.fraction.denominator};
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const PacketTime& packet_time) {
+    writer.begin_array();
+    writer.value(packet_time.fraction.numerator);
+    writer.value(packet_time.fraction.denominator);
+    writer.end_array();
+}
+
 inline PacketTime tag_invoke(const boost::json::value_to_tag<PacketTime>&, const boost::json::value& jv) {
     const auto& array = jv.as_array();
     PacketTime pt;
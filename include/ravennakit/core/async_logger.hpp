@@ -0,0 +1,401 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "log.hpp"
+#include "format.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace rav {
+
+/**
+ * Logging backend which keeps formatting and sink I/O off the calling thread. Each thread that logs gets its own
+ * single-producer single-consumer byte ring. A log call copies the format string pointer and its arguments into that
+ * ring without locking or allocating, and a background thread formats the messages and hands them to the sink.
+ *
+ * Arithmetic, enum and pointer arguments are copied by value. Strings are copied by content (truncated to
+ * k_max_string_length). Any other argument is formatted into a fixed size buffer on the calling thread, so prefer
+ * passing plain values from realtime threads.
+ *
+ * When a ring is full the message is dropped and counted, and the background thread reports the number of dropped
+ * messages. Each call site below error level is rate limited to k_rate_limit_max_messages per k_rate_limit_window;
+ * messages over the limit are counted and reported with the next message from the same call site. Errors and critical
+ * messages are never rate limited.
+ *
+ * Critical messages are flushed right away, because they typically precede an abort.
+ *
+ * The first log call from a thread allocates and registers the ring of that thread. Call prepare_thread() up front to
+ * do this outside a realtime context.
+ */
+class AsyncLogger {
+  public:
+    /// The size of the ring of each thread, in bytes.
+    static constexpr size_t k_ring_capacity = 64 * 1024;
+
+    /// The max length of a string argument, longer strings are truncated.
+    static constexpr size_t k_max_string_length = 256;
+
+    /// The max number of messages a single call site can log per rate limit window.
+    static constexpr uint32_t k_rate_limit_max_messages = 20;
+
+    /// The length of a rate limit window.
+    static constexpr std::chrono::nanoseconds k_rate_limit_window = std::chrono::seconds(1);
+
+    /// The interval at which the background thread drains the rings.
+    static constexpr std::chrono::milliseconds k_drain_interval {10};
+
+    /**
+     * Per call site state. Must have static storage duration, as the records in the rings refer to it.
+     */
+    struct CallSite {
+        LogLevel level;
+        std::atomic<int64_t> window_start_ns {0};
+        std::atomic<uint32_t> messages_in_window {0};
+        std::atomic<uint32_t> suppressed {0};
+
+        constexpr explicit CallSite(const LogLevel l) : level(l) {}
+
+        /**
+         * Counts a message against the rate limit of this call site.
+         * @param now_ns The current time in nanoseconds.
+         * @return True if the message may be logged, false if it is over the limit.
+         */
+        bool admit(const int64_t now_ns) {
+            auto start = window_start_ns.load(std::memory_order_relaxed);
+            if (now_ns - start >= k_rate_limit_window.count()) {
+                if (window_start_ns.compare_exchange_strong(start, now_ns, std::memory_order_relaxed)) {
+                    messages_in_window.store(0, std::memory_order_relaxed);
+                }
+            }
+            return messages_in_window.fetch_add(1, std::memory_order_relaxed) < k_rate_limit_max_messages;
+        }
+    };
+
+    struct Counters {
+        /// The number of messages written into the rings.
+        uint64_t logged {};
+        /// The number of messages dropped because a ring was full.
+        uint64_t dropped {};
+        /// The number of messages suppressed by rate limiting.
+        uint64_t rate_limited {};
+    };
+
+    /// Receives formatted messages on the background thread.
+    using Sink = std::function<void(LogLevel level, std::string_view message)>;
+
+    /**
+     * Returns the state of a call site. Each lambda type passed as tag yields its own call site, which avoids a static
+     * local at the call site itself (not allowed in constexpr functions before C++23).
+     * @tparam Level The level of the call site.
+     * @tparam Tag A type unique to the call site.
+     * @return The call site.
+     */
+    template<LogLevel Level, class Tag>
+    static CallSite& call_site(Tag) {
+        static CallSite site {Level};
+        return site;
+    }
+
+    /**
+     * @return The process wide logger. The logger is never destroyed, it is shut down (drained) at exit after which log
+     * calls are formatted and written synchronously.
+     */
+    static AsyncLogger& instance();
+
+    /**
+     * @param level The level to check.
+     * @return True if messages of given level should be logged.
+     */
+    static bool should_log(const LogLevel level) {
+#if RAV_ENABLE_SPDLOG
+        return spdlog::should_log(to_spdlog_level(level));
+#else
+        return log_level.load(std::memory_order_relaxed) >= level;
+#endif
+    }
+
+    /**
+     * Logs a message. Realtime safe once the ring of the calling thread exists, as long as all arguments are values or
+     * strings.
+     * @param site The call site, see RAV_ASYNC_LOG.
+     * @param fmt The format string, must have static storage duration.
+     * @param args The arguments.
+     */
+    template<class... Args>
+    void log(CallSite& site, fmt::format_string<Args...> fmt, Args&&... args) {
+        if (site.level > LogLevel::error && !site.admit(now_ns())) {
+            site.suppressed.fetch_add(1, std::memory_order_relaxed);
+            rate_limited_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        const auto encoded = std::make_tuple(encode(args)...);
+        const auto payload_size = std::apply([](const auto&... e) { return (size_t {0} + ... + encoded_size(e)); }, encoded);
+
+        const auto reservation = prepare(sizeof(RecordHeader) + payload_size);
+        if (reservation.data == nullptr) {
+            if (reservation.ring == nullptr) {
+                write_sync(site.level, fmt::vformat(fmt, fmt::make_format_args(args...)));
+            }
+            return;
+        }
+
+        RecordHeader header;
+        header.size = static_cast<uint32_t>(reservation.size);
+        header.site = &site;
+        header.decode = &decode<std::decay_t<decltype(encode(args))>...>;
+        header.format = fmt::string_view(fmt).data();
+        header.format_size = fmt::string_view(fmt).size();
+        header.suppressed = site.suppressed.exchange(0, std::memory_order_relaxed);
+        std::memcpy(reservation.data, &header, sizeof(header));
+
+        auto* cursor = reservation.data + sizeof(RecordHeader);
+        std::apply([&cursor](const auto&... e) { (write_encoded(cursor, e), ...); }, encoded);
+
+        commit(reservation);
+
+        if (site.level == LogLevel::critical) {
+            flush();
+        }
+    }
+
+    /**
+     * Formats and writes all pending messages. Blocks until done.
+     */
+    void flush();
+
+    /**
+     * Stops the background thread after draining all pending messages. Subsequent log calls are written synchronously.
+     */
+    void shutdown();
+
+    /**
+     * Sets the sink, replacing the default one which writes to spdlog or stdout.
+     * @param sink The new sink, or nullptr to restore the default.
+     */
+    void set_sink(Sink sink);
+
+    /**
+     * Makes sure the calling thread has a ring, so that the first log call from this thread doesn't allocate.
+     */
+    void prepare_thread();
+
+    /**
+     * @return The counters, summed over all threads.
+     */
+    [[nodiscard]] Counters get_counters() const;
+
+  private:
+    class Ring;
+
+    using DecodeFunction = void (*)(const uint8_t* payload, fmt::string_view format, fmt::memory_buffer& out);
+
+    struct RecordHeader {
+        uint32_t size {};
+        uint32_t suppressed {};
+        const CallSite* site {};
+        DecodeFunction decode {};
+        const char* format {};
+        size_t format_size {};
+    };
+
+    struct Reservation {
+        Ring* ring {};
+        uint8_t* data {};
+        size_t size {};
+    };
+
+    /// A string argument which was formatted on the calling thread.
+    struct FormattedArg {
+        std::array<char, k_max_string_length> data {};
+        size_t size {};
+    };
+
+    template<class T>
+    static constexpr bool is_string_arg_v = std::is_same_v<T, const char*> || std::is_same_v<T, char*>
+        || std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>;
+
+    template<class T>
+    static constexpr bool is_value_arg_v =
+        !is_string_arg_v<T> && (std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>);
+
+    mutable std::mutex registry_mutex_;
+    std::vector<std::unique_ptr<Ring>> rings_;
+    Counters retired_counters_;
+    std::atomic<uint64_t> rate_limited_ {0};
+    std::atomic<bool> shut_down_ {false};
+
+    std::mutex drain_mutex_;
+    std::vector<Ring*> drain_list_;
+    fmt::memory_buffer drain_buffer_;
+    Sink sink_;
+
+    std::mutex thread_mutex_;
+    std::condition_variable thread_condition_;
+    bool stop_thread_ {false};
+    std::thread thread_;
+
+    AsyncLogger();
+    ~AsyncLogger();
+
+    Reservation prepare(size_t size);
+    void commit(const Reservation& reservation);
+    void write_sync(LogLevel level, std::string_view message);
+    Ring* thread_ring();
+    void run();
+    void drain_locked();
+    void emit_locked(LogLevel level, std::string_view message);
+
+    static int64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    template<class T>
+    static auto encode(const T& arg) {
+        using Type = std::decay_t<T>;
+        if constexpr (is_string_arg_v<Type>) {
+            if constexpr (std::is_pointer_v<Type>) {
+                const Type str = arg;
+                if (str == nullptr) {
+                    return std::string_view("(null)");
+                }
+                return std::string_view(str).substr(0, k_max_string_length);
+            } else {
+                return std::string_view(arg).substr(0, k_max_string_length);
+            }
+        } else if constexpr (is_value_arg_v<Type>) {
+            return static_cast<Type>(arg);
+        } else {
+            FormattedArg formatted;
+            formatted.size = fmt::format_to_n(formatted.data.data(), formatted.data.size(), "{}", arg).size;
+            formatted.size = std::min(formatted.size, formatted.data.size());
+            return formatted;
+        }
+    }
+
+    template<class E>
+    static size_t encoded_size(const E& e) {
+        if constexpr (std::is_same_v<E, std::string_view>) {
+            return sizeof(uint32_t) + e.size();
+        } else if constexpr (std::is_same_v<E, FormattedArg>) {
+            return sizeof(uint32_t) + e.size;
+        } else {
+            return sizeof(E);
+        }
+    }
+
+    template<class E>
+    static void write_encoded(uint8_t*& cursor, const E& e) {
+        if constexpr (std::is_same_v<E, std::string_view> || std::is_same_v<E, FormattedArg>) {
+            const std::string_view str = to_string_view(e);
+            const auto size = static_cast<uint32_t>(str.size());
+            std::memcpy(cursor, &size, sizeof(size));
+            std::memcpy(cursor + sizeof(size), str.data(), str.size());
+            cursor += sizeof(size) + str.size();
+        } else {
+            std::memcpy(cursor, &e, sizeof(E));
+            cursor += sizeof(E);
+        }
+    }
+
+    template<class E>
+    static auto read_encoded(const uint8_t*& cursor) {
+        if constexpr (std::is_same_v<E, std::string_view> || std::is_same_v<E, FormattedArg>) {
+            uint32_t size {};
+            std::memcpy(&size, cursor, sizeof(size));
+            const std::string_view str(reinterpret_cast<const char*>(cursor + sizeof(size)), size);
+            cursor += sizeof(size) + size;
+            return str;
+        } else {
+            E value;
+            std::memcpy(&value, cursor, sizeof(E));
+            cursor += sizeof(E);
+            return value;
+        }
+    }
+
+    static std::string_view to_string_view(const std::string_view str) {
+        return str;
+    }
+
+    static std::string_view to_string_view(const FormattedArg& formatted) {
+        return {formatted.data.data(), formatted.size};
+    }
+
+    template<class... E>
+    static void decode(const uint8_t* payload, const fmt::string_view format, fmt::memory_buffer& out) {
+        // Braced initialization guarantees left to right evaluation.
+        std::tuple<decltype(read_encoded<E>(payload))...> values {read_encoded<E>(payload)...};
+        std::apply([&](auto&... v) { fmt::vformat_to(fmt::appender(out), format, fmt::make_format_args(v...)); }, values);
+    }
+
+#if RAV_ENABLE_SPDLOG
+    static spdlog::level::level_enum to_spdlog_level(const LogLevel level) {
+        switch (level) {
+            case LogLevel::off:
+                return spdlog::level::off;
+            case LogLevel::critical:
+                return spdlog::level::critical;
+            case LogLevel::error:
+                return spdlog::level::err;
+            case LogLevel::warning:
+                return spdlog::level::warn;
+            case LogLevel::info:
+                return spdlog::level::info;
+            case LogLevel::debug:
+                return spdlog::level::debug;
+            case LogLevel::trace:
+            default:
+                return spdlog::level::trace;
+        }
+    }
+#endif
+};
+
+}  // namespace rav
+
+/**
+ * Logs a message through the AsyncLogger, with its own rate limit state for this call site.
+ * @param level The LogLevel of the message.
+ */
+#define RAV_ASYNC_LOG(level, ...)                                                                        \
+    if (::rav::AsyncLogger::should_log(level)) {                                                         \
+        ::rav::AsyncLogger::instance().log(::rav::AsyncLogger::call_site<level>([] {}), __VA_ARGS__);    \
+    }
@@ -286,13 +286,13 @@ class AudioData {
             return;
         } else if constexpr (std::is_same_v<SrcType, DstType> && std::is_same_v<SrcInterleaving, DstInterleaving>) {
             RAV_ASSERT_DEBUG(src_size == dst_size, "size should be smaller or equal to the size of the type");
-            std::copy_n(src, src_size, dst);
             if constexpr (SrcByteOrder::is_little_endian == DstByteOrder::is_little_endian) {
+                std::copy_n(src, src_size, dst);
                 return;  // No need for swapping (at this point we already know interleaving is the same)
             }
-            for (size_t i = 0; i < dst_size; ++i) {
-                dst[i] = rav::swap_bytes(dst[i]);
-            }
+            rav::swap_bytes_copy(
+                reinterpret_cast<const uint8_t*>(src), reinterpret_cast<uint8_t*>(dst), src_size * sizeof(SrcType), sizeof(SrcType)
+            );
             return;
         }
 
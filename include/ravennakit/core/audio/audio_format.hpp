@@ -28,6 +28,7 @@
 #include "ravennakit/core/byte_order.hpp"
 #include "ravennakit/core/format.hpp"
 #include "ravennakit/core/json.hpp"
+#include "ravennakit/core/json_writer.hpp"
 
 #include <tuple>
 #include <string>
@@ -138,6 +139,16 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     };
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const AudioFormat& audio_format) {
+    writer.begin_object();
+    writer.member("byte_order", AudioFormat::to_string(audio_format.byte_order));
+    writer.member("channel_ordering", AudioFormat::to_string(audio_format.ordering));
+    writer.member("encoding", to_string(audio_format.encoding));
+    writer.member("num_channels", audio_format.num_channels);
+    writer.member("sample_rate", audio_format.sample_rate);
+    writer.end_object();
+}
+
 inline AudioFormat tag_invoke(const boost::json::value_to_tag<AudioFormat>&, const boost::json::value& jv) {
     AudioFormat format;
     format.byte_order = AudioFormat::byte_order_from_string(jv.at("byte_order").as_string().c_str()).value();
@@ -84,23 +84,24 @@ inline void swap_bytes(uint8_t* data, const size_t size) {
 }
 
 /**
- * Swaps given amount of bytes in the given data, in place, with the given stride.
+ * Swaps the bytes of every sample of stride bytes in the given data, in place. Strides of 2, 3 and 4 bytes use SIMD
+ * shuffles when available (SSSE3 on x86, NEON on ARM). Trailing bytes which don't form a complete sample are left
+ * untouched.
  * @param data The data to swap.
  * @param size The size of the data (in bytes).
  * @param stride The stride of the data (in bytes).
  */
-inline void swap_bytes(uint8_t* data, const size_t size, const size_t stride) {
-    // Check for null data pointer or zero size
-    if (data == nullptr || size == 0 || stride <= 1) {
-        return;
-    }
+void swap_bytes(uint8_t* data, size_t size, size_t stride);
 
-    for (size_t i = 0; i < size; i += stride) {
-        for (size_t j = 0; j < stride / 2; ++j) {
-            std::swap(data[i + j], data[i + stride - j - 1]);
-        }
-    }
-}
+/**
+ * Copies the given data while swapping the bytes of every sample of stride bytes, which is faster than a copy followed
+ * by an in-place swap. Trailing bytes which don't form a complete sample are copied as is.
+ * @param src The data to read. Must either be equal to dst or not overlap with it.
+ * @param dst The data to write, of at least size bytes.
+ * @param size The size of the data (in bytes).
+ * @param stride The stride of the data (in bytes).
+ */
+void swap_bytes_copy(const uint8_t* src, uint8_t* dst, size_t size, size_t stride);
 
 /**
  * @tparam Type The type of the value to swap.
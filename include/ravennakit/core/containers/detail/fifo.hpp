@@ -25,8 +25,9 @@
 #pragma once
 
 #include <atomic>
-#include <functional>
-#include <mutex>
+#include <cstddef>
+#include <memory>
+#include <optional>
 
 namespace rav {
 
@@ -52,10 +53,18 @@ struct Fifo {
         void update(size_t timestamp, size_t capacity, size_t number_of_elements);
     };
 
+    /// The assumed size of a cache line, used to keep data written by different threads apart.
+    static constexpr size_t k_cache_line_size = 64;
+
     /**
      * A fifo without any synchronization. Can be used in single-threaded environments.
      */
     struct Single {
+        /// Whether peeking and consuming as separate steps is supported.
+        static constexpr bool k_single_consumer = true;
+        /// Whether reserving and publishing as separate steps is supported.
+        static constexpr bool k_single_producer = true;
+
         /**
          * A lock returned by a prepared operation.
          */
@@ -64,25 +73,26 @@ struct Fifo {
 
             Lock() = default;
 
-            explicit Lock(std::function<void()>&& commit) : commit_(std::move(commit)) {}
+            Lock(size_t* timestamp, const size_t new_timestamp) : timestamp_(timestamp), new_timestamp_(new_timestamp) {}
 
             /**
              * Returns true if this lock is valid, or false if not.
              */
             explicit operator bool() const {
-                return commit_ != nullptr;
+                return timestamp_ != nullptr;
             }
 
             /**
              * Commits the operation if the lock is valid.
              */
             void commit() const {
-                if (commit_)
-                    commit_();
+                if (timestamp_)
+                    *timestamp_ = new_timestamp_;
             }
 
           private:
-            std::function<void()> commit_;
+            size_t* timestamp_ {};
+            size_t new_timestamp_ {};
         };
 
         /**
@@ -122,6 +132,31 @@ struct Fifo {
          */
         [[nodiscard]] size_t size() const;
 
+        /**
+         * Thread safe: no
+         * Realtime safe: yes
+         * @return The number of elements which can be read.
+         */
+        [[nodiscard]] size_t num_readable() const;
+
+        /**
+         * Advances the producer timestamp without computing a position, for elements written in place.
+         * Thread safe: no
+         * Realtime safe: yes
+         * @param number_of_elements The number of elements to publish.
+         * @return True if the elements were published, false if there is not enough free space.
+         */
+        bool commit_write(size_t number_of_elements);
+
+        /**
+         * Advances the consumer timestamp without computing a position, for elements read in place.
+         * Thread safe: no
+         * Realtime safe: yes
+         * @param number_of_elements The number of elements to release.
+         * @return True if the elements were released, false if there is not enough data.
+         */
+        bool commit_read(size_t number_of_elements);
+
         /**
          * Resizes the buffer. Implies a reset.
          * Thread safe: no
@@ -145,32 +180,41 @@ struct Fifo {
 
     /**
      * A fifo which a single producer and single consumer thread can simultaneously read and write to.
+     * The producer and consumer timestamps live on separate cache lines, and each side keeps a cached copy of the other
+     * side's timestamp so that the shared atomic is only touched when the cached value says the buffer is full or empty.
      */
     struct Spsc {
+        /// Whether peeking and consuming as separate steps is supported.
+        static constexpr bool k_single_consumer = true;
+        /// Whether reserving and publishing as separate steps is supported.
+        static constexpr bool k_single_producer = true;
+
         struct Lock {
             Fifo::Position position {};
 
             Lock() = default;
 
-            explicit Lock(std::function<void()>&& commit) : commit_(std::move(commit)) {}
+            Lock(std::atomic<size_t>* timestamp, const size_t new_timestamp) :
+                timestamp_(timestamp), new_timestamp_(new_timestamp) {}
 
             /**
              * Returns true if this lock is valid, or false if not.
              */
             explicit operator bool() const {
-                return commit_ != nullptr;
+                return timestamp_ != nullptr;
             }
 
             /**
              * Commits the operation if the lock is valid.
              */
             void commit() const {
-                if (commit_)
-                    commit_();
+                if (timestamp_)
+                    timestamp_->store(new_timestamp_, std::memory_order_release);
             }
 
           private:
-            std::function<void()> commit_;
+            std::atomic<size_t>* timestamp_ {};
+            size_t new_timestamp_ {};
         };
 
         /**
@@ -186,7 +230,19 @@ struct Fifo {
          * @param number_of_elements The number of elements to write.
          * @return A valid lock if space is available; otherwise, an invalid lock.
          */
-        Lock prepare_for_write(size_t number_of_elements);
+        Lock prepare_for_write(const size_t number_of_elements) {
+            const auto write_ts = write_ts_.load(std::memory_order_relaxed);
+            if (write_ts - cached_read_ts_ + number_of_elements > capacity_) {
+                cached_read_ts_ = read_ts_.load(std::memory_order_acquire);
+                if (write_ts - cached_read_ts_ + number_of_elements > capacity_) {
+                    return {};  // Not enough free space in buffer.
+                }
+            }
+
+            Lock write_lock(&write_ts_, write_ts + number_of_elements);
+            write_lock.position.update(write_ts, capacity_, number_of_elements);
+            return write_lock;
+        }
 
         /**
          * Prepares for reading.
@@ -201,105 +257,81 @@ struct Fifo {
          * @param number_of_elements The number of elements to read.
          * @return A valid lock if sufficient data is available; otherwise, an invalid lock.
          */
-        Lock prepare_for_read(size_t number_of_elements);
+        Lock prepare_for_read(const size_t number_of_elements) {
+            const auto read_ts = read_ts_.load(std::memory_order_relaxed);
+            if (cached_write_ts_ - read_ts < number_of_elements) {
+                cached_write_ts_ = write_ts_.load(std::memory_order_acquire);
+                if (cached_write_ts_ - read_ts < number_of_elements) {
+                    return {};  // Not enough data available.
+                }
+            }
+
+            Lock read_lock(&read_ts_, read_ts + number_of_elements);
+            read_lock.position.update(read_ts, capacity_, number_of_elements);
+            return read_lock;
+        }
 
         /**
          * Thread safe: yes
          * Realtime safe: yes
          * @return The number of elements in the buffer.
          */
-        [[nodiscard]] size_t size() const;
+        [[nodiscard]] size_t size() const {
+            const auto read_ts = read_ts_.load(std::memory_order_acquire);
+            return write_ts_.load(std::memory_order_acquire) - read_ts;
+        }
 
         /**
-         * Resizes the buffer. Implies a reset.
-         * Thread safe: no
-         * Realtime safe: no
-         * @param capacity The new capacity of the buffer.
+         * Refreshes the consumer's view of the producer timestamp, so that a subsequent prepare_for_read() of up to the
+         * returned number of elements doesn't touch the producer's cache line again.
+         * Thread safe: yes when used from a single consumer thread
+         * Realtime safe: yes
+         * @return The number of elements which can be read.
          */
-        void resize(size_t capacity);
+        [[nodiscard]] size_t num_readable() {
+            cached_write_ts_ = write_ts_.load(std::memory_order_acquire);
+            return cached_write_ts_ - read_ts_.load(std::memory_order_relaxed);
+        }
 
         /**
-         * Resets the buffer, discarding existing contents.
+         * Publishes elements written in place, like committing a lock of prepare_for_write() without computing the
+         * position. Only touches the consumer's cache line if the cached view says there is not enough free space.
+         * Thread safe: yes when used from a single producer thread
+         * Realtime safe: yes
+         * @param number_of_elements The number of elements to publish.
+         * @return True if the elements were published, false if there is not enough free space.
          */
-        void reset();
-
-      private:
-        std::atomic<size_t> read_ts_ = 0;   // Consumer timestamp
-        std::atomic<size_t> write_ts_ = 0;  // Producer timestamp
-        size_t capacity_ = 0;
-    };
-
-    /**
-     * A fifo where multiple producer threads can write to the buffer, but only a single consumer thread can read from
-     * it.
-     */
-    struct Mpsc {
-        struct Lock {
-            Fifo::Position position {};
-
-            Lock() = default;
-
-            explicit Lock(std::function<void()>&& commit) : commit_(commit) {}
-
-            explicit Lock(std::function<void()>&& commit, std::unique_lock<std::mutex>&& unique_lock) :
-                commit_(commit), lock_(std::move(unique_lock)) {}
-
-            /**
-             * Returns true if this lock is valid, or false if not.
-             */
-            explicit operator bool() const {
-                return commit_ != nullptr;
+        bool commit_write(const size_t number_of_elements) {
+            const auto write_ts = write_ts_.load(std::memory_order_relaxed);
+            if (write_ts - cached_read_ts_ + number_of_elements > capacity_) {
+                cached_read_ts_ = read_ts_.load(std::memory_order_acquire);
+                if (write_ts - cached_read_ts_ + number_of_elements > capacity_) {
+                    return false;
+                }
             }
-
-            /**
-             * Commits the operation if the lock is valid.
-             */
-            void commit() const {
-                if (commit_)
-                    commit_();
-            }
-
-          private:
-            std::function<void()> commit_;
-            std::unique_lock<std::mutex> lock_;
-        };
-
-        /**
-         * Prepares for writing.
-         *
-         * Attempts to acquire a lock for writing `number_of_elements` to the FIFO buffer. If sufficient space is
-         * available, a valid lock is returned, reserving the required buffer space for the duration of the lock. If
-         * space is insufficient, an invalid lock is returned.
-         *
-         * Thread safe: yes
-         * Realtime safe: no
-         *
-         * @param number_of_elements The number of elements to write.
-         * @return A valid lock if space is available; otherwise, an invalid lock.
-         */
-        Lock prepare_for_write(size_t number_of_elements);
+            write_ts_.store(write_ts + number_of_elements, std::memory_order_release);
+            return true;
+        }
 
         /**
-         * Prepares for reading.
-         *
-         * Attempts to acquire a lock for reading `number_of_elements` from the FIFO buffer. If sufficient data is
-         * available, a valid lock is returned, reserving the required buffer space for the duration of the lock. If
-         * there is not enough data available, an invalid lock is returned.
-         *
+         * Releases elements read in place, like committing a lock of prepare_for_read() without computing the position.
+         * Only touches the producer's cache line if the cached view says there is not enough data.
          * Thread safe: yes when used from a single consumer thread
          * Realtime safe: yes
-         *
-         * @param number_of_elements The number of elements to read.
-         * @return A valid lock if sufficient data is available; otherwise, an invalid lock.
+         * @param number_of_elements The number of elements to release.
+         * @return True if the elements were released, false if there is not enough data.
          */
-        Lock prepare_for_read(size_t number_of_elements);
-
-        /**
-         * Thread safe: yes
-         * Realtime safe: yes
-         * @return The number of elements in the buffer.
-         */
-        [[nodiscard]] size_t size() const;
+        bool commit_read(const size_t number_of_elements) {
+            const auto read_ts = read_ts_.load(std::memory_order_relaxed);
+            if (cached_write_ts_ - read_ts < number_of_elements) {
+                cached_write_ts_ = write_ts_.load(std::memory_order_acquire);
+                if (cached_write_ts_ - read_ts < number_of_elements) {
+                    return false;
+                }
+            }
+            read_ts_.store(read_ts + number_of_elements, std::memory_order_release);
+            return true;
+        }
 
         /**
          * Resizes the buffer. Implies a reset.
@@ -307,91 +339,170 @@ struct Fifo {
          * Realtime safe: no
          * @param capacity The new capacity of the buffer.
          */
-        void resize(size_t capacity);
+        void resize(const size_t capacity) {
+            reset();
+            capacity_ = capacity;
+        }
 
         /**
          * Resets the buffer, discarding existing contents.
          */
-        void reset();
+        void reset() {
+            write_ts_ = 0;
+            cached_read_ts_ = 0;
+            read_ts_ = 0;
+            cached_write_ts_ = 0;
+        }
 
       private:
-        std::atomic<size_t> read_ts_ = 0;   // Consumer timestamp
-        std::atomic<size_t> write_ts_ = 0;  // Producer timestamp
-        size_t capacity_ = 0;
-        std::mutex mutex_;
+        // Producer side
+        alignas(k_cache_line_size) std::atomic<size_t> write_ts_ = 0;  // Producer timestamp
+        size_t cached_read_ts_ = 0;                                   // The producer's view of the consumer timestamp
+
+        // Consumer side
+        alignas(k_cache_line_size) std::atomic<size_t> read_ts_ = 0;  // Consumer timestamp
+        size_t cached_write_ts_ = 0;                                 // The consumer's view of the producer timestamp
+
+        // Read by both sides, written only on resize
+        alignas(k_cache_line_size) size_t capacity_ = 0;
     };
 
     /**
-     * A fifo where a single producer thread and multiple consumer threads can simultaneously read and write to the
-     * buffer.
+     * Lock-free bounded fifo based on sequence-numbered cells (after Dmitry Vyukov's bounded MPMC queue). Every element
+     * has a sequence number which tells whether it is free to be written or holds data ready to be read for a given
+     * timestamp. Sides with multiple threads claim their elements with a compare-and-swap on their timestamp during
+     * prepare, sides with a single thread simply advance their timestamp on commit. No thread ever waits for another
+     * thread: when the cells aren't ready an invalid lock is returned and the caller can try again later.
+     *
+     * Note that the elements of a valid lock stay reserved until the lock is committed, so a valid lock must always be
+     * committed to not stall the other threads.
+     *
+     * @tparam MultiProducer Whether multiple threads may write to the fifo.
+     * @tparam MultiConsumer Whether multiple threads may read from the fifo.
      */
-    struct Spmc {
+    template<bool MultiProducer, bool MultiConsumer>
+    struct Sequenced {
+        /// Whether peeking and consuming as separate steps is supported.
+        static constexpr bool k_single_consumer = !MultiConsumer;
+        /// Whether reserving and publishing as separate steps is supported.
+        static constexpr bool k_single_producer = !MultiProducer;
+
         struct Lock {
             Fifo::Position position {};
 
             Lock() = default;
 
-            explicit Lock(std::function<void()>&& commit) : commit_(commit) {}
-
-            explicit Lock(std::function<void()>&& commit, std::unique_lock<std::mutex>&& unique_lock) :
-                commit_(commit), lock_(std::move(unique_lock)) {}
+            Lock(
+                std::atomic<size_t>* sequences, const size_t capacity, const size_t timestamp, const size_t number_of_elements,
+                const size_t sequence_offset, std::atomic<size_t>* timestamp_to_advance
+            ) :
+                valid_(true),
+                sequences_(sequences),
+                capacity_(capacity),
+                timestamp_(timestamp),
+                number_of_elements_(number_of_elements),
+                sequence_offset_(sequence_offset),
+                timestamp_to_advance_(timestamp_to_advance) {}
 
             /**
              * Returns true if this lock is valid, or false if not.
              */
             explicit operator bool() const {
-                return commit_ != nullptr;
+                return valid_;
             }
 
             /**
-             * Commits the operation if the lock is valid.
+             * Commits the operation if the lock is valid, handing the elements over to the other side.
              */
             void commit() const {
-                if (commit_)
-                    commit_();
+                if (!valid_) {
+                    return;
+                }
+                auto index = position.index1;
+                for (size_t i = 0; i < number_of_elements_; ++i) {
+                    sequences_[index].store(timestamp_ + i + sequence_offset_, std::memory_order_release);
+                    if (++index == capacity_) {
+                        index = 0;
+                    }
+                }
+                if (timestamp_to_advance_) {
+                    timestamp_to_advance_->store(timestamp_ + number_of_elements_, std::memory_order_release);
+                }
             }
 
           private:
-            std::function<void()> commit_;
-            std::unique_lock<std::mutex> lock_;
+            bool valid_ {};
+            std::atomic<size_t>* sequences_ {};
+            size_t capacity_ {};
+            size_t timestamp_ {};
+            size_t number_of_elements_ {};
+            size_t sequence_offset_ {};                       // Added to the timestamp of each element on commit
+            std::atomic<size_t>* timestamp_to_advance_ {};  // Only set for the single-threaded side
         };
 
         /**
          * Prepares for writing.
          *
          * Attempts to acquire a lock for writing `number_of_elements` to the FIFO buffer. If sufficient space is
-         * available, a valid lock is returned, reserving the required buffer space for the duration of the lock. If
+         * available, a valid lock is returned, reserving the required buffer space until the lock is committed. If
          * space is insufficient, an invalid lock is returned.
          *
-         * Thread safe: yes when used from a single producer thread
+         * Thread safe: yes (from a single producer thread if MultiProducer is false)
          * Realtime safe: yes
          *
          * @param number_of_elements The number of elements to write.
          * @return A valid lock if space is available; otherwise, an invalid lock.
          */
-        Lock prepare_for_write(size_t number_of_elements);
+        Lock prepare_for_write(const size_t number_of_elements) {
+            // A cell is free for timestamp ts when its sequence equals ts, and holds data once its sequence is ts + 1.
+            const auto timestamp = claim<MultiProducer>(write_ts_, number_of_elements, 0);
+            if (!timestamp) {
+                return {};
+            }
+
+            Lock write_lock(
+                sequences_.get(), capacity_, *timestamp, number_of_elements, 1, MultiProducer ? nullptr : &write_ts_
+            );
+            write_lock.position.update(*timestamp, capacity_, number_of_elements);
+            return write_lock;
+        }
 
         /**
          * Prepares for reading.
          *
          * Attempts to acquire a lock for reading `number_of_elements` from the FIFO buffer. If sufficient data is
-         * available, a valid lock is returned, reserving the required buffer space for the duration of the lock. If
+         * available, a valid lock is returned, reserving the required buffer space until the lock is committed. If
          * there is not enough data available, an invalid lock is returned.
          *
-         * Thread safe: yes
-         * Realtime safe: no
+         * Thread safe: yes (from a single consumer thread if MultiConsumer is false)
+         * Realtime safe: yes
          *
          * @param number_of_elements The number of elements to read.
          * @return A valid lock if sufficient data is available; otherwise, an invalid lock.
          */
-        Lock prepare_for_read(size_t number_of_elements);
+        Lock prepare_for_read(const size_t number_of_elements) {
+            // Once read, the cell becomes free for the timestamp one lap further.
+            const auto timestamp = claim<MultiConsumer>(read_ts_, number_of_elements, 1);
+            if (!timestamp) {
+                return {};
+            }
+
+            Lock read_lock(
+                sequences_.get(), capacity_, *timestamp, number_of_elements, capacity_, MultiConsumer ? nullptr : &read_ts_
+            );
+            read_lock.position.update(*timestamp, capacity_, number_of_elements);
+            return read_lock;
+        }
 
         /**
          * Thread safe: yes
          * Realtime safe: yes
-         * @return The number of elements in the buffer.
+         * @return The number of elements in the buffer, including elements which are still being written or read.
          */
-        [[nodiscard]] size_t size() const;
+        [[nodiscard]] size_t size() const {
+            const auto read_ts = read_ts_.load(std::memory_order_acquire);
+            return write_ts_.load(std::memory_order_acquire) - read_ts;
+        }
 
         /**
          * Resizes the buffer. Implies a reset.
@@ -399,108 +510,98 @@ struct Fifo {
          * Realtime safe: no
          * @param capacity The new capacity of the buffer.
          */
-        void resize(size_t capacity);
+        void resize(const size_t capacity) {
+            sequences_ = capacity > 0 ? std::make_unique<std::atomic<size_t>[]>(capacity) : nullptr;
+            capacity_ = capacity;
+            reset();
+        }
 
         /**
          * Resets the buffer, discarding existing contents.
+         * Thread safe: no
+         * Realtime safe: yes
          */
-        void reset();
+        void reset() {
+            for (size_t i = 0; i < capacity_; ++i) {
+                sequences_[i].store(i, std::memory_order_relaxed);
+            }
+            write_ts_.store(0, std::memory_order_release);
+            read_ts_.store(0, std::memory_order_release);
+        }
 
       private:
-        std::atomic<size_t> read_ts_ = 0;   // Consumer timestamp
-        std::atomic<size_t> write_ts_ = 0;  // Producer timestamp
+        alignas(k_cache_line_size) std::atomic<size_t> write_ts_ = 0;  // Producer timestamp
+        alignas(k_cache_line_size) std::atomic<size_t> read_ts_ = 0;   // Consumer timestamp
+        alignas(k_cache_line_size) std::unique_ptr<std::atomic<size_t>[]> sequences_;
         size_t capacity_ = 0;
-        std::mutex mutex_;
-    };
-
-    /**
-     * A fifo where multiple producer and multiple consumer threads can simultaneously read and write to the buffer.
-     */
-    struct Mpmc {
-        struct Lock {
-            Fifo::Position position {};
-
-            Lock() = default;
-
-            explicit Lock(std::function<void()>&& commit, std::unique_lock<std::mutex>&& unique_lock) :
-                commit_(commit), lock_(std::move(unique_lock)) {}
-
-            /**
-             * Returns true if this lock is valid, or false if not.
-             */
-            explicit operator bool() const {
-                return commit_ != nullptr;
-            }
-
-            /**
-             * Commits the operation if the lock is valid.
-             */
-            void commit() const {
-                if (commit_)
-                    commit_();
-            }
-
-          private:
-            std::function<void()> commit_;
-            std::unique_lock<std::mutex> lock_;
-        };
 
         /**
-         * Prepares for writing.
-         *
-         * Attempts to acquire a lock for writing `number_of_elements` to the FIFO buffer. If sufficient space is
-         * available, a valid lock is returned, reserving the required buffer space for the duration of the lock. If
-         * space is insufficient, an invalid lock is returned.
-         *
-         * Thread safe: yes
-         * Realtime safe: no
-         *
-         * @param number_of_elements The number of elements to write.
-         * @return A valid lock if space is available; otherwise, an invalid lock.
-         */
-        Lock prepare_for_write(size_t number_of_elements);
-
-        /**
-         * Prepares for reading.
-         *
-         * Attempts to acquire a lock for reading `number_of_elements` from the FIFO buffer. If sufficient data is
-         * available, a valid lock is returned, reserving the required buffer space for the duration of the lock. If
-         * there is not enough data available, an invalid lock is returned.
-         *
-         * Thread safe: yes
-         * Realtime safe: no
-         *
-         * @param number_of_elements The number of elements to read.
-         * @return A valid lock if sufficient data is available; otherwise, an invalid lock.
+         * Finds the timestamp from which `number_of_elements` cells are in the expected state, and claims them by
+         * advancing the timestamp if multiple threads operate on this side.
+         * @tparam Claim True to claim the cells with a compare-and-swap.
+         * @param timestamp The timestamp of this side.
+         * @param number_of_elements The number of cells needed.
+         * @param sequence_offset The difference between the expected sequence and the timestamp of a cell.
+         * @return The first timestamp, or nullopt if not enough cells are ready.
          */
-        Lock prepare_for_read(size_t number_of_elements);
+        template<bool Claim>
+        std::optional<size_t> claim(std::atomic<size_t>& timestamp, const size_t number_of_elements, const size_t sequence_offset) {
+            if (number_of_elements > capacity_) {
+                return std::nullopt;
+            }
 
-        /**
-         * Thread safe: yes
-         * Realtime safe: yes
-         * @return The number of elements in the buffer.
-         */
-        [[nodiscard]] size_t size();
+            auto ts = timestamp.load(std::memory_order_relaxed);
+            while (true) {
+                auto index = number_of_elements > 0 ? ts % capacity_ : 0;
+                auto difference = std::ptrdiff_t {0};
+                for (size_t i = 0; i < number_of_elements; ++i) {
+                    const auto sequence = sequences_[index].load(std::memory_order_acquire);
+                    difference = static_cast<std::ptrdiff_t>(sequence - (ts + i + sequence_offset));
+                    if (difference != 0) {
+                        break;
+                    }
+                    if (++index == capacity_) {
+                        index = 0;
+                    }
+                }
+
+                if (difference < 0) {
+                    return std::nullopt;  // The other side hasn't released enough cells yet.
+                }
+
+                if (difference > 0) {
+                    ts = timestamp.load(std::memory_order_relaxed);  // Another thread got there first.
+                    continue;
+                }
+
+                if constexpr (Claim) {
+                    if (!timestamp.compare_exchange_weak(ts, ts + number_of_elements, std::memory_order_relaxed)) {
+                        continue;
+                    }
+                }
+
+                return ts;
+            }
+        }
+    };
 
-        /**
-         * Resizes the buffer. Implies a reset.
-         * Thread safe: no
-         * Realtime safe: no
-         * @param capacity The new capacity of the buffer.
-         */
-        void resize(size_t capacity);
+    /**
+     * A lock-free fifo where multiple producer threads can write to the buffer, but only a single consumer thread can
+     * read from the buffer.
+     */
+    struct Mpsc: Sequenced<true, false> {};
 
-        /**
-         * Resets the buffer, discarding existing contents.
-         */
-        void reset();
+    /**
+     * A lock-free fifo where a single producer thread and multiple consumer threads can simultaneously read and write to
+     * the buffer.
+     */
+    struct Spmc: Sequenced<false, true> {};
 
-      private:
-        size_t read_ts_ = 0;   // Consumer timestamp
-        size_t write_ts_ = 0;  // Producer timestamp
-        size_t capacity_ = 0;
-        std::mutex mutex_;
-    };
+    /**
+     * A lock-free fifo where multiple producer and multiple consumer threads can simultaneously read and write to the
+     * buffer.
+     */
+    struct Mpmc: Sequenced<true, true> {};
 };
 
 }  // namespace rav
@@ -24,20 +24,55 @@
 
 #pragma once
 
+#include "buffer_view.hpp"
 #include "detail/fifo.hpp"
 
 #include <vector>
 #include <cstring>
+#include <memory>
 #include <optional>
+#include <tuple>
 
 namespace rav {
 
 /**
  * A classic FIFO buffer implementation with different strategies F.
+ * @tparam Allocator The allocator of the storage (i.e. ArenaAllocator to place the storage in an arena).
  */
-template<class T, class F>
+template<class T, class F, class Allocator = std::allocator<T>>
 class FifoBuffer {
   public:
+    /**
+     * A range of elements in the buffer, which consists of up to two contiguous regions because the range can wrap
+     * around the end of the storage.
+     */
+    struct Range {
+        BufferView<T> first;
+        BufferView<T> second;
+
+        /**
+         * @return The total number of elements in the range.
+         */
+        [[nodiscard]] size_t size() const {
+            return first.size() + second.size();
+        }
+
+        /**
+         * @return True if the range holds no elements.
+         */
+        [[nodiscard]] bool empty() const {
+            return first.empty() && second.empty();
+        }
+
+        /**
+         * @param index The index of the element, without bounds checking.
+         * @return The element at the given index.
+         */
+        T& operator[](const size_t index) const {
+            return index < first.size() ? first[index] : second[index - first.size()];
+        }
+    };
+
     FifoBuffer() = default;
 
     /**
@@ -59,9 +94,46 @@ class FifoBuffer {
      * @param value The value to push.
      * @return True if the value was pushed, false if the buffer is full.
      */
-    [[nodiscard]] bool push(T value) {
+    [[nodiscard]] bool push(const T& value) {
+        if (auto lock = fifo_.prepare_for_write(1)) {
+            buffer_[lock.position.index1] = value;
+            lock.commit();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Pushes a value to the buffer.
+     * @param value The value to push.
+     * @return True if the value was pushed, false if the buffer is full.
+     */
+    [[nodiscard]] bool push(T&& value) {
+        if (auto lock = fifo_.prepare_for_write(1)) {
+            buffer_[lock.position.index1] = std::move(value);
+            lock.commit();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Constructs a value in place in the next free slot of the buffer, avoiding an intermediate copy. Types which can
+     * throw during construction are constructed as a temporary and moved into the slot instead.
+     * @param args The arguments to construct the value with.
+     * @return True if the value was constructed, false if the buffer is full.
+     */
+    template<class... Args>
+    [[nodiscard]] bool emplace(Args&&... args) {
         if (auto lock = fifo_.prepare_for_write(1)) {
-            lock.position.size1 > 0 ? buffer_[lock.position.index1] = std::move(value) : buffer_[0] = std::move(value);
+            if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+                auto* slot = std::addressof(buffer_[lock.position.index1]);
+                slot->~T();
+                new (slot) T(std::forward<Args>(args)...);
+            } else {
+                // Constructing could throw, which would leave a destroyed value behind.
+                buffer_[lock.position.index1] = T(std::forward<Args>(args)...);
+            }
             lock.commit();
             return true;
         }
@@ -74,14 +146,94 @@ class FifoBuffer {
      */
     [[nodiscard]] std::optional<T> pop() {
         if (auto lock = fifo_.prepare_for_read(1)) {
-            T value;
-            lock.position.size1 > 0 ? value = std::move(buffer_[lock.position.index1]) : value = std::move(buffer_[0]);
+            std::optional<T> value(std::move(buffer_[lock.position.index1]));
             lock.commit();
             return value;
         }
         return std::nullopt;
     }
 
+    /**
+     * Gives access to the oldest value in the buffer without removing it, so that large values don't have to be copied
+     * out. The value stays valid until consume() is called. Only available for strategies with a single consumer, and
+     * only to be called from the consumer thread.
+     * @return A pointer to the oldest value, or nullptr if the buffer is empty.
+     */
+    [[nodiscard]] T* try_peek() {
+        static_assert(F::k_single_consumer, "Peeking requires a single consumer");
+        if (auto lock = fifo_.prepare_for_read(1)) {
+            return std::addressof(buffer_[lock.position.index1]);
+        }
+        return nullptr;
+    }
+
+    /**
+     * Removes the oldest value from the buffer, typically after inspecting it through try_peek(). Does nothing if the
+     * buffer is empty. Only to be called from the consumer thread.
+     */
+    void consume() {
+        static_assert(F::k_single_consumer, "Consuming a peeked value requires a single consumer");
+        if (auto lock = fifo_.prepare_for_read(1)) {
+            lock.commit();
+        }
+    }
+
+    /**
+     * Gives access to all elements available for reading, so that a whole batch can be processed with a single
+     * synchronization of the consumer and producer. The elements stay valid until commit_read() is called. Only
+     * available for the Single and Spsc strategies, and only to be called from the consumer thread.
+     * @return The elements available for reading, oldest first.
+     */
+    [[nodiscard]] Range read_available() {
+        static_assert(F::k_single_consumer, "Reading in place requires a single consumer");
+        const auto number_of_elements = fifo_.num_readable();
+        if (number_of_elements == 0) {
+            return {};
+        }
+        if (auto lock = fifo_.prepare_for_read(number_of_elements)) {
+            return make_range(lock.position);
+        }
+        return {};
+    }
+
+    /**
+     * Removes the oldest elements from the buffer, typically after processing them through read_available(). Does
+     * nothing if fewer elements are available. Only to be called from the consumer thread.
+     * @param number_of_elements The number of elements to remove.
+     */
+    void commit_read(const size_t number_of_elements) {
+        static_assert(F::k_single_consumer, "Reading in place requires a single consumer");
+        std::ignore = fifo_.commit_read(number_of_elements);
+    }
+
+    /**
+     * Reserves free slots for writing in place, which become visible to the consumer once commit_write() is called.
+     * The slots contain stale values which are to be overwritten. Only available for the Single and Spsc strategies,
+     * and only to be called from the producer thread.
+     * @param number_of_elements The number of slots to reserve.
+     * @return The reserved slots, or an empty range if there is not enough free space.
+     */
+    [[nodiscard]] Range write_reserve(const size_t number_of_elements) {
+        static_assert(F::k_single_producer, "Writing in place requires a single producer");
+        if (number_of_elements == 0) {
+            return {};
+        }
+        if (auto lock = fifo_.prepare_for_write(number_of_elements)) {
+            return make_range(lock.position);
+        }
+        return {};
+    }
+
+    /**
+     * Publishes the first elements previously reserved by write_reserve() to the consumer. Does nothing if there is not
+     * enough free space.
+     * @param number_of_elements The number of elements to publish.
+     */
+    void commit_write(const size_t number_of_elements) {
+        static_assert(F::k_single_producer, "Writing in place requires a single producer");
+        std::ignore = fifo_.commit_write(number_of_elements);
+    }
+
     /**
      * Convenience function to pop all available data. Thread safe when called from the consumer thread.
      */
@@ -161,9 +313,23 @@ class FifoBuffer {
         return fifo_.size();
     }
 
+    /**
+     * @returns The number of elements the buffer can hold.
+     */
+    [[nodiscard]] size_t capacity() const {
+        return buffer_.size();
+    }
+
   private:
-    std::vector<T> buffer_;
+    std::vector<T, Allocator> buffer_;
     F fifo_;
+
+    Range make_range(const Fifo::Position& position) {
+        return {
+            BufferView<T>(buffer_.data() + position.index1, position.size1),
+            BufferView<T>(buffer_.data(), position.size2),
+        };
+    }
 };
 
 }  // namespace rav
@@ -0,0 +1,443 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "ravennakit/core/assert.hpp"
+#include "ravennakit/core/json.hpp"
+
+#include <boost/uuid/uuid.hpp>
+#include <fmt/format.h>
+
+#include <charconv>
+#include <cmath>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace rav {
+
+class JsonWriter;
+
+/**
+ * Tag type for tag_invoke overloads which write a value to a JsonWriter, in the same way boost::json::value_from_tag is
+ * used for building a boost::json::value. Overloads have the signature:
+ *
+ *     void tag_invoke(const rav::JsonWriteTag&, rav::JsonWriter& writer, const T& value);
+ *
+ * and are found by argument dependent lookup.
+ */
+struct JsonWriteTag {};
+
+namespace detail {
+
+template<class T, class = void>
+struct has_json_write: std::false_type {};
+
+template<class T>
+struct has_json_write<
+    T, std::void_t<decltype(tag_invoke(std::declval<const JsonWriteTag&>(), std::declval<JsonWriter&>(), std::declval<const T&>()))>>:
+    std::true_type {};
+
+template<class T>
+struct is_optional: std::false_type {};
+
+template<class T>
+struct is_optional<std::optional<T>>: std::true_type {};
+
+template<class T>
+struct is_variant: std::false_type {};
+
+template<class... Ts>
+struct is_variant<std::variant<Ts...>>: std::true_type {};
+
+template<class T, class = void>
+struct is_map: std::false_type {};
+
+template<class T>
+struct is_map<T, std::void_t<typename T::key_type, typename T::mapped_type, decltype(std::declval<const T&>().begin())>>:
+    std::is_convertible<const typename T::key_type&, std::string_view> {};
+
+template<class T, class = void>
+struct is_range: std::false_type {};
+
+template<class T>
+struct is_range<T, std::void_t<decltype(std::begin(std::declval<const T&>())), decltype(std::end(std::declval<const T&>()))>>:
+    std::true_type {};
+
+}  // namespace detail
+
+/**
+ * Writes JSON text directly into a string, without building a boost::json::value first. The output is identical to what
+ * boost::json::serialize produces for the equivalent value (no whitespace, same escaping), which means that the string can
+ * be used wherever serialized JSON was used before.
+ *
+ * Values are written with value(), which supports booleans, numbers, strings, uuids, std::optional (null when empty),
+ * std::variant, ranges (as array) and maps with string keys (as object). Other types are written by their
+ * tag_invoke(const JsonWriteTag&, JsonWriter&, const T&) overload, or when there is none, through boost::json::value_from.
+ *
+ * The writer appends to the given string, so a string can be reused (cleared) between documents to avoid allocations.
+ */
+class JsonWriter {
+  public:
+    /**
+     * Constructs a writer which appends to the given string.
+     * @param output The string to append to. Must outlive the writer.
+     */
+    explicit JsonWriter(std::string& output) : output_(output) {}
+
+    /**
+     * Starts an object. Must be balanced with a call to end_object().
+     */
+    void begin_object() {
+        separate();
+        output_.push_back('{');
+        needs_separator_ = false;
+        depth_++;
+    }
+
+    /**
+     * Ends the current object.
+     */
+    void end_object() {
+        RAV_ASSERT(depth_ > 0, "Unbalanced end_object");
+        output_.push_back('}');
+        needs_separator_ = true;
+        depth_--;
+    }
+
+    /**
+     * Starts an array. Must be balanced with a call to end_array().
+     */
+    void begin_array() {
+        separate();
+        output_.push_back('[');
+        needs_separator_ = false;
+        depth_++;
+    }
+
+    /**
+     * Ends the current array.
+     */
+    void end_array() {
+        RAV_ASSERT(depth_ > 0, "Unbalanced end_array");
+        output_.push_back(']');
+        needs_separator_ = true;
+        depth_--;
+    }
+
+    /**
+     * Writes the key of the next member of the current object. Must be followed by a value.
+     * @param name The key.
+     */
+    void key(const std::string_view name) {
+        separate();
+        write_escaped(name);
+        output_.push_back(':');
+        needs_separator_ = false;
+    }
+
+    /**
+     * Writes a member of the current object.
+     * @param name The key of the member.
+     * @param v The value of the member.
+     */
+    template<class T>
+    void member(const std::string_view name, const T& v) {
+        key(name);
+        value(v);
+    }
+
+    /**
+     * Writes null.
+     */
+    void null() {
+        separate();
+        output_.append("null");
+        needs_separator_ = true;
+    }
+
+    /**
+     * Writes JSON text which has been serialized before, for example a cached representation.
+     * @param json The JSON text of a single value. Not validated.
+     */
+    void raw(const std::string_view json) {
+        separate();
+        output_.append(json);
+        needs_separator_ = true;
+    }
+
+    /**
+     * Writes a value.
+     * @param v The value to write.
+     */
+    template<class T>
+    void value(const T& v) {
+        if constexpr (detail::has_json_write<T>::value) {
+            tag_invoke(JsonWriteTag {}, *this, v);
+        } else if constexpr (std::is_same_v<T, bool>) {
+            separate();
+            output_.append(v ? "true" : "false");
+            needs_separator_ = true;
+        } else if constexpr (std::is_integral_v<T>) {
+            write_integer(v);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            write_floating_point(v);
+        } else if constexpr (std::is_same_v<T, std::nullptr_t> || std::is_same_v<T, std::monostate>) {
+            null();
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            separate();
+            write_escaped(std::string_view(v));
+            needs_separator_ = true;
+        } else if constexpr (std::is_same_v<T, boost::uuids::uuid>) {
+            write_uuid(v);
+        } else if constexpr (detail::is_optional<T>::value) {
+            if (v.has_value()) {
+                value(*v);
+            } else {
+                null();
+            }
+        } else if constexpr (detail::is_variant<T>::value) {
+            std::visit(
+                [this](const auto& alternative) {
+                    value(alternative);
+                },
+                v
+            );
+#if RAV_HAS_BOOST_JSON
+        } else if constexpr (
+            std::is_same_v<T, boost::json::value> || std::is_same_v<T, boost::json::object> || std::is_same_v<T, boost::json::array>
+        ) {
+            raw(boost::json::serialize(v));
+#endif
+        } else if constexpr (detail::is_map<T>::value) {
+            begin_object();
+            for (const auto& [k, mapped] : v) {
+                member(k, mapped);
+            }
+            end_object();
+        } else if constexpr (detail::is_range<T>::value) {
+            begin_array();
+            for (const auto& element : v) {
+                value(element);
+            }
+            end_array();
+        } else {
+#if RAV_HAS_BOOST_JSON
+            raw(boost::json::serialize(boost::json::value_from(v)));
+#else
+            static_assert(sizeof(T) == 0, "No JsonWriteTag overload for this type");
+#endif
+        }
+    }
+
+    /**
+     * @return The string which is being written to.
+     */
+    [[nodiscard]] std::string& output() const {
+        return output_;
+    }
+
+    /**
+     * @return True if all objects and arrays have been closed.
+     */
+    [[nodiscard]] bool is_complete() const {
+        return depth_ == 0;
+    }
+
+  private:
+    std::string& output_;
+    size_t depth_ {0};
+    bool needs_separator_ {false};
+
+    void separate() {
+        if (needs_separator_) {
+            output_.push_back(',');
+        }
+    }
+
+    template<class T>
+    void write_integer(const T v) {
+        separate();
+        char buffer[24];
+        const auto result = std::to_chars(std::begin(buffer), std::end(buffer), v);
+        output_.append(buffer, result.ptr);
+        needs_separator_ = true;
+    }
+
+    /**
+     * Writes a number the way boost::json::serialize does: the shortest representation which round trips, in Ryu's
+     * scientific notation (1.5E0, 1E-3, -0E0). Floats are written as the double they convert to, like value_from does.
+     * NaN is written as null and infinity as 1e99999, which parsers read back as infinity.
+     */
+    template<class T>
+    void write_floating_point(const T value) {
+        const auto v = static_cast<double>(value);
+        separate();
+        needs_separator_ = true;
+        if (std::isnan(v)) {
+            output_.append("null");
+            return;
+        }
+        if (std::signbit(v)) {
+            output_.push_back('-');
+        }
+        if (std::isinf(v)) {
+            output_.append("1e99999");
+            return;
+        }
+
+        // fmt produces the shortest round trip digits, either in fixed (0.001) or exponent (1.5e-07) notation
+        char buffer[32];
+        const auto end = fmt::format_to_n(std::begin(buffer), sizeof(buffer), "{}", std::abs(v)).out;
+        char digits[32];
+        int num_digits = 0;
+        int num_leading_zeros = 0;  // Zeros between the decimal point and the first significant digit
+        int point = -1;             // Position of the decimal point in the digits, if any
+        int exponent = 0;
+        for (auto it = std::begin(buffer); it != end; ++it) {
+            if (*it == '.') {
+                point = num_digits;
+            } else if (*it == 'e') {
+                std::from_chars(it + (*(it + 1) == '+' ? 2 : 1), end, exponent);
+                break;
+            } else if (*it != '0' || num_digits > 0) {
+                digits[num_digits++] = *it;
+            } else if (point >= 0) {
+                num_leading_zeros++;
+            }
+        }
+        if (num_digits == 0) {
+            output_.append("0E0");
+            return;
+        }
+        exponent += (point >= 0 ? point : num_digits) - 1 - num_leading_zeros;
+        while (num_digits > 1 && digits[num_digits - 1] == '0') {
+            num_digits--;
+        }
+
+        output_.push_back(digits[0]);
+        if (num_digits > 1) {
+            output_.push_back('.');
+            output_.append(digits + 1, static_cast<size_t>(num_digits - 1));
+        }
+        output_.push_back('E');
+        char exponent_buffer[8];
+        const auto result = std::to_chars(std::begin(exponent_buffer), std::end(exponent_buffer), exponent);
+        output_.append(exponent_buffer, result.ptr);
+    }
+
+    void write_uuid(const boost::uuids::uuid& uuid) {
+        static constexpr char k_hex[] = "0123456789abcdef";
+        separate();
+        char buffer[38];
+        size_t pos = 0;
+        buffer[pos++] = '"';
+        size_t i = 0;
+        for (const uint8_t byte : uuid) {
+            if (i == 4 || i == 6 || i == 8 || i == 10) {
+                buffer[pos++] = '-';
+            }
+            buffer[pos++] = k_hex[byte >> 4];
+            buffer[pos++] = k_hex[byte & 0x0f];
+            i++;
+        }
+        buffer[pos++] = '"';
+        output_.append(buffer, pos);
+        needs_separator_ = true;
+    }
+
+    void write_escaped(const std::string_view str) {
+        static constexpr char k_hex[] = "0123456789abcdef";
+        output_.push_back('"');
+        size_t begin = 0;
+        for (size_t i = 0; i < str.size(); ++i) {
+            const auto c = static_cast<unsigned char>(str[i]);
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+            output_.append(str.data() + begin, i - begin);
+            begin = i + 1;
+            output_.push_back('\\');
+            switch (c) {
+                case '"':
+                case '\\':
+                    output_.push_back(static_cast<char>(c));
+                    break;
+                case '\b':
+                    output_.push_back('b');
+                    break;
+                case '\f':
+                    output_.push_back('f');
+                    break;
+                case '\n':
+                    output_.push_back('n');
+                    break;
+                case '\r':
+                    output_.push_back('r');
+                    break;
+                case '\t':
+                    output_.push_back('t');
+                    break;
+                default:
+                    output_.append("u00");
+                    output_.push_back(k_hex[c >> 4]);
+                    output_.push_back(k_hex[c & 0x0f]);
+                    break;
+            }
+        }
+        output_.append(str.data() + begin, str.size() - begin);
+        output_.push_back('"');
+    }
+};
+
+/**
+ * Serializes a value to JSON text, appending to the given string.
+ * @param v The value to serialize.
+ * @param output The string to append to.
+ */
+template<class T>
+void serialize_json(const T& v, std::string& output) {
+    JsonWriter writer(output);
+    writer.value(v);
+    RAV_ASSERT(writer.is_complete(), "Unbalanced JSON writer calls");
+}
+
+/**
+ * Serializes a value to JSON text.
+ * @param v The value to serialize.
+ * @return The JSON text.
+ */
+template<class T>
+[[nodiscard]] std::string serialize_json(const T& v) {
+    std::string output;
+    serialize_json(v, output);
+    return output;
+}
+
+}  // namespace rav
@@ -35,8 +35,11 @@
     #define RAV_ENABLE_SPDLOG 0
 #endif
 
-#if RAV_ENABLE_SPDLOG
+#ifndef RAV_ENABLE_ASYNC_LOG
+    #define RAV_ENABLE_ASYNC_LOG 0
+#endif
 
+#if RAV_ENABLE_SPDLOG
     #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
 
     #if RAV_MACOS
@@ -44,6 +47,47 @@
     #endif
 
     #include <spdlog/spdlog.h>
+#else
+    #include "ravennakit/core/format.hpp"
+#endif
+
+enum class LogLevel { off, critical, error, warning, info, debug, trace };
+
+inline std::atomic log_level = LogLevel::info;
+
+#if RAV_ENABLE_ASYNC_LOG
+
+    #include "async_logger.hpp"
+
+    #ifndef RAV_LOG_TRACE
+        #define RAV_LOG_TRACE(...) RAV_ASYNC_LOG(LogLevel::trace, __VA_ARGS__)
+    #endif
+
+    #ifndef RAV_LOG_DEBUG
+        #define RAV_LOG_DEBUG(...) RAV_ASYNC_LOG(LogLevel::debug, __VA_ARGS__)
+    #endif
+
+    #ifndef RAV_LOG_CRITICAL
+        #define RAV_LOG_CRITICAL(...) RAV_ASYNC_LOG(LogLevel::critical, __VA_ARGS__)
+    #endif
+
+    #ifndef RAV_LOG_ERROR
+        #define RAV_LOG_ERROR(...) RAV_ASYNC_LOG(LogLevel::error, __VA_ARGS__)
+    #endif
+
+    #ifndef RAV_LOG_WARNING
+        #define RAV_LOG_WARNING(...) RAV_ASYNC_LOG(LogLevel::warning, __VA_ARGS__)
+    #endif
+
+    #ifndef RAV_LOG_INFO
+        #define RAV_LOG_INFO(...) RAV_ASYNC_LOG(LogLevel::info, __VA_ARGS__)
+    #endif
+
+    #ifndef RAV_LOG
+        #define RAV_LOG(...) RAV_ASYNC_LOG(LogLevel::trace, __VA_ARGS__)
+    #endif
+
+#elif RAV_ENABLE_SPDLOG
 
     #ifndef RAV_LOG_TRACE
         #define RAV_LOG_TRACE(...) SPDLOG_TRACE(__VA_ARGS__)
@@ -75,12 +119,6 @@
 
 #else
 
-    #include "ravennakit/core/format.hpp"
-
-enum class LogLevel { off, critical, error, warning, info, debug, trace };
-
-inline std::atomic log_level = LogLevel::info;
-
     #ifndef RAV_LOG_TRACE
         #define RAV_LOG_TRACE(...)                     \
             if (log_level.load() >= LogLevel::trace) { \
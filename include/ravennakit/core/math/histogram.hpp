@@ -0,0 +1,330 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "ravennakit/core/assert.hpp"
+
+#include <boost/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace rav {
+
+/**
+ * A fixed memory, log-linear histogram of unsigned integer values (in the spirit of HdrHistogram). Values below
+ * 2^k_sub_bucket_bits are counted exactly, above that every power of two is divided into 2^(k_sub_bucket_bits - 1)
+ * linear buckets, which bounds the relative error of a reported value to 1 / 2^(k_sub_bucket_bits - 1). Values larger
+ * than k_max_value are counted as k_max_value.
+ *
+ * Recording doesn't lock and uses no atomic read-modify-write operations: the histogram is divided into shards and
+ * every shard must be written by a single thread only (e.g. shard 0 by the network thread, shard 1 by the audio
+ * thread). Any thread can take a snapshot at any time, which merges the shards.
+ */
+class Histogram {
+  public:
+    /// The number of bits of precision of a value.
+    static constexpr uint32_t k_sub_bucket_bits = 7;
+
+    /// The number of bits of the largest value which can be represented.
+    static constexpr uint32_t k_max_value_bits = 40;
+
+    /// The largest value which can be represented. As nanoseconds, this is a bit over 18 minutes.
+    static constexpr uint64_t k_max_value = (uint64_t {1} << k_max_value_bits) - 1;
+
+    /// The number of linear buckets per power of two.
+    static constexpr size_t k_sub_bucket_half_count = size_t {1} << (k_sub_bucket_bits - 1);
+
+    /// The total number of buckets.
+    static constexpr size_t k_num_buckets =
+        (k_max_value_bits - k_sub_bucket_bits) * k_sub_bucket_half_count + (size_t {1} << k_sub_bucket_bits);
+
+    /**
+     * A merged copy of the counts of a histogram.
+     */
+    class Snapshot {
+      public:
+        Snapshot() : counts_(k_num_buckets) {}
+
+        /**
+         * @return The number of recorded values.
+         */
+        [[nodiscard]] uint64_t count() const {
+            return count_;
+        }
+
+        /**
+         * @return The smallest recorded value, or 0 if no values were recorded.
+         */
+        [[nodiscard]] uint64_t min() const {
+            return count_ == 0 ? 0 : min_;
+        }
+
+        /**
+         * @return The largest recorded value, or 0 if no values were recorded.
+         */
+        [[nodiscard]] uint64_t max() const {
+            return max_;
+        }
+
+        /**
+         * @return The mean of the recorded values, or 0 if no values were recorded.
+         */
+        [[nodiscard]] double mean() const {
+            return count_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_);
+        }
+
+        /**
+         * @param percentile The percentile, in the range [0, 100].
+         * @return The value at given percentile: the highest value which is equivalent to the value at given percentile,
+         * limited to the range of recorded values. Returns 0 if no values were recorded.
+         */
+        [[nodiscard]] uint64_t value_at_percentile(const double percentile) const {
+            if (count_ == 0) {
+                return 0;
+            }
+            const auto p = std::clamp(percentile, 0.0, 100.0);
+            const auto target = std::max(uint64_t {1}, static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(count_))));
+            uint64_t total = 0;
+            for (size_t i = 0; i < counts_.size(); ++i) {
+                total += counts_[i];
+                if (total >= target) {
+                    return std::clamp(highest_equivalent_value(i), min(), max_);
+                }
+            }
+            return max_;
+        }
+
+        /**
+         * @return The counts of all buckets, indexed by bucket.
+         */
+        [[nodiscard]] const std::vector<uint64_t>& counts() const {
+            return counts_;
+        }
+
+        /**
+         * Adds the counts of another snapshot to this one.
+         * @param other The snapshot to add.
+         */
+        void merge(const Snapshot& other) {
+            for (size_t i = 0; i < counts_.size(); ++i) {
+                counts_[i] += other.counts_[i];
+            }
+            if (other.count_ > 0) {
+                min_ = count_ == 0 ? other.min_ : std::min(min_, other.min_);
+                max_ = std::max(max_, other.max_);
+            }
+            count_ += other.count_;
+            sum_ += other.sum_;
+        }
+
+      private:
+        friend class Histogram;
+
+        std::vector<uint64_t> counts_;
+        uint64_t count_ {};
+        uint64_t sum_ {};
+        uint64_t min_ {};
+        uint64_t max_ {};
+    };
+
+    /**
+     * Constructor.
+     * @param num_shards The number of shards, one for every thread that records values.
+     */
+    explicit Histogram(const size_t num_shards = 1) {
+        RAV_ASSERT(num_shards > 0, "At least one shard is required");
+        shards_.reserve(num_shards);
+        for (size_t i = 0; i < num_shards; ++i) {
+            shards_.push_back(std::make_unique<Shard>());
+        }
+    }
+
+    /**
+     * Records a value. Realtime safe. Each shard must only be written by a single thread at a time.
+     * @param value The value to record.
+     * @param shard The shard to record into.
+     */
+    void record(const uint64_t value, const size_t shard = 0) {
+        RAV_ASSERT_DEBUG(shard < shards_.size(), "Shard index out of range");
+        auto& s = *shards_[shard];
+        const auto v = std::min(value, k_max_value);
+        increment(s.counts[bucket_index(v)], 1);
+        increment(s.sum, v);
+        if (v < s.min.load(std::memory_order_relaxed)) {
+            s.min.store(v, std::memory_order_relaxed);
+        }
+        if (v > s.max.load(std::memory_order_relaxed)) {
+            s.max.store(v, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Clears all recorded values. Not thread safe: make sure no thread is recording values at the same time.
+     */
+    void reset() {
+        for (auto& shard : shards_) {
+            for (size_t i = 0; i < k_num_buckets; ++i) {
+                shard->counts[i].store(0, std::memory_order_relaxed);
+            }
+            shard->sum.store(0, std::memory_order_relaxed);
+            shard->min.store(UINT64_MAX, std::memory_order_relaxed);
+            shard->max.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Merges the shards into a snapshot. Can be called from any thread while values are being recorded, in which case
+     * the values recorded concurrently may or may not be included.
+     * @return The snapshot.
+     */
+    [[nodiscard]] Snapshot snapshot() const {
+        Snapshot result;
+        for (const auto& shard : shards_) {
+            uint64_t shard_count = 0;
+            for (size_t i = 0; i < k_num_buckets; ++i) {
+                const auto count = shard->counts[i].load(std::memory_order_relaxed);
+                result.counts_[i] += count;
+                shard_count += count;
+            }
+            if (shard_count > 0) {
+                const auto shard_min = shard->min.load(std::memory_order_relaxed);
+                result.min_ = result.count_ == 0 ? shard_min : std::min(result.min_, shard_min);
+                result.max_ = std::max(result.max_, shard->max.load(std::memory_order_relaxed));
+            }
+            result.count_ += shard_count;
+            result.sum_ += shard->sum.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    /**
+     * @return The number of shards.
+     */
+    [[nodiscard]] size_t num_shards() const {
+        return shards_.size();
+    }
+
+    /**
+     * @param value The value.
+     * @return The index of the bucket counting given value.
+     */
+    static size_t bucket_index(uint64_t value) {
+        value = std::min(value, k_max_value);
+        if (value < (uint64_t {1} << k_sub_bucket_bits)) {
+            return static_cast<size_t>(value);
+        }
+        const auto exponent = most_significant_bit(value) - k_sub_bucket_bits + 1;
+        return exponent * k_sub_bucket_half_count + static_cast<size_t>(value >> exponent);
+    }
+
+    /**
+     * @param index The index of a bucket.
+     * @return The lowest value counted by the bucket.
+     */
+    static uint64_t lowest_equivalent_value(const size_t index) {
+        if (index < 2 * k_sub_bucket_half_count) {
+            return index;
+        }
+        const auto exponent = index / k_sub_bucket_half_count - 1;
+        const auto sub_bucket = index - exponent * k_sub_bucket_half_count;
+        return static_cast<uint64_t>(sub_bucket) << exponent;
+    }
+
+    /**
+     * @param index The index of a bucket.
+     * @return The highest value counted by the bucket.
+     */
+    static uint64_t highest_equivalent_value(const size_t index) {
+        if (index < 2 * k_sub_bucket_half_count) {
+            return index;
+        }
+        const auto exponent = index / k_sub_bucket_half_count - 1;
+        const auto sub_bucket = index - exponent * k_sub_bucket_half_count;
+        return ((static_cast<uint64_t>(sub_bucket) + 1) << exponent) - 1;
+    }
+
+  private:
+    struct Shard {
+        std::unique_ptr<std::atomic<uint64_t>[]> counts = std::make_unique<std::atomic<uint64_t>[]>(k_num_buckets);
+        std::atomic<uint64_t> sum {0};
+        std::atomic<uint64_t> min {UINT64_MAX};
+        std::atomic<uint64_t> max {0};
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+
+    /// Single writer increment: a relaxed load and store instead of a read-modify-write.
+    static void increment(std::atomic<uint64_t>& value, const uint64_t amount) {
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    static uint32_t most_significant_bit(const uint64_t value) {
+#if defined(_MSC_VER)
+        unsigned long index {};
+        _BitScanReverse64(&index, value);
+        return static_cast<uint32_t>(index);
+#else
+        return 63 - static_cast<uint32_t>(__builtin_clzll(value));
+#endif
+    }
+};
+
+/**
+ * Serializes a snapshot as the number of values, min, max, mean, a set of percentiles and the non-empty buckets (as
+ * pairs of the highest equivalent value and the count).
+ */
+inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv, const Histogram::Snapshot& snapshot) {
+    boost::json::array buckets;
+    const auto& counts = snapshot.counts();
+    for (size_t i = 0; i < counts.size(); ++i) {
+        if (counts[i] > 0) {
+            buckets.push_back(boost::json::array {Histogram::highest_equivalent_value(i), counts[i]});
+        }
+    }
+
+    jv = {
+        {"count", snapshot.count()},
+        {"min", snapshot.min()},
+        {"max", snapshot.max()},
+        {"mean", snapshot.mean()},
+        {"p50", snapshot.value_at_percentile(50.0)},
+        {"p90", snapshot.value_at_percentile(90.0)},
+        {"p99", snapshot.value_at_percentile(99.0)},
+        {"p99_9", snapshot.value_at_percentile(99.9)},
+        {"p99_99", snapshot.value_at_percentile(99.99)},
+        {"buckets", std::move(buckets)},
+    };
+}
+
+}  // namespace rav
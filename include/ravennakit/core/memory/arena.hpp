@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "ravennakit/core/assert.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rav {
+
+/**
+ * A memory arena which reserves one large region up front and hands out cache-line-aligned blocks from it. The region
+ * is backed by huge pages when possible (MAP_HUGETLB on Linux, large pages on Windows), locked into memory (mlock) and
+ * pre-faulted, so that buffers which are touched from realtime threads don't cause TLB pressure or page faults.
+ *
+ * Allocating and freeing takes a lock and is meant to be done from non-realtime threads (i.e. when setting up readers
+ * and writers), reading and writing the handed out memory is free of any synchronization. Every allocation is tagged
+ * with a subsystem name for which the usage is reported. When the arena is exhausted allocations fall back to the heap
+ * and are reported as overflow.
+ *
+ * Memory is normally obtained through ArenaAllocator while an Arena::Scope is active on the current thread.
+ */
+class Arena {
+  public:
+    /// The alignment of every block handed out by the arena.
+    static constexpr size_t k_alignment = 64;
+
+    /// The size of the default arena.
+    static constexpr size_t k_default_size = 32 * 1024 * 1024;
+
+    /// The size of a huge page which the region is rounded up to when using huge pages.
+    static constexpr size_t k_huge_page_size = 2 * 1024 * 1024;
+
+    struct Options {
+        /// The size of the region in bytes.
+        size_t size = k_default_size;
+        /// Whether to try to back the region with huge pages.
+        bool use_huge_pages = true;
+        /// Whether to try to lock the region into memory.
+        bool lock_memory = true;
+        /// Whether to touch every page of the region up front.
+        bool prefault = true;
+    };
+
+    struct Info {
+        /// The size of the region in bytes.
+        size_t capacity = 0;
+        /// The number of bytes currently allocated from the region, including block headers and padding.
+        size_t used = 0;
+        /// Whether the region is backed by huge pages.
+        bool huge_pages = false;
+        /// Whether the region is locked into memory.
+        bool locked = false;
+    };
+
+    struct Usage {
+        /// The name of the subsystem.
+        std::string subsystem;
+        /// The number of bytes currently allocated from the arena by this subsystem.
+        size_t bytes = 0;
+        /// The number of live allocations made from the arena by this subsystem.
+        size_t allocations = 0;
+        /// The number of bytes currently allocated on the heap because the arena was exhausted.
+        size_t overflow_bytes = 0;
+        /// The number of live allocations made on the heap because the arena was exhausted.
+        size_t overflow_allocations = 0;
+    };
+
+    /**
+     * Makes allocations through ArenaAllocator on the current thread come from the given arena and be accounted to the
+     * given subsystem for as long as this object lives. Scopes can be nested.
+     */
+    class Scope {
+      public:
+        /**
+         * @param arena The arena to allocate from.
+         * @param subsystem The name of the subsystem. Must have static storage duration (i.e. a string literal).
+         */
+        Scope(Arena& arena, const char* subsystem);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        Scope(Scope&&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+      private:
+        friend class Arena;
+        Arena& arena_;
+        const char* subsystem_;
+        Scope* previous_;
+    };
+
+    /**
+     * Reserves the region.
+     * @param options The options for the region.
+     */
+    explicit Arena(const Options& options);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    Arena(Arena&&) = delete;
+    Arena& operator=(Arena&&) = delete;
+
+    /**
+     * @return The process wide arena used for audio buffers of the receiver and sender. The arena is created on first
+     * use and never destroyed.
+     */
+    static Arena& get_default();
+
+    /**
+     * Allocates memory aligned to k_alignment. When a scope is active on the current thread the memory comes from the
+     * arena of that scope (or from the heap if the arena is exhausted), otherwise from the heap.
+     * @param size The number of bytes to allocate.
+     * @return A pointer to the memory. Throws std::bad_alloc on failure.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * Frees memory previously allocated through allocate(), regardless of which arena or thread it came from.
+     * @param ptr The memory to free. Can be nullptr.
+     */
+    static void deallocate(void* ptr) noexcept;
+
+    /**
+     * Allocates memory from this arena, accounted to given subsystem.
+     * @param size The number of bytes to allocate.
+     * @param subsystem The name of the subsystem. Must have static storage duration (i.e. a string literal).
+     * @return A pointer to the memory, or nullptr if the arena is exhausted.
+     */
+    [[nodiscard]] void* try_allocate(size_t size, const char* subsystem);
+
+    /**
+     * @return Information about the region.
+     */
+    [[nodiscard]] Info get_info() const;
+
+    /**
+     * @return The usage per subsystem, sorted by subsystem name.
+     */
+    [[nodiscard]] std::vector<Usage> get_usage() const;
+
+    /**
+     * @param ptr The pointer to test.
+     * @return True if the pointer points into the region of this arena.
+     */
+    [[nodiscard]] bool contains(const void* ptr) const;
+
+  private:
+    struct Header;
+
+    uint8_t* region_ {};
+    size_t capacity_ {};
+    bool huge_pages_ {};
+    bool locked_ {};
+    bool mapped_ {};
+
+    mutable std::mutex mutex_;
+    std::map<size_t, size_t> free_blocks_;  // Offset -> size, guarded by mutex_
+    std::map<std::string_view, Usage> usage_;  // Guarded by mutex_
+    size_t used_ {};                           // Guarded by mutex_
+
+    static Scope*& current_scope();
+    void free_block(Header* header) noexcept;
+    void account(const Header& header, bool add);
+};
+
+/**
+ * A stateless allocator which allocates through Arena::allocate() and is therefore served from the arena of the
+ * Arena::Scope which is active when a container allocates. Memory can be freed at any time from any thread.
+ * @tparam T The value type.
+ */
+template<class T>
+class ArenaAllocator {
+  public:
+    using value_type = T;
+
+    ArenaAllocator() = default;
+
+    template<class U>
+    explicit ArenaAllocator(const ArenaAllocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(const size_t n) {
+        static_assert(alignof(T) <= Arena::k_alignment, "Alignment of T not supported");
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(Arena::allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, size_t) noexcept {
+        Arena::deallocate(ptr);
+    }
+
+    friend bool operator==(const ArenaAllocator&, const ArenaAllocator&) noexcept {
+        return true;
+    }
+
+    friend bool operator!=(const ArenaAllocator&, const ArenaAllocator&) noexcept {
+        return false;
+    }
+};
+
+/// A vector whose storage is served by the active arena scope.
+template<class T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+}  // namespace rav
@@ -24,13 +24,15 @@
 
 #pragma once
 
+#include "ravennakit/core/math/sliding_stats.hpp"
 #include "ravennakit/core/net/http/detail/http_fmt_adapters.hpp"
 
 #include <boost/asio.hpp>
 #include <boost/url.hpp>
 
+#include <deque>
+#include <optional>
 #include <string>
-#include <queue>
 
 namespace rav {
 
@@ -50,6 +52,16 @@ class HttpClientBase {
     /// Callback type for async requests.
     using ResponseCallback = std::function<void(boost::system::result<http::response<http::string_body>> response)>;
 
+    /// The priority of a request.
+    enum class Priority {
+        /// Requests are sent in the order in which they were made.
+        normal,
+        /// Sent before all normal requests. May use a connection of its own when all connections are busy, so that it
+        /// doesn't have to wait for (large) requests in flight. That connection never carries normal requests. Meant for
+        /// small, time critical requests like heartbeats.
+        high,
+    };
+
     /**
      * Sets the host to connect to.
      * @param url The url with the host info.
@@ -107,6 +119,23 @@ class HttpClientBase {
         http::verb method, std::string_view target, std::string body, std::string_view content_type, ResponseCallback callback
     ) = 0;
 
+    /**
+     * Asynchronous request with a priority. The default implementation ignores the priority.
+     * @param method The HTTP method to use for the request.
+     * @param target The target to request.
+     * @param body The optional body to send with the request.
+     * @param content_type The content type of the body.
+     * @param callback The callback to call when the request is complete.
+     * @param priority The priority of the request.
+     */
+    virtual void request_with_priority_async(
+        const http::verb method, const std::string_view target, std::string body, const std::string_view content_type,
+        ResponseCallback callback, const Priority priority
+    ) {
+        std::ignore = priority;
+        request_async(method, target, std::move(body), content_type, std::move(callback));
+    }
+
     /**
      * Clears all scheduled requests if there are any. Otherwise, this function has no effect.
      */
@@ -125,9 +154,34 @@ class HttpClientBase {
 
 /**
  * A high level wrapper around boost::beast for making HTTP requests.
+ *
+ * Requests are sent over a pool of persistent (keep-alive) connections to the host. By default the pool holds a single
+ * connection, which means that requests are sent and answered in the order in which they were made. The resolved
+ * endpoints of the host are cached until the host changes or connecting fails.
  */
 class HttpClient: public HttpClientBase {
   public:
+    /// The number of requests the latency statistics are calculated over.
+    static constexpr size_t k_metrics_window = 100;
+
+    /**
+     * Statistics about the requests made by this client.
+     */
+    struct Metrics {
+        /// Time between making a request and sending it, in milliseconds.
+        SlidingStats queue_time_ms {k_metrics_window};
+        /// Time between making a request and receiving the response, in milliseconds.
+        SlidingStats response_time_ms {k_metrics_window};
+        /// The number of requests which completed with a response.
+        size_t num_responses = 0;
+        /// The number of requests which failed without a response.
+        size_t num_failures = 0;
+        /// The number of connections which were made.
+        size_t num_connects = 0;
+        /// The number of DNS lookups which were made.
+        size_t num_resolves = 0;
+    };
+
     /**
      * Constructs a new HttpClient using the given io_context, but no url.
      * @param io_context The io_context to use for the request.
@@ -218,6 +272,14 @@ class HttpClient: public HttpClientBase {
         http::verb method, std::string_view target, std::string body, std::string_view content_type, ResponseCallback callback
     ) override;
 
+    /**
+     * @copydoc HttpClientBase::request_with_priority_async
+     */
+    void request_with_priority_async(
+        http::verb method, std::string_view target, std::string body, std::string_view content_type, ResponseCallback callback,
+        Priority priority
+    ) override;
+
     /**
      * @copydoc HttpClientBase::delete_async
      */
@@ -238,36 +300,71 @@ class HttpClient: public HttpClientBase {
      */
     [[nodiscard]] const std::string& get_service() const override;
 
+    /**
+     * Sets the maximum number of concurrent connections for normal requests. Higher numbers allow more requests in
+     * flight, at the cost of requests no longer being answered in the order in which they were made. A high priority
+     * request can use one connection on top of this number, which is only used for high priority requests.
+     * @param max_connections The maximum number of connections, at least 1.
+     */
+    void set_max_connections(size_t max_connections);
+
+    /**
+     * @return The number of open or opening connections.
+     */
+    [[nodiscard]] size_t get_connection_count() const;
+
+    /**
+     * @return Statistics about the requests made by this client.
+     */
+    [[nodiscard]] const Metrics& get_metrics() const;
+
   private:
+    /**
+     * A request waiting to be sent.
+     */
+    struct PendingRequest {
+        http::request<http::string_body> request;
+        ResponseCallback callback;
+        Priority priority {Priority::normal};
+        std::chrono::steady_clock::time_point queued_at;
+    };
+
     /**
      * A session class that keeps itself alive and handles the connection and request/response cycle.
      */
     class Session: public std::enable_shared_from_this<Session> {
       public:
         enum class State { disconnected, resolving, connecting, connected, waiting_for_send, waiting_for_response };
-        explicit Session(boost::asio::io_context& io_context, HttpClient* owner, std::chrono::milliseconds timeout_seconds);
+        explicit Session(
+            boost::asio::io_context& io_context, HttpClient* owner, std::chrono::milliseconds timeout_seconds, bool priority_only
+        );
 
         void send_requests();
         void clear_owner();
-
-        ResponseCallback callback_;
+        [[nodiscard]] bool is_idle() const;
+        [[nodiscard]] bool is_open() const;
+        [[nodiscard]] bool is_priority_only() const;
 
       private:
         HttpClient* owner_ = nullptr;
         std::chrono::milliseconds timeout_seconds_ = std::chrono::seconds(30);
+        bool priority_only_ = false;  // The extra session for high priority requests, never sends normal requests
         boost::asio::ip::tcp::resolver resolver_;
         boost::beast::tcp_stream stream_;
-        http::request<http::string_body> request_;
+        PendingRequest request_;
         http::response<http::string_body> response_;
         boost::beast::flat_buffer buffer_;
         State state_ = State::disconnected;
 
         void async_connect();
         void async_send();
+        void async_write();
+        void connect(const tcp::resolver::results_type& endpoints);
         void on_resolve(const boost::beast::error_code& ec, const tcp::resolver::results_type& results);
         void on_connect(const boost::beast::error_code& ec, const tcp::resolver::results_type::endpoint_type&);
         void on_write(const boost::beast::error_code& ec, std::size_t bytes_transferred);
         void on_read(boost::beast::error_code ec, std::size_t bytes_transferred);
+        void fail(const boost::beast::error_code& ec);
 
         bool take_next_request();
     };
@@ -276,8 +373,14 @@ class HttpClient: public HttpClientBase {
     std::chrono::milliseconds timeout_seconds_ = std::chrono::seconds(30);
     std::string host_;
     std::string service_;
-    std::queue<std::pair<http::request<http::string_body>, ResponseCallback>> requests_;
-    std::shared_ptr<Session> session_;
+    std::deque<PendingRequest> requests_;
+    std::vector<std::shared_ptr<Session>> sessions_;
+    size_t max_connections_ = 1;
+    std::optional<tcp::resolver::results_type> resolved_endpoints_;
+    Metrics metrics_;
+
+    void dispatch_requests();
+    void reset_sessions();
 };
 
 }  // namespace rav
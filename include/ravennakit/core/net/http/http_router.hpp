@@ -28,16 +28,28 @@
 #include "ravennakit/core/util/path_matcher.hpp"
 
 #include <boost/beast.hpp>
+#include <boost/container/static_vector.hpp>
 
+#include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
-#include <functional>
-#include <map>
 #include <utility>
+#include <vector>
 
 namespace rav {
 
 /**
- * A simple HTTP router that matches HTTP requests to handlers based on the method and path.
+ * An HTTP router that matches HTTP requests to handlers based on the method and path.
+ *
+ * Patterns follow the syntax of PathMatcher: static segments, parameters ("{id}", optionally with a literal prefix and
+ * suffix like "v{version}.json"), the single segment wildcard "*" and the recursive wildcard "**" (last segment only).
+ * Routes are compiled into a segment trie on insertion, so matching is a single walk over the path which doesn't
+ * allocate. When several routes could match, static segments take precedence over parameters, parameters over "*" and
+ * "*" over "**".
+ *
+ * Parameter names point into the router and parameter values point into the matched path.
+ *
  * @tparam HandlerType The type of the handler function.
  */
 template<typename HandlerType>
@@ -55,48 +67,202 @@ class HttpRouter {
         RAV_ASSERT(handler != nullptr, "Handler cannot be null");
         RAV_ASSERT(method != boost::beast::http::verb::unknown, "Method cannot be unknown");
 
-        for (auto& route : routes_) {
-            if (route.method == method && route.pattern == pattern) {
-                route.handler = std::move(handler);
-                return;  // Updated existing route
+        auto remaining = pattern;
+        if (!remaining.empty() && remaining.front() == '/') {
+            remaining.remove_prefix(1);
+        }
+
+        Node* node = &root_;
+        size_t num_parameters = 0;
+
+        while (const auto segment = next_segment(remaining)) {
+            if (*segment == "**") {
+                if (!remaining.empty()) {
+                    RAV_ASSERT_FALSE("Recursive wildcard must be the last segment of a pattern");
+                    return;
+                }
+                set_handler(node->recursive_handlers, method, std::move(handler));
+                return;
+            }
+
+            if (*segment == "*") {
+                if (node->wildcard_child == nullptr) {
+                    node->wildcard_child = std::make_unique<Node>();
+                }
+                node = node->wildcard_child.get();
+                continue;
+            }
+
+            const auto open = segment->find('{');
+            if (open == std::string_view::npos) {
+                node = find_or_add_static_child(*node, *segment);
+                continue;
+            }
+
+            const auto close = segment->find('}', open);
+            if (close == std::string_view::npos || close == open + 1) {
+                RAV_ASSERT_FALSE("Invalid parameter in pattern");
+                return;
+            }
+
+            if (++num_parameters > PathMatcher::Parameters::k_max_parameters) {
+                RAV_ASSERT_FALSE("Too many parameters in pattern");
+                return;
             }
+
+            node = find_or_add_parameter_child(
+                *node, segment->substr(0, open), segment->substr(open + 1, close - open - 1), segment->substr(close + 1)
+            );
         }
 
-        // If no existing route was found, add a new one
-        routes_.emplace_back(Route {method, std::string(pattern), std::move(handler)});
+        set_handler(node->handlers, method, std::move(handler));
     }
 
     /**
      * Matches the given method and path to a handler. If a matching route is found, the handler is returned.
      * @param method The HTTP method to match (e.g., GET, POST).
      * @param path The path to match.
-     * @param parameters The parameters to fill with the extracted values from the path.
+     * @param parameters The parameters to fill with the extracted values from the path. May be null.
      * @return A pointer to the matching handler, or nullptr if no match is found.
      */
-    HandlerType* match(const boost::beast::http::verb method, const std::string_view path, PathMatcher::Parameters* parameters) {
-        for (auto& route : routes_) {
-            if (route.method == method) {
-                auto match_result = PathMatcher::match(path, route.pattern, parameters);
-                if (match_result.has_error()) {
-                    RAV_LOG_ERROR("Error matching path: {}", match_result.error());
-                    continue;
-                }
-                if (match_result.value()) {
-                    return &route.handler;
-                }
+    HandlerType* match(const boost::beast::http::verb method, std::string_view path, PathMatcher::Parameters* parameters) {
+        if (path.empty()) {
+            return nullptr;
+        }
+
+        if (path.front() == '/') {
+            path.remove_prefix(1);
+        }
+
+        Captures captures;
+        auto* handler = match_node(root_, method, path, captures);
+        if (handler != nullptr && parameters != nullptr) {
+            for (const auto& [name, value] : captures) {
+                parameters->set(name, value);
             }
         }
-        return nullptr;  // No matching route found
+        return handler;
     }
 
   private:
-    struct Route {
-        boost::beast::http::verb method {};
-        std::string pattern;
-        HandlerType handler;
+    using Handlers = std::vector<std::pair<boost::beast::http::verb, HandlerType>>;
+    using Captures =
+        boost::container::static_vector<std::pair<std::string_view, std::string_view>, PathMatcher::Parameters::k_max_parameters>;
+
+    struct Node {
+        std::string segment;  // Static segment, or the parameter name for parameter nodes
+        std::string prefix;   // Parameter nodes only
+        std::string suffix;   // Parameter nodes only
+        std::vector<std::unique_ptr<Node>> static_children;
+        std::vector<std::unique_ptr<Node>> parameter_children;
+        std::unique_ptr<Node> wildcard_child;
+        Handlers handlers;            // Routes ending at this node
+        Handlers recursive_handlers;  // Routes ending with "**" at this node
     };
 
-    std::vector<Route> routes_;
+    Node root_;
+
+    /**
+     * Consumes the next path segment, with the same semantics as StringParser::split('/').
+     * @param remaining The remaining path, without leading slash.
+     * @return The segment, or nullopt if the path is exhausted.
+     */
+    static std::optional<std::string_view> next_segment(std::string_view& remaining) {
+        if (remaining.empty()) {
+            return std::nullopt;
+        }
+        const auto pos = remaining.find('/');
+        const auto segment = remaining.substr(0, pos);
+        remaining = pos == std::string_view::npos ? std::string_view() : remaining.substr(pos + 1);
+        return segment;
+    }
+
+    static Node* find_or_add_static_child(Node& node, const std::string_view segment) {
+        for (auto& child : node.static_children) {
+            if (child->segment == segment) {
+                return child.get();
+            }
+        }
+        auto& child = node.static_children.emplace_back(std::make_unique<Node>());
+        child->segment = segment;
+        return child.get();
+    }
+
+    static Node*
+    find_or_add_parameter_child(Node& node, const std::string_view prefix, const std::string_view name, const std::string_view suffix) {
+        for (auto& child : node.parameter_children) {
+            if (child->segment == name && child->prefix == prefix && child->suffix == suffix) {
+                return child.get();
+            }
+        }
+        auto& child = node.parameter_children.emplace_back(std::make_unique<Node>());
+        child->segment = name;
+        child->prefix = prefix;
+        child->suffix = suffix;
+        return child.get();
+    }
+
+    static void set_handler(Handlers& handlers, const boost::beast::http::verb method, HandlerType handler) {
+        for (auto& [verb, existing] : handlers) {
+            if (verb == method) {
+                existing = std::move(handler);
+                return;  // Updated existing route
+            }
+        }
+        handlers.emplace_back(method, std::move(handler));
+    }
+
+    static HandlerType* find_handler(Handlers& handlers, const boost::beast::http::verb method) {
+        for (auto& [verb, handler] : handlers) {
+            if (verb == method) {
+                return &handler;
+            }
+        }
+        return nullptr;
+    }
+
+    static HandlerType*
+    match_node(Node& node, const boost::beast::http::verb method, const std::string_view path, Captures& captures) {
+        auto remaining = path;
+        const auto segment = next_segment(remaining);
+
+        if (!segment) {
+            if (auto* handler = find_handler(node.handlers, method)) {
+                return handler;
+            }
+            return find_handler(node.recursive_handlers, method);
+        }
+
+        for (auto& child : node.static_children) {
+            if (child->segment == *segment) {
+                if (auto* handler = match_node(*child, method, remaining, captures)) {
+                    return handler;
+                }
+                break;
+            }
+        }
+
+        for (auto& child : node.parameter_children) {
+            const auto affix_size = child->prefix.size() + child->suffix.size();
+            if (segment->size() < affix_size || segment->compare(0, child->prefix.size(), child->prefix) != 0
+                || segment->compare(segment->size() - child->suffix.size(), child->suffix.size(), child->suffix) != 0) {
+                continue;
+            }
+            captures.emplace_back(child->segment, segment->substr(child->prefix.size(), segment->size() - affix_size));
+            if (auto* handler = match_node(*child, method, remaining, captures)) {
+                return handler;
+            }
+            captures.pop_back();
+        }
+
+        if (node.wildcard_child != nullptr) {
+            if (auto* handler = match_node(*node.wildcard_child, method, remaining, captures)) {
+                return handler;
+            }
+        }
+
+        return find_handler(node.recursive_handlers, method);
+    }
 };
 
 }  // namespace rav
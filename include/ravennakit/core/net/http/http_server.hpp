@@ -26,6 +26,7 @@
 
 #include "http_router.hpp"
 #include "detail/http_fmt_adapters.hpp"
+#include "ravennakit/core/util/safe_function.hpp"
 
 #include <map>
 #include <boost/asio.hpp>
@@ -36,6 +37,9 @@
 #include <boost/url.hpp>
 
 #include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
 
 namespace rav {
 
@@ -51,9 +55,43 @@ class HttpServer {
     /// The time to wait for a request before closing the connection.
     static constexpr auto k_timeout_seconds = 5;
 
+    /// The maximum number of messages queued on a WebSocket connection. A client which falls this far behind is
+    /// disconnected.
+    static constexpr size_t k_max_queued_websocket_messages = 1024;
+
+    /**
+     * A connection which was upgraded to the WebSocket protocol. Must only be used from the io_context thread and must
+     * not outlive the server.
+     */
+    class WebSocketConnection {
+      public:
+        /// Called when the connection was closed, by either side. Not called when the server is stopped.
+        SafeFunction<void()> on_close;
+
+        virtual ~WebSocketConnection() = default;
+
+        /**
+         * Queues a text message. Messages are sent in the order in which they were queued.
+         * @param message The message to send.
+         */
+        virtual void send(std::string message) = 0;
+
+        /**
+         * Closes the connection.
+         */
+        virtual void close() = 0;
+
+        /**
+         * @return True if the connection is open.
+         */
+        [[nodiscard]] virtual bool is_open() const = 0;
+    };
+
+    using WebSocketHandler = std::function<void(const Request&, std::shared_ptr<WebSocketConnection>, PathMatcher::Parameters&)>;
+
     /**
      * Constructs a new HttpServer using the given io_context.
-     * The io_context must be single threaded.
+     * The io_context must be single threaded. Handlers are always called on the io_context.
      * @param io_context The io_context to use for the server.
      */
     explicit HttpServer(boost::asio::io_context& io_context);
@@ -73,6 +111,22 @@ class HttpServer {
      */
     void stop();
 
+    /**
+     * Sets the number of worker threads. With worker threads, connections are accepted, requests are parsed and
+     * responses are serialized and written on the workers, and only the handlers are called on the io_context. This
+     * keeps slow clients and bursts of requests from delaying other work on the io_context. With zero worker threads
+     * (the default) everything happens on the io_context. Takes effect the next time the server is started.
+     * Routes must be added before the server is started when using worker threads.
+     * @param num_threads The number of worker threads.
+     */
+    void set_worker_threads(size_t num_threads);
+
+    /**
+     * @return The number of worker threads the server is running with, which is zero when not running or when running
+     * on the io_context.
+     */
+    [[nodiscard]] size_t get_worker_threads() const;
+
     /**
      * @return The local (listening) endpoint of the server.
      */
@@ -88,6 +142,11 @@ class HttpServer {
      */
     [[nodiscard]] size_t get_client_count() const;
 
+    /**
+     * @return The number of open WebSocket connections.
+     */
+    [[nodiscard]] size_t get_websocket_count() const;
+
     /**
      * Adds a handler for GET requests to the given pattern.
      * @param pattern The pattern to match against the request path.
@@ -124,6 +183,25 @@ class HttpServer {
         router_.insert(boost::beast::http::verb::patch, pattern, std::move(handler));
     }
 
+    /**
+     * Adds a handler for DELETE requests to the given pattern.
+     * @param pattern The pattern to match against the request path.
+     * @param handler The handler to call when a request matches the pattern.
+     */
+    void del(const std::string_view pattern, Handler handler) {
+        router_.insert(boost::beast::http::verb::delete_, pattern, std::move(handler));
+    }
+
+    /**
+     * Adds a handler for WebSocket upgrade requests to the given pattern. The handler is called once the upgrade has
+     * completed.
+     * @param pattern The pattern to match against the request path.
+     * @param handler The handler to call with the upgraded connection.
+     */
+    void websocket(const std::string_view pattern, WebSocketHandler handler) {
+        websocket_router_.insert(boost::beast::http::verb::get, pattern, std::move(handler));
+    }
+
   private:
     class Listener;
     std::shared_ptr<Listener> listener_;
@@ -131,15 +209,30 @@ class HttpServer {
     class ClientSession;
     std::vector<std::shared_ptr<ClientSession>> client_sessions_;
 
+    class WebSocketSession;
+    std::vector<std::shared_ptr<WebSocketSession>> websocket_sessions_;
+
     boost::asio::io_context& io_context_;
+    mutable std::mutex sessions_mutex_;  // Protects client_sessions_ and websocket_sessions_, which workers modify
+
+    size_t num_worker_threads_ = 0;
+    std::unique_ptr<boost::asio::io_context> worker_context_;  // Kept across restarts, sockets might still refer to it
+    std::optional<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> worker_work_guard_;
+    std::vector<std::thread> worker_threads_;
 
     HttpRouter<Handler> router_;
+    HttpRouter<WebSocketHandler> websocket_router_;
 
+    [[nodiscard]] boost::asio::any_io_executor get_listener_executor() const;
+    [[nodiscard]] boost::asio::any_io_executor make_session_executor() const;
+    void stop_workers();
     void on_accept(boost::asio::ip::tcp::socket socket);
     void on_listener_error(const boost::beast::error_code& ec, std::string_view what) const;
     void on_client_error(const boost::beast::error_code& ec, std::string_view what) const;
     boost::beast::http::message_generator on_request(const boost::beast::http::request<boost::beast::http::string_body>&);
     void remove_client_session(const ClientSession* session);
+    void on_websocket_upgrade(boost::asio::ip::tcp::socket socket, Request request);
+    void remove_websocket_session(const WebSocketSession* session);
 };
 
 }  // namespace rav
@@ -45,6 +45,14 @@ class AtomicRwLock {
     /// The number of iterations after which a function will start sleeping.
     static constexpr uint32_t k_sleep_threshold = 10'000;
 
+    /// Counts how often locking failed, to make contention between the realtime and non-realtime side measurable.
+    struct ContentionCounters {
+        /// The number of times a shared lock couldn't be acquired.
+        uint64_t failed_shared_locks {};
+        /// The number of times an exclusive lock couldn't be acquired.
+        uint64_t failed_exclusive_locks {};
+    };
+
     /// Exclusive unlock function.
     struct Exclusive {
         static void unlock(AtomicRwLock* lock) {
@@ -110,6 +118,7 @@ class AtomicRwLock {
             if (readers.compare_exchange_strong(waiting_state, k_exclusive_lock_bit, std::memory_order_acq_rel)) {
                 return AccessGuard<Exclusive>(this);
             }
+            failed_exclusive_locks_.fetch_add(1, std::memory_order_relaxed);
 
             if (i >= k_sleep_threshold) {
                 std::this_thread::sleep_for(std::chrono::milliseconds(10));
@@ -136,6 +145,7 @@ class AtomicRwLock {
         if (readers.compare_exchange_strong(e, k_exclusive_lock_bit, std::memory_order_acq_rel)) {
             return AccessGuard<Exclusive>(this);
         }
+        failed_exclusive_locks_.fetch_add(1, std::memory_order_relaxed);
         return AccessGuard<Exclusive>(nullptr);
     }
 
@@ -172,18 +182,33 @@ class AtomicRwLock {
         uint32_t prev_readers = readers.load(std::memory_order_acquire);
 
         if (prev_readers >= k_readers_mask) {
+            failed_shared_locks_.fetch_add(1, std::memory_order_relaxed);
             return AccessGuard<Shared>(nullptr);
         }
 
         prev_readers = readers.fetch_add(1, std::memory_order_acq_rel);
         if (prev_readers >= k_readers_mask) {
             readers.fetch_sub(1, std::memory_order_release);
+            failed_shared_locks_.fetch_add(1, std::memory_order_relaxed);
             return AccessGuard<Shared>(nullptr);
         }
 
         return AccessGuard<Shared>(this);
     }
 
+    /**
+     * Every failed attempt counts, including the attempts made by lock_shared() and lock_exclusive() while spinning.
+     * Thread safe: yes
+     * Wait-free: yes
+     * @return The number of failed lock attempts since construction.
+     */
+    [[nodiscard]] ContentionCounters get_contention_counters() const {
+        return {
+            failed_shared_locks_.load(std::memory_order_relaxed),
+            failed_exclusive_locks_.load(std::memory_order_relaxed),
+        };
+    }
+
     /**
      * @return True if shared locked. This is a relaxed check and cannot be used to draw any conclusions.
      */
@@ -210,6 +235,8 @@ class AtomicRwLock {
     static constexpr uint32_t k_exclusive_lock_waiting_bit = 1u << 31;
     static constexpr uint32_t k_readers_mask = 0xFFFFFF;
     std::atomic<uint32_t> readers {0};
+    std::atomic<uint64_t> failed_shared_locks_ {0};
+    std::atomic<uint64_t> failed_exclusive_locks_ {0};
 
     /**
      * Releases the exclusive lock. Only call this when a successful call to lock_exclusive or try_lock_exclusive was
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "ravennakit/core/log.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace rav {
+
+/**
+ * Generation based protection of shared state, in the spirit of read-copy-update. Readers enter a read section which
+ * never fails and never waits, and see the state as it was published when they looked at it. Writers never modify state
+ * which readers might be looking at: they unpublish (or replace) it first and then call synchronize(), which waits for a
+ * grace period in which every read section that could have seen the old state has ended. After that, the old state can
+ * be retired or reused.
+ *
+ * Internally readers are counted per generation parity. A grace period flips the generation twice, each time waiting
+ * for the readers of the previous parity to leave, which also catches readers that loaded the generation just before a
+ * flip.
+ */
+class Epoch {
+  public:
+    /// The max number of tries before giving up (preventing runaway code).
+    static constexpr size_t k_loop_upper_bound = 1'000'000;
+
+    /// The number of iterations after which a function will start yielding.
+    static constexpr uint32_t k_yield_threshold = 10;
+
+    /// The number of iterations after which a function will start sleeping.
+    static constexpr uint32_t k_sleep_threshold = 10'000;
+
+    /// Keeps a read section open for as long as it is alive.
+    class ReadGuard {
+      public:
+        explicit ReadGuard(std::atomic<uint32_t>* readers) : readers_(readers) {}
+
+        ~ReadGuard() {
+            if (readers_) {
+                readers_->fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        ReadGuard(ReadGuard&& other) noexcept : readers_(std::exchange(other.readers_, nullptr)) {}
+        ReadGuard& operator=(ReadGuard&& other) noexcept = delete;
+
+      private:
+        std::atomic<uint32_t>* readers_ {};
+    };
+
+    Epoch() = default;
+
+    Epoch(const Epoch&) = delete;
+    Epoch& operator=(const Epoch&) = delete;
+
+    Epoch(Epoch&&) = delete;
+    Epoch& operator=(Epoch&&) = delete;
+
+    /**
+     * Enters a read section. Shared state loaded while the returned guard is alive stays valid until the guard goes out
+     * of scope.
+     * Thread safe: yes
+     * Wait-free: yes
+     * @return A guard which keeps the read section open as long as it's alive.
+     */
+    [[nodiscard]] ReadGuard enter() {
+        auto& readers = readers_[generation_.load(std::memory_order_acquire) & 1].count;
+        readers.fetch_add(1, std::memory_order_relaxed);
+        // Pairs with the fence in synchronize(): either the writer sees this reader, or this reader sees the writer's
+        // changes to the shared state.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return ReadGuard(&readers);
+    }
+
+    /**
+     * Waits until all read sections which were open when this function was called have ended. Call this after
+     * unpublishing state and before retiring it.
+     * Thread safe: yes
+     * Wait-free: no
+     * @return True if the grace period has passed, or false if the loop upper bound was reached while waiting.
+     */
+    [[nodiscard]] bool synchronize() {
+        std::lock_guard lock(mutex_);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        for (int flip = 0; flip < 2; ++flip) {
+            const auto previous = generation_.fetch_add(1, std::memory_order_acq_rel);
+            if (!wait_for_readers_to_leave(readers_[previous & 1].count)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @return The current generation, which advances by two for every grace period.
+     */
+    [[nodiscard]] uint64_t generation() const {
+        return generation_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return True if any read section is open. This is a relaxed check and cannot be used to draw any conclusions.
+     */
+    [[nodiscard]] bool has_readers() const {
+        return readers_[0].count.load(std::memory_order_relaxed) + readers_[1].count.load(std::memory_order_relaxed) > 0;
+    }
+
+  private:
+    struct alignas(64) Readers {
+        std::atomic<uint32_t> count {0};
+    };
+
+    std::atomic<uint64_t> generation_ {0};
+    std::array<Readers, 2> readers_ {};
+    std::mutex mutex_;  // Serializes writers
+
+    static bool wait_for_readers_to_leave(const std::atomic<uint32_t>& readers) {
+        for (size_t i = 0; i < k_loop_upper_bound; ++i) {
+            if (readers.load(std::memory_order_acquire) == 0) {
+                return true;
+            }
+
+            if (i >= k_sleep_threshold) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            } else if (i >= k_yield_threshold) {
+                std::this_thread::yield();
+            }
+        }
+
+        RAV_LOG_ERROR("Loop upper bound reached");
+        return false;
+    }
+};
+
+}  // namespace rav
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "ravennakit/core/assert.hpp"
+
+#include <array>
+#include <atomic>
+#include <optional>
+
+namespace rav {
+
+/**
+ * A variant of RealtimeSharedObject which keeps multiple versions of the object around, so that any number of realtime
+ * threads can access the object at the same time and updates never have to wait for them. Each version counts its
+ * readers. An update writes into a version which no reader is using and publishes it; the versions it replaces are
+ * retired and their values are only destroyed on the non-realtime side (during a later update or reclaim()), once no
+ * reader uses them anymore.
+ * @tparam T The type of the object to share.
+ * @tparam NumVersions The number of versions to keep. Updates fail while every version other than the current one is
+ * still being read, so this should be at least the number of realtime threads plus two.
+ */
+template<class T, size_t NumVersions = 4>
+class MultiVersionRealtimeSharedObject {
+  public:
+    static_assert(NumVersions >= 2, "At least two versions are needed");
+
+    /**
+     * A guard object provides access to the value. The object is used to access the value in a real-time safe way.
+     */
+    class RealtimeAccessGuard {
+      public:
+        explicit RealtimeAccessGuard(MultiVersionRealtimeSharedObject& owner) {
+            while (true) {
+                const auto index = owner.current_.load(std::memory_order_acquire);
+                auto& version = owner.versions_[index];
+                version.readers.fetch_add(1, std::memory_order_seq_cst);
+
+                // The version might have been retired (and even reused) in between, in which case it's not ours to read.
+                if (owner.current_.load(std::memory_order_seq_cst) == index) {
+                    version_ = &version;
+                    return;
+                }
+
+                version.readers.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        ~RealtimeAccessGuard() {
+            reset();
+        }
+
+        RealtimeAccessGuard(const RealtimeAccessGuard&) = delete;
+        RealtimeAccessGuard& operator=(const RealtimeAccessGuard&) = delete;
+        RealtimeAccessGuard(RealtimeAccessGuard&&) = delete;
+        RealtimeAccessGuard& operator=(RealtimeAccessGuard&&) = delete;
+
+        /**
+         * @return A pointer to the contained object, or nullptr if the guard was reset.
+         */
+        const T* get() const {
+            return version_ ? &*version_->value : nullptr;
+        }
+
+        /**
+         * @return A reference to the contained object. Reference is only valid if the guard was not reset.
+         */
+        const T& operator*() const {
+            RAV_ASSERT_DEBUG(version_ != nullptr, "Guard was reset");
+            return *version_->value;
+        }
+
+        /**
+         * @return A pointer to the contained object, or nullptr if the guard was reset.
+         */
+        const T* operator->() const {
+            RAV_ASSERT_DEBUG(version_ != nullptr, "Guard was reset");
+            return get();
+        }
+
+        /**
+         * Releases the version this guard is reading.
+         */
+        void reset() {
+            if (version_) {
+                version_->readers.fetch_sub(1, std::memory_order_release);
+                version_ = nullptr;
+            }
+        }
+
+      private:
+        typename MultiVersionRealtimeSharedObject::Version* version_ {};
+    };
+
+    /**
+     * Default constructor.
+     */
+    MultiVersionRealtimeSharedObject() {
+        versions_[0].value.emplace();
+    }
+
+    /**
+     * @param initial_value Initial value to set.
+     */
+    explicit MultiVersionRealtimeSharedObject(T initial_value) {
+        versions_[0].value.emplace(std::move(initial_value));
+    }
+
+    ~MultiVersionRealtimeSharedObject() {
+        for (auto& version : versions_) {
+            RAV_ASSERT_NO_THROW(version.readers.load() == 0, "There should be no active readers");
+        }
+    }
+
+    MultiVersionRealtimeSharedObject(const MultiVersionRealtimeSharedObject&) = delete;
+    MultiVersionRealtimeSharedObject& operator=(const MultiVersionRealtimeSharedObject&) = delete;
+    MultiVersionRealtimeSharedObject(MultiVersionRealtimeSharedObject&&) = delete;
+    MultiVersionRealtimeSharedObject& operator=(MultiVersionRealtimeSharedObject&&) = delete;
+
+    /**
+     * @return A guard for realtime access to the current value. Updates made during the lifetime of the guard are not
+     * visible through it, and don't have to wait for it.
+     * Real-time safe: yes, lock-free (retries only when an update is published at the same time)
+     * Thread safe: yes
+     */
+    [[nodiscard]] RealtimeAccessGuard access_realtime() {
+        return RealtimeAccessGuard(*this);
+    }
+
+    /**
+     * Publishes a new value. Never waits for readers: the value is written into a version which no reader is using.
+     * Values of retired versions are destroyed here when no longer in use.
+     * Real-time safe: no
+     * Thread safe: no (call from a single non-realtime thread)
+     * @param value The new value to share with the realtime threads.
+     * @return True if the value was published, or false if every other version is still being read.
+     */
+    [[nodiscard]] bool update(T value) {
+        reclaim();
+
+        const auto current = current_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < NumVersions; ++i) {
+            if (i == current || versions_[i].readers.load(std::memory_order_seq_cst) != 0) {
+                continue;
+            }
+            versions_[i].value = std::move(value);
+            current_.store(i, std::memory_order_seq_cst);
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * Resets the object to contain a new, default constructed object.
+     * @return True if resetting succeeded, or false if not.
+     */
+    [[nodiscard]] bool reset() {
+        return update(T {});
+    }
+
+    /**
+     * Destroys the values of retired versions which are no longer being read.
+     * Real-time safe: no
+     * Thread safe: no (call from the thread which updates)
+     * @return The number of retired values which are still being read.
+     */
+    size_t reclaim() {
+        size_t num_in_use = 0;
+        const auto current = current_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < NumVersions; ++i) {
+            if (i == current || !versions_[i].value.has_value()) {
+                continue;
+            }
+            if (versions_[i].readers.load(std::memory_order_seq_cst) != 0) {
+                num_in_use++;
+                continue;
+            }
+            versions_[i].value.reset();
+        }
+        return num_in_use;
+    }
+
+  private:
+    struct Version {
+        alignas(64) std::atomic<uint32_t> readers {0};
+        alignas(64) std::optional<T> value;  // On its own cache line, to not be disturbed by the reader count
+    };
+
+    std::array<Version, NumVersions> versions_ {};
+    std::atomic<size_t> current_ {0};
+};
+
+}  // namespace rav
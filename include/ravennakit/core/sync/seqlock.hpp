@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+
+namespace rav {
+
+/**
+ * A sequence lock for publishing a trivially copyable value from a single writer to any number of readers. Writing is
+ * wait-free and never blocked by readers. Reading is lock-free: a reader retries when it overlaps with a write and gives
+ * up after a bounded number of attempts.
+ * The value is stored as relaxed atomic words so that a torn read (which is detected and discarded) is not a data race.
+ * @tparam T The type of the value. Must be trivially copyable.
+ */
+template<class T>
+class SeqLock {
+  public:
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+    static_assert(std::is_default_constructible_v<T>, "T must be default constructible");
+
+    /// The max number of attempts for a reader before giving up.
+    static constexpr size_t k_max_read_attempts = 100;
+
+    SeqLock() {
+        write(T {});
+    }
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    SeqLock(SeqLock&&) = delete;
+    SeqLock& operator=(SeqLock&&) = delete;
+
+    /**
+     * Publishes a new value.
+     * Thread safe: only when called from a single writer thread.
+     * Wait-free: yes
+     * @param value The value to publish.
+     */
+    void write(const T& value) {
+        std::array<uint64_t, k_num_words> words {};
+        std::memcpy(words.data(), std::addressof(value), sizeof(T));
+
+        const auto sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);  // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (size_t i = 0; i < k_num_words; ++i) {
+            words_[i].store(words[i], std::memory_order_relaxed);
+        }
+
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * Reads the most recently published value.
+     * Thread safe: yes
+     * Wait-free: no, but lock-free and bounded.
+     * @return The value, or nullopt if the writer kept interfering for k_max_read_attempts attempts.
+     */
+    [[nodiscard]] std::optional<T> read() const {
+        for (size_t attempt = 0; attempt < k_max_read_attempts; ++attempt) {
+            const auto before = sequence_.load(std::memory_order_acquire);
+            if (before & 1) {
+                continue;  // Write in progress
+            }
+
+            std::array<uint64_t, k_num_words> words {};
+            for (size_t i = 0; i < k_num_words; ++i) {
+                words[i] = words_[i].load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) != before) {
+                continue;  // Torn read
+            }
+
+            T value;
+            std::memcpy(static_cast<void*>(std::addressof(value)), words.data(), sizeof(T));
+            return value;
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * Reads the most recently published value, but only if it was published after the value the caller has seen last.
+     * Thread safe: yes
+     * Wait-free: no, but lock-free and bounded.
+     * @param last_sequence The sequence of the value the caller has seen last, updated when a newer value is returned.
+     * Start with zero to also get the initial value.
+     * @return The value, or nullopt if nothing was published since or the writer kept interfering.
+     */
+    [[nodiscard]] std::optional<T> read_if_changed(uint32_t& last_sequence) const {
+        for (size_t attempt = 0; attempt < k_max_read_attempts; ++attempt) {
+            const auto before = sequence_.load(std::memory_order_acquire);
+            if (before == last_sequence) {
+                return std::nullopt;
+            }
+            if (before & 1) {
+                continue;  // Write in progress
+            }
+
+            std::array<uint64_t, k_num_words> words {};
+            for (size_t i = 0; i < k_num_words; ++i) {
+                words[i] = words_[i].load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) != before) {
+                continue;  // Torn read
+            }
+
+            T value;
+            std::memcpy(static_cast<void*>(std::addressof(value)), words.data(), sizeof(T));
+            last_sequence = before;
+            return value;
+        }
+
+        return std::nullopt;
+    }
+
+  private:
+    static constexpr size_t k_num_words = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<uint32_t> sequence_ {};
+    std::array<std::atomic<uint64_t>, k_num_words> words_ {};
+};
+
+}  // namespace rav
@@ -24,10 +24,12 @@
 
 #pragma once
 
+#include "ravennakit/core/assert.hpp"
 #include "ravennakit/core/string_parser.hpp"
 
-#include <map>
 #include <string_view>
+#include <utility>
+#include <boost/container/static_vector.hpp>
 #include <boost/system/result.hpp>
 #include <fmt/ostream.h>
 
@@ -53,16 +55,34 @@ class PathMatcher {
 
     /**
      * Contains parameters extracted from a path with convenience functions to convert to integers.
+     * Names and values are stored as views: names refer to the pattern (or the compiled route) and values refer to the
+     * matched path. Both must outlive the Parameters instance. Storage is fixed in size, so filling parameters never
+     * allocates.
      */
     class Parameters {
       public:
+        /// The maximum number of parameters which can be stored.
+        static constexpr size_t k_max_parameters = 8;
+
+        using Container = boost::container::static_vector<std::pair<std::string_view, std::string_view>, k_max_parameters>;
+
         /**
-         * Set a parameter with the given name and value.
-         * @param name The parameter name (e.g. "id" in "{id}").
-         * @param value The parameter value.
+         * Set a parameter with the given name and value. An existing parameter with the same name is overwritten.
+         * @param name The parameter name (e.g. "id" in "{id}"). Must outlive this object.
+         * @param value The parameter value. Must outlive this object.
          */
         void set(const std::string_view name, const std::string_view value) {
-            parameters_[std::string(name)] = std::string(value);
+            for (auto& parameter : parameters_) {
+                if (parameter.first == name) {
+                    parameter.second = value;
+                    return;
+                }
+            }
+            if (parameters_.size() >= k_max_parameters) {
+                RAV_ASSERT_FALSE("Too many parameters");
+                return;
+            }
+            parameters_.emplace_back(name, value);
         }
 
         /**
@@ -70,10 +90,11 @@ class PathMatcher {
          * @param name The parameter name (e.g. "id" in "{id}").
          * @return The parameter value, or nullptr if the parameter was not found.
          */
-        [[nodiscard]] const std::string* get(const std::string_view name) const {
-            const auto it = parameters_.find(std::string(name));
-            if (it != parameters_.end()) {
-                return &it->second;
+        [[nodiscard]] const std::string_view* get(const std::string_view name) const {
+            for (const auto& parameter : parameters_) {
+                if (parameter.first == name) {
+                    return &parameter.second;
+                }
             }
             return nullptr;
         }
@@ -87,18 +108,17 @@ class PathMatcher {
          */
         template<typename T>
         std::enable_if_t<std::is_integral_v<T>, std::optional<T>> get_as(const std::string_view name) const {
-            const auto it = parameters_.find(std::string(name));
-            if (it != parameters_.end()) {
-                return string_to_int<T>(it->second);
+            if (const auto* value = get(name)) {
+                return string_to_int<T>(*value);
             }
             return std::nullopt;
         }
 
         /**
-         * Get all parameters as a map.
-         * @return A map of parameter names to values.
+         * Get all parameters in the order they were set.
+         * @return The (name, value) pairs.
          */
-        [[nodiscard]] const std::map<std::string, std::string>& get_all() const {
+        [[nodiscard]] const Container& get_all() const {
             return parameters_;
         }
 
@@ -117,7 +137,7 @@ class PathMatcher {
         }
 
       private:
-        std::map<std::string, std::string> parameters_;  // name => value
+        Container parameters_;  // name => value
     };
 
     /**
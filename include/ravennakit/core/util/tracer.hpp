@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "ravennakit/core/clock.hpp"
+#include "ravennakit/core/platform.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define RAV_TRACER_USE_TSC 1
+    #if RAV_WINDOWS
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+#else
+    #define RAV_TRACER_USE_TSC 0
+#endif
+
+namespace rav {
+
+/**
+ * Built-in tracing which is always compiled in and can be enabled at runtime. Every thread which records events gets a
+ * fixed size ring of events which overwrites the oldest events when full, so the rings always hold the most recent
+ * history. Recording an event takes a timestamp (rdtsc where available) and writes a few words into the ring of the
+ * calling thread: no locks, no allocations (after the first event of a thread) and no system calls. When tracing is
+ * disabled, recording costs a single relaxed load.
+ *
+ * The contents of the rings can be exported in the Chrome trace event format at any time, which can be opened in
+ * chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Names must have static storage duration (string literals, __func__), because only the pointer is stored.
+ */
+class Tracer {
+  public:
+    /// The number of events each thread keeps.
+    static constexpr size_t k_events_per_thread = 8192;
+
+    /// The number of rings of finished threads which are kept before they get reused.
+    static constexpr size_t k_max_finished_threads = 16;
+
+    enum class EventType : uint64_t { zone_begin, zone_end, plot, counter, message };
+
+    /// An event as returned by get_events().
+    struct Event {
+        uint64_t timestamp_ns {};
+        const char* name {};
+        EventType type {};
+        double value {};
+        uint32_t thread_id {};
+    };
+
+    /**
+     * Records the begin of a zone when constructed and the end when destroyed, if tracing was enabled at construction.
+     */
+    class Zone {
+      public:
+        explicit Zone(const char* name) {
+            if (is_enabled()) {
+                name_ = name;
+                record(EventType::zone_begin, name, 0);
+            }
+        }
+
+        ~Zone() {
+            if (name_ != nullptr) {
+                record(EventType::zone_end, name_, 0);
+            }
+        }
+
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+
+        Zone(Zone&&) = delete;
+        Zone& operator=(Zone&&) = delete;
+
+      private:
+        const char* name_ {};
+    };
+
+    /**
+     * @return True if tracing is enabled.
+     */
+    static bool is_enabled() {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Enables or disables tracing. Events recorded so far are kept.
+     * @param enabled True to enable.
+     */
+    static void set_enabled(bool enabled);
+
+    /**
+     * Records a plot value, shown as a graph.
+     * @param name The name of the plot.
+     * @param value The value.
+     */
+    static void plot(const char* name, const double value) {
+        if (is_enabled()) {
+            record(EventType::plot, name, to_bits(value));
+        }
+    }
+
+    /**
+     * Records a counter value, shown as a graph.
+     * @param name The name of the counter.
+     * @param value The value.
+     */
+    static void counter(const char* name, const int64_t value) {
+        if (is_enabled()) {
+            record(EventType::counter, name, static_cast<uint64_t>(value));
+        }
+    }
+
+    /**
+     * Records an instant event.
+     * @param message The message.
+     */
+    static void message(const char* message) {
+        if (is_enabled()) {
+            record(EventType::message, message, 0);
+        }
+    }
+
+    /**
+     * Sets the name of the calling thread, as shown in the exported trace.
+     * @param name The name. Copied.
+     */
+    static void set_thread_name(const char* name);
+
+    /**
+     * Makes sure the calling thread has a ring, so that the first event of this thread doesn't allocate.
+     */
+    static void prepare_thread();
+
+    /**
+     * Discards all recorded events.
+     */
+    static void clear();
+
+    /**
+     * @return The recorded events of all threads, ordered by thread and time. Can be called while events are being
+     * recorded, in which case the oldest event of a ring might be left out.
+     */
+    static std::vector<Event> get_events();
+
+    /**
+     * @return The recorded events in the Chrome trace event format (JSON).
+     */
+    static std::string export_chrome_trace();
+
+    /**
+     * Writes the recorded events in the Chrome trace event format to a file.
+     * @param path The path of the file.
+     * @return True if the file was written.
+     */
+    static bool write_chrome_trace(const std::string& path);
+
+    /**
+     * @return The current time in ticks of the trace clock.
+     */
+    static uint64_t now_ticks() {
+#if RAV_TRACER_USE_TSC
+        return __rdtsc();
+#else
+        return clock::now_monotonic_high_resolution_ns();
+#endif
+    }
+
+  private:
+    class Ring;
+    friend struct TracerRegistry;
+
+    static std::atomic<bool> enabled_;
+    static inline thread_local Ring* thread_ring_ = nullptr;
+
+    static void record(const EventType type, const char* name, const uint64_t value) {
+        auto* ring = thread_ring_;
+        if (ring == nullptr) {
+            ring = register_thread();
+        }
+        write_event(ring, now_ticks(), type, name, value);
+    }
+
+    static Ring* register_thread();
+    static void write_event(Ring* ring, uint64_t ticks, EventType type, const char* name, uint64_t value);
+
+    static uint64_t to_bits(const double value) {
+        uint64_t bits {};
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+};
+
+}  // namespace rav
+
+#define RAV_TRACE_CONCAT_INNER(a, b) a##b
+#define RAV_TRACE_CONCAT(a, b) RAV_TRACE_CONCAT_INNER(a, b)
+
+/// Records a zone spanning the rest of the current scope.
+#define RAV_TRACE_ZONE(name) const ::rav::Tracer::Zone RAV_TRACE_CONCAT(rav_trace_zone_, __LINE__)(name)
+
+/// Records a zone named after the current function, spanning the rest of the current scope.
+#define RAV_TRACE_FUNCTION() RAV_TRACE_ZONE(__func__)
+
+/// Records a value of a plot. The value is only evaluated when tracing is enabled.
+#define RAV_TRACE_PLOT(name, value) \
+    (::rav::Tracer::is_enabled() ? ::rav::Tracer::plot(name, static_cast<double>(value)) : static_cast<void>(0))
+
+/// Records a value of a counter. The value is only evaluated when tracing is enabled.
+#define RAV_TRACE_COUNTER(name, value) \
+    (::rav::Tracer::is_enabled() ? ::rav::Tracer::counter(name, static_cast<int64_t>(value)) : static_cast<void>(0))
+
+/// Records an instant event.
+#define RAV_TRACE_MESSAGE(text) ::rav::Tracer::message(text)
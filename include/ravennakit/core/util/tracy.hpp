@@ -27,6 +27,11 @@
 #include "ravennakit/core/warnings.hpp"
 #include "ravennakit/core/platform.hpp"
 
+#include "ravennakit/core/util/tracer.hpp"
+
+// The TRACY_* macros always record into the built-in rav::Tracer (which can be enabled at runtime), and additionally
+// into Tracy when it is compiled in.
+
 #if defined(TRACY_ENABLE) && TRACY_ENABLE
     #if RAV_APPLE
         #define TracyFunction __PRETTY_FUNCTION__
@@ -36,17 +41,37 @@ RAV_BEGIN_IGNORE_WARNINGS
     #include <tracy/Tracy.hpp>
 RAV_END_IGNORE_WARNINGS
 
-    #define TRACY_ZONE_SCOPED ZoneScoped  // NOLINT(bugprone-reserved-identifier)
-    #define TRACY_PLOT(name, value) TracyPlot(name, value)
-    #define TRACY_MESSAGE(message) TracyMessageL(message)
-    #define TRACY_MESSAGE_COLOR(message, color) TracyMessageLC(message, color)
-    #define TRACY_SET_THREAD_NAME(name) tracy::SetThreadName(name)
+    // Declares two scope guards, so this can't be wrapped into a single statement.
+    #define TRACY_ZONE_SCOPED \
+        ZoneScoped;           \
+        RAV_TRACE_FUNCTION()  // NOLINT(bugprone-reserved-identifier)
+    #define TRACY_PLOT(name, value)                     \
+        do {                                            \
+            const auto rav_tracy_plot_value = (value);  \
+            TracyPlot(name, rav_tracy_plot_value);      \
+            RAV_TRACE_PLOT(name, rav_tracy_plot_value); \
+        } while (0)
+    #define TRACY_MESSAGE(message)      \
+        do {                            \
+            TracyMessageL(message);     \
+            RAV_TRACE_MESSAGE(message); \
+        } while (0)
+    #define TRACY_MESSAGE_COLOR(message, color) \
+        do {                                    \
+            TracyMessageLC(message, color);     \
+            RAV_TRACE_MESSAGE(message);         \
+        } while (0)
+    #define TRACY_SET_THREAD_NAME(name)           \
+        do {                                      \
+            tracy::SetThreadName(name);           \
+            ::rav::Tracer::set_thread_name(name); \
+        } while (0)
 #else
-    #define TRACY_ZONE_SCOPED
-    #define TRACY_PLOT(...)
-    #define TRACY_MESSAGE(...)
-    #define TRACY_MESSAGE_COLOR(...)
-    #define TRACY_SET_THREAD_NAME(...)
+    #define TRACY_ZONE_SCOPED RAV_TRACE_FUNCTION()
+    #define TRACY_PLOT(name, value) RAV_TRACE_PLOT(name, value)
+    #define TRACY_MESSAGE(message) RAV_TRACE_MESSAGE(message)
+    #define TRACY_MESSAGE_COLOR(message, color) RAV_TRACE_MESSAGE(message)
+    #define TRACY_SET_THREAD_NAME(name) ::rav::Tracer::set_thread_name(name)
 #endif
 
 namespace rav {
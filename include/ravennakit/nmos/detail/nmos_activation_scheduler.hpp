@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "ravennakit/core/assert.hpp"
+#include "ravennakit/core/json.hpp"
+#include "ravennakit/nmos/detail/nmos_timestamp.hpp"
+#include "ravennakit/nmos/models/nmos_activation_response.hpp"
+
+#include <boost/container_hash/hash.hpp>
+#include <boost/uuid/uuid.hpp>
+
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace rav::nmos {
+
+/**
+ * Holds the IS-05 activations which are scheduled for a moment on the PTP timeline, ordered by activation time. There
+ * is at most one pending activation per resource.
+ *
+ * The scheduler itself doesn't keep time. Its owner arms a single timer for next_activation_time() and collects the
+ * activations which are due with take_due() when it fires.
+ */
+class ActivationScheduler {
+  public:
+    static constexpr uint64_t k_nanoseconds_per_second = 1'000'000'000;
+
+    /**
+     * An activation waiting for its activation time.
+     */
+    struct ScheduledActivation {
+        /// The id of the sender or receiver to activate.
+        boost::uuids::uuid resource_id;
+
+        /// True if the resource is a sender, false if it's a receiver.
+        bool is_sender {};
+
+        /// The requested activation, with the activation_time set to the absolute time the activation will happen.
+        ActivationResponse activation;
+
+        /// The staged parameters (the PATCH request) to apply at activation.
+        boost::json::value patch_request;
+    };
+
+    /**
+     * Schedules an activation. Replaces a pending activation for the same resource.
+     * @param scheduled The activation. The activation_time must be set.
+     */
+    void schedule(ScheduledActivation scheduled) {
+        RAV_ASSERT(scheduled.activation.activation_time.has_value(), "Activation time must be set");
+        std::ignore = cancel(scheduled.resource_id);
+        const auto id = scheduled.resource_id;
+        timeline_.emplace(*scheduled.activation.activation_time, id);
+        pending_.emplace(id, std::move(scheduled));
+    }
+
+    /**
+     * Cancels the pending activation of a resource.
+     * @param resource_id The id of the resource.
+     * @return True if an activation was cancelled, false if there was no pending activation for the resource.
+     */
+    bool cancel(const boost::uuids::uuid& resource_id) {
+        const auto it = pending_.find(resource_id);
+        if (it == pending_.end()) {
+            return false;
+        }
+        auto [first, last] = timeline_.equal_range(*it->second.activation.activation_time);
+        for (; first != last; ++first) {
+            if (first->second == resource_id) {
+                timeline_.erase(first);
+                break;
+            }
+        }
+        pending_.erase(it);
+        return true;
+    }
+
+    /**
+     * @param resource_id The id of the resource.
+     * @return The pending activation of the resource, or nullptr if there is none.
+     */
+    [[nodiscard]] const ScheduledActivation* find(const boost::uuids::uuid& resource_id) const {
+        const auto it = pending_.find(resource_id);
+        return it != pending_.end() ? &it->second : nullptr;
+    }
+
+    /**
+     * @return The time of the earliest pending activation, or nullopt if nothing is scheduled.
+     */
+    [[nodiscard]] std::optional<Timestamp> next_activation_time() const {
+        if (timeline_.empty()) {
+            return std::nullopt;
+        }
+        return timeline_.begin()->first;
+    }
+
+    /**
+     * Removes and returns the activations which are due.
+     * @param now The current PTP time.
+     * @return The activations with an activation time at or before now, in order of activation time.
+     */
+    std::vector<ScheduledActivation> take_due(const Timestamp& now) {
+        std::vector<ScheduledActivation> due;
+        while (!timeline_.empty() && timeline_.begin()->first <= now) {
+            const auto it = pending_.find(timeline_.begin()->second);
+            RAV_ASSERT(it != pending_.end(), "Timeline and pending activations are out of sync");
+            due.push_back(std::move(it->second));
+            pending_.erase(it);
+            timeline_.erase(timeline_.begin());
+        }
+        return due;
+    }
+
+    /**
+     * @return The number of pending activations.
+     */
+    [[nodiscard]] size_t size() const {
+        return pending_.size();
+    }
+
+    /**
+     * Cancels all pending activations.
+     */
+    void clear() {
+        timeline_.clear();
+        pending_.clear();
+    }
+
+    /**
+     * Resolves the requested time of an activation to an absolute time on the PTP timeline.
+     * @param activation The requested activation.
+     * @param now The current PTP time, used for immediate and relative activations.
+     * @return The absolute activation time, or nullopt if the activation has no mode or a scheduled activation has no
+     * requested time.
+     */
+    [[nodiscard]] static std::optional<Timestamp> resolve_activation_time(const Activation& activation, const Timestamp& now) {
+        if (!activation.mode.has_value()) {
+            return std::nullopt;
+        }
+        switch (*activation.mode) {
+            case Activation::Mode::activate_immediate:
+                return now;
+            case Activation::Mode::activate_scheduled_absolute:
+                return activation.requested_time;
+            case Activation::Mode::activate_scheduled_relative:
+                if (!activation.requested_time.has_value()) {
+                    return std::nullopt;
+                }
+                return from_nanoseconds(to_nanoseconds(now) + to_nanoseconds(*activation.requested_time));
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * Moves a time forward to the next packet boundary of a stream which is clocked from the PTP timeline (as in AES67,
+     * where the RTP timestamp is the number of media clock ticks since the PTP epoch plus the media clock offset).
+     * @param time The time to align.
+     * @param clock_rate The media clock rate (the sample rate).
+     * @param frames_per_packet The number of frames in a packet.
+     * @param media_clock_offset The offset of the media clock, in media clock ticks (mediaclk:direct=<offset>).
+     * @return The first time at or after the given time at which a packet starts.
+     */
+    [[nodiscard]] static Timestamp align_to_packet_boundary(
+        const Timestamp& time, const uint32_t clock_rate, const uint32_t frames_per_packet, const int64_t media_clock_offset
+    ) {
+        if (clock_rate == 0 || frames_per_packet == 0) {
+            return time;
+        }
+
+        // Split in seconds and nanoseconds to keep the intermediate values within 64 bits
+        auto ticks = time.seconds * clock_rate + ceil_div(uint64_t {time.nanoseconds} * clock_rate, k_nanoseconds_per_second);
+
+        const auto offset = static_cast<uint64_t>(media_clock_offset % frames_per_packet + frames_per_packet) % frames_per_packet;
+        const auto remainder = (ticks + offset) % frames_per_packet;
+        if (remainder != 0) {
+            ticks += frames_per_packet - remainder;
+        }
+
+        const auto nanoseconds = ceil_div(ticks % clock_rate * k_nanoseconds_per_second, clock_rate);
+        if (nanoseconds >= k_nanoseconds_per_second) {
+            return {ticks / clock_rate + 1, 0};
+        }
+        return {ticks / clock_rate, static_cast<uint32_t>(nanoseconds)};
+    }
+
+    /**
+     * @param time The time.
+     * @return The time in nanoseconds.
+     */
+    [[nodiscard]] static uint64_t to_nanoseconds(const Timestamp& time) {
+        return time.seconds * k_nanoseconds_per_second + time.nanoseconds;
+    }
+
+    /**
+     * @param nanoseconds The time in nanoseconds.
+     * @return The time as timestamp.
+     */
+    [[nodiscard]] static Timestamp from_nanoseconds(const uint64_t nanoseconds) {
+        return {nanoseconds / k_nanoseconds_per_second, static_cast<uint32_t>(nanoseconds % k_nanoseconds_per_second)};
+    }
+
+  private:
+    std::multimap<Timestamp, boost::uuids::uuid> timeline_;
+    std::unordered_map<boost::uuids::uuid, ScheduledActivation, boost::hash<boost::uuids::uuid>> pending_;
+
+    static uint64_t ceil_div(const uint64_t numerator, const uint64_t denominator) {
+        return (numerator + denominator - 1) / denominator;
+    }
+};
+
+}  // namespace rav::nmos
@@ -0,0 +1,215 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "nmos_timestamp.hpp"
+#include "ravennakit/core/json_writer.hpp"
+
+#include <boost/container_hash/hash.hpp>
+#include <boost/uuid/uuid.hpp>
+#include <fmt/format.h>
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rav::nmos {
+
+/**
+ * Caches the serialized JSON representation of NMOS resources, so that repeated requests for the same resource (or
+ * collection of resources) cost a copy instead of building and serializing a JSON value.
+ *
+ * Entries are keyed on the resource id and are invalidated when the version of the resource changes. This relies on the
+ * rule that the version of a resource must be updated whenever any of its attributes change.
+ */
+class ResourceCache {
+  public:
+    /**
+     * A serialized representation together with its entity tag.
+     */
+    struct Entry {
+        /// The serialized JSON.
+        std::string json;
+
+        /// A strong entity tag for the JSON, including the surrounding quotes (as used in the ETag header).
+        std::string etag;
+    };
+
+    /**
+     * Gets the serialized representation of the given resource, serializing it if the cached version is out of date.
+     * @tparam Resource The type of the resource, must have an id, a version and be writable with a JsonWriter.
+     * @param resource The resource.
+     * @return The cached entry. Stays valid until the resource is erased or the cache is cleared.
+     */
+    template<class Resource>
+    const Entry& get(const Resource& resource) {
+        auto& cached = resources_[resource.id];
+        if (!cached.valid || cached.version != resource.version) {
+            cached.entry.json.clear();  // Keeps the capacity of the previous version
+            serialize_json(resource, cached.entry.json);
+            cached.entry.etag = make_etag(cached.entry.json);
+            cached.version = resource.version;
+            cached.valid = true;
+        }
+        return cached.entry;
+    }
+
+    /**
+     * Gets the serialized representation of a collection of resources (a JSON array), rebuilding it from the cached
+     * resources if any resource was added, removed or changed since the last call.
+     * @tparam Resource The type of the resources.
+     * @param name The name of the collection (e.g. "senders").
+     * @param resources The resources in the collection.
+     * @return The cached entry. Stays valid until the cache is cleared.
+     */
+    template<class Resource>
+    const Entry& get_collection(const std::string_view name, const std::vector<Resource*>& resources) {
+        auto it = collections_.find(name);
+        if (it == collections_.end()) {
+            it = collections_.emplace(std::string(name), Collection {}).first;
+        }
+        auto& collection = it->second;
+
+        if (collection.valid && is_up_to_date(collection, resources)) {
+            return collection.entry;
+        }
+
+        collection.signature.clear();
+        collection.entry.json.clear();
+        collection.entry.json.push_back('[');
+        for (const auto* resource : resources) {
+            if (collection.entry.json.size() > 1) {
+                collection.entry.json.push_back(',');
+            }
+            collection.entry.json.append(get(*resource).json);
+            collection.signature.emplace_back(resource->id, resource->version);
+        }
+        collection.entry.json.push_back(']');
+        collection.entry.etag = make_etag(collection.entry.json);
+        collection.valid = true;
+        return collection.entry;
+    }
+
+    /**
+     * Removes the cached representation of the resource with the given id.
+     * @param id The id of the resource.
+     */
+    void erase(const boost::uuids::uuid& id) {
+        resources_.erase(id);
+    }
+
+    /**
+     * Removes all cached representations.
+     */
+    void clear() {
+        resources_.clear();
+        collections_.clear();
+    }
+
+    /**
+     * @return The number of cached resources.
+     */
+    [[nodiscard]] size_t size() const {
+        return resources_.size();
+    }
+
+    /**
+     * Tests whether the value of an If-None-Match header matches the given entity tag, using weak comparison as
+     * required for If-None-Match (RFC 9110 section 13.1.2).
+     * @param if_none_match The value of the If-None-Match header (e.g. `"abc", W/"def"` or `*`).
+     * @param etag The entity tag to compare against, including the quotes.
+     * @return True if the header matches, in which case a 304 Not Modified response can be sent.
+     */
+    [[nodiscard]] static bool etag_matches(std::string_view if_none_match, const std::string_view etag) {
+        while (!if_none_match.empty()) {
+            const auto pos = if_none_match.find(',');
+            auto tag = if_none_match.substr(0, pos);
+            if_none_match = pos == std::string_view::npos ? std::string_view() : if_none_match.substr(pos + 1);
+
+            while (!tag.empty() && (tag.front() == ' ' || tag.front() == '\t')) {
+                tag.remove_prefix(1);
+            }
+            while (!tag.empty() && (tag.back() == ' ' || tag.back() == '\t')) {
+                tag.remove_suffix(1);
+            }
+            if (tag == "*") {
+                return true;
+            }
+            if (tag.substr(0, 2) == "W/") {
+                tag.remove_prefix(2);
+            }
+            if (!tag.empty() && tag == etag) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+  private:
+    struct CachedResource {
+        Version version;
+        Entry entry;
+        bool valid {false};
+    };
+
+    struct Collection {
+        std::vector<std::pair<boost::uuids::uuid, Version>> signature;  // The id and version of each resource, in order
+        Entry entry;
+        bool valid {false};
+    };
+
+    std::unordered_map<boost::uuids::uuid, CachedResource, boost::hash<boost::uuids::uuid>> resources_;
+    std::map<std::string, Collection, std::less<>> collections_;
+
+    template<class Resource>
+    static bool is_up_to_date(const Collection& collection, const std::vector<Resource*>& resources) {
+        if (collection.signature.size() != resources.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < resources.size(); ++i) {
+            if (collection.signature[i].first != resources[i]->id || collection.signature[i].second != resources[i]->version) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Makes a strong entity tag from the FNV-1a hash of the given data.
+     */
+    static std::string make_etag(const std::string_view data) {
+        uint64_t hash = 0xcbf29ce484222325;
+        for (const auto c : data) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 0x100000001b3;
+        }
+        return fmt::format("\"{:016x}\"", hash);
+    }
+};
+
+}  // namespace rav::nmos
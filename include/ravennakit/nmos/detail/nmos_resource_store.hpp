@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "ravennakit/core/assert.hpp"
+
+#include <boost/container_hash/hash.hpp>
+#include <boost/uuid/uuid.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace rav::nmos {
+
+/**
+ * Holds non-owning pointers to NMOS resources of a single type, indexed by resource id.
+ *
+ * Lookups by id and by pointer are O(1). The resources are also kept in a contiguous list in insertion order, which is
+ * what the collection endpoints and the registry sync iterate over. Removing a resource shifts the pointers after it in
+ * the list; lookups never touch the list.
+ *
+ * The id of a resource is read when it is inserted. If the id of a stored resource changes, call rekey() to update the
+ * index.
+ *
+ * @tparam Resource The type of the resources. Must have an `id` member of type boost::uuids::uuid.
+ */
+template<class Resource>
+class ResourceStore {
+  public:
+    /**
+     * The result of inserting a resource.
+     */
+    enum class InsertResult {
+        /// The resource was added to the store.
+        inserted,
+        /// The resource was already in the store.
+        exists,
+        /// A different resource with the same id is already in the store, nothing was changed.
+        conflict,
+    };
+
+    /**
+     * Adds a resource to the store if it's not already in it.
+     * @param resource The resource to add. Must not be nullptr and must outlive its membership in the store.
+     * @return The result of the operation.
+     */
+    InsertResult insert(Resource* resource) {
+        RAV_ASSERT(resource != nullptr, "Resource must not be nullptr");
+
+        if (keys_.find(resource) != keys_.end()) {
+            return rekey(resource) ? InsertResult::exists : InsertResult::conflict;
+        }
+
+        const auto [it, inserted] = by_id_.emplace(resource->id, resource);
+        if (!inserted) {
+            return InsertResult::conflict;
+        }
+
+        keys_.emplace(resource, resource->id);
+        list_.push_back(resource);
+        return InsertResult::inserted;
+    }
+
+    /**
+     * Updates the index for a stored resource whose id changed.
+     * @param resource The resource.
+     * @return False if the resource is not in the store or if another resource already has the new id, true otherwise.
+     */
+    bool rekey(Resource* resource) {
+        const auto key = keys_.find(resource);
+        if (key == keys_.end()) {
+            return false;
+        }
+        if (key->second == resource->id) {
+            return true;
+        }
+        if (by_id_.find(resource->id) != by_id_.end()) {
+            return false;
+        }
+        by_id_.erase(key->second);
+        by_id_.emplace(resource->id, resource);
+        key->second = resource->id;
+        return true;
+    }
+
+    /**
+     * @param id The id of the resource to find.
+     * @return The resource with the given id, or nullptr if no such resource is in the store.
+     */
+    [[nodiscard]] Resource* find(const boost::uuids::uuid& id) const {
+        const auto it = by_id_.find(id);
+        return it != by_id_.end() ? it->second : nullptr;
+    }
+
+    /**
+     * @param resource The resource to look for.
+     * @return True if the given resource is in the store.
+     */
+    [[nodiscard]] bool contains(const Resource* resource) const {
+        return keys_.find(resource) != keys_.end();
+    }
+
+    /**
+     * Removes a resource from the store.
+     * @param resource The resource to remove.
+     * @return True if the resource was removed, false if it was not in the store.
+     */
+    bool erase(const Resource* resource) {
+        const auto key = keys_.find(resource);
+        if (key == keys_.end()) {
+            return false;
+        }
+        by_id_.erase(key->second);
+        keys_.erase(key);
+        list_.erase(std::find(list_.begin(), list_.end(), resource));
+        return true;
+    }
+
+    /**
+     * Removes all resources for which the predicate returns true.
+     * @param pred The predicate, called with a pointer to each resource.
+     * @return The number of removed resources.
+     */
+    template<class Predicate>
+    size_t erase_if(Predicate pred) {
+        const auto it = std::remove_if(list_.begin(), list_.end(), [this, &pred](Resource* resource) {
+            if (!pred(resource)) {
+                return false;
+            }
+            const auto key = keys_.find(resource);
+            by_id_.erase(key->second);
+            keys_.erase(key);
+            return true;
+        });
+        const auto count = static_cast<size_t>(std::distance(it, list_.end()));
+        list_.erase(it, list_.end());
+        return count;
+    }
+
+    /**
+     * @return The resources in insertion order.
+     */
+    [[nodiscard]] const std::vector<Resource*>& list() const {
+        return list_;
+    }
+
+    /**
+     * @return The number of resources in the store.
+     */
+    [[nodiscard]] size_t size() const {
+        return list_.size();
+    }
+
+    /**
+     * @return True if the store holds no resources.
+     */
+    [[nodiscard]] bool empty() const {
+        return list_.empty();
+    }
+
+    [[nodiscard]] auto begin() const {
+        return list_.begin();
+    }
+
+    [[nodiscard]] auto end() const {
+        return list_.end();
+    }
+
+  private:
+    std::vector<Resource*> list_;
+    std::unordered_map<boost::uuids::uuid, Resource*, boost::hash<boost::uuids::uuid>> by_id_;
+    std::unordered_map<const Resource*, boost::uuids::uuid> keys_;
+};
+
+}  // namespace rav::nmos
@@ -27,6 +27,7 @@
 #include "ravennakit/core/string_parser.hpp"
 #include "ravennakit/ptp/types/ptp_timestamp.hpp"
 #include "ravennakit/core/json.hpp"
+#include "ravennakit/core/json_writer.hpp"
 
 #include <cstdint>
 #include <string>
@@ -52,6 +53,14 @@ struct Timestamp {
 
     explicit Timestamp(const ptp::Timestamp timestamp) : seconds(timestamp.raw_seconds()), nanoseconds(timestamp.raw_nanoseconds()) {}
 
+    friend bool operator==(const Timestamp& lhs, const Timestamp& rhs) {
+        return lhs.seconds == rhs.seconds && lhs.nanoseconds == rhs.nanoseconds;
+    }
+
+    friend bool operator!=(const Timestamp& lhs, const Timestamp& rhs) {
+        return !(lhs == rhs);
+    }
+
     friend bool operator<(const Timestamp& lhs, const Timestamp& rhs) {
         return lhs.seconds < rhs.seconds || (lhs.seconds == rhs.seconds && lhs.nanoseconds < rhs.nanoseconds);
     }
@@ -146,6 +155,12 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     jv = timestamp.to_string();
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const Timestamp& timestamp) {
+    char buffer[32];  // Fits the longest possible timestamp (20 + 1 + 10 characters)
+    const auto result = fmt::format_to_n(buffer, sizeof(buffer), "{}:{}", timestamp.seconds, timestamp.nanoseconds);
+    writer.value(std::string_view(buffer, result.size));
+}
+
 inline Timestamp tag_invoke(const boost::json::value_to_tag<Timestamp>&, const boost::json::value& jv) {
     return Timestamp::from_string(jv.as_string()).value();
 }
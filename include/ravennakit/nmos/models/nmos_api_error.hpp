@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include "ravennakit/core/json_writer.hpp"
+
 #include <boost/json/value.hpp>
 #include <boost/json/value_to.hpp>
 #include <boost/json/value_from.hpp>
@@ -52,6 +54,14 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     jv = {{"code", value.code}, {"error", value.error}, {"debug", value.debug}};
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const ApiError& value) {
+    writer.begin_object();
+    writer.member("code", value.code);
+    writer.member("error", value.error);
+    writer.member("debug", value.debug);
+    writer.end_object();
+}
+
 inline ApiError tag_invoke(const boost::json::value_to_tag<ApiError>&, const boost::json::value& jv) {
     auto obj = jv.as_object();
     ApiError error;
@@ -23,6 +23,8 @@
  */
 
 #pragma once
+
+#include "ravennakit/core/json_writer.hpp"
 #include <string>
 #include <boost/json/value.hpp>
 
@@ -43,4 +45,11 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     jv = {{"name", clock.name}, {"ref_type", ClockInternal::k_ref_type}};
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const ClockInternal& clock) {
+    writer.begin_object();
+    writer.member("name", clock.name);
+    writer.member("ref_type", ClockInternal::k_ref_type);
+    writer.end_object();
+}
+
 }  // namespace rav::nmos
@@ -23,6 +23,8 @@
  */
 
 #pragma once
+
+#include "ravennakit/core/json_writer.hpp"
 #include <string>
 #include <boost/json/conversion.hpp>
 
@@ -58,4 +60,15 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
           {"gmid", clock.gmid},           {"locked", clock.locked}};
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const ClockPtp& clock) {
+    writer.begin_object();
+    writer.member("name", clock.name);
+    writer.member("ref_type", ClockPtp::k_ref_type_ptp);
+    writer.member("traceable", clock.traceable);
+    writer.member("version", ClockPtp::k_version);
+    writer.member("gmid", clock.gmid);
+    writer.member("locked", clock.locked);
+    writer.end_object();
+}
+
 }  // namespace rav::nmos
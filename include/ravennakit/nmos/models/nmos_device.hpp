@@ -72,6 +72,16 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     }
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const Device::Control& control) {
+    writer.begin_object();
+    writer.member("href", control.href);
+    writer.member("type", control.type);
+    if (control.authorization) {
+        writer.member("authorization", *control.authorization);
+    }
+    writer.end_object();
+}
+
 inline Device::Control tag_invoke(const boost::json::value_to_tag<Device::Control>&, const boost::json::value& jv) {
     Device::Control control;
     control.href = jv.at("href").as_string();
@@ -102,6 +112,17 @@ inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::valu
     object["senders"] = senders;
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const Device& device) {
+    writer.begin_object();
+    write_json_members(writer, static_cast<const ResourceCore&>(device));
+    writer.member("type", device.type);
+    writer.member("node_id", device.node_id);
+    writer.member("controls", device.controls);
+    writer.member("receivers", device.receivers);
+    writer.member("senders", device.senders);
+    writer.end_object();
+}
+
 inline Device tag_invoke(const boost::json::value_to_tag<Device>&, const boost::json::value& jv) {
     Device device;
     device.id = boost::lexical_cast<boost::uuids::uuid>(std::string_view(jv.at("id").as_string()));
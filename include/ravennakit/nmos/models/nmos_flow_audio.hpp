@@ -44,6 +44,13 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     jv = {{"numerator", sample_rate.numerator}, {"denominator", sample_rate.denominator}};
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const FlowAudio::SampleRate& sample_rate) {
+    writer.begin_object();
+    writer.member("numerator", sample_rate.numerator);
+    writer.member("denominator", sample_rate.denominator);
+    writer.end_object();
+}
+
 inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::value& jv, const FlowAudio& flow_audio) {
     tag_invoke(tag, jv, static_cast<const FlowCore&>(flow_audio));
     auto& object = jv.as_object();
@@ -51,4 +58,19 @@ inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::valu
     object["sample_rate"] = boost::json::value_from(flow_audio.sample_rate);
 }
 
+/**
+ * Writes the members of an audio flow to an object which is being written.
+ */
+inline void write_json_members(JsonWriter& writer, const FlowAudio& flow_audio) {
+    write_json_members(writer, static_cast<const FlowCore&>(flow_audio));
+    writer.member("format", FlowAudio::k_format);
+    writer.member("sample_rate", flow_audio.sample_rate);
+}
+
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const FlowAudio& flow_audio) {
+    writer.begin_object();
+    write_json_members(writer, flow_audio);
+    writer.end_object();
+}
+
 }  // namespace rav::nmos
@@ -62,4 +62,12 @@ inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::valu
     object["bit_depth"] = flow_audio_raw.bit_depth;
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const FlowAudioRaw& flow_audio_raw) {
+    writer.begin_object();
+    write_json_members(writer, static_cast<const FlowAudio&>(flow_audio_raw));
+    writer.member("media_type", flow_audio_raw.media_type);
+    writer.member("bit_depth", flow_audio_raw.bit_depth);
+    writer.end_object();
+}
+
 }  // namespace rav::nmos
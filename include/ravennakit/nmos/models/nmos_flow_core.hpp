@@ -44,7 +44,27 @@ inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::valu
     auto& object = jv.as_object();
     object["source_id"] = boost::uuids::to_string(flow_core.source_id);
     object["device_id"] = boost::uuids::to_string(flow_core.device_id);
-    object["parents"] = boost::json::value_from(flow_core.parents);
+    boost::json::array parents;
+    for (const auto& parent : flow_core.parents) {
+        parents.push_back(boost::json::value(boost::uuids::to_string(parent)));
+    }
+    object["parents"] = parents;
+}
+
+/**
+ * Writes the members of a flow core to an object which is being written.
+ */
+inline void write_json_members(JsonWriter& writer, const FlowCore& flow_core) {
+    write_json_members(writer, static_cast<const ResourceCore&>(flow_core));
+    writer.member("source_id", flow_core.source_id);
+    writer.member("device_id", flow_core.device_id);
+    writer.member("parents", flow_core.parents);
+}
+
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const FlowCore& flow_core) {
+    writer.begin_object();
+    write_json_members(writer, flow_core);
+    writer.end_object();
 }
 
 }  // namespace rav::nmos
@@ -72,6 +72,12 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     };
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const ReceiverAudio::Capabilities& capabilities) {
+    writer.begin_object();
+    writer.member("media_types", capabilities.media_types);
+    writer.end_object();
+}
+
 inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::value& jv, const ReceiverAudio& receiver) {
     tag_invoke(tag, jv, static_cast<const ReceiverCore&>(receiver));
     auto& jv_obj = jv.as_object();
@@ -79,4 +85,12 @@ inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::valu
     jv_obj["caps"] = boost::json::value_from(receiver.caps);
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const ReceiverAudio& receiver) {
+    writer.begin_object();
+    write_json_members(writer, static_cast<const ReceiverCore&>(receiver));
+    writer.member("format", ReceiverAudio::k_format);
+    writer.member("caps", receiver.caps);
+    writer.end_object();
+}
+
 }  // namespace rav::nmos
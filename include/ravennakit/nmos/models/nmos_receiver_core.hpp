@@ -66,6 +66,11 @@ struct ReceiverCore: ResourceCore {
     Subscription subscription;
 
     std::function<tl::expected<void, ApiError>(const boost::json::value& patch_request)> on_patch_request;
+
+    /// Optional. Validates a patch request without applying it, used to reject scheduled activations when they're staged
+    /// instead of when they're due.
+    std::function<tl::expected<void, ApiError>(const boost::json::value& patch_request)> on_validate_patch_request;
+
     std::function<tl::expected<sdp::SessionDescription, ApiError>()> get_transport_file;
 };
 
@@ -81,6 +86,13 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     jv = object;
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const ReceiverCore::Subscription& subscription) {
+    writer.begin_object();
+    writer.member("active", subscription.active);
+    writer.member("sender_id", subscription.sender_id);
+    writer.end_object();
+}
+
 inline ReceiverCore::Subscription tag_invoke(const boost::json::value_to_tag<ReceiverCore::Subscription>&, const boost::json::value& jv) {
     ReceiverCore::Subscription sub;
     sub.sender_id = uuid_from_json(jv.at("sender_id"));
@@ -97,4 +109,21 @@ inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::valu
     jv_obj["subscription"] = boost::json::value_from(receiver.subscription);
 }
 
+/**
+ * Writes the members of a receiver core to an object which is being written.
+ */
+inline void write_json_members(JsonWriter& writer, const ReceiverCore& receiver) {
+    write_json_members(writer, static_cast<const ResourceCore&>(receiver));
+    writer.member("device_id", receiver.device_id);
+    writer.member("transport", receiver.transport);
+    writer.member("interface_bindings", receiver.interface_bindings);
+    writer.member("subscription", receiver.subscription);
+}
+
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const ReceiverCore& receiver) {
+    writer.begin_object();
+    write_json_members(writer, receiver);
+    writer.end_object();
+}
+
 }  // namespace rav::nmos
@@ -61,4 +61,22 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     };
 }
 
+/**
+ * Writes the members of a resource core to an object which is being written. Used by the resources which derive from
+ * ResourceCore.
+ */
+inline void write_json_members(JsonWriter& writer, const ResourceCore& resource) {
+    writer.member("id", resource.id);
+    writer.member("version", resource.version);
+    writer.member("label", resource.label);
+    writer.member("description", resource.description);
+    writer.member("tags", resource.tags);
+}
+
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const ResourceCore& resource) {
+    writer.begin_object();
+    write_json_members(writer, resource);
+    writer.end_object();
+}
+
 }  // namespace rav::nmos
@@ -88,14 +88,38 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     jv = {{"host", endpoint.host}, {"port", endpoint.port}, {"protocol", endpoint.protocol}, {"authorization", endpoint.authorization}};
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const Self::Endpoint& endpoint) {
+    writer.begin_object();
+    writer.member("host", endpoint.host);
+    writer.member("port", endpoint.port);
+    writer.member("protocol", endpoint.protocol);
+    writer.member("authorization", endpoint.authorization);
+    writer.end_object();
+}
+
 inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv, const Self::Api& api) {
     jv = {{"versions", boost::json::value_from(api.versions)}, {"endpoints", boost::json::value_from(api.endpoints)}};
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const Self::Api& api) {
+    writer.begin_object();
+    writer.member("versions", api.versions);
+    writer.member("endpoints", api.endpoints);
+    writer.end_object();
+}
+
 inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv, const Self::Interface& interface) {
     jv = {{"chassis_id", boost::json::value_from(interface.chassis_id)}, {"port_id", interface.port_id}, {"name", interface.name}};
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const Self::Interface& interface) {
+    writer.begin_object();
+    writer.member("chassis_id", interface.chassis_id);
+    writer.member("port_id", interface.port_id);
+    writer.member("name", interface.name);
+    writer.end_object();
+}
+
 inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::value& jv, const Self& self) {
     tag_invoke(tag, jv, static_cast<const ResourceCore&>(self));
     auto& object = jv.as_object();
@@ -107,4 +131,20 @@ inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::valu
     object["interfaces"] = boost::json::value_from(self.interfaces);
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const Self& self) {
+    writer.begin_object();
+    write_json_members(writer, static_cast<const ResourceCore&>(self));
+    writer.member("href", self.href);
+    writer.key("caps");
+    writer.begin_object();
+    writer.end_object();
+    writer.member("api", self.api);
+    writer.key("services");
+    writer.begin_array();
+    writer.end_array();
+    writer.member("clocks", self.clocks);
+    writer.member("interfaces", self.interfaces);
+    writer.end_object();
+}
+
 }  // namespace rav::nmos
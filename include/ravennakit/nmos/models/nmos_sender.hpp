@@ -86,6 +86,11 @@ struct Sender: ResourceCore {
     }
 
     std::function<tl::expected<void, ApiError>(const boost::json::value& patch_request)> on_patch_request;
+
+    /// Optional. Validates a patch request without applying it, used to reject scheduled activations when they're staged
+    /// instead of when they're due.
+    std::function<tl::expected<void, ApiError>(const boost::json::value& patch_request)> on_validate_patch_request;
+
     std::function<tl::expected<sdp::SessionDescription, ApiError>()> get_transport_file;
 };
 
@@ -96,6 +101,13 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     };
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const Sender::Subscription& subscription) {
+    writer.begin_object();
+    writer.member("receiver_id", subscription.receiver_id);
+    writer.member("active", subscription.active);
+    writer.end_object();
+}
+
 inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::value& jv, const Sender& sender) {
     tag_invoke(tag, jv, static_cast<const ResourceCore&>(sender));
     auto& jv_sender = jv.as_object();
@@ -111,4 +123,16 @@ inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::valu
     jv_sender["subscription"] = boost::json::value_from(sender.subscription);
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const Sender& sender) {
+    writer.begin_object();
+    write_json_members(writer, static_cast<const ResourceCore&>(sender));
+    writer.member("flow_id", sender.flow_id);
+    writer.member("transport", sender.transport);
+    writer.member("device_id", sender.device_id);
+    writer.member("manifest_href", sender.manifest_href);
+    writer.member("interface_bindings", sender.interface_bindings);
+    writer.member("subscription", sender.subscription);
+    writer.end_object();
+}
+
 }  // namespace rav::nmos
@@ -83,4 +83,8 @@ inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::valu
     );
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const Source& source) {
+    writer.value(source.any_of);
+}
+
 }  // namespace rav::nmos
@@ -62,6 +62,12 @@ inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& j
     };
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const SourceAudio::Channel& channel) {
+    writer.begin_object();
+    writer.member("label", channel.label);
+    writer.end_object();
+}
+
 inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::value& jv, const SourceAudio& source) {
     tag_invoke(tag, jv, static_cast<const SourceCore&>(source));
     auto& obj = jv.as_object();
@@ -69,4 +75,12 @@ inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::valu
     obj["channels"] = boost::json::value_from(source.channels);
 }
 
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const SourceAudio& source) {
+    writer.begin_object();
+    write_json_members(writer, static_cast<const SourceCore&>(source));
+    writer.member("format", SourceAudio::k_format);
+    writer.member("channels", source.channels);
+    writer.end_object();
+}
+
 }  // namespace rav::nmos
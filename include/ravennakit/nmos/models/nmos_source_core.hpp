@@ -50,8 +50,31 @@ inline void tag_invoke(const boost::json::value_from_tag& tag, boost::json::valu
     auto& obj = jv.as_object();
     obj["caps"] = boost::json::object();  // Capabilities (not yet defined)
     obj["device_id"] = boost::uuids::to_string(source.device_id);
-    obj["parents"] = boost::json::value_from(source.parents);
+    boost::json::array parents;
+    for (const auto& parent : source.parents) {
+        parents.push_back(boost::json::value(boost::uuids::to_string(parent)));
+    }
+    obj["parents"] = parents;
     obj["clock_name"] = boost::json::value_from(source.clock_name);
 }
 
+/**
+ * Writes the members of a source core to an object which is being written.
+ */
+inline void write_json_members(JsonWriter& writer, const SourceCore& source) {
+    write_json_members(writer, static_cast<const ResourceCore&>(source));
+    writer.key("caps");
+    writer.begin_object();  // Capabilities (not yet defined)
+    writer.end_object();
+    writer.member("device_id", source.device_id);
+    writer.member("parents", source.parents);
+    writer.member("clock_name", source.clock_name);
+}
+
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const SourceCore& source) {
+    writer.begin_object();
+    write_json_members(writer, source);
+    writer.end_object();
+}
+
 }  // namespace rav::nmos
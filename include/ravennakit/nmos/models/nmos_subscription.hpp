@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "ravennakit/core/json.hpp"
+#include "ravennakit/core/json_writer.hpp"
+#include "ravennakit/nmos/detail/nmos_uuid.hpp"
+
+#include <boost/uuid/uuid.hpp>
+
+#include <string>
+
+namespace rav::nmos {
+
+/**
+ * A subscription to changes of a collection of resources, delivered over a WebSocket connection.
+ * https://specs.amwa.tv/is-04/releases/v1.3.3/APIs/schemas/with-refs/queryapi-subscription-response.html
+ */
+struct Subscription {
+    /// Globally unique identifier for the subscription.
+    boost::uuids::uuid id {};
+
+    /// Address to connect to for the WebSocket subscription.
+    std::string ws_href;
+
+    /// Rate limiting for messages. Sets the minimum interval between consecutive websocket messages.
+    uint32_t max_update_rate_ms {100};
+
+    /// Whether the API will retain or destroy the subscription after the final client disconnects.
+    bool persist {false};
+
+    /// Whether the WebSocket connection requires encryption (wss://).
+    bool secure {false};
+
+    /// HTTP resource path in the query API which this subscription relates to (e.g. /senders).
+    std::string resource_path;
+
+    /// Object containing attributes to filter the resource on. Only an empty filter is supported.
+    boost::json::object params;
+};
+
+inline void tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv, const Subscription& subscription) {
+    jv = {
+        {"id", boost::uuids::to_string(subscription.id)},
+        {"ws_href", subscription.ws_href},
+        {"max_update_rate_ms", subscription.max_update_rate_ms},
+        {"persist", subscription.persist},
+        {"secure", subscription.secure},
+        {"resource_path", subscription.resource_path},
+        {"params", subscription.params},
+    };
+}
+
+inline void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const Subscription& subscription) {
+    writer.begin_object();
+    writer.member("id", subscription.id);
+    writer.member("ws_href", subscription.ws_href);
+    writer.member("max_update_rate_ms", subscription.max_update_rate_ms);
+    writer.member("persist", subscription.persist);
+    writer.member("secure", subscription.secure);
+    writer.member("resource_path", subscription.resource_path);
+    writer.member("params", subscription.params);
+    writer.end_object();
+}
+
+inline Subscription tag_invoke(const boost::json::value_to_tag<Subscription>&, const boost::json::value& jv) {
+    Subscription subscription;
+    if (const auto result = jv.try_at("max_update_rate_ms")) {
+        subscription.max_update_rate_ms = boost::json::value_to<uint32_t>(*result);
+    }
+    subscription.persist = jv.at("persist").as_bool();
+    if (const auto result = jv.try_at("secure")) {
+        subscription.secure = result->as_bool();
+    }
+    subscription.resource_path = jv.at("resource_path").as_string();
+    subscription.params = jv.at("params").as_object();
+    return subscription;
+}
+
+}  // namespace rav::nmos
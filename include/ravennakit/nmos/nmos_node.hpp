@@ -24,16 +24,20 @@
 
 #pragma once
 
+#include "detail/nmos_activation_scheduler.hpp"
 #include "detail/nmos_api_version.hpp"
 #include "detail/nmos_error.hpp"
 #include "detail/nmos_operating_mode.hpp"
 #include "detail/nmos_registry_browser.hpp"
+#include "detail/nmos_resource_cache.hpp"
+#include "detail/nmos_resource_store.hpp"
 #include "models/nmos_device.hpp"
 #include "models/nmos_flow_audio_raw.hpp"
 #include "models/nmos_receiver_audio.hpp"
 #include "models/nmos_self.hpp"
 #include "models/nmos_sender.hpp"
 #include "models/nmos_source.hpp"
+#include "models/nmos_subscription.hpp"
 #include "ravennakit/core/json.hpp"
 #include "ravennakit/core/net/http/http_client.hpp"
 #include "ravennakit/core/net/http/http_server.hpp"
@@ -44,6 +48,8 @@
 #include <boost/system/result.hpp>
 #include <fmt/ostream.h>
 
+#include <deque>
+#include <map>
 #include <unordered_map>
 
 namespace rav::nmos {
@@ -56,6 +62,7 @@ class Node: public ptp::Instance::Subscriber {
   public:
     static std::array<ApiVersion, 2> k_node_api_versions;
     static std::array<ApiVersion, 2> k_connection_api_versions;
+    static std::array<ApiVersion, 1> k_query_api_versions;
     static constexpr auto k_default_timeout = std::chrono::milliseconds(2000);
     static constexpr auto k_internal_clock_name = "clk0";
     static constexpr auto k_ptp_clock_name = "clk1";
@@ -70,6 +77,7 @@ class Node: public ptp::Instance::Subscriber {
         std::string registry_address;  // For when operation_mode is registered and discover_mode is manual.
         bool enabled {false};          // Whether the node is enabled or not.
         uint16_t api_port {0};         // The port of the local APIs (the node and connection apis).
+        uint16_t api_worker_threads {0};  // Threads for HTTP I/O, or 0 to serve the APIs from the node's io_context.
         std::string label;             // Freeform string label for the resource.
         std::string description;       // Detailed description of the resource.
 
@@ -92,7 +100,9 @@ class Node: public ptp::Instance::Subscriber {
         static boost::system::result<Configuration, std::string> from_json(const boost::json::value& json);
 
         [[nodiscard]] auto constexpr tie() const {
-            return std::tie(id, operation_mode, api_version, registry_address, enabled, label, description, api_port);
+            return std::tie(
+                id, operation_mode, api_version, registry_address, enabled, label, description, api_port, api_worker_threads
+            );
         }
 
         friend bool operator==(const Configuration& lhs, const Configuration& rhs) {
@@ -112,8 +122,24 @@ class Node: public ptp::Instance::Subscriber {
 
     enum class Status { disabled, discovering, connecting, connected, registered, p2p, error };
 
+    /**
+     * Reports a scheduled IS-05 activation which was applied.
+     */
+    struct ActivationEvent {
+        /// The id of the sender or receiver which was activated.
+        boost::uuids::uuid resource_id;
+
+        /// The time the activation was scheduled for (the requested time aligned to the next packet boundary).
+        Timestamp activation_time;
+
+        /// The PTP time at which the staged parameters were handed to the resource, minus the activation time. This
+        /// measures the control path (activation timer and event loop), not the moment the data path switched.
+        std::chrono::nanoseconds dispatch_delay {};
+    };
+
     SafeFunction<void(const Status& status, const StatusInfo& status_info)> on_status_changed;
     SafeFunction<void(const Configuration& config)> on_configuration_changed;
+    SafeFunction<void(const ActivationEvent& event)> on_activation;
 
     explicit Node(
         boost::asio::io_context& io_context, ptp::Instance& ptp_instance, std::unique_ptr<RegistryBrowserBase> registry_browser = nullptr,
@@ -314,14 +340,52 @@ class Node: public ptp::Instance::Subscriber {
     static constexpr uint8_t k_max_failed_heartbeats = 5;
     static constexpr auto k_heartbeat_interval = std::chrono::seconds(5);
     static constexpr size_t k_clock_ptp_index = 1;
+    static constexpr auto k_registry_sync_delay = std::chrono::milliseconds(10);  // Window in which changes are coalesced
+    static constexpr size_t k_max_registry_posts_in_flight = 4;
+    static constexpr uint8_t k_max_registry_post_attempts = 5;
+    static constexpr auto k_registry_retry_backoff = std::chrono::milliseconds(100);
+    static constexpr auto k_max_registry_retry_backoff = std::chrono::milliseconds(5000);
+    static constexpr auto k_subscription_connect_timeout = std::chrono::seconds(30);  // For non-persistent subscriptions
+
+    /**
+     * The state of a resource as last sent to the clients of a subscription.
+     */
+    struct SentResource {
+        Version version;
+        std::string json;
+        uint32_t generation = 0;  // The generation in which the resource was last seen
+    };
+
+    /**
+     * A WebSocket subscription together with its connected clients.
+     */
+    struct SubscriptionState {
+        Subscription subscription;
+        std::vector<std::shared_ptr<HttpServer::WebSocketConnection>> connections;
+        std::unordered_map<boost::uuids::uuid, SentResource, boost::hash<boost::uuids::uuid>> sent;
+        uint32_t generation = 0;
+        std::chrono::steady_clock::time_point last_update {};
+        std::chrono::steady_clock::time_point created {};
+    };
+
+    /**
+     * A resource waiting to be posted to the registry.
+     */
+    struct PendingPost {
+        std::string type;
+        boost::uuids::uuid id;
+        std::string body;
+        uint8_t attempts = 0;
+    };
 
     ptp::Instance& ptp_instance_;
     Self self_;
-    std::vector<Device*> devices_;
-    std::vector<FlowAudioRaw*> flows_;
-    std::vector<ReceiverAudio*> receivers_;
-    std::vector<Sender*> senders_;
-    std::vector<SourceAudio*> sources_;
+    ResourceStore<Device> devices_;
+    ResourceStore<FlowAudioRaw> flows_;
+    ResourceStore<ReceiverAudio> receivers_;
+    ResourceStore<Sender> senders_;
+    ResourceStore<SourceAudio> sources_;
+    ResourceCache resource_cache_;
 
     Configuration configuration_;
     Status status_ {Status::disabled};
@@ -340,20 +404,44 @@ class Node: public ptp::Instance::Subscriber {
     AsioTimer heartbeat_timer_;  // Keep below connector_ to avoid dangling reference
     Version current_version_;
 
+    std::deque<PendingPost> pending_posts_;
+    size_t posts_in_flight_ = 0;
+    uint32_t registry_sync_generation_ = 0;  // Incremented to ignore responses of abandoned requests
+    uint8_t consecutive_post_failures_ = 0;
+    bool sync_scheduled_ = false;
+    bool retry_scheduled_ = false;
+    bool confirm_registration_when_synced_ = false;
+    AsioTimer sync_timer_;
+    AsioTimer retry_timer_;
+
+    ActivationScheduler scheduled_activations_;
+    std::unordered_map<boost::uuids::uuid, ActivationResponse, boost::hash<boost::uuids::uuid>> active_activations_;
+    boost::asio::steady_timer activation_timer_;
+
+    std::map<boost::uuids::uuid, SubscriptionState> subscriptions_;
+    bool subscription_update_scheduled_ = false;
+    AsioTimer subscription_timer_;
+    AsioTimer subscription_expiry_timer_;
+
     [[nodiscard]] boost::system::result<void, Error> start_internal();
     void stop_internal();
 
     void register_async();
+    void confirm_registration_async();
     void unregister_async();
-    void post_resource_async(std::string type, boost::json::value resource);
+    void post_resource_async(std::string_view type, const boost::uuids::uuid& id, std::string_view resource_json);
+    void send_pending_posts();
+    void on_post_resource_response(PendingPost post, const boost::system::result<http::response<http::string_body>>& result);
+    void cancel_pending_posts(const boost::uuids::uuid& id);
+    void reset_registry_sync();
     void delete_resource_async(std::string resource_type, const boost::uuids::uuid& id);
     void update_self();
     void send_heartbeat_async();
     void connect_to_registry_async();
     void connect_to_registry_async(std::string_view host, std::string_view service);
 
-    [[nodiscard]] bool add_receiver_to_device(const ReceiverAudio& receiver) const;
-    [[nodiscard]] bool add_sender_to_device(const Sender& sender) const;
+    [[nodiscard]] bool add_receiver_to_device(const ReceiverAudio& receiver);
+    [[nodiscard]] bool add_sender_to_device(const Sender& sender);
 
     bool select_registry(const dnssd::ServiceDescription& desc);
     void handle_registry_discovered(const dnssd::ServiceDescription& desc);
@@ -361,7 +449,32 @@ class Node: public ptp::Instance::Subscriber {
     void set_status(Status new_status);
     void update_all_resources_to_now();
     void send_updated_resources_async();
+    void schedule_send_updated_resources_async();
     void update_device(Device& device);
+
+    [[nodiscard]] tl::expected<void, ApiError>
+    validate_patch_request(const boost::uuids::uuid& resource_id, bool is_sender, const boost::json::value& patch_request) const;
+    [[nodiscard]] tl::expected<ActivationResponse, ApiError> stage_activation(
+        const boost::uuids::uuid& resource_id, bool is_sender, const boost::json::value& patch_request,
+        const sdp::SessionDescription& transport_file
+    );
+    [[nodiscard]] ActivationResponse get_staged_activation(const boost::uuids::uuid& resource_id) const;
+    [[nodiscard]] ActivationResponse get_active_activation(const boost::uuids::uuid& resource_id) const;
+    void schedule_activation_timer();
+    void execute_due_activations();
+    void cancel_activations(const boost::uuids::uuid& resource_id);
+
+    [[nodiscard]] tl::expected<Subscription, ApiError> create_subscription(const boost::json::value& request, std::string_view host);
+    void connect_subscription(const boost::uuids::uuid& subscription_id, std::shared_ptr<HttpServer::WebSocketConnection> connection);
+    void disconnect_subscription(const boost::uuids::uuid& subscription_id, const HttpServer::WebSocketConnection* connection);
+    void remove_subscription(std::map<boost::uuids::uuid, SubscriptionState>::iterator it);
+    void expire_unconnected_subscriptions();
+    void send_subscription_updates();
+    [[nodiscard]] std::string update_subscription(SubscriptionState& state);
+    [[nodiscard]] std::string make_subscription_grain(const SubscriptionState& state, const std::string& data);
+    void visit_resources(
+        std::string_view resource_path, const std::function<void(const boost::uuids::uuid&, const Version&, const std::string&)>& visitor
+    );
 };
 
 const char* to_string(const Node::Status& status);
@@ -35,6 +35,9 @@ namespace rav::ntp {
  */
 class Timestamp {
   public:
+    /// The number of seconds between the NTP epoch (1900) and the unix epoch (1970).
+    static constexpr uint64_t k_seconds_from_ntp_epoch_to_unix_epoch = 2'208'988'800;
+
     Timestamp() = default;
 
     /**
@@ -58,6 +61,26 @@ class Timestamp {
         return fraction_;
     }
 
+    /**
+     * @return The middle 32 bits of the timestamp (the lower 16 bits of the integer part and the higher 16 bits of the
+     * fractional part), as used in the LSR field of RTCP report blocks.
+     */
+    [[nodiscard]] uint32_t to_compact() const {
+        return integer_ << 16 | fraction_ >> 16;
+    }
+
+    /**
+     * @return The number of nanoseconds since the unix epoch represented by this timestamp. Timestamps before the unix
+     * epoch return 0.
+     */
+    [[nodiscard]] uint64_t to_unix_nanoseconds() const {
+        if (integer_ < k_seconds_from_ntp_epoch_to_unix_epoch) {
+            return 0;
+        }
+        const auto seconds = static_cast<uint64_t>(integer_) - k_seconds_from_ntp_epoch_to_unix_epoch;
+        return seconds * 1'000'000'000 + (static_cast<uint64_t>(fraction_) * 1'000'000'000 >> 32);
+    }
+
     /**
      * @return A string representation of the timestamp.
      */
@@ -87,6 +110,18 @@ class Timestamp {
         return {integer, static_cast<uint32_t>(fraction << 16)};
     }
 
+    /**
+     * Creates a timestamp from a number of nanoseconds since the unix epoch. PTP time (which also counts from 1970) can
+     * be passed in directly to get an NTP timestamp in the PTP timescale, as used by AES67 and RFC 7273.
+     * @param nanos The number of nanoseconds since the unix epoch.
+     * @return The NTP timestamp.
+     */
+    static Timestamp from_unix_nanoseconds(const uint64_t nanos) {
+        const auto seconds = nanos / 1'000'000'000 + k_seconds_from_ntp_epoch_to_unix_epoch;
+        const auto fraction = (nanos % 1'000'000'000 << 32) / 1'000'000'000;
+        return {static_cast<uint32_t>(seconds), static_cast<uint32_t>(fraction)};
+    }
+
     friend bool operator==(const Timestamp& lhs, const Timestamp& rhs) {
         return lhs.integer_ == rhs.integer_ && lhs.fraction_ == rhs.fraction_;
     }
@@ -51,6 +51,14 @@ class Instance {
      */
     struct Configuration {
         uint8_t domain_number {};
+
+        friend bool operator==(const Configuration& lhs, const Configuration& rhs) {
+            return lhs.domain_number == rhs.domain_number;
+        }
+
+        friend bool operator!=(const Configuration& lhs, const Configuration& rhs) {
+            return !(lhs == rhs);
+        }
     };
 
     class Subscriber {
@@ -358,12 +358,35 @@ class RavennaNode {
     [[nodiscard]] bool is_maintenance_thread() const;
 
     /**
-     * @returns A JSON representation of the node.
+     * @returns A JSON representation of the node. The "revision" member can be passed to to_boost_json_patch() to get the
+     * changes made after this snapshot was taken. The revision only ever increases, with every change to the configuration,
+     * senders or receivers of the node.
      */
     [[nodiscard]] std::future<boost::json::object> to_boost_json();
 
     /**
-     * Restores the node from a JSON representation.
+     * Creates a differential snapshot containing only the senders and receivers which changed after the snapshot (or patch)
+     * with given revision was taken. The patch also contains the ids of all senders and receivers in order, which is how
+     * removals are expressed, and the node, PTP and NMOS configuration which are small enough to always include.
+     * A base snapshot followed by its patches can be restored by passing each of them, in order, to restore_from_boost_json().
+     * @param since_revision The "revision" member of the snapshot or patch to create the patch against.
+     * @returns A JSON representation of the changes.
+     */
+    [[nodiscard]] std::future<boost::json::object> to_boost_json_patch(uint64_t since_revision);
+
+    /**
+     * Serializes the node to the same JSON representation as to_boost_json(), writing senders and receivers directly into
+     * the string instead of building a boost::json::object first. Preferred for large nodes which are saved to a file.
+     * @returns The JSON text of the node.
+     */
+    [[nodiscard]] std::future<std::string> to_json_string();
+
+    /**
+     * Restores the node from a JSON representation, which is either a full snapshot or a patch created by
+     * to_boost_json_patch(). Senders and receivers are matched by their NMOS uuid: unchanged ones are left alone and keep
+     * streaming, changed ones are updated in place, and only those which are new or gone are created or removed. A sender
+     * which exists already can't change its session id or NMOS source and flow ids, such a snapshot is rejected. A patch is
+     * only applied on top of the snapshot or patch it was made against, i.e. the one restored last.
      * @param json The JSON representation of the node.
      * @return A future that will be set when the operation is complete.
      */
@@ -432,8 +455,14 @@ class RavennaNode {
 
     SubscriberList<Subscriber> subscribers_;
     NetworkInterfaceConfig network_interface_config_;
+    uint64_t state_revision_ {Id::get_next_process_wide_unique_id().value()};
+    std::optional<uint64_t> restored_revision_;  // The revision of the last restored snapshot or patch, patches must be based on it
 
     uint32_t generate_unique_session_id() const;
+    void bump_state_revision();
+    [[nodiscard]] uint64_t get_state_revision() const;
+    [[nodiscard]] boost::json::object make_boost_json(std::optional<uint64_t> since_revision) const;
+    [[nodiscard]] tl::expected<void, std::string> restore_from_snapshot(const boost::json::value& json);
     void do_maintenance() const;
     void update_ravenna_browser();
 };
@@ -26,6 +26,7 @@
 
 #include "ravenna_rtsp_client.hpp"
 #include "ravennakit/core/containers/fifo_buffer.hpp"
+#include "ravennakit/core/json_writer.hpp"
 #include "ravennakit/core/util/id.hpp"
 #include "ravennakit/nmos/nmos_node.hpp"
 #include "ravennakit/nmos/models/nmos_receiver_audio.hpp"
@@ -126,6 +127,12 @@ class RavennaReceiver: public RavennaRtspClient::Subscriber {
      */
     [[nodiscard]] const boost::uuids::uuid& get_uuid() const;
 
+    /**
+     * @return The revision of the state which is part of the JSON representation of this receiver. The revision is taken from
+     * a process-wide increasing counter and changes whenever that state changes, which makes it suitable for dirty tracking.
+     */
+    [[nodiscard]] uint64_t get_revision() const;
+
     /**
      * Updates the configuration of the receiver. Only takes into account the fields in the configuration that are set.
      * This allows to update only a subset of the configuration.
@@ -186,6 +193,12 @@ class RavennaReceiver: public RavennaRtspClient::Subscriber {
      */
     [[nodiscard]] boost::json::object to_boost_json() const;
 
+    /**
+     * Writes the same JSON representation as to_boost_json(), without building a boost::json::object first.
+     * @param writer The writer to write to.
+     */
+    void write_json(JsonWriter& writer) const;
+
     /**
      * Restores the receiver from a JSON representation.
      * @param json The JSON representation of the receiver.
@@ -211,6 +224,7 @@ class RavennaReceiver: public RavennaRtspClient::Subscriber {
     rtp::AudioReceiver& rtp_audio_receiver_;
     nmos::Node* nmos_node_ {nullptr};
     const Id id_;
+    uint64_t revision_ {Id::get_next_process_wide_unique_id().value()};
     Configuration configuration_;
     NetworkInterfaceConfig network_interface_config_;
     nmos::ReceiverAudio nmos_receiver_;
@@ -218,10 +232,13 @@ class RavennaReceiver: public RavennaRtspClient::Subscriber {
     rtp::AudioReceiver::ReaderParameters reader_parameters_;
     std::array<rtp::AudioReceiver::StreamState, rtp::AudioReceiver::k_max_num_redundant_sessions> streams_states_ {};
     Throttle<void> stats_throttle_ {std::chrono::seconds(1)};
+    std::array<uint32_t, rtp::AudioReceiver::k_max_num_redundant_sessions> streams_stats_updates_ {};
 
     void handle_announced_sdp(const sdp::SessionDescription& sdp);
+    void mark_changed();
     tl::expected<void, std::string> update_nmos();
     tl::expected<void, std::string> update_rtsp();
+    [[nodiscard]] tl::expected<Configuration, nmos::ApiError> make_patched_configuration(const boost::json::value& patch_request) const;
     tl::expected<void, nmos::ApiError> handle_patch_request(const boost::json::value& patch_request);
 };
 
@@ -234,6 +251,8 @@ tl::expected<rtp::AudioReceiver::ReaderParameters, std::string> create_rtp_recei
 
 void tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv, const RavennaReceiver::Configuration& config);
 
+void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const RavennaReceiver::Configuration& config);
+
 RavennaReceiver::Configuration tag_invoke(const boost::json::value_to_tag<RavennaReceiver::Configuration>&, const boost::json::value& jv);
 
 }  // namespace rav
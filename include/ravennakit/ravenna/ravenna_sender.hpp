@@ -25,6 +25,7 @@
 #pragma once
 
 #include "ravennakit/aes67/aes67_packet_time.hpp"
+#include "ravennakit/core/json_writer.hpp"
 #include "ravennakit/core/util/uri.hpp"
 #include "ravennakit/core/containers/fifo_buffer.hpp"
 #include "ravennakit/core/util/rank.hpp"
@@ -121,6 +122,12 @@ class RavennaSender: public rtsp::Server::PathHandler, public ptp::Instance::Sub
      */
     [[nodiscard]] uint32_t get_session_id() const;
 
+    /**
+     * @return The revision of the state which is part of the JSON representation of this sender. The revision is taken from a
+     * process-wide increasing counter and changes whenever that state changes, which makes it suitable for dirty tracking.
+     */
+    [[nodiscard]] uint64_t get_revision() const;
+
     /**
      * Updates the configuration of the sender.
      * @param config The configuration to update.
@@ -192,6 +199,12 @@ class RavennaSender: public rtsp::Server::PathHandler, public ptp::Instance::Sub
      */
     boost::json::object to_boost_json() const;
 
+    /**
+     * Writes the same JSON representation as to_boost_json(), without building a boost::json::object first.
+     * @param writer The writer to write to.
+     */
+    void write_json(JsonWriter& writer) const;
+
     /**
      * Restores the sender from a JSON representation.
      * @param json The JSON representation of the sender.
@@ -229,6 +242,7 @@ class RavennaSender: public rtsp::Server::PathHandler, public ptp::Instance::Sub
 
     Id id_;
     uint32_t session_id_ {};
+    uint64_t revision_ {Id::get_next_process_wide_unique_id().value()};
     Configuration configuration_;
     std::string rtsp_path_by_name_;
     std::string rtsp_path_by_id_;
@@ -248,21 +262,27 @@ class RavennaSender: public rtsp::Server::PathHandler, public ptp::Instance::Sub
      * Sends an announcement request to all connected clients.
      */
     void send_announce() const;
+    void mark_changed();
     void update_nmos();
     void update_advertisement();
     void generate_auto_addresses_if_needed(bool notify_subscribers);
     bool generate_auto_addresses_if_needed(std::vector<Destination>& destinations) const;
     void restart_streaming() const;
+    [[nodiscard]] tl::expected<Configuration, nmos::ApiError> make_patched_configuration(const boost::json::value& patch_request) const;
     tl::expected<void, rav::nmos::ApiError> handle_patch_request(const boost::json::value& patch_request);
     void register_dnssd_session_advertisement();
 };
 
 void tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv, const RavennaSender::Destination& destination);
 
+void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const RavennaSender::Destination& destination);
+
 RavennaSender::Destination tag_invoke(const boost::json::value_to_tag<RavennaSender::Destination>&, const boost::json::value& jv);
 
 void tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv, const RavennaSender::Configuration& config);
 
+void tag_invoke(const JsonWriteTag&, JsonWriter& writer, const RavennaSender::Configuration& config);
+
 RavennaSender::Configuration tag_invoke(const boost::json::value_to_tag<RavennaSender::Configuration>&, const boost::json::value& jv);
 
 }  // namespace rav
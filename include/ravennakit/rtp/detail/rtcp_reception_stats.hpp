@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "ravennakit/ntp/ntp_timestamp.hpp"
+#include "ravennakit/rtp/rtcp_packet.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+namespace rav::rtcp {
+
+/**
+ * Keeps the per-source reception state needed to fill in RTCP report blocks, following RFC 3550 appendix A.3 (loss)
+ * and A.8 (inter-arrival jitter). Not thread safe, meant to be updated from the network thread.
+ */
+class ReceptionStats {
+  public:
+    /// The maximum forward jump in sequence numbers which is considered a normal dropout instead of a restart.
+    static constexpr uint16_t k_max_dropout = 3000;
+
+    /// The maximum backward jump in sequence numbers which is considered a reordered packet instead of a restart.
+    static constexpr uint16_t k_max_misorder = 100;
+
+    /**
+     * Updates the statistics with an incoming RTP packet.
+     * @param sequence_number The sequence number of the packet.
+     * @param rtp_timestamp The RTP timestamp of the packet.
+     * @param arrival_time The arrival time of the packet, converted to RTP timestamp units.
+     */
+    void update(const uint16_t sequence_number, const uint32_t rtp_timestamp, const uint32_t arrival_time) {
+        if (!max_seq_.has_value()) {
+            restart(sequence_number);
+        } else {
+            const auto delta = static_cast<uint16_t>(sequence_number - *max_seq_);
+            if (delta < k_max_dropout) {
+                if (sequence_number < *max_seq_) {
+                    cycles_ += 1 << 16;  // Sequence number wrapped around
+                }
+                max_seq_ = sequence_number;
+            } else if (delta <= 0xffff - k_max_misorder) {
+                restart(sequence_number);  // A very large jump, assume the sender restarted
+            }
+            // Otherwise: a duplicate or reordered packet, which is counted as received below.
+        }
+
+        received_++;
+
+        // Inter-arrival jitter
+        const auto transit = static_cast<int32_t>(arrival_time - rtp_timestamp);
+        if (transit_.has_value()) {
+            const auto d = std::abs(static_cast<double>(transit - *transit_));
+            jitter_ += (d - jitter_) / 16.0;
+        }
+        transit_ = transit;
+    }
+
+    /**
+     * Registers the arrival of a sender report from the source.
+     * @param ntp_timestamp The NTP timestamp inside the sender report.
+     * @param arrival_time_ns The arrival time in nanoseconds (monotonic, arbitrary epoch).
+     */
+    void update_sender_report(const ntp::Timestamp ntp_timestamp, const uint64_t arrival_time_ns) {
+        last_sr_timestamp_ = ntp_timestamp.to_compact();
+        last_sr_arrival_time_ns_ = arrival_time_ns;
+    }
+
+    /**
+     * Creates a report block for the current state and starts a new reporting interval.
+     * @param ssrc The SSRC of the source the report is about.
+     * @param now_ns The current time in nanoseconds, using the same clock as passed to update_sender_report().
+     * @return The report block.
+     */
+    [[nodiscard]] ReportBlock make_report_block(const uint32_t ssrc, const uint64_t now_ns) {
+        ReportBlock block;
+        block.ssrc = ssrc;
+
+        if (!max_seq_.has_value()) {
+            return block;
+        }
+
+        const auto extended_max = cycles_ + *max_seq_;
+        const auto expected = extended_max - base_seq_ + 1;
+        const auto expected_interval = expected - expected_prior_;
+        const auto received_interval = received_ - received_prior_;
+        expected_prior_ = expected;
+        received_prior_ = received_;
+
+        const auto lost_interval = static_cast<int64_t>(expected_interval) - static_cast<int64_t>(received_interval);
+        if (expected_interval != 0 && lost_interval > 0) {
+            block.fraction_lost = static_cast<uint8_t>(std::min<int64_t>((lost_interval << 8) / expected_interval, 255));
+        }
+
+        const auto lost = static_cast<int64_t>(expected) - static_cast<int64_t>(received_);
+        block.number_of_packets_lost = static_cast<int32_t>(std::clamp<int64_t>(lost, -0x800000, 0x7fffff));
+        block.extended_highest_sequence_number_received = extended_max;
+        block.inter_arrival_jitter = static_cast<uint32_t>(jitter_);
+
+        if (last_sr_timestamp_ != 0) {
+            block.last_sr_timestamp = last_sr_timestamp_;
+            const auto delay_ns = now_ns > last_sr_arrival_time_ns_ ? now_ns - last_sr_arrival_time_ns_ : 0;
+            block.delay_since_last_sr = static_cast<uint32_t>((delay_ns << 16) / 1'000'000'000);
+        }
+
+        return block;
+    }
+
+    /**
+     * @return The inter-arrival jitter in RTP timestamp units.
+     */
+    [[nodiscard]] double get_jitter() const {
+        return jitter_;
+    }
+
+    /**
+     * @return True if at least one packet was received since the last reset.
+     */
+    [[nodiscard]] bool has_received() const {
+        return max_seq_.has_value();
+    }
+
+    /**
+     * Resets to the initial state.
+     */
+    void reset() {
+        *this = {};
+    }
+
+  private:
+    std::optional<uint16_t> max_seq_;
+    uint32_t cycles_ {};
+    uint32_t base_seq_ {};
+    uint32_t received_ {};
+    uint32_t expected_prior_ {};
+    uint32_t received_prior_ {};
+    std::optional<int32_t> transit_;
+    double jitter_ {};
+    uint32_t last_sr_timestamp_ {};
+    uint64_t last_sr_arrival_time_ns_ {};
+
+    void restart(const uint16_t sequence_number) {
+        max_seq_ = sequence_number;
+        cycles_ = 0;
+        base_seq_ = sequence_number;
+        received_ = 0;
+        expected_prior_ = 0;
+        received_prior_ = 0;
+    }
+};
+
+}  // namespace rav::rtcp
@@ -24,23 +24,28 @@
 
 #pragma once
 
+#include "rtcp_reception_stats.hpp"
 #include "rtp_filter.hpp"
 #include "rtp_packet_stats.hpp"
 #include "rtp_ringbuffer.hpp"
 #include "rtp_session.hpp"
 #include "ravennakit/aes67/aes67_constants.hpp"
 #include "ravennakit/core/audio/audio_buffer_view.hpp"
+#include "ravennakit/core/containers/byte_buffer.hpp"
+#include "ravennakit/core/math/histogram.hpp"
 #include "ravennakit/core/math/interval_stats.hpp"
 #include "ravennakit/core/math/sliding_stats.hpp"
+#include "ravennakit/core/memory/arena.hpp"
 #include "ravennakit/core/net/asio/asio_helpers.hpp"
 #include "ravennakit/core/sync/atomic_rw_lock.hpp"
+#include "ravennakit/core/sync/epoch.hpp"
+#include "ravennakit/core/sync/seqlock.hpp"
 #include "ravennakit/core/util/id.hpp"
 #include "ravennakit/core/util/safe_function.hpp"
 #include "ravennakit/ptp/ptp_instance.hpp"
 
 #include <boost/asio.hpp>
 #include <boost/container/static_vector.hpp>
-#include <boost/lockfree/spsc_value.hpp>
 
 namespace rav::rtp {
 
@@ -59,15 +64,24 @@ struct AudioReceiver {
     /// systems we go a bit higher. Note that this number is not the same as the delay or added latency.
     static constexpr uint32_t k_buffer_size_ms = 200;
 
+    /// The interval at which RTCP receiver reports are sent for each stream, when RTCP is enabled.
+    static constexpr uint64_t k_rtcp_report_interval_ms = 1000;
+
+    /// When a reader is reconfigured, the max time to wait for the new reader to receive its first packets, and for the
+    /// audio thread to switch over to it.
+    static constexpr uint64_t k_reconfigure_timeout_ms = 100;
+
     using ArrayOfAddresses = std::array<ip_address_v4, k_max_num_redundant_sessions>;
 
     struct StreamInfo {
         Session session;
         Filter filter;
         uint16_t packet_time_frames {};
+        /// The RTP timestamp at PTP time zero, when the media clock of the stream is directly derived from PTP (RFC 7273).
+        std::optional<uint32_t> ptp_media_clock_offset;
 
         [[nodiscard]] auto tie() const {
-            return std::tie(session, filter, packet_time_frames);
+            return std::tie(session, filter, packet_time_frames, ptp_media_clock_offset);
         }
 
         friend bool operator==(const StreamInfo& lhs, const StreamInfo& rhs) {
@@ -137,6 +151,23 @@ struct AudioReceiver {
      */
     [[nodiscard]] bool add_reader(Id id, const ReaderParameters& parameters, const ArrayOfAddresses& interfaces);
 
+    /**
+     * Updates the parameters of the reader with given id, or adds a reader if there is none yet. A change to the source
+     * filters only is applied to the existing reader in place. Any other change is applied make-before-break: a shadow
+     * reader is set up in a free slot next to the existing one, joining new multicast groups while the current ones stay
+     * joined. The switchover then continues on the io_context without blocking: the shadow reader gets some time to
+     * receive its first packets before it is published, the audio thread switches over on its next read, taking over the
+     * read position and, when the audio format is unchanged, the audio which hasn't been read yet. Only then is the old
+     * reader retired, leaving the groups and closing the sockets which are no longer used. Until then, the reader is
+     * found by its id through the shadow reader.
+     * Thread safe: no, must be called from the thread running the io_context.
+     * @param id The id of the reader.
+     * @param parameters The new parameters of the reader.
+     * @param interfaces The interfaces to receive multicast sessions on.
+     * @return true if the reader was updated or added, or false if not.
+     */
+    [[nodiscard]] bool update_reader(Id id, const ReaderParameters& parameters, const ArrayOfAddresses& interfaces);
+
     /**
      * Removes the reader with given id, if it exists.
      * Thread safe: no.
@@ -203,6 +234,15 @@ struct AudioReceiver {
      */
     std::optional<PacketStats::Counters> get_packet_stats(Id reader_id, size_t stream_index);
 
+    /**
+     * Like get_packet_stats(), but only returns the statistics if they were updated since the caller got them last.
+     * @param reader_id The id of the reader to get statistics from.
+     * @param stream_index The index of the stream to get stats from.
+     * @param last_update Keeps track of the update the caller has seen last, start with zero.
+     * @return The statistics for given stream index, or nullopt if they didn't change or could not be read.
+     */
+    std::optional<PacketStats::Counters> get_packet_stats_if_updated(Id reader_id, size_t stream_index, uint32_t& last_update);
+
     /**
      * @param reader_id The id of the reader to get the state for.
      * @param stream_index The index of the stream to get the state for.
@@ -210,6 +250,22 @@ struct AudioReceiver {
      */
     [[nodiscard]] std::optional<StreamState> get_stream_state(Id reader_id, size_t stream_index) const;
 
+    /**
+     * @param reader_id The id of the reader to get the counters for.
+     * @return The number of times the network thread failed to lock the reader, and the number of times reconfiguring
+     * the reader failed to lock it, or nullopt if there is no reader for given id.
+     */
+    [[nodiscard]] std::optional<AtomicRwLock::ContentionCounters> get_lock_contention_counters(Id reader_id) const;
+
+    /**
+     * Thread safe: yes.
+     * @param reader_id The id of the reader.
+     * @param stream_index The index of the stream.
+     * @return The distribution of the intervals between received packets in nanoseconds, or nullopt if there is no
+     * reader for given id.
+     */
+    [[nodiscard]] std::optional<Histogram::Snapshot> get_packet_interval_histogram(Id reader_id, size_t stream_index) const;
+
     struct SocketWithContext {
         explicit SocketWithContext(boost::asio::io_context& io_context) : socket(io_context) {}
 
@@ -229,35 +285,55 @@ struct AudioReceiver {
     struct StreamContext {
         Session session;
         Filter filter;
+        CompiledFilter compiled_filter;  // Used on the network thread, compiled from filter
         uint16_t packet_time_frames {};
+        std::optional<uint32_t> ptp_media_clock_offset;
         std::optional<WrappingUint32> rtp_ts;
         ip_address_v4 interface;
-        FifoBuffer<PacketBuffer, Fifo::Spsc> packets;
-        FifoBuffer<uint16_t, Fifo::Spsc> packets_too_old;
+        FifoBuffer<PacketBuffer, Fifo::Spsc, ArenaAllocator<PacketBuffer>> packets;
+        FifoBuffer<uint16_t, Fifo::Spsc, ArenaAllocator<uint16_t>> packets_too_old;
         PacketStats packet_stats;
-        boost::lockfree::spsc_value<PacketStats::Counters, boost::lockfree::allow_multiple_reads<true>> packet_stats_counters;
+        SeqLock<PacketStats::Counters> packet_stats_counters;
         std::atomic<bool> reset_max_values {false};
         IntervalStats packet_interval_stats;
+        Histogram packet_interval_histogram;  // Packet intervals in nanoseconds, network thread writes and any thread reads
         WrappingUint64 prev_packet_time_ns;
         std::atomic<StreamState> state {StreamState::inactive};
+
+        // RTCP (network thread):
+        rtcp::ReceptionStats rtcp_stats;
+        uint32_t remote_ssrc {};
+        ip_address remote_address;                         // Source address of the most recent RTP packet
+        std::optional<udp_endpoint> rtcp_remote_endpoint;  // Source endpoint of the most recent sender report
+        double one_way_latency_ms {};
+        uint64_t last_rtcp_report_time_ns {};
     };
 
     /**
      * Holds the structures to receive incoming data from redundant sources into a single buffer.
      */
     struct Reader {
-        AtomicRwLock rw_lock;
+        AtomicRwLock rw_lock;  // Guards the reader against the network thread
         Id id;
+        std::atomic<Id> published_id {Id {}};  // The id as seen by the audio thread, set once the reader is fully set up
         AudioFormat audio_format;
         std::array<StreamContext, k_max_num_redundant_sessions> streams;
 
         // Audio thread
         Ringbuffer receive_buffer;
-        std::vector<uint8_t> read_audio_data_buffer;
+        ArenaVector<uint8_t> read_audio_data_buffer;
         std::optional<WrappingUint32> most_recent_ts;  // ts of the latest received data
         WrappingUint32 next_ts_to_read;
+
+        // Set on a shadow reader while it replaces the reader it points to. The audio thread takes over the read position
+        // from that reader on its first read and clears this.
+        std::atomic<Reader*> takeover_from {nullptr};
     };
 
+    /// When true, RTCP receiver reports are sent for every stream and incoming sender reports are processed, using a
+    /// socket on the RTCP port of each session. Must be set before adding readers.
+    bool rtcp_enabled {false};
+
     /// Function for joining a multicast group. Can be overridden to alter behaviour. Used for unit testing.
     SafeFunction<bool(udp_socket&, ip_address_v4, ip_address_v4)> join_multicast_group;
 
@@ -268,10 +344,34 @@ struct AudioReceiver {
 
     static constexpr auto k_max_num_sessions = k_max_num_readers * k_max_num_redundant_sessions;
 
-    boost::container::static_vector<SocketWithContext, k_max_num_sessions> sockets;
+    using SocketList = boost::container::static_vector<SocketWithContext, k_max_num_sessions>;
+
+    SocketList sockets;
+    SocketList rtcp_sockets;
     boost::container::static_vector<Reader, k_max_num_readers> readers;
 
+    /// Protects the readers against the audio thread. A reader is unpublished and a grace period passes before it is
+    /// reset, so that reading audio never has to fail or wait because a reader is being reconfigured.
+    Epoch realtime_epoch;
+
+    /// A reader which is being replaced by a shadow reader with the same id, see update_reader().
+    struct Switchover {
+        Reader* current {};
+        Reader* shadow {};
+        bool is_consumed {};   // Whether the audio thread was reading from the current reader
+        bool is_published {};  // Whether the shadow reader has been published in place of the current one
+        uint64_t deadline_ns {};
+    };
+
+    /// The switchovers in progress, driven by switchover_timer.
+    boost::container::static_vector<Switchover, k_max_num_readers> switchovers;
+    boost::asio::steady_timer switchover_timer;
+
     uint64_t last_time_maintenance {};
+
+    // RTCP (network thread):
+    uint32_t rtcp_ssrc {};
+    ByteBuffer rtcp_send_buffer;
 };
 
 /**
@@ -24,14 +24,20 @@
 
 #pragma once
 
+#include "rtp_packet_stats.hpp"
 #include "rtp_ringbuffer.hpp"
 #include "ravennakit/aes67/aes67_constants.hpp"
 #include "ravennakit/core/audio/audio_buffer_view.hpp"
 #include "ravennakit/core/audio/audio_format.hpp"
 #include "ravennakit/core/containers/byte_buffer.hpp"
+#include "ravennakit/core/math/histogram.hpp"
+#include "ravennakit/core/memory/arena.hpp"
 #include "ravennakit/core/net/asio/asio_helpers.hpp"
 #include "ravennakit/core/sync/atomic_rw_lock.hpp"
+#include "ravennakit/core/sync/epoch.hpp"
+#include "ravennakit/core/sync/seqlock.hpp"
 #include "ravennakit/core/util/id.hpp"
+#include "ravennakit/ptp/ptp_instance.hpp"
 #include "ravennakit/rtp/rtp_packet.hpp"
 
 #include <boost/container/static_vector.hpp>
@@ -56,6 +62,18 @@ struct AudioSender {
     /// The maximum number of redundant sessions per stream.
     static constexpr auto k_max_num_redundant_sessions = 2;  // How many redundant paths
 
+    /// The interval at which RTCP sender reports are sent for each writer, when RTCP is enabled.
+    static constexpr uint64_t k_rtcp_report_interval_ms = 1000;
+
+    /// The number of report intervals after which a remote receiver which stopped sending reports is forgotten.
+    static constexpr uint64_t k_rtcp_receiver_timeout_intervals = 5;
+
+    /// The maximum number of remote receivers tracked per writer for RTCP statistics.
+    static constexpr size_t k_max_num_remote_receivers = 8;
+
+    /// The number of sent sender reports remembered for matching the LSR field of incoming receiver reports.
+    static constexpr size_t k_num_sender_reports_history = 4;
+
     using ArrayOfAddresses = std::array<ip_address_v4, k_max_num_redundant_sessions>;
 
     struct WriterParameters {
@@ -101,6 +119,29 @@ struct AudioSender {
      */
     bool set_ttl(Id id, uint8_t ttl);
 
+    /**
+     * Returns the statistics reported back by the remote receivers of given writer through RTCP receiver reports. When
+     * multiple receivers report, the worst values are returned.
+     * @param writer_id The id of the writer.
+     * @return The statistics, or nullopt if no statistics could be read.
+     */
+    std::optional<PacketStats::Counters> get_packet_stats(Id writer_id);
+
+    /**
+     * @param writer_id The id of the writer to get the counters for.
+     * @return The number of times the network thread failed to lock the writer, and the number of times reconfiguring
+     * the writer failed to lock it, or nullopt if there is no writer for given id.
+     */
+    [[nodiscard]] std::optional<AtomicRwLock::ContentionCounters> get_lock_contention_counters(Id writer_id) const;
+
+    /**
+     * Thread safe: yes.
+     * @param writer_id The id of the writer.
+     * @return The distribution of the time in nanoseconds between a packet being scheduled by the audio thread and being
+     * sent by the network thread, or nullopt if there is no writer for given id.
+     */
+    [[nodiscard]] std::optional<Histogram::Snapshot> get_send_delay_histogram(Id writer_id) const;
+
     /**
      * Call this to send outgoing packets onto the network. Should be called from a single high priority thread with
      * regular short intervals.
@@ -130,14 +171,30 @@ struct AudioSender {
     struct FifoPacket {
         uint32_t rtp_timestamp {};
         uint32_t payload_size_bytes {};
+        uint64_t scheduled_time_ns {};
         std::array<uint8_t, aes67::constants::k_max_payload> payload {};
     };
 
+    struct RemoteReceiver {
+        uint32_t ssrc {};
+        PacketStats::Counters counters;
+        uint64_t last_report_time_ns {};
+    };
+
+    struct SentSenderReport {
+        uint32_t ntp_compact {};  // The middle 32 bits of the NTP timestamp, as echoed in the LSR field
+        uint64_t send_time_ns {};
+    };
+
     struct Writer {
-        explicit Writer(std::array<udp_socket, k_max_num_redundant_sessions>&& s) : sockets(std::move(s)) {}
+        Writer(
+            std::array<udp_socket, k_max_num_redundant_sessions>&& s, std::array<udp_socket, k_max_num_redundant_sessions>&& rtcp_s
+        ) :
+            sockets(std::move(s)), rtcp_sockets(std::move(rtcp_s)) {}
 
-        AtomicRwLock rw_lock;
+        AtomicRwLock rw_lock;  // Guards the writer against the network thread
         Id id;
+        std::atomic<Id> published_id {Id {}};  // The id as seen by the audio thread, set once the writer is fully set up
         std::array<udp_endpoint, k_max_num_redundant_sessions> destinations;
         std::array<udp_socket, k_max_num_redundant_sessions> sockets;
         std::atomic<size_t> num_packets_failed_to_schedule {0};  // TODO: Report somewhere
@@ -145,15 +202,30 @@ struct AudioSender {
 
         // Audio thread:
         ByteBuffer rtp_packet_buffer;
-        std::vector<uint8_t> intermediate_send_buffer;
-        std::vector<uint8_t> intermediate_audio_buffer;
+        ArenaVector<uint8_t> intermediate_send_buffer;
+        ArenaVector<uint8_t> intermediate_audio_buffer;
         uint32_t packet_time_frames {};
         Packet rtp_packet;
         AudioFormat audio_format;
         Ringbuffer rtp_buffer;
 
         // Audio thread writes and network thread reads:
-        FifoBuffer<FifoPacket, Fifo::Spsc> outgoing_data;
+        FifoBuffer<FifoPacket, Fifo::Spsc, ArenaAllocator<FifoPacket>> outgoing_data;
+
+        // RTCP (network thread):
+        std::array<udp_socket, k_max_num_redundant_sessions> rtcp_sockets;
+        uint32_t ssrc {};
+        uint32_t packet_count {};
+        uint32_t octet_count {};
+        uint32_t last_rtp_timestamp {};
+        uint64_t last_sender_report_time_ns {};
+        ByteBuffer rtcp_buffer;
+        std::array<SentSenderReport, k_num_sender_reports_history> sent_sender_reports {};
+        std::array<RemoteReceiver, k_max_num_remote_receivers> remote_receivers {};
+
+        // Network thread writes and any thread reads:
+        SeqLock<PacketStats::Counters> packet_stats_counters;
+        Histogram send_delay_histogram;
     };
 
     struct SocketWithContext {
@@ -163,7 +235,19 @@ struct AudioSender {
         udp_socket socket;
     };
 
+    /// When true, RTCP sender reports are sent for every writer and incoming receiver reports are processed, using a
+    /// socket on the RTCP port (destination port + 1) of each destination. Must be set before adding writers.
+    bool rtcp_enabled {false};
+
+    /// Used to timestamp sender reports in the PTP timescale.
+    ptp::Instance::Subscriber ptp_instance_subscriber;
+
     boost::container::static_vector<Writer, k_max_num_writers> writers;
+
+    /// Protects the writers against the audio thread. A writer is unpublished and a grace period passes before it is
+    /// reset, so that sending audio never has to fail or wait because a writer is being reconfigured.
+    Epoch realtime_epoch;
+
     boost::system::error_code last_error;  // Used to avoid log spamming
 };
 
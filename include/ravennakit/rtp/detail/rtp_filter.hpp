@@ -30,6 +30,8 @@
 #include <boost/asio.hpp>
 #include "ravennakit/core/expected.hpp"
 
+#include <algorithm>
+
 namespace rav::rtp {
 
 /**
@@ -161,6 +163,8 @@ class Filter {
     }
 
   private:
+    friend class CompiledFilter;
+
     struct filter {
         sdp::FilterMode mode {sdp::FilterMode::undefined};
         boost::asio::ip::address address;
@@ -178,4 +182,107 @@ class Filter {
     std::vector<filter> filters_;  // TODO: Avoid allocations here. Store filters in-class.
 };
 
+/**
+ * A Filter compiled for evaluation on the packet path. The include and exclude entries are resolved into a single
+ * sorted list of addresses which are either allowed or denied, so that evaluation is a lookup without comparing
+ * boost::asio::ip::address values. Building allocates, evaluating doesn't.
+ */
+class CompiledFilter {
+  public:
+    CompiledFilter() = default;
+
+    /**
+     * Compiles given filter.
+     * @param filter The filter to compile.
+     */
+    explicit CompiledFilter(const Filter& filter) : connection_address_(filter.connection_address_) {
+        if (connection_address_.is_v4()) {
+            connection_address_v4_ = connection_address_.to_v4().to_uint();
+        }
+
+        allow_list_ = std::any_of(filter.filters_.begin(), filter.filters_.end(), [](const Filter::filter& f) {
+            return f.mode == sdp::FilterMode::include;
+        });
+
+        const auto is_excluded = [&filter](const boost::asio::ip::address& address) {
+            return std::any_of(filter.filters_.begin(), filter.filters_.end(), [&address](const Filter::filter& f) {
+                return f.mode == sdp::FilterMode::exclude && f.address == address;
+            });
+        };
+
+        // With include filters only the included addresses which are not excluded are valid (exclude takes priority),
+        // without include filters everything but the excluded addresses is valid.
+        for (const auto& f : filter.filters_) {
+            if (f.mode != (allow_list_ ? sdp::FilterMode::include : sdp::FilterMode::exclude)) {
+                continue;
+            }
+            if (allow_list_ && is_excluded(f.address)) {
+                continue;
+            }
+            if (f.address.is_v4()) {
+                addresses_v4_.push_back(f.address.to_v4().to_uint());
+            } else {
+                addresses_v6_.push_back(f.address.to_v6().to_bytes());
+            }
+        }
+
+        std::sort(addresses_v4_.begin(), addresses_v4_.end());
+        addresses_v4_.erase(std::unique(addresses_v4_.begin(), addresses_v4_.end()), addresses_v4_.end());
+        std::sort(addresses_v6_.begin(), addresses_v6_.end());
+        addresses_v6_.erase(std::unique(addresses_v6_.begin(), addresses_v6_.end()), addresses_v6_.end());
+    }
+
+    /**
+     * @return The connection address.
+     */
+    [[nodiscard]] const boost::asio::ip::address& connection_address() const {
+        return connection_address_;
+    }
+
+    /**
+     * Checks if the given connection address matches and if source address is a valid source address. Gives the same
+     * result as Filter::is_valid_source.
+     * @param connection_address The connection address.
+     * @param src_address The source address.
+     * @return True if the connection address and source address matches the filter, or false if not.
+     */
+    [[nodiscard]] bool
+    is_valid_source(const boost::asio::ip::address& connection_address, const boost::asio::ip::address& src_address) const {
+        if (connection_address.is_v4() && connection_address_.is_v4()) {
+            if (connection_address.to_v4().to_uint() != connection_address_v4_) {
+                return false;
+            }
+        } else if (connection_address != connection_address_) {
+            return false;
+        }
+
+        if (src_address.is_v4()) {
+            return contains(addresses_v4_, src_address.to_v4().to_uint()) == allow_list_;
+        }
+        return std::binary_search(addresses_v6_.begin(), addresses_v6_.end(), src_address.to_v6().to_bytes()) == allow_list_;
+    }
+
+  private:
+    boost::asio::ip::address connection_address_;
+    uint32_t connection_address_v4_ {};
+    bool allow_list_ {};  // True when addresses are the only valid sources, false when they are the only invalid sources
+    std::vector<uint32_t> addresses_v4_;
+    std::vector<boost::asio::ip::address_v6::bytes_type> addresses_v6_;
+
+    /// Branchless binary search, for the small sorted lists found in SDP source filters.
+    static bool contains(const std::vector<uint32_t>& sorted, const uint32_t value) {
+        if (sorted.empty()) {
+            return false;
+        }
+        const uint32_t* first = sorted.data();
+        auto length = sorted.size();
+        while (length > 1) {
+            const auto half = length / 2;
+            first = first[half - 1] < value ? first + half : first;
+            length -= half;
+        }
+        return *first == value;
+    }
+};
+
 }  // namespace rav::rtp
@@ -24,11 +24,14 @@
 
 #pragma once
 
+#include "ravennakit/core/assert.hpp"
 #include "ravennakit/core/math/running_average.hpp"
 #include "ravennakit/core/util/tracy.hpp"
 #include "ravennakit/core/util/wrapping_uint.hpp"
 #include "ravennakit/rtp/rtp_packet_view.hpp"
 
+#include <algorithm>
+#include <array>
 #include <utility>
 #include <tuple>
 
@@ -50,6 +53,10 @@ class PacketStats {
         uint32_t too_late {};
         /// The difference between the average interval and the min/max interval.
         double jitter {};  // Not used by this class, but can be filled in externally.
+        /// The one-way network latency in milliseconds, derived from RTCP sender reports. Not used by this class.
+        double one_way_latency_ms {};
+        /// The round trip time in milliseconds, derived from RTCP receiver reports. Not used by this class.
+        double round_trip_time_ms {};
 
         [[nodiscard]] auto tie() const {
             return std::tie(out_of_order, too_late, duplicates, dropped);
@@ -74,16 +81,21 @@ class PacketStats {
 
         [[nodiscard]] std::string to_string() const {
             return fmt::format(
-                "out_of_order: {}, duplicates: {}, dropped: {}, too_late: {}, jitter: {}", out_of_order, duplicates, dropped, too_late,
-                jitter
+                "out_of_order: {}, duplicates: {}, dropped: {}, too_late: {}, jitter: {}, one_way_latency_ms: {}, round_trip_time_ms: {}",
+                out_of_order, duplicates, dropped, too_late, jitter, one_way_latency_ms, round_trip_time_ms
             );
         }
     };
 
+    /// The number of sequence numbers tracked for dropped packets. This is half the range of the sequence number,
+    /// beyond which a packet is considered newer instead of older.
+    static constexpr size_t k_window_size = 0x8000;
+
     explicit PacketStats() = default;
 
     /**
      * Updates the statistics with the given packet.
+     * Constant time and allocation free (apart from marking a gap, which is linear in the number of missing words).
      * @param sequence_number The sequence number of the incoming packet.
      * @return Returns the total counts if changed.
      */
@@ -93,11 +105,12 @@ class PacketStats {
 
         if (!most_recent_sequence_number_) {
             most_recent_sequence_number_ = packet_sequence_number;
+            clear_dropped(sequence_number);
             return std::nullopt;
         }
 
         if (packet_sequence_number <= most_recent_sequence_number_) {
-            if (remove_dropped(sequence_number)) {
+            if (test_and_clear_dropped(sequence_number)) {
                 --totals_.dropped;
                 ++totals_.out_of_order;
             } else {
@@ -108,14 +121,15 @@ class PacketStats {
         }
 
         if (const auto diff = most_recent_sequence_number_->update(sequence_number)) {
-            clear_outdated_dropped_packets();
-
-            for (uint16_t i = 1; i < *diff; i++) {
-                ++totals_.dropped;
-                // TODO: avoid heap allocation (since this is used on the network thread).
-                dropped_packets_.push_back(sequence_number - i);
+            // Marking the gap overwrites the bits of the sequence numbers which are now older than the window, which
+            // expires them implicitly.
+            if (*diff > 1) {
+                const auto num_dropped = static_cast<uint16_t>(*diff - 1);
+                mark_dropped(static_cast<uint16_t>(sequence_number - num_dropped), num_dropped);
+                totals_.dropped += num_dropped;
                 dirty_ = true;
             }
+            clear_dropped(sequence_number);
 
             if (dirty_) {
                 dirty_ = false;
@@ -158,35 +172,46 @@ class PacketStats {
     void reset() {
         most_recent_sequence_number_ = {};
         totals_ = {};
+        dirty_ = {};
+        dropped_ = {};
     }
 
   private:
+    static constexpr size_t k_bits_per_word = 64;
+
     std::optional<WrappingUint16> most_recent_sequence_number_ {};
     Counters totals_ {};
     bool dirty_ {};
-    std::vector<uint16_t> dropped_packets_ {};
-
-    bool remove_dropped(const uint16_t sequence_number) {
-        for (auto& s : dropped_packets_) {
-            if (s == sequence_number) {
-                s = dropped_packets_.back();
-                dropped_packets_.pop_back();
-                return true;
-            }
-        }
+    std::array<uint64_t, k_window_size / k_bits_per_word> dropped_ {};  // One bit per sequence number in the window
 
-        return false;
+    static size_t to_index(const uint16_t sequence_number) {
+        return sequence_number & (k_window_size - 1);
     }
 
-    void clear_outdated_dropped_packets() {
-        const auto most_recent = *most_recent_sequence_number_;
-        for (auto it = dropped_packets_.begin(); it != dropped_packets_.end();) {
-            // If a packet is newer than the most recent packet, it's older than half the range of uint16.
-            if (WrappingUint16(*it) > most_recent) {
-                it = dropped_packets_.erase(it);
-            } else {
-                ++it;
-            }
+    bool test_and_clear_dropped(const uint16_t sequence_number) {
+        const auto index = to_index(sequence_number);
+        const auto mask = uint64_t {1} << index % k_bits_per_word;
+        auto& word = dropped_[index / k_bits_per_word];
+        const bool was_dropped = (word & mask) != 0;
+        word &= ~mask;
+        return was_dropped;
+    }
+
+    void clear_dropped(const uint16_t sequence_number) {
+        const auto index = to_index(sequence_number);
+        dropped_[index / k_bits_per_word] &= ~(uint64_t {1} << index % k_bits_per_word);
+    }
+
+    void mark_dropped(const uint16_t first_sequence_number, size_t count) {
+        RAV_ASSERT_DEBUG(count <= k_window_size, "Count exceeds the window size");
+        auto index = to_index(first_sequence_number);
+        while (count > 0) {
+            const auto bit = index % k_bits_per_word;
+            const auto n = std::min(count, k_bits_per_word - bit);
+            const auto mask = n == k_bits_per_word ? ~uint64_t {0} : ((uint64_t {1} << n) - 1) << bit;
+            dropped_[index / k_bits_per_word] |= mask;
+            index = (index + n) & (k_window_size - 1);
+            count -= n;
         }
     }
 };
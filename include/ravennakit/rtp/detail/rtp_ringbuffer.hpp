@@ -27,6 +27,7 @@
 #include "ravennakit/core/containers/fifo_buffer.hpp"
 #include "ravennakit/rtp/rtp_packet_view.hpp"
 #include "ravennakit/core/log.hpp"
+#include "ravennakit/core/memory/arena.hpp"
 #include "ravennakit/core/util/wrapping_uint.hpp"
 
 namespace rav::rtp {
@@ -143,6 +144,32 @@ class Ringbuffer {
         return true;
     }
 
+    /**
+     * Copies the frames in a range of timestamps from another buffer into this buffer, at the same timestamps. Only touches
+     * the given range, and doesn't allocate, so it's safe to call from the audio thread.
+     * @param other The buffer to copy from.
+     * @param from_timestamp The timestamp of the first frame to copy.
+     * @param num_frames The number of frames to copy.
+     * @returns true if the frames were copied, or false if the buffers differ in frame size or the range doesn't fit.
+     */
+    bool copy_from(const Ringbuffer& other, const uint32_t from_timestamp, const uint32_t num_frames) {
+        const auto num_bytes = static_cast<size_t>(num_frames) * bytes_per_frame_;
+        if (other.bytes_per_frame_ != bytes_per_frame_ || num_bytes > buffer_.size() || num_bytes > other.buffer_.size()) {
+            return false;
+        }
+        if (num_bytes == 0) {
+            return true;
+        }
+
+        const Fifo::Position position(static_cast<size_t>(from_timestamp) * bytes_per_frame_, other.buffer_.size(), num_bytes);
+        write(from_timestamp, {other.buffer_.data() + position.index1, position.size1});
+        if (position.size2 > 0) {
+            const auto size1_frames = static_cast<uint32_t>(position.size1 / bytes_per_frame_);
+            write(from_timestamp + size1_frames, {other.buffer_.data(), position.size2});
+        }
+        return true;
+    }
+
     /**
      * Clears all data by filling with the ground value.
      */
@@ -177,7 +204,7 @@ class Ringbuffer {
   private:
     uint32_t bytes_per_frame_ = 0;  // Number of bytes (octets) per frame
     WrappingUint32 next_ts_;        // Producer ts
-    std::vector<uint8_t> buffer_;   // Stores the actual data
+    ArenaVector<uint8_t> buffer_;   // Stores the actual data
     uint8_t ground_value_ = 0;      // Value to clear the buffer with.
 };
 
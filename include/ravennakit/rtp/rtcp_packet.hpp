@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include "ravennakit/core/containers/byte_buffer.hpp"
+#include "ravennakit/ntp/ntp_timestamp.hpp"
+
+#include <boost/container/static_vector.hpp>
+
+namespace rav::rtcp {
+
+/**
+ * Holds the reception statistics for a single source, as carried inside sender and receiver reports.
+ */
+struct ReportBlock {
+    /// The SSRC of the source this report block is about.
+    uint32_t ssrc {};
+    /// The fraction of packets lost since the previous report, as a fixed point number with the binary point at the
+    /// left edge of the field.
+    uint8_t fraction_lost {};
+    /// The cumulative number of packets lost. Will be clamped to a 24-bit signed value when encoded.
+    int32_t number_of_packets_lost {};
+    /// The extended highest sequence number received.
+    uint32_t extended_highest_sequence_number_received {};
+    /// The inter-arrival jitter in timestamp units.
+    uint32_t inter_arrival_jitter {};
+    /// The middle 32 bits of the NTP timestamp of the last received sender report, or 0 if none was received.
+    uint32_t last_sr_timestamp {};
+    /// The delay since receiving the last sender report in units of 1/65536 seconds, or 0 if none was received.
+    uint32_t delay_since_last_sr {};
+
+    /**
+     * Encodes the report block into given buffer.
+     * @param buffer The buffer to write to.
+     */
+    void encode(ByteBuffer& buffer) const;
+};
+
+/**
+ * The maximum number of report blocks which fit in a single sender or receiver report.
+ */
+static constexpr size_t k_max_num_report_blocks = 31;
+
+/**
+ * Holds the state for an RTCP sender report and provides a method to encode it.
+ */
+struct SenderReport {
+    /// The SSRC of the sender.
+    uint32_t ssrc {};
+    /// The wallclock time at which this report was sent.
+    ntp::Timestamp ntp_timestamp {};
+    /// The RTP timestamp corresponding to ntp_timestamp.
+    uint32_t rtp_timestamp {};
+    /// The total number of RTP packets sent.
+    uint32_t packet_count {};
+    /// The total number of payload octets sent.
+    uint32_t octet_count {};
+    /// Optional reception report blocks, when the sender is also receiving.
+    boost::container::static_vector<ReportBlock, k_max_num_report_blocks> report_blocks;
+
+    /**
+     * Encodes the sender report into given buffer. This method writes to the buffer as-is, the caller is responsible
+     * to prepare the buffer (clear it after previous calls).
+     * @param buffer The buffer to write to.
+     */
+    void encode(ByteBuffer& buffer) const;
+};
+
+/**
+ * Holds the state for an RTCP receiver report and provides a method to encode it.
+ */
+struct ReceiverReport {
+    /// The SSRC of the receiver sending this report.
+    uint32_t ssrc {};
+    /// The reception report blocks.
+    boost::container::static_vector<ReportBlock, k_max_num_report_blocks> report_blocks;
+
+    /**
+     * Encodes the receiver report into given buffer. This method writes to the buffer as-is, the caller is responsible
+     * to prepare the buffer (clear it after previous calls).
+     * @param buffer The buffer to write to.
+     */
+    void encode(ByteBuffer& buffer) const;
+};
+
+}  // namespace rav::rtcp
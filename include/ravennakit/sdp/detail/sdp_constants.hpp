@@ -38,6 +38,7 @@ constexpr auto k_sdp_sync_time = "sync-time";
 constexpr auto k_sdp_group = "group";
 constexpr auto k_sdp_clock_deviation = "clock-deviation";
 constexpr auto k_sdp_mid = "mid";
+constexpr auto k_sdp_framecount = "framecount";
 constexpr auto k_sdp_inet = "IN";
 constexpr auto k_sdp_ipv4 = "IP4";
 constexpr auto k_sdp_ipv6 = "IP6";
@@ -24,4 +24,5 @@
 
 #pragma once
 
+#include "sdp_diff.hpp"
 #include "sdp_session_description.hpp"
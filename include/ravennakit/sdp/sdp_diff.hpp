@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#pragma once
+
+#include <string_view>
+
+namespace rav::sdp {
+
+/**
+ * Classification of the difference between two versions of a session description.
+ */
+enum class Difference {
+    /// The descriptions are equivalent (possibly apart from line endings or blank lines).
+    none,
+    /// Only information which doesn't affect the data path changed, like the origin version, names or clock info.
+    metadata,
+    /// Something changed which affects which packets are received or how they are decoded.
+    data_path,
+};
+
+/**
+ * @param difference The difference to get the name for.
+ * @return The name of the difference.
+ */
+const char* to_string(Difference difference);
+
+/**
+ * Classifies the difference between two SDP texts without parsing them into a SessionDescription. The lines are
+ * compared as views into the given texts, so nothing is copied or allocated. Connection (c=) and media (m=) lines and
+ * the rtpmap, ptime, framecount, source-filter, mid and group attributes are considered to be part of the data path,
+ * all other lines are metadata. Data path lines are compared in order, which means that reordering them is reported as
+ * a data path change even if the parsed result would be the same.
+ * @param previous_sdp_text The previous SDP text.
+ * @param new_sdp_text The new SDP text.
+ * @return The difference between the texts.
+ */
+[[nodiscard]] Difference diff(std::string_view previous_sdp_text, std::string_view new_sdp_text);
+
+}  // namespace rav::sdp
@@ -0,0 +1,364 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/async_logger.hpp"
+#include "ravennakit/core/containers/detail/fifo.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+constexpr size_t k_record_alignment = 8;
+
+size_t align_record_size(const size_t size) {
+    return (size + k_record_alignment - 1) & ~(k_record_alignment - 1);
+}
+
+#if !RAV_ENABLE_SPDLOG
+char level_prefix(const LogLevel level) {
+    switch (level) {
+        case LogLevel::critical:
+            return 'C';
+        case LogLevel::error:
+            return 'E';
+        case LogLevel::warning:
+            return 'W';
+        case LogLevel::info:
+            return 'I';
+        case LogLevel::debug:
+            return 'D';
+        case LogLevel::trace:
+        case LogLevel::off:
+        default:
+            return 'T';
+    }
+}
+#endif
+
+}  // namespace
+
+/**
+ * Single-producer single-consumer ring of variable sized records. A record which doesn't fit before the end of the
+ * buffer is placed at the start, the space in between is skipped by the consumer.
+ */
+class rav::AsyncLogger::Ring {
+  public:
+    std::atomic<uint64_t> logged {0};
+    std::atomic<uint64_t> dropped {0};
+    std::atomic<bool> abandoned {false};
+    uint64_t reported_dropped {0};
+
+    explicit Ring(const size_t capacity) : data_(std::make_unique<uint8_t[]>(capacity)), capacity_(capacity) {}
+
+    /**
+     * Producer side. Reserves space for a record.
+     * @param size The size of the record, a multiple of k_record_alignment.
+     * @return A pointer to the reserved space, or nullptr if the ring is full.
+     */
+    uint8_t* prepare(const size_t size) {
+        if (size > capacity_ / 2) {
+            return nullptr;
+        }
+
+        const auto head = head_.load(std::memory_order_relaxed);
+        const auto offset = head % capacity_;
+        const auto padding = offset + size > capacity_ ? capacity_ - offset : 0;
+        const auto required = padding + size;
+
+        if (capacity_ - (head - cached_tail_) < required) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (capacity_ - (head - cached_tail_) < required) {
+                return nullptr;
+            }
+        }
+
+        if (padding >= sizeof(RecordHeader)) {
+            RecordHeader marker;
+            marker.size = static_cast<uint32_t>(padding);
+            std::memcpy(data_.get() + offset, &marker, sizeof(marker));
+        }
+
+        pending_head_ = head + required;
+        return data_.get() + (padding > 0 ? 0 : offset);
+    }
+
+    /**
+     * Producer side. Publishes the record reserved by the last call to prepare().
+     */
+    void commit() {
+        head_.store(pending_head_, std::memory_order_release);
+        logged.store(logged.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Consumer side. Calls handler for every record in the ring and releases the space afterward.
+     * @param handler Called as handler(header, payload).
+     */
+    template<class Handler>
+    void drain(Handler&& handler) {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        const auto head = head_.load(std::memory_order_acquire);
+
+        while (tail != head) {
+            const auto offset = tail % capacity_;
+            const auto remaining = capacity_ - offset;
+            if (remaining < sizeof(RecordHeader)) {
+                tail += remaining;
+                continue;
+            }
+
+            RecordHeader header;
+            std::memcpy(&header, data_.get() + offset, sizeof(header));
+            if (header.site != nullptr) {
+                handler(header, data_.get() + offset + sizeof(RecordHeader));
+            }
+            tail += header.size;
+        }
+
+        tail_.store(tail, std::memory_order_release);
+    }
+
+    [[nodiscard]] bool empty() const {
+        return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire);
+    }
+
+  private:
+    std::unique_ptr<uint8_t[]> data_;
+    size_t capacity_ {};
+
+    alignas(Fifo::k_cache_line_size) std::atomic<size_t> head_ {0};
+    size_t pending_head_ {0};
+    size_t cached_tail_ {0};
+
+    alignas(Fifo::k_cache_line_size) std::atomic<size_t> tail_ {0};
+};
+
+rav::AsyncLogger& rav::AsyncLogger::instance() {
+    // Never destroyed: threads may still log during static destruction. The atexit handler drains what is left.
+    static AsyncLogger* logger = [] {
+        auto* l = new AsyncLogger();
+        std::atexit([] {
+            instance().shutdown();
+        });
+        return l;
+    }();
+    return *logger;
+}
+
+rav::AsyncLogger::AsyncLogger() = default;
+
+rav::AsyncLogger::~AsyncLogger() {
+    shutdown();
+}
+
+void rav::AsyncLogger::flush() {
+    std::lock_guard lock(drain_mutex_);
+    drain_locked();
+}
+
+void rav::AsyncLogger::shutdown() {
+    {
+        std::lock_guard lock(thread_mutex_);
+        stop_thread_ = true;
+    }
+    thread_condition_.notify_all();
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    std::lock_guard lock(drain_mutex_);
+    drain_locked();
+    shut_down_.store(true, std::memory_order_release);
+    drain_locked();
+}
+
+void rav::AsyncLogger::set_sink(Sink sink) {
+    std::lock_guard lock(drain_mutex_);
+    sink_ = std::move(sink);
+}
+
+void rav::AsyncLogger::prepare_thread() {
+    std::ignore = thread_ring();
+}
+
+rav::AsyncLogger::Counters rav::AsyncLogger::get_counters() const {
+    std::lock_guard lock(registry_mutex_);
+    auto counters = retired_counters_;
+    for (const auto& ring : rings_) {
+        counters.logged += ring->logged.load(std::memory_order_relaxed);
+        counters.dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    counters.rate_limited = rate_limited_.load(std::memory_order_relaxed);
+    return counters;
+}
+
+rav::AsyncLogger::Reservation rav::AsyncLogger::prepare(const size_t size) {
+    if (shut_down_.load(std::memory_order_acquire)) {
+        return {};
+    }
+
+    auto* ring = thread_ring();
+    const auto aligned_size = align_record_size(size);
+    auto* data = ring->prepare(aligned_size);
+    if (data == nullptr) {
+        ring->dropped.store(ring->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    return {ring, data, aligned_size};
+}
+
+void rav::AsyncLogger::commit(const Reservation& reservation) {
+    reservation.ring->commit();
+}
+
+void rav::AsyncLogger::write_sync(const LogLevel level, const std::string_view message) {
+    std::lock_guard lock(drain_mutex_);
+    emit_locked(level, message);
+}
+
+rav::AsyncLogger::Ring* rav::AsyncLogger::thread_ring() {
+    struct ThreadRing {
+        Ring* ring {};
+
+        ~ThreadRing() {
+            if (ring != nullptr) {
+                ring->abandoned.store(true, std::memory_order_release);
+                ring = nullptr;  // The background thread frees abandoned rings
+            }
+        }
+    };
+
+    thread_local ThreadRing thread_ring;
+
+    if (thread_ring.ring == nullptr) {
+        auto ring = std::make_unique<Ring>(k_ring_capacity);
+        thread_ring.ring = ring.get();
+
+        std::lock_guard lock(registry_mutex_);
+        rings_.push_back(std::move(ring));
+        if (!thread_.joinable() && !shut_down_.load(std::memory_order_acquire)) {
+            thread_ = std::thread([this] {
+                run();
+            });
+        }
+    }
+
+    return thread_ring.ring;
+}
+
+void rav::AsyncLogger::run() {
+    while (true) {
+        {
+            std::lock_guard lock(drain_mutex_);
+            drain_locked();
+        }
+
+        std::unique_lock lock(thread_mutex_);
+        if (thread_condition_.wait_for(lock, k_drain_interval, [this] {
+                return stop_thread_;
+            })) {
+            return;
+        }
+    }
+}
+
+void rav::AsyncLogger::drain_locked() {
+    drain_list_.clear();
+    {
+        std::lock_guard lock(registry_mutex_);
+        for (const auto& ring : rings_) {
+            drain_list_.push_back(ring.get());
+        }
+    }
+
+    bool has_abandoned_rings = false;
+
+    for (auto* ring : drain_list_) {
+        const auto abandoned = ring->abandoned.load(std::memory_order_acquire);
+
+        ring->drain([this](const RecordHeader& header, const uint8_t* payload) {
+            const fmt::string_view format(header.format, header.format_size);
+            drain_buffer_.clear();
+            try {
+                header.decode(payload, format, drain_buffer_);
+            } catch (const fmt::format_error& e) {
+                drain_buffer_.clear();
+                fmt::format_to(fmt::appender(drain_buffer_), "{} (format error: {})", format, e.what());
+            }
+            if (header.suppressed > 0) {
+                fmt::format_to(fmt::appender(drain_buffer_), " ({} similar messages suppressed)", header.suppressed);
+            }
+            emit_locked(header.site->level, std::string_view(drain_buffer_.data(), drain_buffer_.size()));
+        });
+
+        const auto dropped = ring->dropped.load(std::memory_order_relaxed);
+        if (dropped != ring->reported_dropped) {
+            drain_buffer_.clear();
+            fmt::format_to(
+                fmt::appender(drain_buffer_), "{} log messages dropped because the log ring of a thread was full",
+                dropped - ring->reported_dropped
+            );
+            emit_locked(LogLevel::warning, std::string_view(drain_buffer_.data(), drain_buffer_.size()));
+            ring->reported_dropped = dropped;
+        }
+
+        has_abandoned_rings |= abandoned;
+    }
+
+    if (!has_abandoned_rings) {
+        return;
+    }
+
+    std::lock_guard lock(registry_mutex_);
+    rings_.erase(
+        std::remove_if(
+            rings_.begin(), rings_.end(),
+            [this](const std::unique_ptr<Ring>& ring) {
+                // Only rings which were abandoned before draining are guaranteed to be drained completely.
+                if (!ring->abandoned.load(std::memory_order_acquire) || !ring->empty()
+                    || ring->reported_dropped != ring->dropped.load(std::memory_order_relaxed)) {
+                    return false;
+                }
+                retired_counters_.logged += ring->logged.load(std::memory_order_relaxed);
+                retired_counters_.dropped += ring->dropped.load(std::memory_order_relaxed);
+                return true;
+            }
+        ),
+        rings_.end()
+    );
+}
+
+void rav::AsyncLogger::emit_locked(const LogLevel level, const std::string_view message) {
+    if (sink_) {
+        sink_(level, message);
+        return;
+    }
+
+#if RAV_ENABLE_SPDLOG
+    spdlog::default_logger_raw()->log(to_spdlog_level(level), spdlog::string_view_t(message.data(), message.size()));
+#else
+    fmt::println("[{}] {}", level_prefix(level), message);
+#endif
+}
@@ -0,0 +1,280 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/byte_order.hpp"
+
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define RAV_BYTE_ORDER_SSSE3 1
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define RAV_TARGET_SSSE3
+    #else
+        #include <cpuid.h>
+        #define RAV_TARGET_SSSE3 __attribute__((target("ssse3")))
+    #endif
+    #include <tmmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #define RAV_BYTE_ORDER_NEON 1
+    #include <arm_neon.h>
+#endif
+
+namespace {
+
+template<size_t Stride>
+void swap_samples_scalar(const uint8_t* src, uint8_t* dst, const size_t num_samples) {
+    for (size_t i = 0; i < num_samples * Stride; i += Stride) {
+        if constexpr (Stride == 2) {
+            uint16_t value;
+            std::memcpy(&value, src + i, sizeof(value));
+            value = RAV_BYTE_SWAP_16(value);
+            std::memcpy(dst + i, &value, sizeof(value));
+        } else if constexpr (Stride == 3) {
+            const auto first = src[i];
+            dst[i] = src[i + 2];
+            dst[i + 1] = src[i + 1];
+            dst[i + 2] = first;
+        } else if constexpr (Stride == 4) {
+            uint32_t value;
+            std::memcpy(&value, src + i, sizeof(value));
+            value = RAV_BYTE_SWAP_32(value);
+            std::memcpy(dst + i, &value, sizeof(value));
+        }
+    }
+}
+
+void swap_samples_scalar(const uint8_t* src, uint8_t* dst, const size_t num_samples, const size_t stride) {
+    if (src == dst) {
+        for (size_t i = 0; i < num_samples * stride; i += stride) {
+            for (size_t j = 0; j < stride / 2; ++j) {
+                std::swap(dst[i + j], dst[i + stride - j - 1]);
+            }
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < num_samples * stride; i += stride) {
+        for (size_t j = 0; j < stride; ++j) {
+            dst[i + j] = src[i + stride - j - 1];
+        }
+    }
+}
+
+#if RAV_BYTE_ORDER_SSSE3
+
+bool has_ssse3() {
+    #if defined(__SSSE3__) || defined(__AVX__)
+    return true;
+    #elif defined(_MSC_VER) && !defined(__clang__)
+    int info[4] {};
+    __cpuid(info, 1);
+    return (info[2] & (1 << 9)) != 0;
+    #else
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & bit_SSSE3) != 0;
+    #endif
+}
+
+const bool k_has_ssse3 = has_ssse3();
+
+// Shuffle masks which reverse the bytes of every sample in a vector.
+alignas(16) constexpr uint8_t k_shuffle_2[16] = {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+alignas(16) constexpr uint8_t k_shuffle_4[16] = {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+
+// Three byte samples cross vector boundaries: 48 bytes (16 samples) are processed as three vectors, every output vector
+// combining the shuffled bytes of up to three input vectors. The masks are [output vector][input vector], 0x80 zeroes.
+alignas(16) constexpr uint8_t k_shuffle_3[3][3][16] = {
+    {
+        {2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 0x80},
+        {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 1},
+        {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+    },
+    {
+        {0x80, 15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0, 0x80, 4, 3, 2, 7, 6, 5, 10, 9, 8, 13, 12, 11, 0x80, 15},
+        {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0, 0x80},
+    },
+    {
+        {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {14, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x80, 3, 2, 1, 6, 5, 4, 9, 8, 7, 12, 11, 10, 15, 14, 13},
+    },
+};
+
+RAV_TARGET_SSSE3 __m128i load_mask(const uint8_t* mask) {
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(mask));
+}
+
+/**
+ * Swaps as many 2 or 4 byte samples as possible using 16 byte shuffles.
+ * @return The number of bytes processed.
+ */
+RAV_TARGET_SSSE3 size_t swap_bytes_ssse3(const uint8_t* src, uint8_t* dst, const size_t size, const uint8_t* shuffle) {
+    const auto mask = load_mask(shuffle);
+    size_t i = 0;
+
+    for (; i + 64 <= size; i += 64) {
+        const auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16));
+        const auto v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 32));
+        const auto v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 48));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v0, mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 16), _mm_shuffle_epi8(v1, mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 32), _mm_shuffle_epi8(v2, mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 48), _mm_shuffle_epi8(v3, mask));
+    }
+
+    for (; i + 16 <= size; i += 16) {
+        const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, mask));
+    }
+
+    return i;
+}
+
+/**
+ * Swaps as many 3 byte samples as possible, 16 samples at a time.
+ * @return The number of bytes processed.
+ */
+RAV_TARGET_SSSE3 size_t swap_bytes_ssse3_3(const uint8_t* src, uint8_t* dst, const size_t size) {
+    const auto m00 = load_mask(k_shuffle_3[0][0]);
+    const auto m01 = load_mask(k_shuffle_3[0][1]);
+    const auto m10 = load_mask(k_shuffle_3[1][0]);
+    const auto m11 = load_mask(k_shuffle_3[1][1]);
+    const auto m12 = load_mask(k_shuffle_3[1][2]);
+    const auto m21 = load_mask(k_shuffle_3[2][1]);
+    const auto m22 = load_mask(k_shuffle_3[2][2]);
+    size_t i = 0;
+
+    for (; i + 48 <= size; i += 48) {
+        const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16));
+        const auto c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 32));
+        const auto o0 = _mm_or_si128(_mm_shuffle_epi8(a, m00), _mm_shuffle_epi8(b, m01));
+        const auto o1 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, m10), _mm_shuffle_epi8(b, m11)), _mm_shuffle_epi8(c, m12));
+        const auto o2 = _mm_or_si128(_mm_shuffle_epi8(b, m21), _mm_shuffle_epi8(c, m22));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), o0);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 16), o1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 32), o2);
+    }
+
+    return i;
+}
+
+template<size_t Stride>
+size_t swap_bytes_simd(const uint8_t* src, uint8_t* dst, const size_t size) {
+    if (!k_has_ssse3) {
+        return 0;
+    }
+    if constexpr (Stride == 2) {
+        return swap_bytes_ssse3(src, dst, size, k_shuffle_2);
+    } else if constexpr (Stride == 3) {
+        return swap_bytes_ssse3_3(src, dst, size);
+    } else {
+        return swap_bytes_ssse3(src, dst, size, k_shuffle_4);
+    }
+}
+
+#elif RAV_BYTE_ORDER_NEON
+
+template<size_t Stride>
+size_t swap_bytes_simd(const uint8_t* src, uint8_t* dst, const size_t size) {
+    size_t i = 0;
+    if constexpr (Stride == 3) {
+        // De-interleave 16 samples into byte planes, and interleave them again with the outer planes exchanged
+        for (; i + 48 <= size; i += 48) {
+            auto planes = vld3q_u8(src + i);
+            std::swap(planes.val[0], planes.val[2]);
+            vst3q_u8(dst + i, planes);
+        }
+    } else {
+        for (; i + 32 <= size; i += 32) {
+            const auto v0 = vld1q_u8(src + i);
+            const auto v1 = vld1q_u8(src + i + 16);
+            if constexpr (Stride == 2) {
+                vst1q_u8(dst + i, vrev16q_u8(v0));
+                vst1q_u8(dst + i + 16, vrev16q_u8(v1));
+            } else {
+                vst1q_u8(dst + i, vrev32q_u8(v0));
+                vst1q_u8(dst + i + 16, vrev32q_u8(v1));
+            }
+        }
+    }
+    return i;
+}
+
+#else
+
+template<size_t Stride>
+size_t swap_bytes_simd(const uint8_t*, uint8_t*, size_t) {
+    return 0;
+}
+
+#endif
+
+template<size_t Stride>
+void swap_bytes_strided(const uint8_t* src, uint8_t* dst, const size_t size) {
+    const auto done = swap_bytes_simd<Stride>(src, dst, size);
+    swap_samples_scalar<Stride>(src + done, dst + done, (size - done) / Stride);
+}
+
+}  // namespace
+
+void rav::swap_bytes(uint8_t* data, const size_t size, const size_t stride) {
+    swap_bytes_copy(data, data, size, stride);
+}
+
+void rav::swap_bytes_copy(const uint8_t* src, uint8_t* dst, const size_t size, const size_t stride) {
+    if (src == nullptr || dst == nullptr || size == 0) {
+        return;
+    }
+
+    if (stride <= 1) {
+        if (src != dst) {
+            std::memcpy(dst, src, size);
+        }
+        return;
+    }
+
+    switch (stride) {
+        case 2:
+            swap_bytes_strided<2>(src, dst, size);
+            break;
+        case 3:
+            swap_bytes_strided<3>(src, dst, size);
+            break;
+        case 4:
+            swap_bytes_strided<4>(src, dst, size);
+            break;
+        default:
+            swap_samples_scalar(src, dst, size / stride, stride);
+            break;
+    }
+
+    // Copy the incomplete sample at the end, if any
+    if (const auto remainder = size % stride; remainder > 0 && src != dst) {
+        std::memcpy(dst + size - remainder, src + size - remainder, remainder);
+    }
+}
@@ -41,18 +41,12 @@ void rav::Fifo::Position::update(const size_t timestamp, const size_t capacity,
     }
 }
 
-size_t rav::Fifo::Spmc::size() const {
-    return write_ts_.load() - read_ts_.load();
-}
-
 rav::Fifo::Single::Lock rav::Fifo::Single::prepare_for_write(const size_t number_of_elements) {
     if (write_ts_ - read_ts_ + number_of_elements > capacity_) {
         return {};
     }
 
-    Lock write_lock([this, number_of_elements] {
-        write_ts_ += number_of_elements;
-    });
+    Lock write_lock(&write_ts_, write_ts_ + number_of_elements);
     write_lock.position.update(write_ts_, capacity_, number_of_elements);
     return write_lock;
 }
@@ -62,9 +56,7 @@ rav::Fifo::Single::Lock rav::Fifo::Single::prepare_for_read(const size_t number_
         return {};
     }
 
-    Lock read_lock([this, number_of_elements] {
-        read_ts_ += number_of_elements;
-    });
+    Lock read_lock(&read_ts_, read_ts_ + number_of_elements);
     read_lock.position.update(read_ts_, capacity_, number_of_elements);
     return read_lock;
 }
@@ -73,180 +65,32 @@ size_t rav::Fifo::Single::size() const {
     return write_ts_ - read_ts_;
 }
 
-void rav::Fifo::Single::resize(const size_t capacity) {
-    reset();
-    capacity_ = capacity;
-}
-
-void rav::Fifo::Single::reset() {
-    read_ts_ = 0;
-    write_ts_ = 0;
-}
-
-rav::Fifo::Spsc::Lock rav::Fifo::Spsc::prepare_for_write(const size_t number_of_elements) {
-    if (write_ts_.load() - read_ts_.load() + number_of_elements > capacity_) {
-        return {};  // Not enough free space in buffer.
-    }
-
-    Lock write_lock([this, number_of_elements] {
-        write_ts_.fetch_add(number_of_elements);
-    });
-    write_lock.position.update(write_ts_, capacity_, number_of_elements);
-    return write_lock;
-}
-
-rav::Fifo::Spsc::Lock rav::Fifo::Spsc::prepare_for_read(const size_t number_of_elements) {
-    if (write_ts_.load() - read_ts_.load() < number_of_elements) {
-        return {};  // Not enough data available.
-    }
-
-    Lock read_lock([this, number_of_elements] {
-        read_ts_.fetch_add(number_of_elements);
-    });
-    read_lock.position.update(read_ts_, capacity_, number_of_elements);
-    return read_lock;
-}
-
-size_t rav::Fifo::Spsc::size() const {
-    return write_ts_.load() - read_ts_.load();
-}
-
-void rav::Fifo::Spsc::resize(const size_t capacity) {
-    reset();
-    capacity_ = capacity;
-}
-
-void rav::Fifo::Spsc::reset() {
-    read_ts_ = 0;
-    write_ts_ = 0;
-}
-
-rav::Fifo::Mpsc::Lock rav::Fifo::Mpsc::prepare_for_write(const size_t number_of_elements) {
-    std::unique_lock guard(mutex_);
-
-    if (write_ts_.load() - read_ts_.load() + number_of_elements > capacity_) {
-        return {};  // Not enough free space in buffer.
-    }
-
-    Lock write_lock(
-        [this, number_of_elements] {
-            write_ts_.fetch_add(number_of_elements);
-        },
-        std::move(guard)
-    );
-    write_lock.position.update(write_ts_, capacity_, number_of_elements);
-    return write_lock;
-}
-
-rav::Fifo::Mpsc::Lock rav::Fifo::Mpsc::prepare_for_read(const size_t number_of_elements) {
-    if (write_ts_.load() - read_ts_.load() < number_of_elements) {
-        return {};  // Not enough data available.
-    }
-    Lock read_lock([this, number_of_elements] {
-        read_ts_.fetch_add(number_of_elements);
-    });
-    read_lock.position.update(read_ts_, capacity_, number_of_elements);
-    return read_lock;
-}
-
-size_t rav::Fifo::Mpsc::size() const {
-    return write_ts_.load() - read_ts_.load();
-}
-
-void rav::Fifo::Mpsc::resize(const size_t capacity) {
-    reset();
-    capacity_ = capacity;
-}
-
-void rav::Fifo::Mpsc::reset() {
-    read_ts_ = 0;
-    write_ts_ = 0;
-}
-
-rav::Fifo::Spmc::Lock rav::Fifo::Spmc::prepare_for_write(const size_t number_of_elements) {
-    if (write_ts_.load() - read_ts_.load() + number_of_elements > capacity_) {
-        return {};  // Not enough free space in buffer.
-    }
-
-    Lock write_lock([this, number_of_elements] {
-        write_ts_.fetch_add(number_of_elements);
-    });
-    write_lock.position.update(write_ts_, capacity_, number_of_elements);
-    return write_lock;
-}
-
-rav::Fifo::Spmc::Lock rav::Fifo::Spmc::prepare_for_read(const size_t number_of_elements) {
-    std::unique_lock guard(mutex_);
-
-    if (write_ts_.load() - read_ts_.load() < number_of_elements) {
-        return {};  // Not enough data available.
-    }
-
-    Lock read_lock(
-        [this, number_of_elements] {
-            read_ts_.fetch_add(number_of_elements);
-        },
-        std::move(guard)
-    );
-    read_lock.position.update(read_ts_, capacity_, number_of_elements);
-    return read_lock;
-}
-
-void rav::Fifo::Spmc::resize(const size_t capacity) {
-    reset();
-    capacity_ = capacity;
-}
-
-void rav::Fifo::Spmc::reset() {
-    read_ts_ = 0;
-    write_ts_ = 0;
+size_t rav::Fifo::Single::num_readable() const {
+    return write_ts_ - read_ts_;
 }
 
-rav::Fifo::Mpmc::Lock rav::Fifo::Mpmc::prepare_for_write(const size_t number_of_elements) {
-    std::unique_lock guard(mutex_);
-
+bool rav::Fifo::Single::commit_write(const size_t number_of_elements) {
     if (write_ts_ - read_ts_ + number_of_elements > capacity_) {
-        return {};  // Not enough free space in buffer.
+        return false;
     }
-
-    Lock write_lock(
-        [this, number_of_elements] {
-            write_ts_ += number_of_elements;
-        },
-        std::move(guard)
-    );
-    write_lock.position.update(write_ts_, capacity_, number_of_elements);
-    return write_lock;
+    write_ts_ += number_of_elements;
+    return true;
 }
 
-rav::Fifo::Mpmc::Lock rav::Fifo::Mpmc::prepare_for_read(const size_t number_of_elements) {
-    std::unique_lock guard(mutex_);
-
+bool rav::Fifo::Single::commit_read(const size_t number_of_elements) {
     if (write_ts_ - read_ts_ < number_of_elements) {
-        return {};  // Not enough data available.
+        return false;
     }
-
-    Lock read_lock(
-        [this, number_of_elements] {
-            read_ts_ += number_of_elements;
-        },
-        std::move(guard)
-    );
-    read_lock.position.update(read_ts_, capacity_, number_of_elements);
-    return read_lock;
+    read_ts_ += number_of_elements;
+    return true;
 }
 
-size_t rav::Fifo::Mpmc::size() {
-    std::unique_lock guard(mutex_);
-    return write_ts_ - read_ts_;
-}
-
-void rav::Fifo::Mpmc::resize(const size_t capacity) {
+void rav::Fifo::Single::resize(const size_t capacity) {
     reset();
     capacity_ = capacity;
 }
 
-void rav::Fifo::Mpmc::reset() {
+void rav::Fifo::Single::reset() {
     read_ts_ = 0;
     write_ts_ = 0;
 }
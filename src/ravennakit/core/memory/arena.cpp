@@ -0,0 +1,362 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/memory/arena.hpp"
+
+#include "ravennakit/core/log.hpp"
+#include "ravennakit/core/platform.hpp"
+
+#if RAV_WINDOWS
+    #include <windows.h>
+#elif RAV_POSIX
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+struct alignas(rav::Arena::k_alignment) rav::Arena::Header {
+    Arena* arena;           // The arena this block is accounted to, or nullptr for plain heap blocks.
+    const char* subsystem;  // The subsystem this block is accounted to, or nullptr for plain heap blocks.
+    size_t size;            // The size of the block including this header.
+    bool in_arena;          // Whether the block lives inside the region of the arena.
+};
+
+namespace {
+
+size_t round_up(const size_t value, const size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+size_t get_page_size() {
+#if RAV_WINDOWS
+    SYSTEM_INFO info {};
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#elif RAV_POSIX
+    const auto page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? static_cast<size_t>(page_size) : 4096;
+#else
+    return 4096;
+#endif
+}
+
+}  // namespace
+
+rav::Arena::Scope::Scope(Arena& arena, const char* subsystem) :
+    arena_(arena), subsystem_(subsystem), previous_(current_scope()) {
+    RAV_ASSERT(subsystem != nullptr, "Subsystem must not be nullptr");
+    current_scope() = this;
+}
+
+rav::Arena::Scope::~Scope() {
+    RAV_ASSERT_NO_THROW(current_scope() == this, "Scopes must be destroyed in reverse order of construction");
+    current_scope() = previous_;
+}
+
+rav::Arena::Arena(const Options& options) {
+    if (options.size == 0) {
+        return;
+    }
+
+    const auto page_size = get_page_size();
+    void* region = nullptr;
+
+#if RAV_WINDOWS
+    if (options.use_huge_pages) {
+        // Requires the SeLockMemoryPrivilege, which is usually not granted. Large pages are always locked.
+        if (const auto large_page_size = GetLargePageMinimum(); large_page_size > 0) {
+            const auto size = round_up(options.size, large_page_size);
+            region = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if (region != nullptr) {
+                capacity_ = size;
+                huge_pages_ = true;
+                locked_ = true;
+            }
+        }
+    }
+    if (region == nullptr) {
+        const auto size = round_up(options.size, page_size);
+        region = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        if (region != nullptr) {
+            capacity_ = size;
+            if (options.lock_memory) {
+                // Grow the working set so that the region fits, VirtualLock fails otherwise.
+                SIZE_T min_size = 0;
+                SIZE_T max_size = 0;
+                if (GetProcessWorkingSetSize(GetCurrentProcess(), &min_size, &max_size)) {
+                    SetProcessWorkingSetSize(GetCurrentProcess(), min_size + size, std::max(max_size, min_size + size));
+                }
+                locked_ = VirtualLock(region, size) != 0;
+            }
+        }
+    }
+    mapped_ = region != nullptr;
+#elif RAV_POSIX
+    #if defined(MAP_HUGETLB)
+    if (options.use_huge_pages) {
+        const auto size = round_up(options.size, k_huge_page_size);
+        region = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (region == MAP_FAILED) {
+            region = nullptr;  // No huge pages reserved by the system, fall back to normal pages.
+        } else {
+            capacity_ = size;
+            huge_pages_ = true;
+        }
+    }
+    #endif
+    if (region == nullptr) {
+        const auto size = round_up(options.size, page_size);
+        region = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (region == MAP_FAILED) {
+            region = nullptr;
+        } else {
+            capacity_ = size;
+    #if defined(MADV_HUGEPAGE)
+            if (options.use_huge_pages) {
+                // Ask for transparent huge pages instead.
+                std::ignore = madvise(region, size, MADV_HUGEPAGE);
+            }
+    #endif
+        }
+    }
+    if (region != nullptr && options.lock_memory) {
+        locked_ = mlock(region, capacity_) == 0;
+    }
+    mapped_ = region != nullptr;
+#endif
+
+    if (region == nullptr) {
+        // Fall back to a plain allocation which at least keeps the blocks close together.
+        capacity_ = round_up(options.size, k_alignment);
+        region = ::operator new(capacity_, std::align_val_t {k_alignment}, std::nothrow);
+        if (region == nullptr) {
+            RAV_LOG_ERROR("Failed to reserve arena of {} bytes", options.size);
+            capacity_ = 0;
+            return;
+        }
+    }
+
+    region_ = static_cast<uint8_t*>(region);
+
+    if (options.prefault) {
+        for (size_t i = 0; i < capacity_; i += page_size) {
+            static_cast<volatile uint8_t*>(region_)[i] = 0;
+        }
+    }
+
+    free_blocks_.emplace(0, capacity_);
+
+    if (options.lock_memory && !locked_) {
+        RAV_LOG_WARNING("Failed to lock arena of {} bytes into memory (check the memlock limit)", capacity_);
+    }
+
+    RAV_LOG_DEBUG("Reserved arena of {} bytes (huge pages: {}, locked: {})", capacity_, huge_pages_, locked_);
+}
+
+rav::Arena::~Arena() {
+    if (region_ == nullptr) {
+        return;
+    }
+
+    if (used_ != 0) {
+        RAV_LOG_ERROR("Arena destroyed with {} bytes still in use, leaking the region", used_);
+        return;
+    }
+
+#if RAV_WINDOWS
+    if (mapped_) {
+        VirtualFree(region_, 0, MEM_RELEASE);
+        return;
+    }
+#elif RAV_POSIX
+    if (mapped_) {
+        if (locked_) {
+            munlock(region_, capacity_);
+        }
+        munmap(region_, capacity_);
+        return;
+    }
+#endif
+
+    ::operator delete(region_, std::align_val_t {k_alignment});
+}
+
+rav::Arena& rav::Arena::get_default() {
+    static auto* arena = new Arena(Options {});  // Never destroyed, blocks might be freed during static destruction.
+    return *arena;
+}
+
+void* rav::Arena::allocate(const size_t size) {
+    const auto* scope = current_scope();
+
+    if (scope != nullptr) {
+        if (auto* ptr = scope->arena_.try_allocate(size, scope->subsystem_)) {
+            return ptr;
+        }
+    }
+
+    const auto block_size = round_up(size, k_alignment) + sizeof(Header);
+    auto* header = new (::operator new(block_size, std::align_val_t {k_alignment})) Header {};
+    header->size = block_size;
+
+    if (scope != nullptr) {
+        RAV_LOG_WARNING("Arena exhausted, allocating {} bytes for {} from the heap", size, scope->subsystem_);
+        header->arena = &scope->arena_;
+        header->subsystem = scope->subsystem_;
+        const std::lock_guard lock(scope->arena_.mutex_);
+        scope->arena_.account(*header, true);
+    }
+
+    return header + 1;
+}
+
+void rav::Arena::deallocate(void* ptr) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    auto* header = static_cast<Header*>(ptr) - 1;
+
+    if (header->in_arena) {
+        header->arena->free_block(header);
+        return;
+    }
+
+    if (header->arena != nullptr) {
+        const std::lock_guard lock(header->arena->mutex_);
+        header->arena->account(*header, false);
+    }
+
+    header->~Header();
+    ::operator delete(header, std::align_val_t {k_alignment});
+}
+
+void* rav::Arena::try_allocate(const size_t size, const char* subsystem) {
+    RAV_ASSERT(subsystem != nullptr, "Subsystem must not be nullptr");
+
+    if (size > capacity_) {
+        return nullptr;
+    }
+
+    const auto block_size = round_up(size, k_alignment) + sizeof(Header);
+
+    const std::lock_guard lock(mutex_);
+
+    // First fit, which keeps the blocks of a reader or writer (allocated one after the other) close together.
+    for (auto it = free_blocks_.begin(); it != free_blocks_.end(); ++it) {
+        if (it->second < block_size) {
+            continue;
+        }
+
+        const auto offset = it->first;
+        const auto remaining = it->second - block_size;
+        free_blocks_.erase(it);
+        if (remaining > 0) {
+            free_blocks_.emplace(offset + block_size, remaining);
+        }
+
+        auto* header = new (region_ + offset) Header {this, subsystem, block_size, true};
+        used_ += block_size;
+        account(*header, true);
+        return header + 1;
+    }
+
+    return nullptr;
+}
+
+rav::Arena::Info rav::Arena::get_info() const {
+    const std::lock_guard lock(mutex_);
+    return {capacity_, used_, huge_pages_, locked_};
+}
+
+std::vector<rav::Arena::Usage> rav::Arena::get_usage() const {
+    const std::lock_guard lock(mutex_);
+    std::vector<Usage> usage;
+    usage.reserve(usage_.size());
+    for (const auto& [subsystem, u] : usage_) {
+        usage.push_back(u);
+    }
+    return usage;
+}
+
+bool rav::Arena::contains(const void* ptr) const {
+    const auto* p = static_cast<const uint8_t*>(ptr);
+    return region_ != nullptr && p >= region_ && p < region_ + capacity_;
+}
+
+rav::Arena::Scope*& rav::Arena::current_scope() {
+    static thread_local Scope* scope = nullptr;
+    return scope;
+}
+
+void rav::Arena::free_block(Header* header) noexcept {
+    const auto offset = static_cast<size_t>(reinterpret_cast<uint8_t*>(header) - region_);
+    auto size = header->size;
+
+    const std::lock_guard lock(mutex_);
+
+    account(*header, false);
+    used_ -= size;
+    header->~Header();
+
+    auto [it, inserted] = free_blocks_.emplace(offset, size);
+    RAV_ASSERT_NO_THROW(inserted, "Block freed twice");
+
+    // Coalesce with the next block
+    if (const auto next = std::next(it); next != free_blocks_.end() && offset + size == next->first) {
+        it->second += next->second;
+        size = it->second;
+        free_blocks_.erase(next);
+    }
+
+    // Coalesce with the previous block
+    if (it != free_blocks_.begin()) {
+        if (const auto prev = std::prev(it); prev->first + prev->second == offset) {
+            prev->second += size;
+            free_blocks_.erase(it);
+        }
+    }
+}
+
+void rav::Arena::account(const Header& header, const bool add) {
+    auto& usage = usage_[header.subsystem];
+    if (usage.subsystem.empty()) {
+        usage.subsystem = header.subsystem;
+    }
+
+    auto& bytes = header.in_arena ? usage.bytes : usage.overflow_bytes;
+    auto& allocations = header.in_arena ? usage.allocations : usage.overflow_allocations;
+
+    if (add) {
+        bytes += header.size;
+        allocations += 1;
+    } else {
+        RAV_ASSERT_NO_THROW(bytes >= header.size && allocations > 0, "Usage underflow");
+        bytes -= header.size;
+        allocations -= 1;
+    }
+}
@@ -66,9 +66,7 @@ rav::HttpClient::HttpClient(
 }
 
 rav::HttpClient::~HttpClient() {
-    if (session_) {
-        session_->clear_owner();
-    }
+    reset_sessions();
 }
 
 void rav::HttpClient::set_host(const boost::urls::url& url) {
@@ -82,12 +80,10 @@ void rav::HttpClient::set_host(const std::string_view url) {
 
 void rav::HttpClient::set_host(const std::string_view host, const std::string_view service) {
     if (host == host_ && service == service_) {
-        return;  // No change, no need to reset the session.
-    }
-    if (session_) {
-        session_->clear_owner();  // Clear the owner to avoid dangling pointer issues.
-        session_.reset();         // Reset the session to create a new one on the next request.
+        return;  // No change, no need to reset the sessions.
     }
+    reset_sessions();  // New sessions will be created on the next request.
+    resolved_endpoints_.reset();
     host_ = host;
     service_ = service;
 }
@@ -107,7 +103,15 @@ void rav::HttpClient::delete_async(const std::string_view target, ResponseCallba
 }
 
 void rav::HttpClient::request_async(
-    const http::verb method, const std::string_view target, std::string body, std::string_view content_type, ResponseCallback callback
+    const http::verb method, const std::string_view target, std::string body, const std::string_view content_type,
+    ResponseCallback callback
+) {
+    request_with_priority_async(method, target, std::move(body), content_type, std::move(callback), Priority::normal);
+}
+
+void rav::HttpClient::request_with_priority_async(
+    const http::verb method, const std::string_view target, std::string body, std::string_view content_type, ResponseCallback callback,
+    const Priority priority
 ) {
     auto request = http::request<http::string_body>(method, target.empty() ? "/" : target, 11);
     request.set(http::field::host, host_);
@@ -124,17 +128,23 @@ void rav::HttpClient::request_async(
         request.prepare_payload();
     }
 
-    requests_.emplace(std::move(request), std::move(callback));
+    PendingRequest pending {std::move(request), std::move(callback), priority, std::chrono::steady_clock::now()};
 
-    if (!session_) {
-        session_ = std::make_shared<Session>(io_context_, this, timeout_seconds_);
+    if (priority == Priority::high) {
+        // Ahead of all normal requests, behind earlier high priority requests
+        const auto it = std::find_if(requests_.begin(), requests_.end(), [](const PendingRequest& r) {
+            return r.priority != Priority::high;
+        });
+        requests_.insert(it, std::move(pending));
+    } else {
+        requests_.push_back(std::move(pending));
     }
 
-    session_->send_requests();
+    dispatch_requests();
 }
 
 void rav::HttpClient::cancel_outstanding_requests() {
-    requests_ = {};
+    requests_.clear();
 }
 
 const std::string& rav::HttpClient::get_host() const {
@@ -145,17 +155,70 @@ const std::string& rav::HttpClient::get_service() const {
     return service_;
 }
 
-rav::HttpClient::Session::Session(boost::asio::io_context& io_context, HttpClient* owner, const std::chrono::milliseconds timeout_seconds) :
-    owner_(owner), timeout_seconds_(timeout_seconds), resolver_(io_context), stream_(io_context) {}
+void rav::HttpClient::set_max_connections(const size_t max_connections) {
+    max_connections_ = std::max<size_t>(max_connections, 1);
+}
 
-void rav::HttpClient::Session::send_requests() {
-    RAV_ASSERT(owner_ != nullptr, "HttpClient::Session must have an owner");
-    if (owner_->requests_.empty()) {
-        return;
+size_t rav::HttpClient::get_connection_count() const {
+    return static_cast<size_t>(std::count_if(sessions_.begin(), sessions_.end(), [](const auto& session) {
+        return session->is_open();
+    }));
+}
+
+const rav::HttpClient::Metrics& rav::HttpClient::get_metrics() const {
+    return metrics_;
+}
+
+void rav::HttpClient::dispatch_requests() {
+    // Idle sessions first, preferring connected ones to avoid the cost of connecting
+    for (const bool connected : {true, false}) {
+        for (size_t i = 0; i < sessions_.size() && !requests_.empty(); ++i) {
+            const auto session = sessions_[i];  // Copy, sending can complete synchronously and modify the list
+            if (session->is_idle() && session->is_open() == connected) {
+                session->send_requests();
+            }
+        }
+    }
+
+    // Then open new connections, if allowed. Normal requests never use more than max_connections_ sessions, which keeps
+    // them in order with the default of 1. A high priority request which finds all of those busy gets one extra
+    // session, which only ever sends high priority requests.
+    while (!requests_.empty()) {
+        const auto num_priority_only = static_cast<size_t>(std::count_if(sessions_.begin(), sessions_.end(), [](const auto& session) {
+            return session->is_priority_only();
+        }));
+        bool priority_only = false;
+        if (sessions_.size() - num_priority_only >= max_connections_) {
+            if (requests_.front().priority != Priority::high || num_priority_only > 0) {
+                break;
+            }
+            priority_only = true;
+        }
+        const auto session =
+            sessions_.emplace_back(std::make_shared<Session>(io_context_, this, timeout_seconds_, priority_only));
+        session->send_requests();
+    }
+}
+
+void rav::HttpClient::reset_sessions() {
+    for (const auto& session : sessions_) {
+        session->clear_owner();  // Clear the owner to avoid dangling pointer issues.
     }
+    sessions_.clear();
+}
+
+rav::HttpClient::Session::Session(
+    boost::asio::io_context& io_context, HttpClient* owner, const std::chrono::milliseconds timeout_seconds, const bool priority_only
+) :
+    owner_(owner), timeout_seconds_(timeout_seconds), priority_only_(priority_only), resolver_(io_context), stream_(io_context) {}
 
+void rav::HttpClient::Session::send_requests() {
+    RAV_ASSERT(owner_ != nullptr, "HttpClient::Session must have an owner");
     if (state_ == State::disconnected) {
-        async_connect();  // Start the connection process
+        // Take the request before connecting, so that a failure to connect is reported to this request
+        if (take_next_request()) {
+            async_connect();
+        }
     } else if (state_ == State::connected) {
         async_send();  // If already connected, just write the next request
     }
@@ -165,8 +228,27 @@ void rav::HttpClient::Session::clear_owner() {
     owner_ = nullptr;
 }
 
+bool rav::HttpClient::Session::is_idle() const {
+    return state_ == State::disconnected || state_ == State::connected;
+}
+
+bool rav::HttpClient::Session::is_open() const {
+    return state_ != State::disconnected;
+}
+
+bool rav::HttpClient::Session::is_priority_only() const {
+    return priority_only_;
+}
+
 void rav::HttpClient::Session::async_connect() {
     RAV_ASSERT(owner_ != nullptr, "HttpClient::Session must have an owner");
+
+    if (owner_->resolved_endpoints_.has_value()) {
+        connect(*owner_->resolved_endpoints_);
+        return;
+    }
+
+    owner_->metrics_.num_resolves++;
     resolver_.async_resolve(
         owner_->host_, owner_->service_.empty() ? k_default_port : owner_->service_,
         boost::beast::bind_front_handler(&Session::on_resolve, shared_from_this())
@@ -176,38 +258,47 @@ void rav::HttpClient::Session::async_connect() {
 
 void rav::HttpClient::Session::async_send() {
     if (!take_next_request()) {
+        state_ = State::connected;
         return;  // No requests to send
     }
+    async_write();
+}
 
+void rav::HttpClient::Session::async_write() {
     // Set a timeout on the operation
     stream_.expires_after(timeout_seconds_);
 
     // Send the HTTP request to the remote host
-    http::async_write(stream_, request_, boost::beast::bind_front_handler(&Session::on_write, shared_from_this()));
+    http::async_write(stream_, request_.request, boost::beast::bind_front_handler(&Session::on_write, shared_from_this()));
 
     state_ = State::waiting_for_send;
 }
 
+void rav::HttpClient::Session::connect(const tcp::resolver::results_type& endpoints) {
+    RAV_ASSERT(owner_ != nullptr, "HttpClient::Session must have an owner");
+    owner_->metrics_.num_connects++;
+
+    // Set a timeout on the operation
+    stream_.expires_after(timeout_seconds_);
+
+    // Make the connection on the IP address we get from a lookup
+    stream_.async_connect(endpoints, boost::beast::bind_front_handler(&Session::on_connect, shared_from_this()));
+
+    state_ = State::connecting;
+}
+
 void rav::HttpClient::Session::on_resolve(const boost::beast::error_code& ec, const tcp::resolver::results_type& results) {
     if (owner_ == nullptr) {
         return;  // Session was abandoned, nothing to do.
     }
 
     if (ec) {
-        if (callback_) {
-            callback_(ec);
-        }
         state_ = State::disconnected;
-        return;  // Error resolving the host
+        return fail(ec);  // Fails the request which triggered the connection attempt
     }
 
-    // Set a timeout on the operation
-    stream_.expires_after(timeout_seconds_);
-
-    // Make the connection on the IP address we get from a lookup
-    stream_.async_connect(results, boost::beast::bind_front_handler(&Session::on_connect, shared_from_this()));
-
-    state_ = State::connecting;
+    owner_->resolved_endpoints_ = results;
+    connect(results);
 }
 
 void rav::HttpClient::Session::on_connect(const boost::beast::error_code& ec, const tcp::resolver::results_type::endpoint_type&) {
@@ -217,15 +308,18 @@ void rav::HttpClient::Session::on_connect(const boost::beast::error_code& ec, co
 
     if (ec) {
         state_ = State::disconnected;
-        if (callback_) {
-            callback_(ec);
-        }
-        return;
+        owner_->resolved_endpoints_.reset();  // The host might have moved, resolve again next time
+        return fail(ec);                      // Fails the request which triggered the connection attempt
     }
 
-    state_ = State::connected;
+    // Requests are small and latency matters more than throughput
+    boost::system::error_code nodelay_ec;
+    stream_.socket().set_option(tcp::no_delay(true), nodelay_ec);
+    if (nodelay_ec) {
+        RAV_LOG_WARNING("HttpClient::Session: failed to set TCP_NODELAY: {}", nodelay_ec.message());
+    }
 
-    async_send();  // Start writing the first request
+    async_write();  // Write the request which triggered the connection attempt
 }
 
 void rav::HttpClient::Session::on_write(const boost::beast::error_code& ec, std::size_t bytes_transferred) {
@@ -237,10 +331,7 @@ void rav::HttpClient::Session::on_write(const boost::beast::error_code& ec, std:
 
     if (ec) {
         state_ = State::disconnected;
-        if (callback_) {
-            callback_(ec);
-        }
-        return;
+        return fail(ec);
     }
 
     response_ = {};
@@ -260,14 +351,19 @@ void rav::HttpClient::Session::on_read(boost::beast::error_code ec, std::size_t
 
     if (ec) {
         state_ = State::disconnected;
-        if (callback_) {
-            callback_(ec);
-        }
-        return;
+        return fail(ec);
     }
 
-    if (callback_) {
-        callback_(response_);
+    const auto elapsed = std::chrono::steady_clock::now() - request_.queued_at;
+    owner_->metrics_.response_time_ms.add(std::chrono::duration<double, std::milli>(elapsed).count());
+    owner_->metrics_.num_responses++;
+
+    if (request_.callback) {
+        request_.callback(response_);
+    }
+
+    if (owner_ == nullptr) {
+        return;  // The client was reset or destroyed from the callback.
     }
 
     if (!response_.keep_alive()) {
@@ -278,8 +374,9 @@ void rav::HttpClient::Session::on_read(boost::beast::error_code ec, std::size_t
         if (ec && ec != boost::beast::errc::not_connected) {
             RAV_LOG_ERROR("HttpClient::Session::on_read: Error closing socket: {}", ec.message());
         }
+        stream_.close();
 
-        if (!owner_->requests_.empty()) {
+        if (take_next_request()) {
             async_connect();  // If there are more requests, reconnect.
             return;
         }
@@ -288,22 +385,39 @@ void rav::HttpClient::Session::on_read(boost::beast::error_code ec, std::size_t
         return;
     }
 
-    if (!owner_->requests_.empty()) {
-        async_send();  // If there are more requests, send the next one.
-        return;
+    // Send the next request if there is one, otherwise become idle so that send_requests will schedule requests.
+    async_send();
+}
+
+void rav::HttpClient::Session::fail(const boost::beast::error_code& ec) {
+    RAV_ASSERT(owner_ != nullptr, "HttpClient::Session must have an owner");
+    stream_.close();
+
+    auto callback = std::move(request_.callback);
+    request_.callback = nullptr;
+    if (callback) {
+        owner_->metrics_.num_failures++;
+        callback(ec);
     }
 
-    // Otherwise set the state to connected so that send_requests will schedule requests for sending.
-    state_ = State::connected;
+    if (owner_ != nullptr && !owner_->requests_.empty()) {
+        owner_->dispatch_requests();  // Remaining requests are sent on a new connection
+    }
 }
 
 bool rav::HttpClient::Session::take_next_request() {
     RAV_ASSERT(owner_ != nullptr, "HttpClient::Session must have an owner");
-    if (!owner_->requests_.empty()) {
-        request_ = std::move(owner_->requests_.front().first);
-        callback_ = std::move(owner_->requests_.front().second);
-        owner_->requests_.pop();
-        return true;
+    if (owner_->requests_.empty()) {
+        return false;
+    }
+    if (priority_only_ && owner_->requests_.front().priority != Priority::high) {
+        return false;  // Normal requests are left to the other sessions to keep them in order
     }
-    return false;
+
+    request_ = std::move(owner_->requests_.front());
+    owner_->requests_.pop_front();
+
+    const auto elapsed = std::chrono::steady_clock::now() - request_.queued_at;
+    owner_->metrics_.queue_time_ms.add(std::chrono::duration<double, std::milli>(elapsed).count());
+    return true;
 }
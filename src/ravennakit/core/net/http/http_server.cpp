@@ -25,6 +25,7 @@
 #include "ravennakit/core/net/http/http_server.hpp"
 
 #include "ravennakit/core/log.hpp"
+#include "ravennakit/core/util/tracy.hpp"
 
 #include <boost/beast/version.hpp>
 #include <boost/beast/core/bind_handler.hpp>
@@ -34,8 +35,11 @@
 #include <boost/beast/http/message_generator.hpp>
 #include <boost/beast/http/read.hpp>
 #include <boost/beast/http/string_body.hpp>
+#include <boost/beast/websocket.hpp>
 #include <boost/system/result.hpp>
 
+#include <deque>
+
 class rav::HttpServer::ClientSession: public std::enable_shared_from_this<ClientSession> {
   public:
     ClientSession() = delete;
@@ -103,8 +107,27 @@ class rav::HttpServer::ClientSession: public std::enable_shared_from_this<Client
             return do_close();
         }
 
-        // Send the response
-        send_response(owner_->on_request(std::move(request_)));
+        // Hand the connection over to a WebSocket session if there is a route for it
+        if (boost::beast::websocket::is_upgrade(request_)
+            && owner_->websocket_router_.match(boost::beast::http::verb::get, request_.target(), nullptr) != nullptr) {
+            stream_.expires_never();
+            owner_->on_websocket_upgrade(stream_.release_socket(), std::move(request_));
+            owner_->remove_client_session(this);
+            return;
+        }
+
+        // Handlers are called on the io_context, which is a different thread than this one when running with workers.
+        // The weak pointer avoids keeping the session (and its socket) alive from the io_context after the server is gone.
+        boost::asio::dispatch(owner_->io_context_, [weak_self = weak_from_this(), request = std::move(request_)] {
+            const auto self = weak_self.lock();
+            if (self == nullptr || self->owner_ == nullptr) {
+                return;
+            }
+            auto response = self->owner_->on_request(request);
+            boost::asio::dispatch(self->stream_.get_executor(), [self, response = std::move(response)]() mutable {
+                self->send_response(std::move(response));
+            });
+        });
     }
 
     void send_response(boost::beast::http::message_generator&& msg) {
@@ -162,10 +185,184 @@ class rav::HttpServer::ClientSession: public std::enable_shared_from_this<Client
     }
 };
 
+class rav::HttpServer::WebSocketSession final: public WebSocketConnection, public std::enable_shared_from_this<WebSocketSession> {
+  public:
+    WebSocketSession() = delete;
+
+    explicit WebSocketSession(boost::asio::ip::tcp::socket&& socket, HttpServer* owner) : ws_(std::move(socket)), owner_(owner) {
+        RAV_ASSERT(owner != nullptr, "Owner cannot be null");
+    }
+
+    void start(Request request) {
+        request_ = std::move(request);
+
+        ws_.set_option(boost::beast::websocket::stream_base::timeout::suggested(boost::beast::role_type::server));
+        ws_.set_option(boost::beast::websocket::stream_base::decorator([](boost::beast::websocket::response_type& res) {
+            res.set(boost::beast::http::field::server, BOOST_BEAST_VERSION_STRING);
+        }));
+
+        ws_.async_accept(request_, boost::beast::bind_front_handler(&WebSocketSession::on_accept, shared_from_this()));
+    }
+
+    void set_owner(HttpServer* owner) {
+        owner_ = owner;
+        if (owner_ == nullptr) {
+            on_close.reset();
+            do_close();  // Called when no worker is running, so the stream can be used from this thread
+        }
+    }
+
+    void send(std::string message) override {
+        boost::asio::dispatch(ws_.get_executor(), [self = shared_from_this(), message = std::move(message)]() mutable {
+            self->do_send(std::move(message));
+        });
+    }
+
+    void close() override {
+        boost::asio::dispatch(ws_.get_executor(), [self = shared_from_this()] {
+            self->do_close();
+        });
+    }
+
+    [[nodiscard]] bool is_open() const override {
+        return open_;
+    }
+
+  private:
+    boost::beast::websocket::stream<boost::beast::tcp_stream> ws_;
+    HttpServer* owner_ {};
+    Request request_;
+    boost::beast::flat_buffer read_buffer_;
+    std::deque<std::string> write_queue_;
+    std::atomic<bool> open_ {false};
+    bool closed_ = false;
+
+    void do_send(std::string message) {
+        if (!open_) {
+            return;
+        }
+
+        if (write_queue_.size() >= k_max_queued_websocket_messages) {
+            RAV_LOG_WARNING("WebSocket client is not keeping up, closing connection");
+            close();
+            return;
+        }
+
+        write_queue_.push_back(std::move(message));
+        if (write_queue_.size() == 1) {
+            do_write();
+        }
+    }
+
+    void do_close() {
+        if (!open_.exchange(false)) {
+            return;
+        }
+        if (write_queue_.size() > 1) {
+            write_queue_.resize(1);  // The front message is being written and must stay alive until the write completes
+        }
+        ws_.async_close(
+            boost::beast::websocket::close_code::normal,
+            [self = shared_from_this()](const boost::beast::error_code&) {
+                self->on_closed();
+            }
+        );
+    }
+
+    void on_accept(const boost::beast::error_code& ec) {
+        if (owner_ == nullptr) {
+            return;  // Server was stopped
+        }
+
+        if (ec) {
+            owner_->on_client_error(ec, "websocket accept");
+            return on_closed();
+        }
+
+        open_ = true;
+        do_read();
+
+        boost::asio::dispatch(owner_->io_context_, [weak_self = weak_from_this()] {
+            const auto self = weak_self.lock();
+            if (self == nullptr || self->owner_ == nullptr) {
+                return;
+            }
+            PathMatcher::Parameters parameters;
+            const auto target = self->request_.target();
+            if (auto* handler = self->owner_->websocket_router_.match(boost::beast::http::verb::get, target, &parameters)) {
+                (*handler)(self->request_, self, parameters);
+            }
+        });
+    }
+
+    void do_read() {
+        // Incoming messages are not used, but reading is what processes control frames (ping, pong and close)
+        ws_.async_read(read_buffer_, boost::beast::bind_front_handler(&WebSocketSession::on_read, shared_from_this()));
+    }
+
+    void on_read(const boost::beast::error_code& ec, std::size_t bytes_transferred) {
+        std::ignore = bytes_transferred;
+
+        if (ec) {
+            if (ec != boost::beast::websocket::error::closed && ec != boost::asio::error::operation_aborted && owner_ != nullptr) {
+                owner_->on_client_error(ec, "websocket read");
+            }
+            open_ = false;
+            return on_closed();
+        }
+
+        read_buffer_.consume(read_buffer_.size());
+        do_read();
+    }
+
+    void do_write() {
+        ws_.text(true);
+        ws_.async_write(
+            boost::asio::buffer(write_queue_.front()),
+            boost::beast::bind_front_handler(&WebSocketSession::on_write, shared_from_this())
+        );
+    }
+
+    void on_write(const boost::beast::error_code& ec, std::size_t bytes_transferred) {
+        std::ignore = bytes_transferred;
+
+        if (ec) {
+            if (owner_ != nullptr) {
+                owner_->on_client_error(ec, "websocket write");
+            }
+            open_ = false;
+            write_queue_.clear();
+            return on_closed();
+        }
+
+        if (!write_queue_.empty()) {
+            write_queue_.pop_front();
+        }
+        if (open_ && !write_queue_.empty()) {
+            do_write();
+        }
+    }
+
+    void on_closed() {
+        if (std::exchange(closed_, true)) {
+            return;
+        }
+        if (owner_ == nullptr) {
+            return;  // Server was stopped, on_close was reset
+        }
+        boost::asio::dispatch(owner_->io_context_, [weak_self = weak_from_this()] {
+            if (const auto self = weak_self.lock()) {
+                self->on_close();
+                self->on_close.reset();
+            }
+        });
+        owner_->remove_websocket_session(this);
+    }
+};
+
 class rav::HttpServer::Listener: public std::enable_shared_from_this<Listener> {
   public:
-    explicit Listener(boost::asio::io_context& io_context, HttpServer* owner) :
-        io_context_(io_context), owner_(owner), acceptor_(io_context) {
+    explicit Listener(const boost::asio::any_io_executor& executor, HttpServer* owner) : owner_(owner), acceptor_(executor) {
         RAV_ASSERT(owner != nullptr, "Owner cannot be null");
     }
 
@@ -213,12 +410,13 @@ class rav::HttpServer::Listener: public std::enable_shared_from_this<Listener> {
     }
 
   private:
-    boost::asio::io_context& io_context_;
     HttpServer* owner_ {};
     boost::asio::ip::tcp::acceptor acceptor_;
 
     void do_accept() {
-        acceptor_.async_accept(io_context_, boost::beast::bind_front_handler(&Listener::on_accept, shared_from_this()));
+        acceptor_.async_accept(
+            owner_->make_session_executor(), boost::beast::bind_front_handler(&Listener::on_accept, shared_from_this())
+        );
     }
 
     void on_accept(const boost::beast::error_code& ec, boost::asio::ip::tcp::socket socket) {
@@ -242,6 +440,14 @@ rav::HttpServer::~HttpServer() {
     stop();
 }
 
+void rav::HttpServer::set_worker_threads(const size_t num_threads) {
+    num_worker_threads_ = num_threads;
+}
+
+size_t rav::HttpServer::get_worker_threads() const {
+    return worker_threads_.size();
+}
+
 boost::system::result<void> rav::HttpServer::start(const std::string_view bind_address, uint16_t port) {
     if (listener_ != nullptr) {
         return boost::asio::error::already_started;
@@ -253,29 +459,94 @@ boost::system::result<void> rav::HttpServer::start(const std::string_view bind_a
         return ec;
     }
 
-    auto listener = std::make_shared<Listener>(io_context_, this);
+    if (num_worker_threads_ > 0) {
+        if (worker_context_ == nullptr) {
+            worker_context_ = std::make_unique<boost::asio::io_context>(static_cast<int>(num_worker_threads_));
+        }
+        worker_context_->restart();
+        worker_work_guard_.emplace(worker_context_->get_executor());
+    }
+
+    auto listener = std::make_shared<Listener>(get_listener_executor(), this);
 
     const auto result = listener->start({addr, port});
     if (result.has_error()) {
+        worker_work_guard_.reset();
         return result;
     }
 
     listener_ = std::move(listener);
 
+    for (size_t i = 0; i < num_worker_threads_; ++i) {
+        worker_threads_.emplace_back([context = worker_context_.get()] {
+            TRACY_SET_THREAD_NAME("http_server_worker");
+            while (true) {
+                try {
+                    context->run();
+                    break;
+                } catch (const std::exception& e) {
+                    RAV_LOG_CRITICAL("Unhandled exception on http server worker: {}", e.what());
+                }
+            }
+        });
+    }
+
     return {};
 }
 
 void rav::HttpServer::stop() {
+    // From here on the sessions are only touched from this thread
+    stop_workers();
+
     if (listener_) {
         listener_->set_owner(nullptr);
         listener_.reset();
     }
 
-    for (const auto& session : client_sessions_) {
+    // Move out first, closing a session can remove it from the list
+    std::unique_lock lock(sessions_mutex_);
+    const auto client_sessions = std::move(client_sessions_);
+    const auto websocket_sessions = std::move(websocket_sessions_);
+    client_sessions_.clear();
+    websocket_sessions_.clear();
+    lock.unlock();
+
+    for (const auto& session : client_sessions) {
         session->set_owner(nullptr);
     }
 
-    client_sessions_.clear();
+    for (const auto& session : websocket_sessions) {
+        session->set_owner(nullptr);
+    }
+}
+
+void rav::HttpServer::stop_workers() {
+    if (worker_context_ == nullptr) {
+        return;
+    }
+
+    // Pending operations are abandoned, they are destroyed together with the worker context or run (and bail out
+    // because their owner is gone) when the server is started again.
+    worker_work_guard_.reset();
+    worker_context_->stop();
+    for (auto& thread : worker_threads_) {
+        thread.join();
+    }
+    worker_threads_.clear();
+}
+
+boost::asio::any_io_executor rav::HttpServer::get_listener_executor() const {
+    if (worker_work_guard_.has_value()) {
+        return worker_context_->get_executor();
+    }
+    return io_context_.get_executor();
+}
+
+boost::asio::any_io_executor rav::HttpServer::make_session_executor() const {
+    if (worker_work_guard_.has_value()) {
+        return boost::asio::make_strand(*worker_context_);  // Serializes the operations of a session over the workers
+    }
+    return io_context_.get_executor();
 }
 
 boost::asio::ip::tcp::endpoint rav::HttpServer::get_local_endpoint() const {
@@ -288,14 +559,23 @@ std::string rav::HttpServer::get_address_string() const {
 }
 
 size_t rav::HttpServer::get_client_count() const {
+    std::lock_guard lock(sessions_mutex_);
     return client_sessions_.size();
 }
 
+size_t rav::HttpServer::get_websocket_count() const {
+    std::lock_guard lock(sessions_mutex_);
+    return websocket_sessions_.size();
+}
+
 void rav::HttpServer::on_accept(boost::asio::ip::tcp::socket socket) {
     auto session = std::make_shared<ClientSession>(std::move(socket), this);
-    session->start();
     RAV_LOG_TRACE("Accepted new connection from {}", session->get_remote_address_string());
-    client_sessions_.push_back(std::move(session));
+    {
+        std::lock_guard lock(sessions_mutex_);
+        client_sessions_.push_back(session);
+    }
+    session->start();
 }
 
 void rav::HttpServer::on_listener_error(const boost::beast::error_code& ec, std::string_view what) const {
@@ -359,6 +639,7 @@ rav::HttpServer::on_request(const boost::beast::http::request<boost::beast::http
 }
 
 void rav::HttpServer::remove_client_session(const ClientSession* session) {
+    std::lock_guard lock(sessions_mutex_);
     client_sessions_.erase(
         std::remove_if(
             client_sessions_.begin(), client_sessions_.end(),
@@ -373,3 +654,26 @@ void rav::HttpServer::remove_client_session(const ClientSession* session) {
         client_sessions_.end()
     );
 }
+
+void rav::HttpServer::on_websocket_upgrade(boost::asio::ip::tcp::socket socket, Request request) {
+    RAV_LOG_INFO("{} {} (websocket upgrade)", request.method_string(), request.target());
+    auto session = std::make_shared<WebSocketSession>(std::move(socket), this);
+    {
+        std::lock_guard lock(sessions_mutex_);
+        websocket_sessions_.push_back(session);
+    }
+    session->start(std::move(request));
+}
+
+void rav::HttpServer::remove_websocket_session(const WebSocketSession* session) {
+    std::lock_guard lock(sessions_mutex_);
+    websocket_sessions_.erase(
+        std::remove_if(
+            websocket_sessions_.begin(), websocket_sessions_.end(),
+            [session](const auto& s) {
+                return s.get() == session;
+            }
+        ),
+        websocket_sessions_.end()
+    );
+}
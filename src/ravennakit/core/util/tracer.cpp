@@ -0,0 +1,330 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/util/tracer.hpp"
+
+#include "ravennakit/core/env.hpp"
+#include "ravennakit/core/format.hpp"
+#include "ravennakit/core/string.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace {
+
+bool is_enabled_by_env() {
+    const auto value = rav::get_env("RAV_TRACING");
+    return value.has_value() && (*value == "1" || rav::string_compare_case_insensitive(*value, "ON"));
+}
+
+void append_json_string(fmt::memory_buffer& out, const std::string_view str) {
+    out.push_back('"');
+    for (const auto c : str) {
+        switch (c) {
+            case '"':
+                fmt::format_to(fmt::appender(out), "\\\"");
+                break;
+            case '\\':
+                fmt::format_to(fmt::appender(out), "\\\\");
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    fmt::format_to(fmt::appender(out), "\\u{:04x}", static_cast<int>(c));
+                } else {
+                    out.push_back(c);
+                }
+        }
+    }
+    out.push_back('"');
+}
+
+}  // namespace
+
+std::atomic<bool> rav::Tracer::enabled_ {is_enabled_by_env()};
+
+class rav::Tracer::Ring {
+  public:
+    struct Slot {
+        std::atomic<uint64_t> ticks {};
+        std::atomic<const char*> name {};
+        std::atomic<EventType> type {};
+        std::atomic<uint64_t> value {};
+    };
+
+    std::unique_ptr<Slot[]> slots = std::make_unique<Slot[]>(k_events_per_thread);
+    std::atomic<uint64_t> head {0};
+    std::atomic<uint64_t> cleared_until {0};
+    std::atomic<bool> in_use {true};
+    uint32_t thread_id {};
+    std::string thread_name;  // Guarded by the registry mutex.
+};
+
+namespace {
+
+/// Ties a ring to the lifetime of its thread, so that the ring can be reused once the thread is gone.
+struct ThreadRingOwner {
+    std::atomic<bool>* in_use {};
+
+    ~ThreadRingOwner() {
+        if (in_use != nullptr) {
+            in_use->store(false, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadRingOwner thread_ring_owner;
+
+/// Maps ticks of the trace clock to nanoseconds on the monotonic clock.
+struct Calibration {
+    uint64_t ticks {};
+    uint64_t ns {};
+
+    static Calibration now() {
+        return {rav::Tracer::now_ticks(), rav::clock::now_monotonic_high_resolution_ns()};
+    }
+};
+
+}  // namespace
+
+namespace rav {
+
+/// Never destroyed, as threads might still record events during static destruction.
+struct TracerRegistry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Tracer::Ring>> rings;
+    uint32_t next_thread_id {1};
+    Calibration start = Calibration::now();
+
+    static TracerRegistry& instance() {
+        static auto* registry = new TracerRegistry();
+        return *registry;
+    }
+};
+
+}  // namespace rav
+
+void rav::Tracer::set_enabled(const bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void rav::Tracer::set_thread_name(const char* name) {
+    auto* ring = thread_ring_ != nullptr ? thread_ring_ : register_thread();
+    auto& registry = TracerRegistry::instance();
+    std::lock_guard lock(registry.mutex);
+    ring->thread_name = name;
+}
+
+void rav::Tracer::prepare_thread() {
+    if (thread_ring_ == nullptr) {
+        std::ignore = register_thread();
+    }
+}
+
+void rav::Tracer::clear() {
+    auto& registry = TracerRegistry::instance();
+    std::lock_guard lock(registry.mutex);
+    for (const auto& ring : registry.rings) {
+        ring->cleared_until.store(ring->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
+
+std::vector<rav::Tracer::Event> rav::Tracer::get_events() {
+    auto& registry = TracerRegistry::instance();
+    std::lock_guard lock(registry.mutex);
+
+    const auto start = registry.start;
+    const auto end = Calibration::now();
+#if RAV_TRACER_USE_TSC
+    const auto ns_per_tick = end.ticks > start.ticks
+        ? static_cast<double>(end.ns - start.ns) / static_cast<double>(end.ticks - start.ticks)
+        : 1.0;
+#else
+    const auto ns_per_tick = 1.0;
+#endif
+
+    std::vector<Event> events;
+    for (const auto& ring : registry.rings) {
+        const auto head = ring->head.load(std::memory_order_acquire);
+        const auto from = std::max(
+            head > k_events_per_thread ? head - k_events_per_thread : 0, ring->cleared_until.load(std::memory_order_relaxed)
+        );
+
+        const auto first_event = events.size();
+        for (auto i = from; i < head; ++i) {
+            const auto& slot = ring->slots[i % k_events_per_thread];
+            Event event;
+            const auto ticks = slot.ticks.load(std::memory_order_relaxed);
+            event.timestamp_ns =
+                start.ns + static_cast<uint64_t>(static_cast<double>(static_cast<int64_t>(ticks - start.ticks)) * ns_per_tick);
+            event.name = slot.name.load(std::memory_order_relaxed);
+            event.type = slot.type.load(std::memory_order_relaxed);
+            const auto value = slot.value.load(std::memory_order_relaxed);
+            if (event.type == EventType::plot) {
+                std::memcpy(&event.value, &value, sizeof(value));
+            } else {
+                event.value = static_cast<double>(static_cast<int64_t>(value));
+            }
+            event.thread_id = ring->thread_id;
+            events.push_back(event);
+        }
+
+        // Events which the recording thread overwrote while they were being copied are discarded. The slot of the event
+        // at head might be in the middle of being written.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto head_after = ring->head.load(std::memory_order_relaxed);
+        if (head_after >= k_events_per_thread) {
+            const auto valid_from = head_after - k_events_per_thread + 1;
+            if (valid_from > from) {
+                const auto num_invalid = std::min(valid_from - from, head - from);
+                events.erase(
+                    events.begin() + static_cast<std::ptrdiff_t>(first_event),
+                    events.begin() + static_cast<std::ptrdiff_t>(first_event + num_invalid)
+                );
+            }
+        }
+    }
+
+    return events;
+}
+
+std::string rav::Tracer::export_chrome_trace() {
+    const auto events = get_events();
+
+    std::vector<std::pair<uint32_t, std::string>> thread_names;
+    {
+        auto& registry = TracerRegistry::instance();
+        std::lock_guard lock(registry.mutex);
+        for (const auto& ring : registry.rings) {
+            thread_names.emplace_back(ring->thread_id, ring->thread_name);
+        }
+    }
+
+    uint64_t origin_ns = events.empty() ? 0 : events.front().timestamp_ns;
+    for (const auto& event : events) {
+        origin_ns = std::min(origin_ns, event.timestamp_ns);
+    }
+
+    fmt::memory_buffer out;
+    fmt::format_to(fmt::appender(out), "{{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    bool first = true;
+    auto separator = [&] {
+        if (!first) {
+            out.push_back(',');
+        }
+        first = false;
+    };
+
+    for (const auto& [thread_id, thread_name] : thread_names) {
+        if (thread_name.empty()) {
+            continue;
+        }
+        separator();
+        fmt::format_to(fmt::appender(out), "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":", thread_id);
+        append_json_string(out, thread_name);
+        fmt::format_to(fmt::appender(out), "}}}}");
+    }
+
+    for (const auto& event : events) {
+        separator();
+        fmt::format_to(fmt::appender(out), "{{\"name\":");
+        append_json_string(out, event.name != nullptr ? event.name : "");
+        const auto ts_us = static_cast<double>(event.timestamp_ns - origin_ns) / 1000.0;
+        fmt::format_to(fmt::appender(out), ",\"pid\":1,\"tid\":{},\"ts\":{:.3f},", event.thread_id, ts_us);
+        switch (event.type) {
+            case EventType::zone_begin:
+                fmt::format_to(fmt::appender(out), "\"ph\":\"B\"}}");
+                break;
+            case EventType::zone_end:
+                fmt::format_to(fmt::appender(out), "\"ph\":\"E\"}}");
+                break;
+            case EventType::plot:
+            case EventType::counter:
+                fmt::format_to(
+                    fmt::appender(out), "\"ph\":\"C\",\"args\":{{\"value\":{}}}}}", std::isfinite(event.value) ? event.value : 0.0
+                );
+                break;
+            case EventType::message:
+            default:
+                fmt::format_to(fmt::appender(out), "\"ph\":\"i\",\"s\":\"t\"}}");
+                break;
+        }
+    }
+
+    fmt::format_to(fmt::appender(out), "]}}");
+    return fmt::to_string(out);
+}
+
+bool rav::Tracer::write_chrome_trace(const std::string& path) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    file << export_chrome_trace();
+    return static_cast<bool>(file);
+}
+
+rav::Tracer::Ring* rav::Tracer::register_thread() {
+    auto& registry = TracerRegistry::instance();
+    std::lock_guard lock(registry.mutex);
+
+    // Keep the events of a number of finished threads around, after that reuse the ring of the oldest one.
+    Ring* ring = nullptr;
+    const auto num_finished = std::count_if(registry.rings.begin(), registry.rings.end(), [](const auto& r) {
+        return !r->in_use.load(std::memory_order_acquire);
+    });
+    if (static_cast<size_t>(num_finished) >= k_max_finished_threads) {
+        const auto it = std::find_if(registry.rings.begin(), registry.rings.end(), [](const auto& r) {
+            return !r->in_use.load(std::memory_order_acquire);
+        });
+        auto reused = std::move(*it);
+        registry.rings.erase(it);
+        reused->in_use.store(true, std::memory_order_relaxed);
+        reused->cleared_until.store(reused->head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        reused->thread_name.clear();
+        ring = registry.rings.emplace_back(std::move(reused)).get();
+    }
+
+    if (ring == nullptr) {
+        ring = registry.rings.emplace_back(std::make_unique<Ring>()).get();
+    }
+
+    ring->thread_id = registry.next_thread_id++;
+    thread_ring_ = ring;
+    thread_ring_owner.in_use = &ring->in_use;
+    return ring;
+}
+
+void rav::Tracer::write_event(Ring* ring, const uint64_t ticks, const EventType type, const char* name, const uint64_t value) {
+    const auto head = ring->head.load(std::memory_order_relaxed);
+    // Orders the previous publication of head before the writes to the slot, which readers rely on to detect overwrites.
+    std::atomic_thread_fence(std::memory_order_release);
+    auto& slot = ring->slots[head % k_events_per_thread];
+    slot.ticks.store(ticks, std::memory_order_relaxed);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.type.store(type, std::memory_order_relaxed);
+    slot.value.store(value, std::memory_order_relaxed);
+    ring->head.store(head + 1, std::memory_order_release);
+}
@@ -24,7 +24,9 @@
 
 #include "ravennakit/nmos/nmos_node.hpp"
 
+#include "ravennakit/aes67/aes67_packet_time.hpp"
 #include "ravennakit/core/json.hpp"
+#include "ravennakit/core/json_writer.hpp"
 #include "ravennakit/core/util/defer.hpp"
 #include "ravennakit/core/util/stl_helpers.hpp"
 #include "ravennakit/core/util/todo.hpp"
@@ -42,6 +44,7 @@
 #include <boost/range.hpp>
 #include <boost/range/algorithm_ext/erase.hpp>
 
+#include <array>
 #include <utility>
 
 namespace {
@@ -71,7 +74,8 @@ void set_error_response(http::response<http::string_body>& res, const rav::nmos:
     res.result(status);
     res.reason(http::obsolete_reason(status));
     set_default_headers(res, "application/json");
-    res.body() = boost::json::serialize(boost::json::value_from(error));
+    res.body().clear();
+    rav::serialize_json(error, res.body());
     res.prepare_payload();
 }
 
@@ -111,6 +115,41 @@ void ok_response(http::response<http::string_body>& res, std::string body, const
     res.prepare_payload();
 }
 
+/**
+ * Sets the response to indicate that the request was successful, with the given value serialized as JSON into the body.
+ * @param res The response to set.
+ * @param value The value to serialize, see JsonWriter for the supported types.
+ */
+template<class T>
+void json_ok_response(http::response<http::string_body>& res, const T& value) {
+    res.result(http::status::ok);
+    set_default_headers(res, "application/json");
+    res.body().clear();
+    rav::serialize_json(value, res.body());
+    res.prepare_payload();
+}
+
+/**
+ * Sets the response to a cached representation and its ETag. If the request carries a matching If-None-Match header the
+ * body is left out and the status is set to 304 Not Modified.
+ * @param req The request.
+ * @param res The response to set.
+ * @param entry The cached representation.
+ */
+void cached_ok_response(
+    const rav::HttpServer::Request& req, http::response<http::string_body>& res, const rav::nmos::ResourceCache::Entry& entry
+) {
+    res.set(http::field::etag, entry.etag);
+    const auto if_none_match = req[http::field::if_none_match];
+    if (rav::nmos::ResourceCache::etag_matches({if_none_match.data(), if_none_match.size()}, entry.etag)) {
+        res.result(http::status::not_modified);
+        set_default_headers(res);
+        res.prepare_payload();
+        return;
+    }
+    ok_response(res, entry.json);
+}
+
 template<typename VersionsContainer>
 std::optional<rav::nmos::ApiVersion> get_valid_api_version_from_parameters(
     const rav::PathMatcher::Parameters& params, const VersionsContainer& versions, const std::string_view param_name = "version"
@@ -217,7 +256,14 @@ boost::json::array get_receiver_constraints(const size_t num_constraints) {
     return constraints_array;
 }
 
-void update_nmos_sender_manifest_href(
+/**
+ * Updates the manifest href of a sender to point at the transport file served by this node.
+ * @param sender The sender to update.
+ * @param network_interface_config The network interface config, the first IPv4 address is used as host.
+ * @param port The port of the http server.
+ * @return True if the manifest href changed, in which case the version of the sender must be updated.
+ */
+bool update_nmos_sender_manifest_href(
     rav::nmos::Sender& sender, const rav::NetworkInterfaceConfig& network_interface_config, const uint16_t port
 ) {
     const auto addrs = network_interface_config.get_interface_ipv4_addresses();
@@ -229,10 +275,49 @@ void update_nmos_sender_manifest_href(
 
     auto uuid = boost::uuids::to_string(sender.id);
 
-    sender.manifest_href = fmt::format(
+    auto manifest_href = fmt::format(
         "http://{}:{}/x-nmos/connection/{}/single/senders/{}/transportfile", address.to_string(), port,
         rav::nmos::Node::k_connection_api_versions.back().to_string(), uuid
     );
+
+    if (sender.manifest_href == manifest_href) {
+        return false;
+    }
+
+    sender.manifest_href = std::move(manifest_href);
+    return true;
+}
+
+/**
+ * Moves an activation time forward to the next packet boundary of the first stream in the transport file.
+ * @param time The activation time.
+ * @param transport_file The transport file of the sender or receiver.
+ * @return The aligned time, or the given time if the transport file doesn't describe the packet timing.
+ */
+rav::nmos::Timestamp align_activation_time(const rav::nmos::Timestamp& time, const rav::sdp::SessionDescription& transport_file) {
+    for (const auto& media : transport_file.media_descriptions) {
+        if (media.formats.empty()) {
+            continue;
+        }
+
+        const auto clock_rate = media.formats.front().clock_rate;
+
+        uint32_t frames_per_packet = 0;
+        if (media.ptime.has_value()) {
+            frames_per_packet = rav::aes67::PacketTime::framecount(*media.ptime, clock_rate);
+        } else if (media.ravenna_framecount.has_value()) {
+            frames_per_packet = *media.ravenna_framecount;
+        }
+
+        int64_t media_clock_offset = 0;
+        const auto& media_clock = media.media_clock.has_value() ? media.media_clock : transport_file.media_clock;
+        if (media_clock.has_value() && media_clock->offset.has_value()) {
+            media_clock_offset = *media_clock->offset;
+        }
+
+        return rav::nmos::ActivationScheduler::align_to_packet_boundary(time, clock_rate, frames_per_packet, media_clock_offset);
+    }
+    return time;
 }
 
 }  // namespace
@@ -247,6 +332,10 @@ std::array<rav::nmos::ApiVersion, 2> rav::nmos::Node::k_connection_api_versions
     ApiVersion {1, 1},
 }};
 
+std::array<rav::nmos::ApiVersion, 1> rav::nmos::Node::k_query_api_versions = {{
+    ApiVersion {1, 3},
+}};
+
 boost::system::result<void, rav::nmos::Error> rav::nmos::Node::Configuration::validate() const {
     bool version_valid = false;
 
@@ -293,6 +382,7 @@ boost::json::object rav::nmos::Node::Configuration::to_json() const {
         {"registry_address", registry_address},
         {"enabled", enabled},
         {"api_port", api_port},
+        {"api_worker_threads", api_worker_threads},
         {"label", label},
         {"description", description},
     };
@@ -330,6 +420,9 @@ rav::nmos::Node::Configuration::from_json(const boost::json::value& json) {
         config.registry_address = json.at("registry_address").as_string();
         config.enabled = json.at("enabled").as_bool();
         config.api_port = json.at("api_port").to_number<uint16_t>();
+        if (const auto* api_worker_threads = json.as_object().if_contains("api_worker_threads")) {
+            config.api_worker_threads = api_worker_threads->to_number<uint16_t>();  // Optional for older configurations
+        }
         config.label = json.at("label").as_string();
         config.description = json.at("description").as_string();
         return config;
@@ -347,7 +440,12 @@ rav::nmos::Node::Node(
     http_client_(std::move(http_client)),
     registry_browser_(std::move(registry_browser)),
     timer_(io_context),
-    heartbeat_timer_(io_context) {
+    heartbeat_timer_(io_context),
+    sync_timer_(io_context),
+    retry_timer_(io_context),
+    activation_timer_(io_context),
+    subscription_timer_(io_context),
+    subscription_expiry_timer_(io_context) {
     if (!http_client_) {
         http_client_ = std::make_unique<HttpClient>(io_context);
     }
@@ -372,11 +470,11 @@ rav::nmos::Node::Node(
     self_.clocks.emplace_back(clock_ptp);  // Must be at k_clock_ptp_index
 
     http_server_.get("/", [](const HttpServer::Request&, HttpServer::Response& res, PathMatcher::Parameters&) {
-        ok_response(res, boost::json::serialize(boost::json::array({"x-nmos/"})));
+        json_ok_response(res, std::array {"x-nmos/"});
     });
 
     http_server_.get("/x-nmos", [](const HttpServer::Request&, HttpServer::Response& res, PathMatcher::Parameters&) {
-        ok_response(res, boost::json::serialize(boost::json::array({"node/", "connection/"})));
+        json_ok_response(res, std::array {"node/", "connection/", "query/"});
     });
 
     // MARK: Node API
@@ -401,43 +499,35 @@ rav::nmos::Node::Node(
                 return invalid_api_version_response(res);
             }
 
-            ok_response(
-                res, boost::json::serialize(boost::json::array({"self/", "sources/", "flows/", "devices/", "senders/", "receivers/"}))
-            );
+            json_ok_response(res, std::array {"self/", "sources/", "flows/", "devices/", "senders/", "receivers/"});
         }
     );
 
     http_server_.get(
         "/x-nmos/node/{version}/self",
-        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+        [this](const HttpServer::Request& req, HttpServer::Response& res, const PathMatcher::Parameters& params) {
             if (!get_valid_api_version_from_parameters(params, k_node_api_versions).has_value()) {
                 return invalid_api_version_response(res);
             }
 
-            ok_response(res, boost::json::serialize(boost::json::value_from(self_)));
+            cached_ok_response(req, res, resource_cache_.get(self_));
         }
     );
 
     http_server_.get(
         "/x-nmos/node/{version}/devices",
-        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+        [this](const HttpServer::Request& req, HttpServer::Response& res, const PathMatcher::Parameters& params) {
             if (!get_valid_api_version_from_parameters(params, k_node_api_versions).has_value()) {
                 return invalid_api_version_response(res);
             }
 
-            boost::json::array devices;
-
-            for (const auto* device : devices_) {
-                devices.push_back(boost::json::value_from(*device));
-            }
-
-            ok_response(res, boost::json::serialize(devices));
+            cached_ok_response(req, res, resource_cache_.get_collection("devices", devices_.list()));
         }
     );
 
     http_server_.get(
         "/x-nmos/node/{version}/devices/{device_id}",
-        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+        [this](const HttpServer::Request& req, HttpServer::Response& res, const PathMatcher::Parameters& params) {
             if (!get_valid_api_version_from_parameters(params, k_node_api_versions).has_value()) {
                 return invalid_api_version_response(res);
             }
@@ -455,7 +545,7 @@ rav::nmos::Node::Node(
             }
 
             if (auto* device = find_device(uuid)) {
-                ok_response(res, boost::json::serialize(boost::json::value_from(*device)));
+                cached_ok_response(req, res, resource_cache_.get(*device));
                 return;
             }
 
@@ -465,24 +555,18 @@ rav::nmos::Node::Node(
 
     http_server_.get(
         "/x-nmos/node/{version}/flows",
-        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+        [this](const HttpServer::Request& req, HttpServer::Response& res, const PathMatcher::Parameters& params) {
             if (!get_valid_api_version_from_parameters(params, k_node_api_versions).has_value()) {
                 return invalid_api_version_response(res);
             }
 
-            boost::json::array flows;
-
-            for (auto* flow : flows_) {
-                flows.push_back(boost::json::value_from(*flow));
-            }
-
-            ok_response(res, boost::json::serialize(flows));
+            cached_ok_response(req, res, resource_cache_.get_collection("flows", flows_.list()));
         }
     );
 
     http_server_.get(
         "/x-nmos/node/{version}/flows/{flow_id}",
-        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+        [this](const HttpServer::Request& req, HttpServer::Response& res, const PathMatcher::Parameters& params) {
             if (!get_valid_api_version_from_parameters(params, k_node_api_versions).has_value()) {
                 return invalid_api_version_response(res);
             }
@@ -500,7 +584,7 @@ rav::nmos::Node::Node(
             }
 
             if (auto* flow = find_flow(uuid)) {
-                ok_response(res, boost::json::serialize(boost::json::value_from(*flow)));
+                cached_ok_response(req, res, resource_cache_.get(*flow));
                 return;
             }
 
@@ -510,24 +594,18 @@ rav::nmos::Node::Node(
 
     http_server_.get(
         "/x-nmos/node/{version}/receivers",
-        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+        [this](const HttpServer::Request& req, HttpServer::Response& res, const PathMatcher::Parameters& params) {
             if (!get_valid_api_version_from_parameters(params, k_node_api_versions).has_value()) {
                 return invalid_api_version_response(res);
             }
 
-            boost::json::array receivers;
-
-            for (auto* receiver : receivers_) {
-                receivers.push_back(boost::json::value_from(*receiver));
-            }
-
-            ok_response(res, boost::json::serialize(receivers));
+            cached_ok_response(req, res, resource_cache_.get_collection("receivers", receivers_.list()));
         }
     );
 
     http_server_.get(
         "/x-nmos/node/{version}/receivers/{receiver_id}",
-        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+        [this](const HttpServer::Request& req, HttpServer::Response& res, const PathMatcher::Parameters& params) {
             if (!get_valid_api_version_from_parameters(params, k_node_api_versions).has_value()) {
                 return invalid_api_version_response(res);
             }
@@ -545,7 +623,7 @@ rav::nmos::Node::Node(
             }
 
             if (auto* receiver = find_receiver(uuid)) {
-                ok_response(res, boost::json::serialize(boost::json::value_from(*receiver)));
+                cached_ok_response(req, res, resource_cache_.get(*receiver));
                 return;
             }
 
@@ -578,24 +656,18 @@ rav::nmos::Node::Node(
 
     http_server_.get(
         "/x-nmos/node/{version}/senders",
-        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+        [this](const HttpServer::Request& req, HttpServer::Response& res, const PathMatcher::Parameters& params) {
             if (!get_valid_api_version_from_parameters(params, k_node_api_versions).has_value()) {
                 return invalid_api_version_response(res);
             }
 
-            boost::json::array senders;
-
-            for (auto* sender : senders_) {
-                senders.push_back(boost::json::value_from(*sender));
-            }
-
-            ok_response(res, boost::json::serialize(senders));
+            cached_ok_response(req, res, resource_cache_.get_collection("senders", senders_.list()));
         }
     );
 
     http_server_.get(
         "/x-nmos/node/{version}/senders/{sender_id}",
-        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+        [this](const HttpServer::Request& req, HttpServer::Response& res, const PathMatcher::Parameters& params) {
             if (!get_valid_api_version_from_parameters(params, k_node_api_versions).has_value()) {
                 return invalid_api_version_response(res);
             }
@@ -613,7 +685,7 @@ rav::nmos::Node::Node(
             }
 
             if (auto* sender = find_sender(uuid)) {
-                ok_response(res, boost::json::serialize(boost::json::value_from(*sender)));
+                cached_ok_response(req, res, resource_cache_.get(*sender));
                 return;
             }
 
@@ -623,24 +695,18 @@ rav::nmos::Node::Node(
 
     http_server_.get(
         "/x-nmos/node/{version}/sources",
-        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+        [this](const HttpServer::Request& req, HttpServer::Response& res, const PathMatcher::Parameters& params) {
             if (!get_valid_api_version_from_parameters(params, k_node_api_versions).has_value()) {
                 return invalid_api_version_response(res);
             }
 
-            boost::json::array sources;
-
-            for (auto* source : sources_) {
-                sources.push_back(boost::json::value_from(*source));
-            }
-
-            ok_response(res, boost::json::serialize(sources));
+            cached_ok_response(req, res, resource_cache_.get_collection("sources", sources_.list()));
         }
     );
 
     http_server_.get(
         "/x-nmos/node/{version}/sources/{source_id}",
-        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+        [this](const HttpServer::Request& req, HttpServer::Response& res, const PathMatcher::Parameters& params) {
             if (!get_valid_api_version_from_parameters(params, k_node_api_versions).has_value()) {
                 return invalid_api_version_response(res);
             }
@@ -658,7 +724,7 @@ rav::nmos::Node::Node(
             }
 
             if (auto* sender = find_source(uuid)) {
-                ok_response(res, boost::json::serialize(boost::json::value_from(*sender)));
+                cached_ok_response(req, res, resource_cache_.get(*sender));
                 return;
             }
 
@@ -688,7 +754,7 @@ rav::nmos::Node::Node(
                 return invalid_api_version_response(res);
             }
 
-            ok_response(res, boost::json::serialize(boost::json::array({"bulk/", "single/"})));
+            json_ok_response(res, std::array {"bulk/", "single/"});
         }
     );
 
@@ -699,7 +765,7 @@ rav::nmos::Node::Node(
                 return invalid_api_version_response(res);
             }
 
-            ok_response(res, boost::json::serialize(boost::json::array({"senders/", "receivers/"})));
+            json_ok_response(res, std::array {"senders/", "receivers/"});
         }
     );
 
@@ -710,7 +776,7 @@ rav::nmos::Node::Node(
                 return invalid_api_version_response(res);
             }
 
-            ok_response(res, boost::json::serialize(boost::json::array({"senders/", "receivers/"})));
+            json_ok_response(res, std::array {"senders/", "receivers/"});
         }
     );
 
@@ -746,13 +812,17 @@ rav::nmos::Node::Node(
                 return invalid_api_version_response(res);
             }
 
-            auto array = boost::json::array();
+            res.result(http::status::ok);
+            set_default_headers(res);
+            res.body().clear();
 
+            JsonWriter writer(res.body());
+            writer.begin_array();
             for (auto& receiver : receivers_) {
-                array.push_back(boost::json::value_from(fmt::format("{}/", boost::uuids::to_string(receiver->id))));
+                writer.value(fmt::format("{}/", boost::uuids::to_string(receiver->id)));
             }
-
-            ok_response(res, boost::json::serialize(array));
+            writer.end_array();
+            res.prepare_payload();
         }
     );
 
@@ -769,13 +839,13 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* receiver = find_receiver(boost::uuids::string_generator()(*receiver_id));
+            auto* receiver = find_receiver(boost::uuids::string_generator()(receiver_id->begin(), receiver_id->end()));
             if (receiver == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Receiver not found");
                 return;
             }
 
-            ok_response(res, boost::json::serialize(boost::json::array({"constraints/", "staged/", "active/", "transporttype/"})));
+            json_ok_response(res, std::array {"constraints/", "staged/", "active/", "transporttype/"});
         }
     );
 
@@ -792,7 +862,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* receiver = find_receiver(boost::uuids::string_generator()(*receiver_id));
+            auto* receiver = find_receiver(boost::uuids::string_generator()(receiver_id->begin(), receiver_id->end()));
             if (receiver == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Receiver not found");
                 return;
@@ -814,7 +884,7 @@ rav::nmos::Node::Node(
                 transport_file.data = *sdp_text;
             }
 
-            ActivationResponse activation_response;
+            const auto activation_response = get_staged_activation(receiver->id);
 
             const boost::json::value value {
                 {"sender_id", json_value_from_uuid(receiver->subscription.sender_id)}, {"master_enable", receiver->subscription.active},
@@ -839,7 +909,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* receiver = find_receiver(boost::uuids::string_generator()(*receiver_id));
+            auto* receiver = find_receiver(boost::uuids::string_generator()(receiver_id->begin(), receiver_id->end()));
             if (receiver == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Receiver not found");
                 return;
@@ -862,7 +932,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* receiver = find_receiver(boost::uuids::string_generator()(*receiver_id));
+            auto* receiver = find_receiver(boost::uuids::string_generator()(receiver_id->begin(), receiver_id->end()));
             if (receiver == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Receiver not found");
                 return;
@@ -899,24 +969,34 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            // Refuse activation modes other than activate_immediate
-            if (const auto result = json.try_at("activation")) {
-                auto activation = boost::json::value_to<Activation>(*result);
-                if (const auto mode = activation.mode) {
-                    if (*mode != Activation::Mode::activate_immediate) {
-                        set_error_response(res, http::status::not_implemented, "Not Implemented", "Only activate_immediate is implemented");
-                        return;
-                    }
-                }
+            RAV_ASSERT(receiver->get_transport_file, "Expecting valid function");
+            const auto active_sdp = receiver->get_transport_file();
+            if (!active_sdp) {
+                set_error_response(res, active_sdp.error());
+                return;
             }
 
-            RAV_ASSERT(receiver->on_patch_request, "Expecting valid function");
-            if (auto result = receiver->on_patch_request(json); !result) {
-                set_error_response(res, result.error());
+            const auto activation_response = stage_activation(receiver->id, false, json, *active_sdp);
+            if (!activation_response) {
+                set_error_response(res, activation_response.error());
                 return;
             }
 
-            RAV_ASSERT(receiver->get_transport_file, "Expecting valid function");
+            // Scheduled activations are applied by the activation timer
+            const bool is_scheduled =
+                activation_response->mode.has_value() && *activation_response->mode != Activation::Mode::activate_immediate;
+
+            if (!is_scheduled) {
+                RAV_ASSERT(receiver->on_patch_request, "Expecting valid function");
+                if (auto result = receiver->on_patch_request(json); !result) {
+                    set_error_response(res, result.error());
+                    return;
+                }
+                if (activation_response->mode.has_value()) {
+                    active_activations_[receiver->id] = *activation_response;
+                }
+            }
+
             auto sdp = receiver->get_transport_file();
             if (!sdp) {
                 set_error_response(res, sdp.error());
@@ -932,15 +1012,16 @@ rav::nmos::Node::Node(
                 transport_file.data = *sdp_text;
             }
 
-            ActivationResponse activation_response;
-
             const boost::json::value value {
                 {"sender_id", json_value_from_uuid(receiver->subscription.sender_id)}, {"master_enable", receiver->subscription.active},
-                {"activation", boost::json::value_from(activation_response)},          {"transport_params", transport_params},
+                {"activation", boost::json::value_from(*activation_response)},         {"transport_params", transport_params},
                 {"transport_file", boost::json::value_from(transport_file)},
             };
 
             ok_response(res, boost::json::serialize(value));
+            if (is_scheduled) {
+                res.result(http::status::accepted);
+            }
         }
     );
 
@@ -957,7 +1038,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* receiver = find_receiver(boost::uuids::string_generator()(*receiver_id));
+            auto* receiver = find_receiver(boost::uuids::string_generator()(receiver_id->begin(), receiver_id->end()));
             if (receiver == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Receiver not found");
                 return;
@@ -979,7 +1060,7 @@ rav::nmos::Node::Node(
                 transport_file.data = *sdp_text;
             }
 
-            ActivationResponse activation_response;
+            const auto activation_response = get_active_activation(receiver->id);
 
             const boost::json::value value {
                 {"sender_id", json_value_from_uuid(receiver->subscription.sender_id)}, {"master_enable", receiver->subscription.active},
@@ -1004,7 +1085,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* receiver = find_receiver(boost::uuids::string_generator()(*receiver_id));
+            auto* receiver = find_receiver(boost::uuids::string_generator()(receiver_id->begin(), receiver_id->end()));
             if (receiver == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Receiver not found");
                 return;
@@ -1027,13 +1108,13 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* receiver = find_receiver(boost::uuids::string_generator()(*receiver_id));
+            auto* receiver = find_receiver(boost::uuids::string_generator()(receiver_id->begin(), receiver_id->end()));
             if (receiver == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Receiver not found");
                 return;
             }
 
-            ok_response(res, boost::json::serialize("urn:x-nmos:transport:rtp"));
+            json_ok_response(res, "urn:x-nmos:transport:rtp");
         }
     );
 
@@ -1068,13 +1149,17 @@ rav::nmos::Node::Node(
                 return invalid_api_version_response(res);
             }
 
-            auto array = boost::json::array();
+            res.result(http::status::ok);
+            set_default_headers(res);
+            res.body().clear();
 
+            JsonWriter writer(res.body());
+            writer.begin_array();
             for (auto& sender : senders_) {
-                array.push_back(boost::json::value_from(fmt::format("{}/", boost::uuids::to_string(sender->id))));
+                writer.value(fmt::format("{}/", boost::uuids::to_string(sender->id)));
             }
-
-            ok_response(res, boost::json::serialize(array));
+            writer.end_array();
+            res.prepare_payload();
         }
     );
 
@@ -1091,15 +1176,13 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* sender = find_sender(boost::uuids::string_generator()(*sender_id));
+            auto* sender = find_sender(boost::uuids::string_generator()(sender_id->begin(), sender_id->end()));
             if (sender == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Sender not found");
                 return;
             }
 
-            ok_response(
-                res, boost::json::serialize(boost::json::array({"constraints/", "staged/", "active/", "transportfile/", "transporttype/"}))
-            );
+            json_ok_response(res, std::array {"constraints/", "staged/", "active/", "transportfile/", "transporttype/"});
         }
     );
 
@@ -1116,7 +1199,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* sender = find_sender(boost::uuids::string_generator()(*sender_id));
+            auto* sender = find_sender(boost::uuids::string_generator()(sender_id->begin(), sender_id->end()));
             if (sender == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Sender not found");
                 return;
@@ -1139,7 +1222,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* sender = find_sender(boost::uuids::string_generator()(*sender_id));
+            auto* sender = find_sender(boost::uuids::string_generator()(sender_id->begin(), sender_id->end()));
             if (sender == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Sender not found");
                 return;
@@ -1152,7 +1235,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            ActivationResponse activation_response;
+            const auto activation_response = get_staged_activation(sender->id);
             auto transport_params = get_sender_transport_params_from_sdp(*transport_file);
 
             const boost::json::value value {
@@ -1179,7 +1262,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* sender = find_sender(boost::uuids::string_generator()(*sender_id));
+            auto* sender = find_sender(boost::uuids::string_generator()(sender_id->begin(), sender_id->end()));
             if (sender == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Sender not found");
                 return;
@@ -1208,41 +1291,53 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            // Refuse activation modes other than activate_immediate
-            if (const auto result = json.try_at("activation")) {
-                auto activation = boost::json::value_to<Activation>(*result);
-                if (const auto mode = activation.mode) {
-                    if (*mode != Activation::Mode::activate_immediate) {
-                        set_error_response(res, http::status::not_implemented, "Not Implemented", "Only activate_immediate is implemented");
-                        return;
-                    }
-                }
+            RAV_ASSERT(sender->get_transport_file, "Expecting valid function");
+            const auto active_transport_file = sender->get_transport_file();
+            if (!active_transport_file) {
+                set_error_response(res, active_transport_file.error());
+                return;
             }
 
-            RAV_ASSERT(sender->on_patch_request, "Expecting valid function");
-            if (auto result = sender->on_patch_request(json); !result) {
-                set_error_response(res, result.error());
+            const auto activation_response = stage_activation(sender->id, true, json, *active_transport_file);
+            if (!activation_response) {
+                set_error_response(res, activation_response.error());
                 return;
             }
 
-            RAV_ASSERT(sender->get_transport_file, "Expecting valid function");
+            // Scheduled activations are applied by the activation timer
+            const bool is_scheduled =
+                activation_response->mode.has_value() && *activation_response->mode != Activation::Mode::activate_immediate;
+
+            if (!is_scheduled) {
+                RAV_ASSERT(sender->on_patch_request, "Expecting valid function");
+                if (auto result = sender->on_patch_request(json); !result) {
+                    set_error_response(res, result.error());
+                    return;
+                }
+                if (activation_response->mode.has_value()) {
+                    active_activations_[sender->id] = *activation_response;
+                }
+            }
+
             auto transport_file = sender->get_transport_file();
             if (!transport_file) {
                 set_error_response(res, transport_file.error());
                 return;
             }
 
-            ActivationResponse activation_response;
             auto transport_params = get_sender_transport_params_from_sdp(*transport_file);
 
             const boost::json::value value {
                 {"receiver_id", json_value_from_uuid(sender->subscription.receiver_id)},
                 {"master_enable", sender->subscription.active},
-                {"activation", boost::json::value_from(activation_response)},
+                {"activation", boost::json::value_from(*activation_response)},
                 {"transport_params", transport_params},
             };
 
             ok_response(res, boost::json::serialize(value));
+            if (is_scheduled) {
+                res.result(http::status::accepted);
+            }
         }
     );
 
@@ -1259,7 +1354,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* sender = find_sender(boost::uuids::string_generator()(*sender_id));
+            auto* sender = find_sender(boost::uuids::string_generator()(sender_id->begin(), sender_id->end()));
             if (sender == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Sender not found");
                 return;
@@ -1272,7 +1367,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            ActivationResponse activation_response;
+            const auto activation_response = get_active_activation(sender->id);
             auto transport_params = get_sender_transport_params_from_sdp(*transport_file);
 
             const boost::json::value value {
@@ -1299,7 +1394,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            const auto* sender = find_sender(boost::uuids::string_generator()(*sender_id));
+            const auto* sender = find_sender(boost::uuids::string_generator()(sender_id->begin(), sender_id->end()));
             if (sender == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Sender not found");
                 return;
@@ -1322,7 +1417,7 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            const auto* sender = find_sender(boost::uuids::string_generator()(*sender_id));
+            const auto* sender = find_sender(boost::uuids::string_generator()(sender_id->begin(), sender_id->end()));
             if (sender == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Sender not found");
                 return;
@@ -1357,13 +1452,161 @@ rav::nmos::Node::Node(
                 return;
             }
 
-            auto* sender = find_sender(boost::uuids::string_generator()(*sender_id));
+            auto* sender = find_sender(boost::uuids::string_generator()(sender_id->begin(), sender_id->end()));
             if (sender == nullptr) {
                 set_error_response(res, http::status::not_found, "Not found", "Sender not found");
                 return;
             }
 
-            ok_response(res, boost::json::serialize("urn:x-nmos:transport:rtp"));
+            json_ok_response(res, "urn:x-nmos:transport:rtp");
+        }
+    );
+
+    // MARK: Query API (subscriptions)
+
+    http_server_.get("/x-nmos/query", [](const HttpServer::Request&, HttpServer::Response& res, PathMatcher::Parameters&) {
+        boost::json::array versions;
+        for (const auto& version : k_query_api_versions) {
+            versions.push_back({fmt::format("{}/", version.to_string())});
+        }
+        ok_response(res, boost::json::serialize(versions));
+    });
+
+    http_server_.get(
+        "/x-nmos/query/{version}",
+        [](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+            if (!get_valid_api_version_from_parameters(params, k_query_api_versions).has_value()) {
+                return invalid_api_version_response(res);
+            }
+
+            json_ok_response(res, std::array {"subscriptions/"});
+        }
+    );
+
+    http_server_.get(
+        "/x-nmos/query/{version}/subscriptions",
+        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+            if (!get_valid_api_version_from_parameters(params, k_query_api_versions).has_value()) {
+                return invalid_api_version_response(res);
+            }
+
+            res.result(http::status::ok);
+            set_default_headers(res);
+            res.body().clear();
+
+            JsonWriter writer(res.body());
+            writer.begin_array();
+            for (const auto& [id, state] : subscriptions_) {
+                writer.value(state.subscription);
+            }
+            writer.end_array();
+            res.prepare_payload();
+        }
+    );
+
+    http_server_.post(
+        "/x-nmos/query/{version}/subscriptions",
+        [this](const HttpServer::Request& req, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+            if (!get_valid_api_version_from_parameters(params, k_query_api_versions).has_value()) {
+                return invalid_api_version_response(res);
+            }
+
+            boost::system::error_code ec;
+            const auto json = boost::json::parse(req.body(), ec);
+            if (ec) {
+                set_error_response(res, http::status::bad_request, "Bad request", ec.message());
+                return;
+            }
+
+            const auto num_subscriptions = subscriptions_.size();
+            const auto subscription = create_subscription(json, req[http::field::host]);
+            if (!subscription) {
+                set_error_response(res, subscription.error());
+                return;
+            }
+
+            json_ok_response(res, *subscription);
+            if (subscriptions_.size() > num_subscriptions) {
+                res.result(http::status::created);  // Otherwise an existing subscription with the same parameters is returned
+            }
+            res.set(
+                http::field::location,
+                fmt::format("/x-nmos/query/{}/subscriptions/{}", *params.get("version"), boost::uuids::to_string(subscription->id))
+            );
+        }
+    );
+
+    http_server_.get(
+        "/x-nmos/query/{version}/subscriptions/{subscription_id}",
+        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+            if (!get_valid_api_version_from_parameters(params, k_query_api_versions).has_value()) {
+                return invalid_api_version_response(res);
+            }
+
+            const auto* subscription_id = params.get("subscription_id");
+            if (subscription_id == nullptr) {
+                set_error_response(res, http::status::bad_request, "Invalid subscription ID", "No subscription ID provided");
+                return;
+            }
+
+            const auto it = subscriptions_.find(boost::uuids::string_generator()(subscription_id->begin(), subscription_id->end()));
+            if (it == subscriptions_.end()) {
+                set_error_response(res, http::status::not_found, "Not found", "Subscription not found");
+                return;
+            }
+
+            json_ok_response(res, it->second.subscription);
+        }
+    );
+
+    http_server_.del(
+        "/x-nmos/query/{version}/subscriptions/{subscription_id}",
+        [this](const HttpServer::Request&, HttpServer::Response& res, const PathMatcher::Parameters& params) {
+            if (!get_valid_api_version_from_parameters(params, k_query_api_versions).has_value()) {
+                return invalid_api_version_response(res);
+            }
+
+            const auto* subscription_id = params.get("subscription_id");
+            if (subscription_id == nullptr) {
+                set_error_response(res, http::status::bad_request, "Invalid subscription ID", "No subscription ID provided");
+                return;
+            }
+
+            const auto it = subscriptions_.find(boost::uuids::string_generator()(subscription_id->begin(), subscription_id->end()));
+            if (it == subscriptions_.end()) {
+                set_error_response(res, http::status::not_found, "Not found", "Subscription not found");
+                return;
+            }
+
+            // Non-persistent subscriptions are managed by the node, and removed when their last client disconnects
+            if (!it->second.subscription.persist) {
+                set_error_response(res, http::status::forbidden, "Forbidden", "Subscription is not persistent");
+                return;
+            }
+
+            remove_subscription(it);
+            res.result(http::status::no_content);
+        }
+    );
+
+    http_server_.websocket(
+        "/x-nmos/query/{version}/subscriptions/{subscription_id}/ws",
+        [this](
+            const HttpServer::Request&, std::shared_ptr<HttpServer::WebSocketConnection> connection,
+            const PathMatcher::Parameters& params
+        ) {
+            const auto* subscription_id = params.get("subscription_id");
+            if (subscription_id == nullptr) {
+                connection->close();
+                return;
+            }
+            const auto id = boost::uuids::string_generator()(subscription_id->begin(), subscription_id->end());
+            if (subscriptions_.find(id) == subscriptions_.end()) {
+                RAV_LOG_WARNING("WebSocket connection for unknown subscription: {}", *subscription_id);
+                connection->close();
+                return;
+            }
+            connect_subscription(id, std::move(connection));
         }
     );
 
@@ -1445,6 +1688,10 @@ tl::expected<void, rav::nmos::Error> rav::nmos::Node::set_configuration(Configur
         restart = true;
     }
 
+    if (configuration_.api_worker_threads != new_configuration.api_worker_threads) {
+        restart = true;
+    }
+
     configuration_ = std::move(new_configuration);
     update_self();
 
@@ -1464,9 +1711,7 @@ tl::expected<void, rav::nmos::Error> rav::nmos::Node::set_configuration(Configur
         set_status(Status::disabled);
     }
 
-    if (status_ == Status::registered) {
-        send_updated_resources_async();
-    }
+    schedule_send_updated_resources_async();
     on_configuration_changed(configuration_);
 
     return {};
@@ -1477,6 +1722,7 @@ const rav::nmos::Node::Configuration& rav::nmos::Node::get_configuration() const
 }
 
 boost::system::result<void, rav::nmos::Error> rav::nmos::Node::start_internal() {
+    http_server_.set_worker_threads(configuration_.api_worker_threads);
     const auto result = http_server_.start("0.0.0.0", configuration_.api_port);
     if (result.has_error()) {
         RAV_LOG_ERROR("Failed to start HTTP server: {}", result.error().message());
@@ -1497,12 +1743,18 @@ boost::system::result<void, rav::nmos::Error> rav::nmos::Node::start_internal()
 
     status_info_.api_port = http_endpoint.port();
 
+    subscription_expiry_timer_.start(k_subscription_connect_timeout, [this] {
+        expire_unconnected_subscriptions();
+    });
+
     for (auto* device : devices_) {
         update_device(*device);
     }
 
     for (auto* sender : senders_) {
-        update_nmos_sender_manifest_href(*sender, network_interface_config_, http_endpoint.port());
+        if (update_nmos_sender_manifest_href(*sender, network_interface_config_, http_endpoint.port())) {
+            sender->version.update(get_local_clock().now());
+        }
     }
 
     // Start the HTTP client to connect to the registry.
@@ -1563,7 +1815,12 @@ void rav::nmos::Node::stop_internal() {
     heartbeat_timer_.stop();
     timer_.stop();
     http_client_->cancel_outstanding_requests();
+    reset_registry_sync();
     http_server_.stop();
+    subscription_timer_.stop();
+    subscription_expiry_timer_.stop();
+    subscription_update_scheduled_ = false;
+    subscriptions_.clear();  // The http server closed all WebSocket connections
     RAV_ASSERT(registry_browser_ != nullptr, "Registry browser should not be null");
     registry_browser_->stop();
     selected_registry_.reset();
@@ -1574,10 +1831,16 @@ void rav::nmos::Node::register_async() {
     post_resource_error_count_ = 0;
     failed_heartbeat_count_ = 0;
 
+    reset_registry_sync();
     update_self();
     update_all_resources_to_now();
+
+    // Confirm the registration once all resources have been posted
+    confirm_registration_when_synced_ = true;
     send_updated_resources_async();
+}
 
+void rav::nmos::Node::confirm_registration_async() {
     http_client_->get_async("/", [this](const boost::system::result<http::response<http::string_body>>& result) {
         if (result.has_error()) {
             RAV_LOG_ERROR("Failed to connect to NMOS registry: {}", result.error().message());
@@ -1610,42 +1873,131 @@ void rav::nmos::Node::unregister_async() {
     delete_resource_async("nodes", self_.id);
 }
 
-void rav::nmos::Node::post_resource_async(std::string type, boost::json::value resource) {
+void rav::nmos::Node::post_resource_async(const std::string_view type, const boost::uuids::uuid& id, const std::string_view resource_json) {
+    // The resource is already serialized, so splice it in instead of building (and serializing) a json value around it.
+    auto body = fmt::format(R"({{"type":"{}","data":{}}})", type, resource_json);
+
+    // Coalesce with a post of the same resource which hasn't been sent yet, keeping its place in the queue.
+    for (auto& pending : pending_posts_) {
+        if (pending.id == id) {
+            pending.body = std::move(body);
+            pending.attempts = 0;
+            return;
+        }
+    }
+
+    pending_posts_.push_back({std::string(type), id, std::move(body)});
+    send_pending_posts();
+}
+
+void rav::nmos::Node::send_pending_posts() {
     RAV_ASSERT(http_client_ != nullptr, "HTTP client should not be null");
 
+    if (retry_scheduled_) {
+        return;  // Backing off, the retry timer will resume sending.
+    }
+
     const auto target = fmt::format("/x-nmos/registration/{}/resource", configuration_.api_version.to_string());
 
-    auto body = boost::json::serialize(boost::json::value {{"type", type}, {"data", std::move(resource)}});
+    while (posts_in_flight_ < k_max_registry_posts_in_flight && !pending_posts_.empty()) {
+        auto post = std::move(pending_posts_.front());
+        pending_posts_.pop_front();
+        posts_in_flight_++;
+
+        auto body = post.body;
+        http_client_->post_async(
+            target, std::move(body),
+            [this, generation = registry_sync_generation_,
+             post = std::move(post)](const boost::system::result<http::response<http::string_body>>& result) mutable {
+                if (generation != registry_sync_generation_) {
+                    return;  // The registry sync was reset since this request was made.
+                }
+                on_post_resource_response(std::move(post), result);
+            },
+            {}
+        );
+    }
 
-    http_client_->post_async(
-        target, body,
-        [this, target, body](const boost::system::result<http::response<http::string_body>>& result) mutable {
-            if (result.has_error()) {
-                RAV_LOG_ERROR("Failed to register with registry: {}", result.error().message());
-                post_resource_error_count_++;
-                return;
-            }
+    if (confirm_registration_when_synced_ && pending_posts_.empty() && posts_in_flight_ == 0) {
+        confirm_registration_when_synced_ = false;
+        confirm_registration_async();
+    }
+}
 
-            const auto& res = result.value();
+void rav::nmos::Node::on_post_resource_response(
+    PendingPost post, const boost::system::result<http::response<http::string_body>>& result
+) {
+    RAV_ASSERT(posts_in_flight_ > 0, "Expecting a post to be in flight");
+    posts_in_flight_--;
 
-            if (res.result() == http::status::ok) {
-                RAV_LOG_INFO("Updated {} {}", target, body);
-            } else if (res.result() == http::status::created) {
-                RAV_LOG_INFO("Created {} {}", target, body);
-            } else if (http::to_status_class(res.result()) == http::status_class::successful) {
-                RAV_LOG_WARNING("Unexpected response from registry: {}", res.result_int());
-            } else {
-                post_resource_error_count_++;
-                if (const auto error = parse_json<ApiError>(res.body())) {
-                    RAV_LOG_ERROR("Failed to post resource: {} ({}) {}", error->code, error->error, body);
-                } else {
-                    RAV_LOG_ERROR("Failed to post resource: {} ({}) {}", res.result_int(), res.body(), body);
-                }
-                set_status(Status::error);
+    // Transport errors and server errors are likely to be transient, so these are retried with exponential backoff.
+    if (result.has_error() || http::to_status_class(result->result()) == http::status_class::server_error) {
+        if (result.has_error()) {
+            RAV_LOG_WARNING("Failed to post {} to registry: {}", post.type, result.error().message());
+        } else {
+            RAV_LOG_WARNING("Failed to post {} to registry: {}", post.type, result->result_int());
+        }
+
+        if (++post.attempts >= k_max_registry_post_attempts) {
+            RAV_LOG_ERROR("Giving up posting {} after {} attempts", post.type, post.attempts);
+            post_resource_error_count_++;
+        } else {
+            const auto superseded = std::any_of(pending_posts_.begin(), pending_posts_.end(), [&post](const PendingPost& pending) {
+                return pending.id == post.id;
+            });
+            if (!superseded) {
+                pending_posts_.push_front(std::move(post));
             }
-        },
-        {}
-    );
+        }
+
+        consecutive_post_failures_ = std::min<uint8_t>(consecutive_post_failures_ + 1, 16);
+        const auto backoff = std::min(k_registry_retry_backoff * (1 << (consecutive_post_failures_ - 1)), k_max_registry_retry_backoff);
+        retry_scheduled_ = true;
+        retry_timer_.once(backoff, [this] {
+            retry_scheduled_ = false;
+            send_pending_posts();
+        });
+        return;
+    }
+
+    consecutive_post_failures_ = 0;
+    const auto& res = result.value();
+
+    if (res.result() == http::status::ok) {
+        RAV_LOG_INFO("Updated {} {}", post.type, post.body);
+    } else if (res.result() == http::status::created) {
+        RAV_LOG_INFO("Created {} {}", post.type, post.body);
+    } else if (http::to_status_class(res.result()) == http::status_class::successful) {
+        RAV_LOG_WARNING("Unexpected response from registry: {}", res.result_int());
+    } else {
+        post_resource_error_count_++;
+        if (const auto error = parse_json<ApiError>(res.body())) {
+            RAV_LOG_ERROR("Failed to post resource: {} ({}) {}", error->code, error->error, post.body);
+        } else {
+            RAV_LOG_ERROR("Failed to post resource: {} ({}) {}", res.result_int(), res.body(), post.body);
+        }
+        set_status(Status::error);
+    }
+
+    send_pending_posts();
+}
+
+void rav::nmos::Node::cancel_pending_posts(const boost::uuids::uuid& id) {
+    stl_remove_if(pending_posts_, [&id](const PendingPost& post) {
+        return post.id == id;
+    });
+}
+
+void rav::nmos::Node::reset_registry_sync() {
+    registry_sync_generation_++;
+    pending_posts_.clear();
+    posts_in_flight_ = 0;
+    consecutive_post_failures_ = 0;
+    confirm_registration_when_synced_ = false;
+    sync_scheduled_ = false;
+    retry_scheduled_ = false;
+    sync_timer_.stop();
+    retry_timer_.stop();
 }
 
 void rav::nmos::Node::delete_resource_async(std::string resource_type, const boost::uuids::uuid& id) {
@@ -1688,8 +2040,9 @@ void rav::nmos::Node::update_self() {
 void rav::nmos::Node::send_heartbeat_async() {
     const auto target = fmt::format("/x-nmos/registration/{}/health/nodes/{}", configuration_.api_version.to_string(), to_string(self_.id));
 
-    http_client_->post_async(
-        target, {},
+    // Heartbeats are sent with high priority so that they don't wait behind (large) resource registrations.
+    http_client_->request_with_priority_async(
+        http::verb::post, target, {}, {},
         [this](const boost::system::result<http::response<http::string_body>>& result) {
             if (result.has_value() && result.value().result() == http::status::ok) {
                 failed_heartbeat_count_ = 0;
@@ -1707,12 +2060,13 @@ void rav::nmos::Node::send_heartbeat_async() {
                 }
             }
             http_client_->cancel_outstanding_requests();
+            reset_registry_sync();
             RAV_LOG_ERROR("Failed to send heartbeat {} times, stopping heartbeat", failed_heartbeat_count_);
             set_status(Status::error);
             heartbeat_timer_.stop();
             connect_to_registry_async();
         },
-        {}
+        HttpClientBase::Priority::high
     );
 }
 
@@ -1741,20 +2095,22 @@ void rav::nmos::Node::connect_to_registry_async(const std::string_view host, con
     connect_to_registry_async();
 }
 
-bool rav::nmos::Node::add_receiver_to_device(const ReceiverAudio& receiver) const {
+bool rav::nmos::Node::add_receiver_to_device(const ReceiverAudio& receiver) {
     for (auto* device : devices_) {
         if (device->id == receiver.device_id) {
             device->receivers.push_back(receiver.id);
+            device->version.update(get_local_clock().now());
             return true;
         }
     }
     return false;
 }
 
-bool rav::nmos::Node::add_sender_to_device(const Sender& sender) const {
+bool rav::nmos::Node::add_sender_to_device(const Sender& sender) {
     for (auto* device : devices_) {
         if (device->id == sender.device_id) {
             device->senders.push_back(sender.id);
+            device->version.update(get_local_clock().now());
             return true;
         }
     }
@@ -1824,42 +2180,479 @@ void rav::nmos::Node::send_updated_resources_async() {
     auto new_version = Version(get_local_clock().now());
 
     if (self_.version > current_version_) {
-        post_resource_async("node", boost::json::value_from(self_));
+        post_resource_async("node", self_.id, resource_cache_.get(self_).json);
     }
 
     for (auto* device : devices_) {
         if (device->version > current_version_) {
-            post_resource_async("device", boost::json::value_from(*device));
+            post_resource_async("device", device->id, resource_cache_.get(*device).json);
         }
     }
 
     for (auto* source : sources_) {
         if (source->version > current_version_) {
-            post_resource_async("source", boost::json::value_from(*source));
+            post_resource_async("source", source->id, resource_cache_.get(*source).json);
         }
     }
 
     for (auto* flow : flows_) {
         if (flow->version > current_version_) {
-            post_resource_async("flow", boost::json::value_from(*flow));
+            post_resource_async("flow", flow->id, resource_cache_.get(*flow).json);
         }
     }
 
     for (auto* sender : senders_) {
         if (sender->version > current_version_) {
-            post_resource_async("sender", boost::json::value_from(*sender));
+            post_resource_async("sender", sender->id, resource_cache_.get(*sender).json);
         }
     }
 
     for (auto* receiver : receivers_) {
         if (receiver->version > current_version_) {
-            post_resource_async("receiver", boost::json::value_from(*receiver));
+            post_resource_async("receiver", receiver->id, resource_cache_.get(*receiver).json);
         }
     }
 
     current_version_ = Version(new_version);
 }
 
+void rav::nmos::Node::schedule_send_updated_resources_async() {
+    if (sync_scheduled_) {
+        return;  // Changes will be picked up by the scheduled sync
+    }
+    sync_scheduled_ = true;
+    sync_timer_.once(k_registry_sync_delay, [this] {
+        sync_scheduled_ = false;
+        if (status_ == Status::registered) {
+            send_updated_resources_async();
+        }
+        send_subscription_updates();
+    });
+}
+
+tl::expected<void, rav::nmos::ApiError> rav::nmos::Node::validate_patch_request(
+    const boost::uuids::uuid& resource_id, const bool is_sender, const boost::json::value& patch_request
+) const {
+    if (is_sender) {
+        const auto* sender = find_sender(resource_id);
+        if (sender == nullptr) {
+            return tl::unexpected(ApiError {http::status::not_found, "Not found", "Sender not found"});
+        }
+        if (sender->on_validate_patch_request) {
+            return sender->on_validate_patch_request(patch_request);
+        }
+        return {};
+    }
+
+    const auto* receiver = find_receiver(resource_id);
+    if (receiver == nullptr) {
+        return tl::unexpected(ApiError {http::status::not_found, "Not found", "Receiver not found"});
+    }
+    if (receiver->on_validate_patch_request) {
+        return receiver->on_validate_patch_request(patch_request);
+    }
+    return {};
+}
+
+tl::expected<rav::nmos::ActivationResponse, rav::nmos::ApiError> rav::nmos::Node::stage_activation(
+    const boost::uuids::uuid& resource_id, const bool is_sender, const boost::json::value& patch_request,
+    const sdp::SessionDescription& transport_file
+) {
+    const bool is_pending = scheduled_activations_.find(resource_id) != nullptr;
+
+    const auto value = patch_request.try_at("activation");
+    if (!value) {
+        if (is_pending) {
+            return tl::unexpected(ApiError {http::status::locked, "Locked", "A scheduled activation is pending"});
+        }
+        return ActivationResponse {};
+    }
+
+    const auto activation = boost::json::value_to<Activation>(*value);
+
+    ActivationResponse response;
+    response.mode = activation.mode;
+
+    // Setting the mode to null unlocks the resource by cancelling the pending activation
+    if (!activation.mode.has_value()) {
+        if (scheduled_activations_.cancel(resource_id)) {
+            RAV_LOG_INFO("Cancelled scheduled activation of {}", boost::uuids::to_string(resource_id));
+            schedule_activation_timer();
+        }
+        return response;
+    }
+
+    if (is_pending) {
+        return tl::unexpected(ApiError {http::status::locked, "Locked", "A scheduled activation is pending"});
+    }
+
+    const auto now = Timestamp(get_local_clock().now());
+    const auto activation_time = ActivationScheduler::resolve_activation_time(activation, now);
+    if (!activation_time.has_value()) {
+        return tl::unexpected(ApiError {http::status::bad_request, "Bad Request", "Scheduled activation requires a requested_time"});
+    }
+
+    if (*activation.mode == Activation::Mode::activate_immediate) {
+        response.activation_time = now;
+        return response;
+    }
+
+    // The staged parameters are applied when the activation is due, which is too late to tell the client they're invalid
+    if (auto result = validate_patch_request(resource_id, is_sender, patch_request); !result) {
+        return tl::unexpected(result.error());
+    }
+
+    response.requested_time = activation.requested_time;
+    response.activation_time = align_activation_time(*activation_time, transport_file);
+
+    scheduled_activations_.schedule({resource_id, is_sender, response, patch_request});
+    RAV_LOG_INFO(
+        "Scheduled activation of {} at {}", boost::uuids::to_string(resource_id), response.activation_time->to_string()
+    );
+    schedule_activation_timer();
+
+    return response;
+}
+
+rav::nmos::ActivationResponse rav::nmos::Node::get_staged_activation(const boost::uuids::uuid& resource_id) const {
+    if (const auto* scheduled = scheduled_activations_.find(resource_id)) {
+        return scheduled->activation;
+    }
+    return {};
+}
+
+rav::nmos::ActivationResponse rav::nmos::Node::get_active_activation(const boost::uuids::uuid& resource_id) const {
+    const auto it = active_activations_.find(resource_id);
+    if (it != active_activations_.end()) {
+        return it->second;
+    }
+    return {};
+}
+
+void rav::nmos::Node::schedule_activation_timer() {
+    const auto next = scheduled_activations_.next_activation_time();
+    if (!next.has_value()) {
+        activation_timer_.cancel();
+        return;
+    }
+
+    // The timer runs on the steady clock, which drifts from the PTP timeline. If the timer fires early nothing will be
+    // due yet and the timer is armed again for the remaining time.
+    const auto now = ActivationScheduler::to_nanoseconds(Timestamp(get_local_clock().now()));
+    const auto deadline = ActivationScheduler::to_nanoseconds(*next);
+    activation_timer_.expires_after(std::chrono::nanoseconds(deadline > now ? deadline - now : 0));
+    activation_timer_.async_wait([this](const boost::system::error_code& error) {
+        if (error == boost::asio::error::operation_aborted) {
+            return;
+        }
+        if (error) {
+            RAV_LOG_ERROR("Activation timer error: {}", error.message());
+            return;
+        }
+        execute_due_activations();
+    });
+}
+
+void rav::nmos::Node::execute_due_activations() {
+    for (auto& scheduled : scheduled_activations_.take_due(Timestamp(get_local_clock().now()))) {
+        const auto id_str = boost::uuids::to_string(scheduled.resource_id);
+
+        tl::expected<void, ApiError> result;
+        if (scheduled.is_sender) {
+            const auto* sender = find_sender(scheduled.resource_id);
+            if (sender == nullptr) {
+                RAV_LOG_WARNING("Sender {} no longer exists, dropping scheduled activation", id_str);
+                continue;
+            }
+            RAV_ASSERT(sender->on_patch_request, "Expecting valid function");
+            result = sender->on_patch_request(scheduled.patch_request);
+        } else {
+            const auto* receiver = find_receiver(scheduled.resource_id);
+            if (receiver == nullptr) {
+                RAV_LOG_WARNING("Receiver {} no longer exists, dropping scheduled activation", id_str);
+                continue;
+            }
+            RAV_ASSERT(receiver->on_patch_request, "Expecting valid function");
+            result = receiver->on_patch_request(scheduled.patch_request);
+        }
+
+        const auto applied_at = Timestamp(get_local_clock().now());
+
+        if (!result) {
+            RAV_LOG_ERROR("Failed to apply scheduled activation of {}: {}", id_str, result.error().error);
+            continue;
+        }
+
+        const auto activation_time = *scheduled.activation.activation_time;
+        const auto dispatch_delay = std::chrono::nanoseconds(
+            static_cast<int64_t>(ActivationScheduler::to_nanoseconds(applied_at))
+            - static_cast<int64_t>(ActivationScheduler::to_nanoseconds(activation_time))
+        );
+        RAV_LOG_INFO(
+            "Activated {} at {} (dispatched {} us late)", id_str, activation_time.to_string(),
+            static_cast<double>(dispatch_delay.count()) / 1000.0
+        );
+
+        active_activations_[scheduled.resource_id] = scheduled.activation;
+        on_activation({scheduled.resource_id, activation_time, dispatch_delay});
+    }
+
+    schedule_activation_timer();
+}
+
+void rav::nmos::Node::cancel_activations(const boost::uuids::uuid& resource_id) {
+    if (scheduled_activations_.cancel(resource_id)) {
+        schedule_activation_timer();
+    }
+    active_activations_.erase(resource_id);
+}
+
+tl::expected<rav::nmos::Subscription, rav::nmos::ApiError>
+rav::nmos::Node::create_subscription(const boost::json::value& request, std::string_view host) {
+    static constexpr std::array<std::string_view, 6> k_resource_paths {
+        "/nodes", "/devices", "/sources", "/flows", "/senders", "/receivers",
+    };
+
+    if (!request.is_object() || request.try_at("resource_path").has_error() || request.try_at("params").has_error()
+        || request.try_at("persist").has_error()) {
+        return tl::unexpected(ApiError {http::status::bad_request, "Bad request", "Missing resource_path, params or persist"});
+    }
+
+    Subscription subscription;
+    try {
+        subscription = boost::json::value_to<Subscription>(request);
+    } catch (const std::exception& e) {
+        return tl::unexpected(ApiError {http::status::bad_request, "Bad request", e.what()});
+    }
+
+    if (std::find(k_resource_paths.begin(), k_resource_paths.end(), subscription.resource_path) == k_resource_paths.end()) {
+        return tl::unexpected(ApiError {http::status::bad_request, "Bad request", "Invalid resource_path"});
+    }
+    if (!subscription.params.empty()) {
+        return tl::unexpected(ApiError {http::status::not_implemented, "Not implemented", "Query parameters are not supported"});
+    }
+    if (subscription.secure) {
+        return tl::unexpected(ApiError {http::status::not_implemented, "Not implemented", "Secure subscriptions are not supported"});
+    }
+
+    // Subscriptions with identical parameters are shared, as required by the spec
+    for (const auto& [id, state] : subscriptions_) {
+        const auto& existing = state.subscription;
+        if (existing.resource_path == subscription.resource_path && existing.persist == subscription.persist
+            && existing.max_update_rate_ms == subscription.max_update_rate_ms) {
+            return existing;
+        }
+    }
+
+    subscription.id = boost::uuids::random_generator()();
+    if (host.empty()) {
+        host = std::string_view(self_.href).substr(std::min(self_.href.size(), std::string_view("http://").size()));
+    }
+    subscription.ws_href = fmt::format(
+        "ws://{}/x-nmos/query/{}/subscriptions/{}/ws", host, k_query_api_versions.back().to_string(),
+        boost::uuids::to_string(subscription.id)
+    );
+
+    SubscriptionState state;
+    state.subscription = subscription;
+    state.created = std::chrono::steady_clock::now();
+    subscriptions_.emplace(subscription.id, std::move(state));
+    return subscription;
+}
+
+void rav::nmos::Node::connect_subscription(
+    const boost::uuids::uuid& subscription_id, std::shared_ptr<HttpServer::WebSocketConnection> connection
+) {
+    auto it = subscriptions_.find(subscription_id);
+    RAV_ASSERT(it != subscriptions_.end(), "Subscription should exist");
+    auto& state = it->second;
+
+    // Bring existing clients up to date first, so the sync grain below reflects what everybody has seen.
+    const auto changes = update_subscription(state);
+    if (!changes.empty()) {
+        const auto grain = make_subscription_grain(state, changes);
+        for (auto& existing : state.connections) {
+            existing->send(grain);
+        }
+        state.last_update = std::chrono::steady_clock::now();
+    }
+
+    std::string data;
+    for (const auto& [id, sent] : state.sent) {
+        if (!data.empty()) {
+            data.push_back(',');
+        }
+        fmt::format_to(
+            std::back_inserter(data), R"({{"path":"{}","pre":{},"post":{}}})", boost::uuids::to_string(id), sent.json, sent.json
+        );
+    }
+    connection->send(make_subscription_grain(state, data));
+
+    connection->on_close = [this, subscription_id, ptr = connection.get()] {
+        disconnect_subscription(subscription_id, ptr);
+    };
+    state.connections.push_back(std::move(connection));
+}
+
+void rav::nmos::Node::disconnect_subscription(
+    const boost::uuids::uuid& subscription_id, const HttpServer::WebSocketConnection* connection
+) {
+    auto it = subscriptions_.find(subscription_id);
+    if (it == subscriptions_.end()) {
+        return;
+    }
+    stl_remove_if(it->second.connections, [connection](const auto& c) {
+        return c.get() == connection;
+    });
+    if (it->second.connections.empty() && !it->second.subscription.persist) {
+        subscriptions_.erase(it);
+    }
+}
+
+void rav::nmos::Node::remove_subscription(const std::map<boost::uuids::uuid, SubscriptionState>::iterator it) {
+    RAV_LOG_TRACE("Removing subscription {}", boost::uuids::to_string(it->first));
+    // Closing a connection calls back into disconnect_subscription, so erase first
+    const auto connections = std::move(it->second.connections);
+    subscriptions_.erase(it);
+    for (const auto& connection : connections) {
+        connection->close();
+    }
+}
+
+void rav::nmos::Node::expire_unconnected_subscriptions() {
+    const auto now = std::chrono::steady_clock::now();
+    for (auto it = subscriptions_.begin(); it != subscriptions_.end();) {
+        const auto& state = it->second;
+        if (state.subscription.persist || !state.connections.empty() || now - state.created < k_subscription_connect_timeout) {
+            ++it;
+            continue;
+        }
+        RAV_LOG_TRACE("Subscription {} expired without a client connecting", boost::uuids::to_string(it->first));
+        it = subscriptions_.erase(it);
+    }
+}
+
+void rav::nmos::Node::send_subscription_updates() {
+    const auto now = std::chrono::steady_clock::now();
+    std::optional<std::chrono::milliseconds> next_update;
+
+    for (auto& [id, state] : subscriptions_) {
+        if (state.connections.empty()) {
+            continue;
+        }
+
+        const auto interval = std::chrono::milliseconds(state.subscription.max_update_rate_ms);
+        if (now - state.last_update < interval) {
+            // Rate limited, try again when the interval has passed
+            const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(interval - (now - state.last_update));
+            next_update = next_update ? std::min(*next_update, remaining) : remaining;
+            continue;
+        }
+
+        const auto changes = update_subscription(state);
+        if (changes.empty()) {
+            continue;
+        }
+
+        const auto grain = make_subscription_grain(state, changes);
+        for (auto& connection : state.connections) {
+            connection->send(grain);
+        }
+        state.last_update = now;
+    }
+
+    if (next_update && !subscription_update_scheduled_) {
+        subscription_update_scheduled_ = true;
+        subscription_timer_.once(*next_update, [this] {
+            subscription_update_scheduled_ = false;
+            send_subscription_updates();
+        });
+    }
+}
+
+std::string rav::nmos::Node::update_subscription(SubscriptionState& state) {
+    std::string data;
+    const auto append = [&data](const boost::uuids::uuid& id, const std::string_view pre, const std::string_view post) {
+        if (!data.empty()) {
+            data.push_back(',');
+        }
+        fmt::format_to(
+            std::back_inserter(data), R"({{"path":"{}","pre":{},"post":{}}})", boost::uuids::to_string(id),
+            pre.empty() ? "null" : pre, post.empty() ? "null" : post
+        );
+    };
+
+    const auto generation = ++state.generation;
+
+    // Added (no pre) and modified (pre and post) resources
+    visit_resources(state.subscription.resource_path, [&](const boost::uuids::uuid& id, const Version& version, const std::string& json) {
+        auto [it, inserted] = state.sent.try_emplace(id);
+        auto& sent = it->second;
+        sent.generation = generation;
+        if (inserted) {
+            append(id, {}, json);
+        } else if (sent.version != version) {
+            append(id, sent.json, json);
+        } else {
+            return;
+        }
+        sent.version = version;
+        sent.json = json;
+    });
+
+    // Removed resources (no post)
+    for (auto it = state.sent.begin(); it != state.sent.end();) {
+        if (it->second.generation != generation) {
+            append(it->first, it->second.json, {});
+            it = state.sent.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    return data;
+}
+
+std::string rav::nmos::Node::make_subscription_grain(const SubscriptionState& state, const std::string& data) {
+    const auto timestamp = Timestamp(get_local_clock().now()).to_string();
+    return fmt::format(
+        R"({{"grain_type":"event","source_id":"{}","flow_id":"{}","origin_timestamp":"{}","sync_timestamp":"{}",)"
+        R"("creation_timestamp":"{}","rate":{{"numerator":0,"denominator":1}},"duration":{{"numerator":0,"denominator":1}},)"
+        R"("grain":{{"type":"urn:x-nmos:format:data.event","topic":"{}/","data":[{}]}}}})",
+        boost::uuids::to_string(self_.id), boost::uuids::to_string(state.subscription.id), timestamp, timestamp, timestamp,
+        state.subscription.resource_path, data
+    );
+}
+
+void rav::nmos::Node::visit_resources(
+    const std::string_view resource_path,
+    const std::function<void(const boost::uuids::uuid&, const Version&, const std::string&)>& visitor
+) {
+    if (resource_path == "/nodes") {
+        visitor(self_.id, self_.version, resource_cache_.get(self_).json);
+    } else if (resource_path == "/devices") {
+        for (const auto* device : devices_) {
+            visitor(device->id, device->version, resource_cache_.get(*device).json);
+        }
+    } else if (resource_path == "/sources") {
+        for (const auto* source : sources_) {
+            visitor(source->id, source->version, resource_cache_.get(*source).json);
+        }
+    } else if (resource_path == "/flows") {
+        for (const auto* flow : flows_) {
+            visitor(flow->id, flow->version, resource_cache_.get(*flow).json);
+        }
+    } else if (resource_path == "/senders") {
+        for (const auto* sender : senders_) {
+            visitor(sender->id, sender->version, resource_cache_.get(*sender).json);
+        }
+    } else if (resource_path == "/receivers") {
+        for (const auto* receiver : receivers_) {
+            visitor(receiver->id, receiver->version, resource_cache_.get(*receiver).json);
+        }
+    }
+}
+
 void rav::nmos::Node::update_device(Device& device) {
     const auto endpoint = http_server_.get_local_endpoint();
     device.controls.clear();
@@ -1908,40 +2701,18 @@ bool rav::nmos::Node::add_or_update_device(Device* device) {
     device->version.update(get_local_clock().now());
     update_device(*device);
 
-    // Test is a device with the same uuid exists
-    for (const auto* existing_device : devices_) {
-        if (existing_device != device && existing_device->id == device->id) {
-            RAV_LOG_ERROR("Device with same uuid already exists");
-            return false;
-        }
-    }
-
-    bool device_exists = false;
-    for (const auto* existing_device : devices_) {
-        if (existing_device == device) {
-            device_exists = true;
-        }
+    if (devices_.insert(device) == ResourceStore<Device>::InsertResult::conflict) {
+        RAV_LOG_ERROR("Device with same uuid already exists");
+        return false;
     }
 
-    if (!device_exists) {
-        devices_.push_back(device);
-    }
-
-    if (status_ == Status::registered) {
-        send_updated_resources_async();
-    }
+    schedule_send_updated_resources_async();
 
     return true;
 }
 
 const rav::nmos::Device* rav::nmos::Node::find_device(const boost::uuids::uuid& uuid) const {
-    const auto it = std::find_if(devices_.begin(), devices_.end(), [uuid](const Device* device) {
-        return device->id == uuid;
-    });
-    if (it != devices_.end()) {
-        return *it;
-    }
-    return nullptr;
+    return devices_.find(uuid);
 }
 
 bool rav::nmos::Node::add_or_update_flow(FlowAudioRaw* flow) {
@@ -1954,17 +2725,12 @@ bool rav::nmos::Node::add_or_update_flow(FlowAudioRaw* flow) {
 
     flow->version = Version(get_local_clock().now());
 
-    const auto it = std::find_if(flows_.begin(), flows_.end(), [flow](const FlowAudioRaw* existing_flow) {
-        return existing_flow == flow;
-    });
-
-    if (it == flows_.end()) {
-        flows_.push_back(flow);
+    if (flows_.insert(flow) == ResourceStore<FlowAudioRaw>::InsertResult::conflict) {
+        RAV_LOG_ERROR("Flow with same uuid already exists");
+        return false;
     }
 
-    if (status_ == Status::registered) {
-        send_updated_resources_async();
-    }
+    schedule_send_updated_resources_async();
 
     return true;
 }
@@ -1972,53 +2738,54 @@ bool rav::nmos::Node::add_or_update_flow(FlowAudioRaw* flow) {
 bool rav::nmos::Node::remove_device(Device* device) {
     RAV_ASSERT(device != nullptr, "Device is null");
 
-    stl_remove_if(senders_, [&device](const Sender* s) {
-        return s->device_id == device->id;
-    });
+    const auto belongs_to_device = [this, &device](const auto* resource) {
+        if (resource->device_id != device->id) {
+            return false;
+        }
+        resource_cache_.erase(resource->id);
+        cancel_pending_posts(resource->id);
+        cancel_activations(resource->id);
+        return true;
+    };
 
-    stl_remove_if(flows_, [&device](const FlowAudioRaw* f) {
-        return f->device_id == device->id;
-    });
+    senders_.erase_if(belongs_to_device);
+    flows_.erase_if(belongs_to_device);
+    sources_.erase_if(belongs_to_device);
+    receivers_.erase_if(belongs_to_device);
 
-    stl_remove_if(sources_, [&device](const SourceAudio* s) {
-        return s->device_id == device->id;
-    });
+    const bool removed = devices_.erase(device);
 
-    stl_remove_if(receivers_, [&device](const ReceiverAudio* r) {
-        return r->device_id == device->id;
-    });
-
-    const auto count = stl_remove_if(devices_, [device](const Device* d) {
-        return d == device;
-    });
+    if (removed) {
+        resource_cache_.erase(device->id);
+        cancel_pending_posts(device->id);
+        schedule_send_updated_resources_async();  // Notifies subscribers of the removal
+    }
 
-    if (status_ == Status::registered && count > 0) {
+    if (status_ == Status::registered && removed) {
         delete_resource_async("devices", device->id);
     }
 
-    return count > 0;
+    return removed;
 }
 
 const rav::nmos::FlowAudioRaw* rav::nmos::Node::find_flow(const boost::uuids::uuid& uuid) const {
-    const auto it = std::find_if(flows_.begin(), flows_.end(), [uuid](const FlowAudioRaw* flow) {
-        return flow->id == uuid;
-    });
-    if (it != flows_.end()) {
-        return *it;
-    }
-    return nullptr;
+    return flows_.find(uuid);
 }
 
 bool rav::nmos::Node::remove_flow(FlowAudioRaw* flow) {
-    const auto count = stl_remove_if(flows_, [&flow](const FlowAudioRaw* f) {
-        return f == flow;
-    });
+    const bool removed = flows_.erase(flow);
 
-    if (status_ == Status::registered && count > 0) {
+    if (removed) {
+        resource_cache_.erase(flow->id);
+        cancel_pending_posts(flow->id);
+        schedule_send_updated_resources_async();  // Notifies subscribers of the removal
+    }
+
+    if (status_ == Status::registered && removed) {
         delete_resource_async("flows", flow->id);
     }
 
-    return count > 0;
+    return removed;
 }
 
 bool rav::nmos::Node::add_or_update_receiver(ReceiverAudio* receiver) {
@@ -2031,47 +2798,48 @@ bool rav::nmos::Node::add_or_update_receiver(ReceiverAudio* receiver) {
 
     receiver->version = Version(get_local_clock().now());
 
-    const auto it = std::find_if(receivers_.begin(), receivers_.end(), [receiver](const ReceiverAudio* existing_receiver) {
-        return receiver == existing_receiver;
-    });
-
-    if (it == receivers_.end()) {
+    if (!receivers_.contains(receiver)) {
+        if (receivers_.find(receiver->id) != nullptr) {
+            RAV_LOG_ERROR("Receiver with same uuid already exists");
+            return false;
+        }
         if (!add_receiver_to_device(*receiver)) {
             RAV_LOG_ERROR("Device not found");
             return false;
         }
-        receivers_.push_back(receiver);
     }
 
-    if (status_ == Status::registered) {
-        send_updated_resources_async();
+    if (receivers_.insert(receiver) == ResourceStore<ReceiverAudio>::InsertResult::conflict) {
+        RAV_LOG_ERROR("Receiver with same uuid already exists");
+        return false;
     }
 
+    schedule_send_updated_resources_async();
+
     return true;
 }
 
 const rav::nmos::ReceiverAudio* rav::nmos::Node::find_receiver(const boost::uuids::uuid& uuid) const {
-    const auto it = std::find_if(receivers_.begin(), receivers_.end(), [uuid](const ReceiverAudio* receiver) {
-        return receiver->id == uuid;
-    });
-    if (it != receivers_.end()) {
-        return *it;
-    }
-    return nullptr;
+    return receivers_.find(uuid);
 }
 
 bool rav::nmos::Node::remove_receiver(ReceiverAudio* receiver) {
     RAV_ASSERT(receiver != nullptr, "Expecting receiver to be a valid pointer");
 
-    const auto count = stl_remove_if(receivers_, [&receiver](const ReceiverAudio* d) {
-        return d == receiver;
-    });
+    const bool removed = receivers_.erase(receiver);
 
-    if (status_ == Status::registered && count > 0) {
+    if (removed) {
+        resource_cache_.erase(receiver->id);
+        cancel_pending_posts(receiver->id);
+        cancel_activations(receiver->id);
+        schedule_send_updated_resources_async();  // Notifies subscribers of the removal
+    }
+
+    if (status_ == Status::registered && removed) {
         delete_resource_async("receivers", receiver->id);
     }
 
-    return count > 0;
+    return removed;
 }
 
 bool rav::nmos::Node::add_or_update_sender(Sender* sender) {
@@ -2082,48 +2850,49 @@ bool rav::nmos::Node::add_or_update_sender(Sender* sender) {
 
     RAV_ASSERT(!sender->device_id.is_nil(), "Sender should have a valid device ID");
 
-    const auto it = std::find_if(senders_.begin(), senders_.end(), [sender](const Sender* s) {
-        return s->id == sender->id;
-    });
-
-    if (it == senders_.end()) {
+    if (!senders_.contains(sender)) {
+        if (senders_.find(sender->id) != nullptr) {
+            RAV_LOG_ERROR("Sender with same uuid already exists");
+            return false;
+        }
         if (!add_sender_to_device(*sender)) {
             RAV_LOG_ERROR("Device not found");
             return false;
         }
-        senders_.push_back(sender);
+    }
+
+    if (senders_.insert(sender) == ResourceStore<Sender>::InsertResult::conflict) {
+        RAV_LOG_ERROR("Sender with same uuid already exists");
+        return false;
     }
 
     update_nmos_sender_manifest_href(*sender, network_interface_config_, http_server_.get_local_endpoint().port());
     sender->version = Version(get_local_clock().now());
 
-    if (status_ == Status::registered) {
-        send_updated_resources_async();
-    }
+    schedule_send_updated_resources_async();
 
     return true;
 }
 
 rav::nmos::Sender* rav::nmos::Node::find_sender(const boost::uuids::uuid& uuid) const {
-    const auto it = std::find_if(senders_.begin(), senders_.end(), [uuid](const Sender* sender) {
-        return sender->id == uuid;
-    });
-    if (it != senders_.end()) {
-        return *it;
-    }
-    return nullptr;
+    return senders_.find(uuid);
 }
 
 bool rav::nmos::Node::remove_sender(Sender* sender) {
-    const auto count = stl_remove_if(senders_, [&sender](const Sender* s) {
-        return s == sender;
-    });
+    const bool removed = senders_.erase(sender);
 
-    if (status_ == Status::registered && count > 0) {
+    if (removed) {
+        resource_cache_.erase(sender->id);
+        cancel_pending_posts(sender->id);
+        cancel_activations(sender->id);
+        schedule_send_updated_resources_async();  // Notifies subscribers of the removal
+    }
+
+    if (status_ == Status::registered && removed) {
         delete_resource_async("senders", sender->id);
     }
 
-    return count > 0;
+    return removed;
 }
 
 bool rav::nmos::Node::add_or_update_source(SourceAudio* source) {
@@ -2136,41 +2905,34 @@ bool rav::nmos::Node::add_or_update_source(SourceAudio* source) {
 
     source->version = Version(get_local_clock().now());
 
-    const auto it = std::find_if(sources_.begin(), sources_.end(), [&source](const SourceAudio* existing_source) {
-        return existing_source->id == source->id;
-    });
-
-    if (it == sources_.end()) {
-        sources_.push_back(std::move(source));
+    if (sources_.insert(source) == ResourceStore<SourceAudio>::InsertResult::conflict) {
+        RAV_LOG_ERROR("Source with same uuid already exists");
+        return false;
     }
 
-    if (status_ == Status::registered) {
-        send_updated_resources_async();
-    }
+    schedule_send_updated_resources_async();
 
     return true;
 }
 
 const rav::nmos::SourceAudio* rav::nmos::Node::find_source(const boost::uuids::uuid& uuid) const {
-    const auto it = std::find_if(sources_.begin(), sources_.end(), [uuid](const SourceAudio* source) {
-        return source->id == uuid;
-    });
-    if (it != sources_.end()) {
-        return *it;
-    }
-    return nullptr;
+    return sources_.find(uuid);
 }
 
 bool rav::nmos::Node::remove_source(SourceAudio* source) {
-    const auto count = stl_remove_if(sources_, [&source](const SourceAudio* s) {
-        return s == source;
-    });
+    const bool removed = sources_.erase(source);
+
+    if (removed) {
+        resource_cache_.erase(source->id);
+        cancel_pending_posts(source->id);
+        schedule_send_updated_resources_async();  // Notifies subscribers of the removal
+    }
 
-    if (status_ == Status::registered && count > 0) {
+    if (status_ == Status::registered && removed) {
         delete_resource_async("sources", source->id);
     }
 
-    return count > 0;
+    return removed;
 }
 
 const boost::uuids::uuid& rav::nmos::Node::get_uuid() const {
@@ -2178,23 +2940,23 @@ const boost::uuids::uuid& rav::nmos::Node::get_uuid() const {
 }
 
 const std::vector<rav::nmos::Device*>& rav::nmos::Node::get_devices() const {
-    return devices_;
+    return devices_.list();
 }
 
 const std::vector<rav::nmos::FlowAudioRaw*>& rav::nmos::Node::get_flows() const {
-    return flows_;
+    return flows_.list();
 }
 
 const std::vector<rav::nmos::ReceiverAudio*>& rav::nmos::Node::get_receivers() const {
-    return receivers_;
+    return receivers_.list();
 }
 
 const std::vector<rav::nmos::Sender*>& rav::nmos::Node::get_senders() const {
-    return senders_;
+    return senders_.list();
 }
 
 const std::vector<rav::nmos::SourceAudio*>& rav::nmos::Node::get_sources() const {
-    return sources_;
+    return sources_.list();
 }
 
 const rav::nmos::Node::Status& rav::nmos::Node::get_status() const {
@@ -2234,6 +2996,7 @@ void rav::nmos::Node::set_network_interface_config(NetworkInterfaceConfig config
     const auto addrs = network_interface_config_.get_interface_ipv4_addresses();
     if (addrs.empty()) {
         RAV_LOG_ERROR("No IPv4 addresses found for the interface");
+        self_.version.update(get_local_clock().now());  // The interfaces changed
         return;
     }
 
@@ -2250,14 +3013,14 @@ void rav::nmos::Node::set_network_interface_config(NetworkInterfaceConfig config
     }
 
     for (auto* sender : senders_) {
-        update_nmos_sender_manifest_href(*sender, network_interface_config_, http_endpoint.port());
+        if (update_nmos_sender_manifest_href(*sender, network_interface_config_, http_endpoint.port())) {
+            sender->version.update(get_local_clock().now());
+        }
     }
 
     self_.version.update(get_local_clock().now());
 
-    if (status_ == Status::registered) {
-        send_updated_resources_async();
-    }
+    schedule_send_updated_resources_async();
 }
 
 std::optional<size_t> rav::nmos::Node::index_of_supported_api_version(const ApiVersion& version) {
@@ -2283,9 +3046,7 @@ void rav::nmos::Node::ptp_parent_changed(const ptp::ParentDs& parent) {
     clock_ptp->traceable = ptp_instance_.get_time_properties_ds().time_traceable;
     self_.version.update(get_local_clock().now());
 
-    if (status_ == Status::registered) {
-        send_updated_resources_async();
-    }
+    schedule_send_updated_resources_async();
 }
 
 void rav::nmos::Node::ptp_port_changed_state(const ptp::Port&) {
@@ -2309,9 +3070,7 @@ void rav::nmos::Node::ptp_port_changed_state(const ptp::Port&) {
 
     clock_ptp->locked = locked;
     self_.version.update(get_local_clock().now());
-    if (status_ == Status::registered) {
-        send_updated_resources_async();
-    }
+    schedule_send_updated_resources_async();
 }
 
 void rav::nmos::tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv, const Node::Configuration& config) {
@@ -2322,6 +3081,7 @@ void rav::nmos::tag_invoke(const boost::json::value_from_tag&, boost::json::valu
         {"registry_address", config.registry_address},
         {"enabled", config.enabled},
         {"api_port", config.api_port},
+        {"api_worker_threads", config.api_worker_threads},
         {"label", config.label},
         {"description", config.description},
     };
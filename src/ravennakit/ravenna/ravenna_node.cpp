@@ -28,6 +28,9 @@
 #include "ravennakit/core/platform/windows/thread_characteristics.hpp"
 #include "ravennakit/ravenna/ravenna_sender.hpp"
 
+#include <initializer_list>
+#include <map>
+#include <set>
 #include <utility>
 
 namespace rav {
@@ -40,6 +43,166 @@ inline bool operator==(const rav::RavennaNode::Configuration& lhs, const rav::Ra
 
 }  // namespace rav
 
+namespace {
+
+/**
+ * Describes how to get from the current senders or receivers of a node to those in a snapshot.
+ */
+template<class T>
+struct RestorePlan {
+    /// In snapshot order, either an existing object which is kept or the state of an object to create.
+    std::vector<std::pair<T*, const boost::json::value*>> entries;
+    /// Existing objects whose state differs from the snapshot, with their state in the snapshot.
+    std::vector<std::pair<T*, const boost::json::value*>> changed;
+};
+
+/**
+ * Matches the senders or receivers in a snapshot to the current ones by uuid. Nothing is created or changed yet: existing
+ * objects are only compared and the configuration of new ones is only parsed, because a new object claims its session path
+ * and DNS-SD name as soon as it is configured, which may still be held by an object on its way out. The members in
+ * identity_keys identify an object to the outside world next to its uuid (session id, NMOS ids), an existing object can't
+ * take on a different value.
+ */
+template<class T>
+tl::expected<RestorePlan<T>, std::string> plan_restore(
+    const std::vector<std::unique_ptr<T>>& current, const boost::json::value& json, const char* entries_key, const char* ids_key,
+    const char* uuid_key, const std::initializer_list<const char*> identity_keys, const bool is_patch
+) {
+    std::map<boost::uuids::uuid, const boost::json::value*> entry_by_uuid;
+    std::vector<boost::uuids::uuid> order;
+
+    for (const auto& entry : json.at(entries_key).as_array()) {
+        const auto uuid = boost::uuids::string_generator()(entry.at(uuid_key).as_string().c_str());
+        if (!entry_by_uuid.emplace(uuid, &entry).second) {
+            return tl::unexpected(fmt::format("Duplicate {}: {}", uuid_key, boost::uuids::to_string(uuid)));
+        }
+        if (!is_patch) {
+            order.push_back(uuid);
+        }
+    }
+
+    // A patch only contains the changed entries, the order and presence of all entries are given by the list of ids.
+    if (is_patch) {
+        for (const auto& id : json.at(ids_key).as_array()) {
+            order.push_back(boost::uuids::string_generator()(id.as_string().c_str()));
+        }
+    }
+
+    std::map<boost::uuids::uuid, T*> existing_by_uuid;
+    for (const auto& object : current) {
+        existing_by_uuid.emplace(object->get_uuid(), object.get());
+    }
+
+    RestorePlan<T> plan;
+    std::set<boost::uuids::uuid> seen;
+    size_t num_entries_used = 0;
+
+    for (const auto& uuid : order) {
+        if (!seen.insert(uuid).second) {
+            return tl::unexpected(fmt::format("Duplicate id in {}: {}", ids_key, boost::uuids::to_string(uuid)));
+        }
+
+        const auto entry = entry_by_uuid.find(uuid);
+        const auto* entry_json = entry != entry_by_uuid.end() ? entry->second : nullptr;
+        if (entry_json != nullptr) {
+            num_entries_used++;
+        }
+
+        if (const auto existing = existing_by_uuid.find(uuid); existing != existing_by_uuid.end()) {
+            const boost::json::value existing_json = existing->second->to_boost_json();
+            if (entry_json != nullptr && existing_json != *entry_json) {
+                for (const auto* key : identity_keys) {
+                    if (existing_json.at(key) != entry_json->at(key)) {
+                        return tl::unexpected(fmt::format("The {} of {} {} can't change", key, uuid_key, boost::uuids::to_string(uuid)));
+                    }
+                }
+                plan.changed.emplace_back(existing->second, entry_json);
+            }
+            plan.entries.emplace_back(existing->second, nullptr);
+            continue;
+        }
+
+        if (entry_json == nullptr) {
+            return tl::unexpected(fmt::format("Patch doesn't apply, unknown {}: {}", uuid_key, boost::uuids::to_string(uuid)));
+        }
+
+        if (auto config = boost::json::try_value_to<typename T::Configuration>(entry_json->at("configuration")); !config) {
+            return tl::unexpected(config.error().message());
+        }
+        plan.entries.emplace_back(nullptr, entry_json);
+    }
+
+    if (num_entries_used != entry_by_uuid.size()) {
+        return tl::unexpected(fmt::format("Patch contains {} which are not listed in {}", entries_key, ids_key));
+    }
+
+    return plan;
+}
+
+/**
+ * @return The addresses of the objects, to tell whether a list changed.
+ */
+template<class T>
+std::vector<const T*> get_pointers(const std::vector<std::unique_ptr<T>>& objects) {
+    std::vector<const T*> pointers;
+    pointers.reserve(objects.size());
+    for (const auto& object : objects) {
+        pointers.push_back(object.get());
+    }
+    return pointers;
+}
+
+/**
+ * Takes the objects which are not part of the plan out of the list.
+ * @return The removed objects.
+ */
+template<class T>
+std::vector<std::unique_ptr<T>> take_removed(std::vector<std::unique_ptr<T>>& current, const RestorePlan<T>& plan) {
+    std::vector<std::unique_ptr<T>> removed;
+    for (auto& object : current) {
+        const auto is_kept = std::any_of(plan.entries.begin(), plan.entries.end(), [&object](const auto& entry) {
+            return entry.first == object.get();
+        });
+        if (!is_kept) {
+            removed.push_back(std::move(object));
+        }
+    }
+    current.erase(std::remove(current.begin(), current.end(), nullptr), current.end());
+    return removed;
+}
+
+/**
+ * Puts the objects in the order of the plan and creates the new ones. Objects which fail to restore are left out.
+ * @param errors Receives the errors of objects which failed to restore.
+ * @return The newly added objects.
+ */
+template<class T, class Factory>
+std::vector<T*> insert_restored(std::vector<std::unique_ptr<T>>& current, const RestorePlan<T>& plan, Factory create, std::string& errors) {
+    std::vector<std::unique_ptr<T>> next;
+    std::vector<T*> added;
+    for (const auto& entry : plan.entries) {
+        if (entry.first == nullptr) {
+            auto created = create();
+            if (auto result = created->restore_from_json(*entry.second); !result) {
+                errors += fmt::format("{}{}", errors.empty() ? "" : ", ", result.error());
+                continue;
+            }
+            added.push_back(created.get());
+            next.push_back(std::move(created));
+            continue;
+        }
+        const auto it = std::find_if(current.begin(), current.end(), [&entry](const auto& object) {
+            return object.get() == entry.first;
+        });
+        RAV_ASSERT(it != current.end(), "Kept object must be present");
+        next.push_back(std::move(*it));
+    }
+    current = std::move(next);
+    return added;
+}
+
+}  // namespace
+
 rav::RavennaNode::RavennaNode() :
     rtsp_server_(io_context_, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::any(), 0)), ptp_instance_(io_context_) {
     nmos_device_.id = boost::uuids::random_generator()();
@@ -48,6 +211,7 @@ rav::RavennaNode::RavennaNode() :
     }
 
     nmos_node_.on_configuration_changed = [this](const nmos::Node::Configuration& config) {
+        bump_state_revision();
         for (const auto& s : subscribers_) {
             s->nmos_node_config_updated(config);
         }
@@ -59,10 +223,17 @@ rav::RavennaNode::RavennaNode() :
         }
     };
 
+    rtp_receiver_.rtcp_enabled = true;
+    rtp_sender_.rtcp_enabled = true;
+
     if (!ptp_instance_.subscribe(&rtp_receiver_.ptp_instance_subscriber)) {
         RAV_LOG_ERROR("Failed to subscribe to PTP instance");
     }
 
+    if (!ptp_instance_.subscribe(&rtp_sender_.ptp_instance_subscriber)) {
+        RAV_LOG_ERROR("Failed to subscribe to PTP instance");
+    }
+
     std::promise<std::thread::id> promise;
     auto f = promise.get_future();
     maintenance_thread_ = std::thread([this, p = std::move(promise)]() mutable {
@@ -92,6 +263,9 @@ rav::RavennaNode::RavennaNode() :
 
     network_thread_ = std::thread([this] {
         TRACY_SET_THREAD_NAME("ravenna_node_network");
+#if RAV_ENABLE_ASYNC_LOG
+        AsyncLogger::instance().prepare_thread();  // So that logging from the RTP receiver and sender doesn't allocate
+#endif
 #if RAV_APPLE
         pthread_setname_np("ravenna_node_network");
         constexpr auto min_packet_time = 125 * 1000;       // 125us
@@ -140,6 +314,9 @@ rav::RavennaNode::~RavennaNode() {
     if (!ptp_instance_.unsubscribe(&rtp_receiver_.ptp_instance_subscriber)) {
         RAV_LOG_ERROR("Failed to unsubscribe from PTP instance");
     }
+    if (!ptp_instance_.unsubscribe(&rtp_sender_.ptp_instance_subscriber)) {
+        RAV_LOG_ERROR("Failed to unsubscribe from PTP instance");
+    }
     io_context_.stop();
     if (maintenance_thread_.joinable()) {
         maintenance_thread_.join();
@@ -165,6 +342,7 @@ std::future<tl::expected<rav::Id, std::string>> rav::RavennaNode::create_receive
             return tl::unexpected(result.error());
         }
         const auto& it = receivers_.emplace_back(std::move(new_receiver));
+        bump_state_revision();
         RAV_ASSERT(!nmos_node_.get_devices().empty(), "NMOS node must have at least one device");
         it->set_nmos_device_id(nmos_device_.id);
         it->set_nmos_node(&nmos_node_);
@@ -184,6 +362,7 @@ std::future<void> rav::RavennaNode::remove_receiver(Id receiver_id) {
                 const std::unique_ptr<RavennaReceiver> tmp = std::move(*it);
                 RAV_ASSERT(tmp != nullptr, "Receiver expected to be valid");
                 receivers_.erase(it);
+                bump_state_revision();
                 for (const auto& s : subscribers_) {
                     s->ravenna_receiver_removed(receiver_id);
                 }
@@ -222,6 +401,7 @@ std::future<tl::expected<rav::Id, std::string>> rav::RavennaNode::create_sender(
             return tl::unexpected(result.error());
         }
         const auto& it = senders_.emplace_back(std::move(new_sender));
+        bump_state_revision();
         it->set_nmos_device_id(nmos_device_.id);
         it->set_nmos_node(&nmos_node_);
         for (const auto& s : subscribers_) {
@@ -240,6 +420,7 @@ std::future<void> rav::RavennaNode::remove_sender(Id sender_id) {
                 const std::unique_ptr<RavennaSender> tmp = std::move(*it);
                 RAV_ASSERT(tmp != nullptr, "Receiver expected to be valid");
                 senders_.erase(it);  // It is empty by now
+                bump_state_revision();
                 for (const auto& s : subscribers_) {
                     s->ravenna_sender_removed(sender_id);
                 }
@@ -271,6 +452,7 @@ std::future<tl::expected<void, std::string>> rav::RavennaNode::set_nmos_configur
         }
         nmos_device_.label = u.label;
         nmos_device_.description = u.description;
+        bump_state_revision();
         if (!nmos_node_.add_or_update_device(&nmos_device_)) {
             return tl::unexpected("Failed to update NMOS device configuration");
         }
@@ -411,6 +593,7 @@ std::future<tl::expected<void, std::string>> rav::RavennaNode::set_ptp_instance_
         if (!result) {
             return tl::unexpected(fmt::format("Failed to set PTP instance configuration: {}", result.error()));
         }
+        bump_state_revision();
         return {};
     };
     return boost::asio::dispatch(io_context_, boost::asio::use_future(work));
@@ -499,6 +682,7 @@ std::future<void> rav::RavennaNode::set_network_interface_config(NetworkInterfac
         }
 
         network_interface_config_ = config;
+        bump_state_revision();
         const auto array_of_addresses =
             network_interface_config_.get_array_of_interface_addresses<rtp::AudioSender::k_max_num_redundant_sessions>();
 
@@ -541,6 +725,7 @@ std::future<void> rav::RavennaNode::set_configuration(Configuration config) {
         }
 
         configuration_ = config;
+        bump_state_revision();
         update_ravenna_browser();
 
         // Update advertiser
@@ -569,174 +754,320 @@ bool rav::RavennaNode::is_maintenance_thread() const {
 
 std::future<boost::json::object> rav::RavennaNode::to_boost_json() {
     auto work = [this] {
-        auto senders = boost::json::array();
+        return make_boost_json(std::nullopt);
+    };
+    return boost::asio::dispatch(io_context_, boost::asio::use_future(work));
+}
+
+std::future<boost::json::object> rav::RavennaNode::to_boost_json_patch(const uint64_t since_revision) {
+    auto work = [this, since_revision] {
+        return make_boost_json(since_revision);
+    };
+    return boost::asio::dispatch(io_context_, boost::asio::use_future(work));
+}
+
+std::future<std::string> rav::RavennaNode::to_json_string() {
+    auto work = [this] {
+        std::string output;
+        JsonWriter writer(output);
+        writer.begin_object();
+
+        writer.key("config");
+        writer.begin_object();
+        writer.member("network_config", network_interface_config_.to_boost_json());
+        writer.member("node_config", configuration_);
+        writer.end_object();
+
+        writer.key("senders");
+        writer.begin_array();
         for (const auto& sender : senders_) {
-            senders.push_back(sender->to_boost_json());
+            sender->write_json(writer);
         }
-        auto receivers = boost::json::array();
+        writer.end_array();
+
+        writer.key("receivers");
+        writer.begin_array();
         for (const auto& receiver : receivers_) {
-            receivers.push_back(receiver->to_boost_json());
+            receiver->write_json(writer);
         }
-
-        boost::json::object config {
-            {
-                "network_config",
-                network_interface_config_.to_boost_json(),
-            },
-            {"node_config", boost::json::value_from(configuration_)}
-        };
-
-        return boost::json::object {
-            {"config", config},
-            {"senders", senders},
-            {"receivers", receivers},
-            {"ptp_instance_config", boost::json::value_from(ptp_instance_.get_configuration())},
-            {"nmos_node", boost::json::object {{"configuration", nmos_node_.get_configuration().to_json()}}},
-            {"nmos_device_id", boost::uuids::to_string(nmos_device_.id)},
-        };
+        writer.end_array();
+
+        writer.member("ptp_instance_config", ptp_instance_.get_configuration());
+        writer.key("nmos_node");
+        writer.begin_object();
+        writer.member("configuration", nmos_node_.get_configuration().to_json());
+        writer.end_object();
+        writer.member("nmos_device_id", nmos_device_.id);
+        writer.member("revision", get_state_revision());
+
+        writer.end_object();
+        return output;
     };
     return boost::asio::dispatch(io_context_, boost::asio::use_future(work));
 }
 
 std::future<tl::expected<void, std::string>> rav::RavennaNode::restore_from_boost_json(const boost::json::value& json) {
     auto work = [this, json]() -> tl::expected<void, std::string> {
-        try {
-            // Configuration
+        return restore_from_snapshot(json);
+    };
+    return boost::asio::dispatch(io_context_, boost::asio::use_future(work));
+}
 
-            auto config = json.at("config");
-            auto network_interface_config = NetworkInterfaceConfig::from_boost_json(config.at("network_config"));
+void rav::RavennaNode::bump_state_revision() {
+    state_revision_ = Id::get_next_process_wide_unique_id().value();
+}
 
-            if (!network_interface_config) {
-                return tl::unexpected(network_interface_config.error());
-            }
+uint64_t rav::RavennaNode::get_state_revision() const {
+    // Senders and receivers bump their own revision when they change, from the same sequence as the node
+    uint64_t revision = state_revision_;
+    for (const auto& sender : senders_) {
+        revision = std::max(revision, sender->get_revision());
+    }
+    for (const auto& receiver : receivers_) {
+        revision = std::max(revision, receiver->get_revision());
+    }
+    return revision;
+}
 
-            Configuration node_config;
-            if (auto result = config.try_at("node_config")) {
-                node_config = boost::json::value_to<Configuration>(*result);
-            }
+boost::json::object rav::RavennaNode::make_boost_json(const std::optional<uint64_t> since_revision) const {
+    const auto is_changed = [since_revision](const auto& object) {
+        return !since_revision.has_value() || object->get_revision() > *since_revision;
+    };
 
-            auto nmos_device_id = boost::uuids::string_generator()(json.at("nmos_device_id").as_string().c_str());
+    auto senders = boost::json::array();
+    for (const auto& sender : senders_) {
+        if (is_changed(sender)) {
+            senders.push_back(sender->to_boost_json());
+        }
+    }
+    auto receivers = boost::json::array();
+    for (const auto& receiver : receivers_) {
+        if (is_changed(receiver)) {
+            receivers.push_back(receiver->to_boost_json());
+        }
+    }
 
-            // Senders
+    boost::json::object config {
+        {
+            "network_config",
+            network_interface_config_.to_boost_json(),
+        },
+        {"node_config", boost::json::value_from(configuration_)}
+    };
 
-            auto senders = json.at("senders").as_array();
-            std::vector<std::unique_ptr<RavennaSender>> new_senders;
+    boost::json::object json {
+        {"config", config},
+        {"senders", senders},
+        {"receivers", receivers},
+        {"ptp_instance_config", boost::json::value_from(ptp_instance_.get_configuration())},
+        {"nmos_node", boost::json::object {{"configuration", nmos_node_.get_configuration().to_json()}}},
+        {"nmos_device_id", boost::uuids::to_string(nmos_device_.id)},
+        {"revision", get_state_revision()},
+    };
 
-            for (auto& sender : senders) {
-                auto new_sender = std::make_unique<RavennaSender>(
-                    rtp_sender_, advertiser_.get(), rtsp_server_, ptp_instance_, id_generator_.next(), 1, *network_interface_config
-                );
-                if (auto result = new_sender->restore_from_json(sender); !result) {
-                    return tl::unexpected(result.error());
-                }
-                new_sender->set_nmos_device_id(nmos_device_id);
-                new_senders.push_back(std::move(new_sender));
-            }
+    if (since_revision.has_value()) {
+        auto sender_ids = boost::json::array();
+        for (const auto& sender : senders_) {
+            sender_ids.emplace_back(boost::uuids::to_string(sender->get_uuid()));
+        }
+        auto receiver_ids = boost::json::array();
+        for (const auto& receiver : receivers_) {
+            receiver_ids.emplace_back(boost::uuids::to_string(receiver->get_uuid()));
+        }
+        json["base_revision"] = *since_revision;
+        json["sender_ids"] = std::move(sender_ids);
+        json["receiver_ids"] = std::move(receiver_ids);
+    }
 
-            // Receivers
+    return json;
+}
 
-            auto receivers = json.at("receivers").as_array();
-            std::vector<std::unique_ptr<RavennaReceiver>> new_receivers;
+tl::expected<void, std::string> rav::RavennaNode::restore_from_snapshot(const boost::json::value& json) {
+    try {
+        // Configuration
 
-            for (auto& receiver : receivers) {
-                auto new_receiver =
-                    std::make_unique<RavennaReceiver>(rtsp_client_, rtp_receiver_, id_generator_.next(), *network_interface_config);
-                if (auto result = new_receiver->restore_from_json(receiver); !result) {
-                    return tl::unexpected(result.error());
-                }
-                new_receiver->set_nmos_device_id(nmos_device_id);
-                new_receivers.push_back(std::move(new_receiver));
-            }
+        auto config = json.at("config");
+        auto network_interface_config = NetworkInterfaceConfig::from_boost_json(config.at("network_config"));
 
-            // PTP Instance
+        if (!network_interface_config) {
+            return tl::unexpected(network_interface_config.error());
+        }
 
-            ptp::Instance::Configuration ptp_config;
-            if (auto ptp_instance_config = json.try_at("ptp_instance_config")) {
-                ptp_config = boost::json::value_to<ptp::Instance::Configuration>(*ptp_instance_config);
-            }
+        Configuration node_config;
+        if (auto result = config.try_at("node_config")) {
+            node_config = boost::json::value_to<Configuration>(*result);
+        }
 
-            // NMOS Node
+        auto nmos_device_id = boost::uuids::string_generator()(json.at("nmos_device_id").as_string().c_str());
 
-            auto nmos_node = json.try_at("nmos_node");
-            if (nmos_node.has_value()) {
-                auto nmos_node_object = nmos_node->as_object();
-                auto nmos_config = nmos::Node::Configuration::from_json(nmos_node_object.at("configuration"));
-                if (nmos_config.has_error()) {
-                    return tl::unexpected(nmos_config.error());
-                }
+        // PTP Instance
 
-                nmos_node_.stop();
-                if (!nmos_node_.remove_device(&nmos_device_)) {
-                    RAV_LOG_ERROR("Failed to remove NMOS device with ID: {}", boost::uuids::to_string(nmos_device_.id));
-                }
-                auto result = nmos_node_.set_configuration(*nmos_config);
-                if (!result) {
-                    return tl::unexpected(fmt::format("Failed to set NMOS node configuration: {}", result.error()));
-                }
-                nmos_device_.id = nmos_device_id;
-                nmos_device_.label = nmos_config->label;
-                nmos_device_.description = nmos_config->description;
-                if (!nmos_node_.add_or_update_device(&nmos_device_)) {
-                    RAV_LOG_ERROR("Failed to add NMOS device to node");
-                }
-            } else {
-                return tl::unexpected("No NMOS node state found in JSON");
+        ptp::Instance::Configuration ptp_config;
+        if (auto ptp_instance_config = json.try_at("ptp_instance_config")) {
+            ptp_config = boost::json::value_to<ptp::Instance::Configuration>(*ptp_instance_config);
+        }
+
+        // NMOS Node
+
+        auto nmos_node = json.try_at("nmos_node");
+        if (!nmos_node.has_value()) {
+            return tl::unexpected("No NMOS node state found in JSON");
+        }
+        auto nmos_config = nmos::Node::Configuration::from_json(nmos_node->as_object().at("configuration"));
+        if (nmos_config.has_error()) {
+            return tl::unexpected(nmos_config.error());
+        }
+
+        // A patch only applies on top of the state it was made against.
+
+        const bool is_patch = json.as_object().contains("sender_ids");
+        std::optional<uint64_t> revision;
+        if (auto value = json.try_at("revision")) {
+            revision = value->to_number<uint64_t>();
+        }
+
+        if (is_patch) {
+            const auto base_revision = json.at("base_revision").to_number<uint64_t>();
+            if (!restored_revision_.has_value() || *restored_revision_ != base_revision) {
+                return tl::unexpected(fmt::format("Patch doesn't apply, it is based on revision {}", base_revision));
             }
+        }
 
-            set_network_interface_config(*network_interface_config).wait();
+        // Senders and receivers. Nothing is changed until the snapshot has been matched against the current state.
 
-            // Swap senders
+        const auto sender_identity_keys = {"session_id", "nmos_source_uuid", "nmos_flow_uuid"};
+        auto sender_plan = plan_restore(senders_, json, "senders", "sender_ids", "nmos_sender_uuid", sender_identity_keys, is_patch);
+        if (!sender_plan) {
+            return tl::unexpected(sender_plan.error());
+        }
 
-            for (const auto& sender : senders_) {
-                sender->set_nmos_node(nullptr);
-                for (auto* s : subscribers_) {
-                    RAV_ASSERT(s != nullptr, "Subscriber must be valid");
-                    s->ravenna_sender_removed(sender->get_id());
-                }
+        auto receiver_plan = plan_restore(receivers_, json, "receivers", "receiver_ids", "nmos_receiver_uuid", {}, is_patch);
+        if (!receiver_plan) {
+            return tl::unexpected(receiver_plan.error());
+        }
+
+        // From here on the state is changed, it no longer matches the revision it was restored from until done.
+        restored_revision_.reset();
+
+        // Remove senders and receivers which are gone, while their NMOS device is still registered.
+
+        const auto senders_before = get_pointers(senders_);
+        const auto receivers_before = get_pointers(receivers_);
+
+        for (const auto& sender : take_removed(senders_, *sender_plan)) {
+            for (auto* s : subscribers_) {
+                RAV_ASSERT(s != nullptr, "Subscriber must be valid");
+                s->ravenna_sender_removed(sender->get_id());
+            }
+        }
+
+        for (const auto& receiver : take_removed(receivers_, *receiver_plan)) {
+            for (auto* s : subscribers_) {
+                RAV_ASSERT(s != nullptr, "Subscriber must be valid");
+                s->ravenna_receiver_removed(receiver->get_id());
             }
+        }
 
-            std::swap(senders_, new_senders);
+        // Only restart the NMOS node when its configuration or device changed.
 
+        if (*nmos_config != nmos_node_.get_configuration() || nmos_device_id != nmos_device_.id) {
+            nmos_node_.stop();
+            if (!nmos_node_.remove_device(&nmos_device_)) {
+                RAV_LOG_ERROR("Failed to remove NMOS device with ID: {}", boost::uuids::to_string(nmos_device_.id));
+            }
+            auto result = nmos_node_.set_configuration(*nmos_config);
+            if (!result) {
+                return tl::unexpected(fmt::format("Failed to set NMOS node configuration: {}", result.error()));
+            }
+            nmos_device_.id = nmos_device_id;
+            nmos_device_.label = nmos_config->label;
+            nmos_device_.description = nmos_config->description;
+            bump_state_revision();
+            if (!nmos_node_.add_or_update_device(&nmos_device_)) {
+                RAV_LOG_ERROR("Failed to add NMOS device to node");
+            }
+
+            // Removing the device also removed the resources of the remaining senders and receivers, register them again.
             for (const auto& sender : senders_) {
+                sender->set_nmos_device_id(nmos_device_id);
+                sender->set_nmos_node(nullptr);
                 sender->set_nmos_node(&nmos_node_);
-                for (auto* s : subscribers_) {
-                    RAV_ASSERT(s != nullptr, "Subscriber must be valid");
-                    s->ravenna_sender_added(*sender);
-                }
             }
-
-            // Swap receivers
-
             for (const auto& receiver : receivers_) {
+                receiver->set_nmos_device_id(nmos_device_id);
                 receiver->set_nmos_node(nullptr);
-                for (auto* s : subscribers_) {
-                    RAV_ASSERT(s != nullptr, "Subscriber must be valid");
-                    s->ravenna_receiver_removed(receiver->get_id());
-                }
+                receiver->set_nmos_node(&nmos_node_);
             }
+        }
 
-            std::swap(receivers_, new_receivers);
+        set_network_interface_config(*network_interface_config).wait();
 
-            for (const auto& receiver : receivers_) {
-                receiver->set_nmos_node(&nmos_node_);
-                for (auto* s : subscribers_) {
-                    RAV_ASSERT(s != nullptr, "Subscriber must be valid");
-                    s->ravenna_receiver_added(*receiver);
-                }
+        // Update changed senders and receivers in place, so that they only restart streaming if their data path changed.
+
+        std::string errors;
+        for (auto& [sender, sender_json] : sender_plan->changed) {
+            if (auto result = sender->restore_from_json(*sender_json); !result) {
+                errors += fmt::format("{}{}", errors.empty() ? "" : ", ", result.error());
+            }
+        }
+
+        for (auto& [receiver, receiver_json] : receiver_plan->changed) {
+            if (auto result = receiver->restore_from_json(*receiver_json); !result) {
+                errors += fmt::format("{}{}", errors.empty() ? "" : ", ", result.error());
             }
+        }
 
-            set_configuration(node_config).wait();
+        // Add new senders and receivers, in the order of the snapshot. The ones they replace are gone by now.
+
+        const auto create_sender = [&] {
+            return std::make_unique<RavennaSender>(
+                rtp_sender_, advertiser_.get(), rtsp_server_, ptp_instance_, id_generator_.next(), 1, *network_interface_config
+            );
+        };
+        for (auto* sender : insert_restored(senders_, *sender_plan, create_sender, errors)) {
+            sender->set_nmos_device_id(nmos_device_id);
+            sender->set_nmos_node(&nmos_node_);
+            for (auto* s : subscribers_) {
+                RAV_ASSERT(s != nullptr, "Subscriber must be valid");
+                s->ravenna_sender_added(*sender);
+            }
+        }
+
+        const auto create_receiver = [&] {
+            return std::make_unique<RavennaReceiver>(rtsp_client_, rtp_receiver_, id_generator_.next(), *network_interface_config);
+        };
+        for (auto* receiver : insert_restored(receivers_, *receiver_plan, create_receiver, errors)) {
+            receiver->set_nmos_device_id(nmos_device_id);
+            receiver->set_nmos_node(&nmos_node_);
+            for (auto* s : subscribers_) {
+                RAV_ASSERT(s != nullptr, "Subscriber must be valid");
+                s->ravenna_receiver_added(*receiver);
+            }
+        }
 
+        if (get_pointers(senders_) != senders_before || get_pointers(receivers_) != receivers_before) {
+            bump_state_revision();  // Senders or receivers were added, removed or reordered
+        }
+
+        set_configuration(node_config).wait();
+
+        if (ptp_config != ptp_instance_.get_configuration()) {
             if (auto result = ptp_instance_.set_configuration(ptp_config); !result) {
                 RAV_LOG_ERROR("Failed to set PTP configuration: {}", result.error());
             }
-        } catch (const std::exception& e) {
-            return tl::unexpected(fmt::format("Failed to parse RavennaNode JSON: {}", e.what()));
+            bump_state_revision();
         }
 
-        return {};
-    };
-    return boost::asio::dispatch(io_context_, boost::asio::use_future(work));
+        if (!errors.empty()) {
+            return tl::unexpected(fmt::format("Failed to restore senders or receivers: {}", errors));
+        }
+
+        restored_revision_ = revision;
+    } catch (const std::exception& e) {
+        return tl::unexpected(fmt::format("Failed to parse RavennaNode JSON: {}", e.what()));
+    }
+
+    return {};
 }
 
 uint32_t rav::RavennaNode::generate_unique_session_id() const {
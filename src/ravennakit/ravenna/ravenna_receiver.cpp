@@ -139,6 +139,15 @@ tl::expected<rav::rtp::AudioReceiver::StreamInfo, std::string> create_stream_fro
     stream_info.session = session;
     stream_info.filter = filter;
     stream_info.packet_time_frames = packet_time_frames;
+
+    // Media level attributes take precedence over session level ones
+    const auto& reference_clock = media_description.reference_clock ? media_description.reference_clock : sdp.reference_clock;
+    const auto& media_clock = media_description.media_clock ? media_description.media_clock : sdp.media_clock;
+    if (reference_clock && reference_clock->source_ == rav::sdp::ReferenceClock::ClockSource::ptp && media_clock
+        && media_clock->mode == rav::sdp::MediaClockSource::ClockMode::direct) {
+        stream_info.ptp_media_clock_offset = static_cast<uint32_t>(media_clock->offset.value_or(0));
+    }
+
     return stream_info;
 }
 
@@ -151,6 +160,15 @@ const rav::sdp::MediaDescription* find_media_description_by_mid(const rav::sdp::
     return nullptr;
 }
 
+tl::expected<void, std::string> validate_configuration(const rav::RavennaReceiver::Configuration& config) {
+    if (config.auto_update_sdp) {
+        if (config.session_name.empty()) {
+            return tl::unexpected("Session name must not be empty when auto_update_sdp is true");
+        }
+    }
+    return {};
+}
+
 }  // namespace
 
 boost::json::object rav::RavennaReceiver::to_boost_json() const {
@@ -161,6 +179,14 @@ boost::json::object rav::RavennaReceiver::to_boost_json() const {
     };
 }
 
+void rav::RavennaReceiver::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.member("configuration", configuration_);
+    writer.member("nmos_receiver_uuid", nmos_receiver_.id);
+    writer.member("nmos_receiver_subscription", nmos_receiver_.subscription);
+    writer.end_object();
+}
+
 tl::expected<void, std::string> rav::RavennaReceiver::restore_from_json(const boost::json::value& json) {
     try {
         auto config = boost::json::try_value_to<Configuration>(json.at("configuration"));
@@ -181,6 +207,11 @@ tl::expected<void, std::string> rav::RavennaReceiver::restore_from_json(const bo
 
         nmos_receiver_.id = nmos_receiver_uuid;
         nmos_receiver_.subscription = nmos_receiver_subscription;
+        mark_changed();
+
+        if (auto nmos_result = update_nmos(); !nmos_result) {
+            return nmos_result;
+        }
 
         return {};
     } catch (const std::exception& e) {
@@ -209,7 +240,7 @@ void rav::RavennaReceiver::do_maintenance() {
     if (stats_throttle_.update()) {
         for (size_t i = 0; i < streams_states_.size(); ++i) {
             if (streams_states_[i] != rtp::AudioReceiver::StreamState::inactive) {
-                if (auto stats = rtp_audio_receiver_.get_packet_stats(id_, i)) {
+                if (auto stats = rtp_audio_receiver_.get_packet_stats_if_updated(id_, i, streams_stats_updates_[i])) {
                     for (auto* subscriber : subscribers_) {
                         subscriber->ravenna_receiver_stream_stats_updated(id_, i, *stats);
                     }
@@ -236,6 +267,13 @@ rav::RavennaReceiver::RavennaReceiver(
         return handle_patch_request(patch_request);
     };
 
+    nmos_receiver_.on_validate_patch_request = [this](const boost::json::value& patch_request) -> tl::expected<void, nmos::ApiError> {
+        if (auto configuration = make_patched_configuration(patch_request); !configuration) {
+            return tl::unexpected(configuration.error());
+        }
+        return {};
+    };
+
     nmos_receiver_.get_transport_file = [this]() -> tl::expected<sdp::SessionDescription, nmos::ApiError> {
         return configuration_.sdp;
     };
@@ -274,6 +312,10 @@ void rav::RavennaReceiver::handle_announced_sdp(const sdp::SessionDescription& s
     }
 }
 
+void rav::RavennaReceiver::mark_changed() {
+    revision_ = Id::get_next_process_wide_unique_id().value();
+}
+
 tl::expected<void, std::string> rav::RavennaReceiver::update_nmos() {
     nmos_receiver_.label = configuration_.session_name;
     nmos_receiver_.subscription.active = configuration_.enabled;
@@ -306,14 +348,14 @@ tl::expected<void, std::string> rav::RavennaReceiver::update_rtsp() {
     return {};
 }
 
-tl::expected<void, rav::nmos::ApiError> rav::RavennaReceiver::handle_patch_request(const boost::json::value& patch_request) {
-    if (const auto result = patch_request.try_at("sender_id")) {
-        nmos_receiver_.subscription.sender_id = uuid_from_json(*result);
-    }
-
+tl::expected<rav::RavennaReceiver::Configuration, rav::nmos::ApiError>
+rav::RavennaReceiver::make_patched_configuration(const boost::json::value& patch_request) const {
     auto configuration = configuration_;
     if (const auto result = patch_request.try_at("master_enable")) {
-        configuration.enabled = boost::json::value_to<bool>(*result);
+        if (!result->is_bool()) {
+            return tl::unexpected(nmos::ApiError {http::status::bad_request, "Expected master_enable to be a boolean"});
+        }
+        configuration.enabled = result->get_bool();
     }
 
     if (const auto result = patch_request.try_at("transport_file")) {
@@ -328,10 +370,28 @@ tl::expected<void, rav::nmos::ApiError> rav::RavennaReceiver::handle_patch_reque
         if (!sdp) {
             return tl::unexpected(nmos::ApiError {http::status::bad_request, fmt::format("Failed to parse SDP: {}", sdp.error())});
         }
-        configuration.sdp = *sdp;
+        configuration.sdp = std::move(*sdp);
+    }
+
+    if (auto result = validate_configuration(configuration); !result) {
+        return tl::unexpected(nmos::ApiError {http::status::bad_request, result.error()});
+    }
+
+    return configuration;
+}
+
+tl::expected<void, rav::nmos::ApiError> rav::RavennaReceiver::handle_patch_request(const boost::json::value& patch_request) {
+    auto configuration = make_patched_configuration(patch_request);
+    if (!configuration) {
+        return tl::unexpected(configuration.error());
+    }
+
+    if (const auto result = patch_request.try_at("sender_id")) {
+        nmos_receiver_.subscription.sender_id = uuid_from_json(*result);
+        mark_changed();
     }
 
-    if (auto t = set_configuration(configuration); !t) {
+    if (auto t = set_configuration(std::move(*configuration)); !t) {
         return tl::unexpected(nmos::ApiError {http::status::internal_server_error, t.error()});
     }
 
@@ -346,13 +406,13 @@ const boost::uuids::uuid& rav::RavennaReceiver::get_uuid() const {
     return nmos_receiver_.id;
 }
 
-tl::expected<void, std::string> rav::RavennaReceiver::set_configuration(Configuration config) {
-    // Validate the configuration
+uint64_t rav::RavennaReceiver::get_revision() const {
+    return revision_;
+}
 
-    if (config.auto_update_sdp) {
-        if (config.session_name.empty()) {
-            return tl::unexpected("Session name must not be empty when auto_update_sdp is true");
-        }
+tl::expected<void, std::string> rav::RavennaReceiver::set_configuration(Configuration config) {
+    if (auto result = validate_configuration(config); !result) {
+        return result;
     }
 
     // Determine changes to apply
@@ -379,6 +439,7 @@ tl::expected<void, std::string> rav::RavennaReceiver::set_configuration(Configur
     // Apply the configuration changes
 
     configuration_ = std::move(config);
+    mark_changed();
 
     auto parameters = create_rtp_receiver_parameters(configuration_.sdp);
     auto new_parameters = parameters.has_value() ? *parameters : rtp::AudioReceiver::ReaderParameters {};
@@ -393,16 +454,17 @@ tl::expected<void, std::string> rav::RavennaReceiver::set_configuration(Configur
     }
 
     if (do_stop_start) {
-        std::ignore = rtp_audio_receiver_.remove_reader(id_);
-
         if (reader_parameters_.is_valid() && configuration_.enabled) {
-            const auto ok = rtp_audio_receiver_.add_reader(
+            // Reconfigures a running reader make-before-break, or adds one if it's not running yet.
+            const auto ok = rtp_audio_receiver_.update_reader(
                 id_, reader_parameters_,
                 network_interface_config_.get_array_of_interface_addresses<rtp::AudioReceiver::k_max_num_redundant_sessions>()
             );
             if (!ok) {
-                RAV_LOG_ERROR("Failed to add RTP reader");
+                RAV_LOG_ERROR("Failed to update RTP reader");
             }
+        } else {
+            std::ignore = rtp_audio_receiver_.remove_reader(id_);
         }
     }
 
@@ -585,6 +647,16 @@ void rav::tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv,
     };
 }
 
+void rav::tag_invoke(const JsonWriteTag&, JsonWriter& writer, const RavennaReceiver::Configuration& config) {
+    writer.begin_object();
+    writer.member("session_name", config.session_name);
+    writer.member("delay_frames", config.delay_frames);
+    writer.member("enabled", config.enabled);
+    writer.member("auto_update_sdp", config.auto_update_sdp);
+    writer.member("sdp", sdp::to_string(config.sdp));
+    writer.end_object();
+}
+
 rav::RavennaReceiver::Configuration
 rav::tag_invoke(const boost::json::value_to_tag<RavennaReceiver::Configuration>&, const boost::json::value& jv) {
     RavennaReceiver::Configuration config;
@@ -24,6 +24,8 @@
 
 #include "ravennakit/ravenna/ravenna_rtsp_client.hpp"
 
+#include "ravennakit/sdp/sdp_diff.hpp"
+
 rav::RavennaRtspClient::RavennaRtspClient(boost::asio::io_context& io_context, RavennaBrowser& browser) :
     io_context_(io_context), browser_(browser) {
     if (!browser_.subscribe(this)) {
@@ -225,6 +227,15 @@ void rav::RavennaRtspClient::do_maintenance() {
 }
 
 void rav::RavennaRtspClient::handle_incoming_sdp(const std::string& sdp_text) {
+    // Servers re-send the same SDP on every DESCRIBE and ANNOUNCE. Sessions are unique by name and the session name is
+    // part of the compared text, so an equivalent stored SDP means there is nothing to parse or announce.
+    for (const auto& session : sessions_) {
+        if (session.sdp_text_.has_value() && sdp::diff(*session.sdp_text_, sdp_text) == sdp::Difference::none) {
+            RAV_LOG_TRACE("SDP for session '{}' didn't change", session.session_name);
+            return;
+        }
+    }
+
     auto sdp = sdp::parse_session_description(sdp_text);
     if (!sdp) {
         RAV_LOG_ERROR("Failed to parse SDP: {}", sdp.error());
@@ -39,6 +39,59 @@
     #pragma comment(lib, "winmm.lib")
 #endif
 
+namespace {
+
+tl::expected<void, std::string> validate_configuration(const rav::RavennaSender::Configuration& config) {
+    if (config.session_name.empty()) {
+        return tl::unexpected("Session name cannot be empty");
+    }
+
+    if (config.destinations.empty()) {
+        return tl::unexpected("no destinations set");
+    }
+
+    if (config.enabled) {
+        int num_enabled_destinations = 0;
+        for (const auto& dst : config.destinations) {
+            if (!dst.enabled) {
+                continue;
+            }
+            if (!dst.endpoint.address().is_unspecified() && !dst.endpoint.address().is_multicast()) {
+                return tl::unexpected(fmt::format("{} address must be multicast", rav::rank::to_ordinal_latin(dst.interface_by_rank)));
+            }
+            num_enabled_destinations++;
+            if (dst.endpoint.address().is_unspecified()) {
+                return tl::unexpected(fmt::format("{} destination address is unspecified", rav::rank::to_ordinal_latin(dst.interface_by_rank)));
+            }
+            if (dst.endpoint.port() == 0) {
+                return tl::unexpected(fmt::format("{} destination port is 0", rav::rank::to_ordinal_latin(dst.interface_by_rank)));
+            }
+        }
+
+        if (num_enabled_destinations == 0) {
+            return tl::unexpected("no enabled destinations");
+        }
+
+        const auto& audio_format = config.audio_format;
+        if (!audio_format.is_valid()) {
+            return tl::unexpected("Invalid audio format");
+        }
+        if (audio_format.ordering != rav::AudioFormat::ChannelOrdering::interleaved) {
+            return tl::unexpected("Only interleaved audio formats are supported");
+        }
+        if (audio_format.byte_order != rav::AudioFormat::ByteOrder::be) {
+            return tl::unexpected("Only big endian audio formats are supported");
+        }
+        if (!config.packet_time.is_valid()) {
+            return tl::unexpected("Invalid packet time");
+        }
+    }
+
+    return {};
+}
+
+}  // namespace
+
 rav::RavennaSender::RavennaSender(
     rtp::AudioSender& rtp_audio_sender, dnssd::Advertiser* advertiser, rtsp::Server& rtsp_server, ptp::Instance& ptp_instance, const Id id,
     const uint32_t session_id, NetworkInterfaceConfig network_interface_config
@@ -71,6 +124,13 @@ rav::RavennaSender::RavennaSender(
         return handle_patch_request(patch_request);
     };
 
+    nmos_sender_.on_validate_patch_request = [this](const boost::json::value& patch_request) -> tl::expected<void, nmos::ApiError> {
+        if (auto configuration = make_patched_configuration(patch_request); !configuration) {
+            return tl::unexpected(configuration.error());
+        }
+        return {};
+    };
+
     nmos_sender_.get_transport_file = [this]() -> tl::expected<sdp::SessionDescription, nmos::ApiError> {
         auto sdp = generate_sdp();
         if (!sdp) {
@@ -128,52 +188,13 @@ uint32_t rav::RavennaSender::get_session_id() const {
     return session_id_;
 }
 
-tl::expected<void, std::string> rav::RavennaSender::set_configuration(Configuration config) {
-    // Validate the configuration
-
-    if (config.session_name.empty()) {
-        return tl::unexpected("Session name cannot be empty");
-    }
-
-    if (config.destinations.empty()) {
-        return tl::unexpected("no destinations set");
-    }
-
-    if (config.enabled) {
-        int num_enabled_destinations = 0;
-        for (const auto& dst : config.destinations) {
-            if (!dst.enabled) {
-                continue;
-            }
-            if (!dst.endpoint.address().is_unspecified() && !dst.endpoint.address().is_multicast()) {
-                return tl::unexpected(fmt::format("{} address must be multicast", rank::to_ordinal_latin(dst.interface_by_rank)));
-            }
-            num_enabled_destinations++;
-            if (dst.endpoint.address().is_unspecified()) {
-                return tl::unexpected(fmt::format("{} destination address is unspecified", rank::to_ordinal_latin(dst.interface_by_rank)));
-            }
-            if (dst.endpoint.port() == 0) {
-                return tl::unexpected(fmt::format("{} destination port is 0", rank::to_ordinal_latin(dst.interface_by_rank)));
-            }
-        }
-
-        if (num_enabled_destinations == 0) {
-            return tl::unexpected("no enabled destinations");
-        }
+uint64_t rav::RavennaSender::get_revision() const {
+    return revision_;
+}
 
-        const auto& audio_format = config.audio_format;
-        if (!audio_format.is_valid()) {
-            return tl::unexpected("Invalid audio format");
-        }
-        if (audio_format.ordering != AudioFormat::ChannelOrdering::interleaved) {
-            return tl::unexpected("Only interleaved audio formats are supported");
-        }
-        if (audio_format.byte_order != AudioFormat::ByteOrder::be) {
-            return tl::unexpected("Only big endian audio formats are supported");
-        }
-        if (!config.packet_time.is_valid()) {
-            return tl::unexpected("Invalid packet time");
-        }
+tl::expected<void, std::string> rav::RavennaSender::set_configuration(Configuration config) {
+    if (auto result = validate_configuration(config); !result) {
+        return result;
     }
 
     // Determine changes
@@ -231,6 +252,7 @@ tl::expected<void, std::string> rav::RavennaSender::set_configuration(Configurat
     // Implement the changes
 
     configuration_ = std::move(config);
+    mark_changed();
 
     generate_auto_addresses_if_needed(configuration_.destinations);
 
@@ -362,6 +384,16 @@ boost::json::object rav::RavennaSender::to_boost_json() const {
     };
 }
 
+void rav::RavennaSender::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.member("session_id", session_id_);
+    writer.member("configuration", configuration_);
+    writer.member("nmos_sender_uuid", nmos_sender_.id);
+    writer.member("nmos_source_uuid", nmos_source_.id);
+    writer.member("nmos_flow_uuid", nmos_flow_.id);
+    writer.end_object();
+}
+
 tl::expected<void, std::string> rav::RavennaSender::restore_from_json(const boost::json::value& json) {
     try {
         auto config = boost::json::try_value_to<Configuration>(json.at("configuration"));
@@ -392,6 +424,8 @@ tl::expected<void, std::string> rav::RavennaSender::restore_from_json(const boos
 
         nmos_sender_.id = nmos_sender_uuid;
         nmos_sender_.flow_id = nmos_flow_.id;
+
+        mark_changed();
     } catch (const std::exception& e) {
         return tl::unexpected(fmt::format("Failed to restore RavennaSender from JSON: {}", e.what()));
     }
@@ -648,8 +682,16 @@ tl::expected<rav::sdp::SessionDescription, std::string> rav::RavennaSender::gene
     return sdp;
 }
 
+void rav::RavennaSender::mark_changed() {
+    revision_ = Id::get_next_process_wide_unique_id().value();
+}
+
 void rav::RavennaSender::generate_auto_addresses_if_needed(const bool notify_subscribers) {
-    if (generate_auto_addresses_if_needed(configuration_.destinations) && notify_subscribers) {
+    if (!generate_auto_addresses_if_needed(configuration_.destinations)) {
+        return;
+    }
+    mark_changed();
+    if (notify_subscribers) {
         for (auto* subscriber : subscribers_) {
             subscriber->ravenna_sender_configuration_updated(id_, configuration_);
         }
@@ -708,14 +750,14 @@ void rav::RavennaSender::restart_streaming() const {
     }
 }
 
-tl::expected<void, rav::nmos::ApiError> rav::RavennaSender::handle_patch_request(const boost::json::value& patch_request) {
-    if (const auto result = patch_request.try_at("receiver_id")) {
-        nmos_sender_.subscription.receiver_id = uuid_from_json(*result);
-    }
-
+tl::expected<rav::RavennaSender::Configuration, rav::nmos::ApiError>
+rav::RavennaSender::make_patched_configuration(const boost::json::value& patch_request) const {
     auto configuration = configuration_;
     if (const auto result = patch_request.try_at("master_enable")) {
-        configuration.enabled = boost::json::value_to<bool>(*result);
+        if (!result->is_bool()) {
+            return tl::unexpected(nmos::ApiError {http::status::bad_request, "Expected master_enable to be a boolean"});
+        }
+        configuration.enabled = result->get_bool();
     }
 
     if (const auto result = patch_request.try_at("transport_params")) {
@@ -753,7 +795,24 @@ tl::expected<void, rav::nmos::ApiError> rav::RavennaSender::handle_patch_request
         }
     }
 
-    if (auto t = set_configuration(configuration); !t) {
+    if (auto result = validate_configuration(configuration); !result) {
+        return tl::unexpected(nmos::ApiError {http::status::bad_request, result.error()});
+    }
+
+    return configuration;
+}
+
+tl::expected<void, rav::nmos::ApiError> rav::RavennaSender::handle_patch_request(const boost::json::value& patch_request) {
+    auto configuration = make_patched_configuration(patch_request);
+    if (!configuration) {
+        return tl::unexpected(configuration.error());
+    }
+
+    if (const auto result = patch_request.try_at("receiver_id")) {
+        nmos_sender_.subscription.receiver_id = uuid_from_json(*result);
+    }
+
+    if (auto t = set_configuration(std::move(*configuration)); !t) {
         return tl::unexpected(nmos::ApiError {http::status::internal_server_error, t.error()});
     }
 
@@ -778,6 +837,15 @@ void rav::tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv,
     };
 }
 
+void rav::tag_invoke(const JsonWriteTag&, JsonWriter& writer, const RavennaSender::Destination& destination) {
+    writer.begin_object();
+    writer.member("interface_by_rank", destination.interface_by_rank);
+    writer.member("address", destination.endpoint.address().to_string());
+    writer.member("port", destination.endpoint.port());
+    writer.member("enabled", destination.enabled);
+    writer.end_object();
+}
+
 void rav::tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv, const RavennaSender::Configuration& config) {
     jv = {
         {"session_name", config.session_name},
@@ -790,6 +858,18 @@ void rav::tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv,
     };
 }
 
+void rav::tag_invoke(const JsonWriteTag&, JsonWriter& writer, const RavennaSender::Configuration& config) {
+    writer.begin_object();
+    writer.member("session_name", config.session_name);
+    writer.member("destinations", config.destinations);
+    writer.member("ttl", config.ttl);
+    writer.member("payload_type", config.payload_type);
+    writer.member("packet_time", config.packet_time);
+    writer.member("audio_format", config.audio_format);
+    writer.member("enabled", config.enabled);
+    writer.end_object();
+}
+
 rav::RavennaSender::Destination
 rav::tag_invoke(const boost::json::value_to_tag<RavennaSender::Destination>&, const boost::json::value& jv) {
     RavennaSender::Destination dst;
@@ -28,6 +28,7 @@
 #include "ravennakit/core/log.hpp"
 #include "ravennakit/core/audio/audio_data.hpp"
 #include "ravennakit/core/net/sockets/extended_udp_socket.hpp"
+#include "ravennakit/rtp/rtcp_packet.hpp"
 #include "ravennakit/rtp/rtcp_packet_view.hpp"
 #include "ravennakit/core/util/subscriber_list.hpp"
 #include "ravennakit/rtp/rtp_packet_view.hpp"
@@ -35,6 +36,9 @@
 #include "ravennakit/core/util/defer.hpp"
 
 #include <fmt/core.h>
+#include <algorithm>
+#include <random>
+#include <thread>
 #include <utility>
 
 namespace {
@@ -58,9 +62,9 @@ namespace {
     return true;
 }
 
-[[nodiscard]] boost::asio::ip::udp::socket* find_socket(rav::rtp::AudioReceiver& receiver, const uint16_t port) {
+[[nodiscard]] boost::asio::ip::udp::socket* find_socket(rav::rtp::AudioReceiver::SocketList& sockets, const uint16_t port) {
     // Try to find existing socket
-    for (auto& ctx : receiver.sockets) {
+    for (auto& ctx : sockets) {
         if (ctx.port == port) {
             return &ctx.socket;
         }
@@ -68,16 +72,16 @@ namespace {
     return nullptr;
 }
 
-[[nodiscard]] boost::asio::ip::udp::socket* find_or_create_socket(rav::rtp::AudioReceiver& receiver, const uint16_t port) {
+[[nodiscard]] boost::asio::ip::udp::socket* find_or_create_socket(rav::rtp::AudioReceiver::SocketList& sockets, const uint16_t port) {
     RAV_ASSERT(port > 0, "Port should be non zero");
 
     // Try to find existing socket
-    if (auto* found = find_socket(receiver, port)) {
+    if (auto* found = find_socket(sockets, port)) {
         return found;
     }
 
     // Try to reuse existing socket slot
-    for (auto& ctx : receiver.sockets) {
+    for (auto& ctx : sockets) {
         const auto socket_guard = ctx.rw_lock.lock_exclusive();
         if (!socket_guard) {
             return nullptr;
@@ -125,9 +129,68 @@ namespace {
     return total;
 }
 
+[[nodiscard]] uint32_t count_rtcp_multicast_groups(
+    rav::rtp::AudioReceiver& receiver, const boost::asio::ip::address_v4& multicast_group,
+    const boost::asio::ip::address_v4& interface_address, const uint16_t rtcp_port
+) {
+    uint32_t total = 0;
+    for (auto& reader : receiver.readers) {
+        for (auto& stream : reader.streams) {
+            if (stream.interface != interface_address) {
+                continue;
+            }
+            if (stream.session.connection_address != multicast_group) {
+                continue;
+            }
+            if (stream.session.rtcp_port != rtcp_port) {
+                continue;
+            }
+            total++;
+        }
+    }
+    return total;
+}
+
+/// Joins the multicast group of the RTCP port of given stream, if the stream is the first one using it.
+void join_rtcp_multicast_group_if_first(rav::rtp::AudioReceiver& receiver, const rav::rtp::AudioReceiver::StreamContext& stream) {
+    if (!stream.session.connection_address.is_multicast() || stream.interface.is_unspecified()) {
+        return;
+    }
+    const auto group = stream.session.connection_address.to_v4();
+    if (count_rtcp_multicast_groups(receiver, group, stream.interface, stream.session.rtcp_port) != 1) {
+        return;  // 1 because the given stream is also counted
+    }
+    auto* socket = find_socket(receiver.rtcp_sockets, stream.session.rtcp_port);
+    if (socket == nullptr) {
+        return;
+    }
+    if (!receiver.join_multicast_group(*socket, group, stream.interface)) {
+        RAV_LOG_ERROR("Failed to join RTCP multicast group");
+    }
+}
+
+/// Leaves the multicast group of the RTCP port of given stream, if the stream is the last one using it.
+void leave_rtcp_multicast_group_if_last(rav::rtp::AudioReceiver& receiver, const rav::rtp::AudioReceiver::StreamContext& stream) {
+    if (!stream.session.connection_address.is_multicast() || stream.interface.is_unspecified()) {
+        return;
+    }
+    const auto group = stream.session.connection_address.to_v4();
+    if (count_rtcp_multicast_groups(receiver, group, stream.interface, stream.session.rtcp_port) != 1) {
+        return;
+    }
+    auto* socket = find_socket(receiver.rtcp_sockets, stream.session.rtcp_port);
+    if (socket == nullptr || !socket->is_open()) {
+        return;
+    }
+    if (!receiver.leave_multicast_group(*socket, group, stream.interface)) {
+        RAV_LOG_ERROR("Failed to leave RTCP multicast group {}:{}", group.to_string(), stream.session.rtcp_port);
+    }
+}
+
 void reset_stream_context(rav::rtp::AudioReceiver::StreamContext& stream) {
     stream.session = {};
     stream.filter = {};
+    stream.compiled_filter = {};
     stream.interface = {};
     stream.rtp_ts = {};
     stream.packets.reset();
@@ -135,7 +198,14 @@ void reset_stream_context(rav::rtp::AudioReceiver::StreamContext& stream) {
     stream.packet_stats.reset();
     stream.packet_stats_counters.write({});
     stream.packet_interval_stats = {};
+    stream.packet_interval_histogram.reset();
     stream.prev_packet_time_ns = {};
+    stream.rtcp_stats.reset();
+    stream.remote_ssrc = {};
+    stream.remote_address = rav::ip_address {};
+    stream.rtcp_remote_endpoint = {};
+    stream.one_way_latency_ms = {};
+    stream.last_rtcp_report_time_ns = {};
 }
 
 void reset_reader(rav::rtp::AudioReceiver::Reader& reader) {
@@ -148,6 +218,7 @@ void reset_reader(rav::rtp::AudioReceiver::Reader& reader) {
     reader.read_audio_data_buffer = {};
     reader.most_recent_ts = {};
     reader.next_ts_to_read = {};
+    reader.takeover_from.store(nullptr, std::memory_order_relaxed);
 }
 
 [[nodiscard]] bool setup_reader(
@@ -176,11 +247,16 @@ void reset_reader(rav::rtp::AudioReceiver::Reader& reader) {
 
     reader.id = id;
 
+    // Buffers touched by the network and audio threads live in the (locked, pre-faulted) arena.
+    const rav::Arena::Scope arena_scope(rav::Arena::get_default(), "rtp_receiver");
+
     for (size_t i = 0; i < reader.streams.size(); ++i) {
         reset_stream_context(reader.streams[i]);
         reader.streams[i].session = parameters.streams[i].session;
         reader.streams[i].filter = parameters.streams[i].filter;
+        reader.streams[i].compiled_filter = rav::rtp::CompiledFilter(parameters.streams[i].filter);
         reader.streams[i].packet_time_frames = parameters.streams[i].packet_time_frames;
+        reader.streams[i].ptp_media_clock_offset = parameters.streams[i].ptp_media_clock_offset;
         reader.streams[i].interface = interfaces[i];
     }
 
@@ -216,7 +292,7 @@ void reset_reader(rav::rtp::AudioReceiver::Reader& reader) {
 
         const auto endpoint = boost::asio::ip::udp::endpoint(stream.session.connection_address, stream.session.rtp_port);
 
-        auto* socket = find_or_create_socket(receiver, endpoint.port());
+        auto* socket = find_or_create_socket(receiver.sockets, endpoint.port());
         if (socket == nullptr) {
             RAV_LOG_ERROR("Failed to create receive socket");
             continue;
@@ -233,6 +309,14 @@ void reset_reader(rav::rtp::AudioReceiver::Reader& reader) {
                 }
             }
         }
+
+        if (receiver.rtcp_enabled) {
+            if (find_or_create_socket(receiver.rtcp_sockets, stream.session.rtcp_port) == nullptr) {
+                RAV_LOG_ERROR("Failed to create RTCP socket");
+                continue;
+            }
+            join_rtcp_multicast_group_if_first(receiver, stream);
+        }
     }
 
     return true;
@@ -269,12 +353,41 @@ void reset_reader(rav::rtp::AudioReceiver::Reader& reader) {
     return true;
 }
 
-size_t count_num_sessions_using_rtp_port(rav::rtp::AudioReceiver& receiver, const uint16_t port) {
+/// @return True if the parameters differ from the current setup of the reader only in ways which don't affect the data path.
+[[nodiscard]] bool is_same_data_path(
+    const rav::rtp::AudioReceiver::Reader& reader, const rav::rtp::AudioReceiver::ReaderParameters& parameters,
+    const rav::rtp::AudioReceiver::ArrayOfAddresses& interfaces
+) {
+    if (reader.audio_format != parameters.audio_format) {
+        return false;
+    }
+    for (size_t i = 0; i < reader.streams.size(); ++i) {
+        if (reader.streams[i].session != parameters.streams[i].session) {
+            return false;
+        }
+        if (reader.streams[i].packet_time_frames != parameters.streams[i].packet_time_frames) {
+            return false;
+        }
+        if (reader.streams[i].interface != interfaces[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @return True if any of the streams of given reader is receiving packets which are being consumed.
+[[nodiscard]] bool has_receiving_stream(const rav::rtp::AudioReceiver::Reader& reader) {
+    return std::any_of(reader.streams.begin(), reader.streams.end(), [](const rav::rtp::AudioReceiver::StreamContext& stream) {
+        return stream.state.load(std::memory_order_relaxed) == rav::rtp::AudioReceiver::StreamState::receiving;
+    });
+}
+
+size_t count_num_sessions_using_port(rav::rtp::AudioReceiver& receiver, const uint16_t port, const bool rtcp) {
     RAV_ASSERT(port > 0, "A valid port must be given, otherwise empty sessions will be counted as well");
     size_t count = 0;
     for (auto& reader : receiver.readers) {
         for (const auto& stream : reader.streams) {
-            if (stream.session.rtp_port == port) {
+            if ((rtcp ? stream.session.rtcp_port : stream.session.rtp_port) == port) {
                 count++;
             }
         }
@@ -282,12 +395,12 @@ size_t count_num_sessions_using_rtp_port(rav::rtp::AudioReceiver& receiver, cons
     return count;
 }
 
-void close_unused_sockets(rav::rtp::AudioReceiver& receiver) {
-    for (auto& socket : receiver.sockets) {
+void close_unused_sockets(rav::rtp::AudioReceiver& receiver, rav::rtp::AudioReceiver::SocketList& sockets, const bool rtcp) {
+    for (auto& socket : sockets) {
         if (!socket.socket.is_open()) {
             continue;
         }
-        if (count_num_sessions_using_rtp_port(receiver, socket.port) == 0) {
+        if (count_num_sessions_using_port(receiver, socket.port, rtcp) == 0) {
             // We're only locking here which is safe as long as the audio thread and network thread only take shared
             // locks. Once that is not the case and these threads start to manipulate the socket structure there will be
             // a data race.
@@ -308,10 +421,350 @@ void close_unused_sockets(rav::rtp::AudioReceiver& receiver) {
     }
 }
 
+void close_unused_sockets(rav::rtp::AudioReceiver& receiver) {
+    close_unused_sockets(receiver, receiver.sockets, false);
+    close_unused_sockets(receiver, receiver.rtcp_sockets, true);
+}
+
+/// Leaves the multicast groups which are no longer used once given reader is gone, resets the reader and closes the sockets
+/// which are no longer used. The reader must be unpublished, past a grace period, and locked exclusively.
+void retire_reader(rav::rtp::AudioReceiver& receiver, rav::rtp::AudioReceiver::Reader& reader) {
+    RAV_ASSERT(reader.rw_lock.is_locked_exclusively(), "Expecting the reader to be locked exclusively");
+
+    for (auto& stream : reader.streams) {
+        if (stream.session.valid() && stream.session.connection_address.is_multicast() && !stream.interface.is_unspecified()) {
+            std::ignore = leave_multicast_group_if_last(
+                receiver, stream.session.connection_address.to_v4(), stream.interface, stream.session.rtp_port
+            );
+            if (receiver.rtcp_enabled) {
+                leave_rtcp_multicast_group_if_last(receiver, stream);
+            }
+        }
+    }
+
+    reset_reader(reader);
+    close_unused_sockets(receiver);
+}
+
+/// @return The reader with given id. While a reader is being replaced, that's the shadow reader which replaces it.
+template<class Receiver>
+auto* find_reader(Receiver& receiver, const rav::Id id) {
+    decltype(&receiver.readers.front()) found = nullptr;
+    for (auto& reader : receiver.readers) {
+        if (reader.id != id) {
+            continue;
+        }
+        const auto is_replaced = std::any_of(receiver.switchovers.begin(), receiver.switchovers.end(), [&reader](const auto& switchover) {
+            return switchover.current == &reader;
+        });
+        if (!is_replaced) {
+            return &reader;
+        }
+        found = &reader;
+    }
+    return found;
+}
+
+void publish_shadow_reader(rav::rtp::AudioReceiver::Switchover& switchover) {
+    // Publish the shadow reader before unpublishing the current one, so that the audio thread always finds one of them.
+    switchover.shadow->published_id.store(switchover.shadow->id, std::memory_order_release);
+    switchover.current->published_id.store({}, std::memory_order_release);
+    switchover.is_published = true;
+}
+
+/// Publishes the shadow reader if that didn't happen yet, and retires the current reader after a grace period.
+[[nodiscard]] bool finish_switchover(rav::rtp::AudioReceiver& receiver, rav::rtp::AudioReceiver::Switchover& switchover) {
+    if (!switchover.is_published) {
+        publish_shadow_reader(switchover);
+    }
+
+    // The current reader must not be taken over after it's been retired.
+    switchover.shadow->takeover_from.store(nullptr, std::memory_order_release);
+
+    if (!receiver.realtime_epoch.synchronize()) {
+        RAV_LOG_ERROR("Failed to wait for the audio thread to release the reader");
+        return false;
+    }
+
+    const auto guard = switchover.current->rw_lock.lock_exclusive();
+    if (!guard) {
+        RAV_LOG_ERROR("Failed to exclusively lock reader");
+        return false;
+    }
+
+    retire_reader(receiver, *switchover.current);
+    return true;
+}
+
+/// Finishes the switchover of the reader with given id right away, if there is one in progress.
+void finish_switchover_now(rav::rtp::AudioReceiver& receiver, const rav::Id id) {
+    for (auto it = receiver.switchovers.begin(); it != receiver.switchovers.end(); ++it) {
+        if (it->shadow->id == id) {
+            std::ignore = finish_switchover(receiver, *it);
+            receiver.switchovers.erase(it);
+            return;
+        }
+    }
+}
+
+void poll_switchovers(rav::rtp::AudioReceiver& receiver);
+
+void schedule_switchover_poll(rav::rtp::AudioReceiver& receiver) {
+    receiver.switchover_timer.expires_after(std::chrono::milliseconds(1));
+    receiver.switchover_timer.async_wait([&receiver](const boost::system::error_code& ec) {
+        if (ec) {
+            return;  // Cancelled, the receiver might be gone
+        }
+        poll_switchovers(receiver);
+    });
+}
+
+/// Advances the switchovers in progress without blocking the io_context, and schedules the next poll while any are left.
+void poll_switchovers(rav::rtp::AudioReceiver& receiver) {
+    const auto now = rav::clock::now_monotonic_high_resolution_ns();
+    const auto timeout_ns = rav::rtp::AudioReceiver::k_reconfigure_timeout_ms * 1'000'000;
+
+    for (auto i = receiver.switchovers.size(); i-- > 0;) {
+        auto& switchover = receiver.switchovers[i];
+
+        if (!switchover.is_published) {
+            // Give the shadow reader time to receive its first packets
+            if (!has_receiving_stream(*switchover.shadow) && now < switchover.deadline_ns) {
+                continue;
+            }
+            publish_shadow_reader(switchover);
+            switchover.deadline_ns = now + timeout_ns;
+        }
+
+        // Give the audio thread time to take over the read position
+        if (switchover.shadow->takeover_from.load(std::memory_order_acquire) != nullptr && now < switchover.deadline_ns) {
+            continue;
+        }
+
+        std::ignore = finish_switchover(receiver, switchover);
+        receiver.switchovers.erase(receiver.switchovers.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+
+    if (!receiver.switchovers.empty()) {
+        schedule_switchover_poll(receiver);
+    }
+}
+
+/// Converts a time in nanoseconds to RTP timestamp units, wrapping around like RTP timestamps do.
+[[nodiscard]] uint32_t nanoseconds_to_rtp_units(const uint64_t nanos, const uint32_t sample_rate) {
+    return static_cast<uint32_t>(nanos / 1'000'000'000 * sample_rate + nanos % 1'000'000'000 * sample_rate / 1'000'000'000);
+}
+
+/// @return True if the wallclock of given sender report is in the PTP timescale of the media clock of the stream.
+[[nodiscard]] bool is_ptp_sender_report(
+    const rav::rtp::AudioReceiver::StreamContext& stream, const rav::rtcp::PacketView& packet, const uint32_t sample_rate
+) {
+    if (!stream.ptp_media_clock_offset.has_value()) {
+        return false;
+    }
+    const auto ptp_time_ns = packet.ntp_timestamp().to_unix_nanoseconds();
+    const auto expected = nanoseconds_to_rtp_units(ptp_time_ns, sample_rate) + *stream.ptp_media_clock_offset;
+    const auto difference = static_cast<int32_t>(packet.rtp_timestamp() - expected);
+    return std::abs(difference) <= static_cast<int32_t>(stream.packet_time_frames);
+}
+
+void handle_rtcp_sender_report(
+    rav::rtp::AudioReceiver& receiver, const rav::rtcp::PacketView& packet, const boost::asio::ip::udp::endpoint& src_endpoint,
+    const boost::asio::ip::udp::endpoint& dst_endpoint, const uint64_t recv_time
+) {
+    TRACY_ZONE_SCOPED;
+
+    const auto& local_clock = receiver.ptp_instance_subscriber.get_local_clock();
+
+    for (auto& reader : receiver.readers) {
+        const auto reader_guard = reader.rw_lock.try_lock_shared();
+        if (!reader_guard) {
+            continue;
+        }
+
+        if (!reader.id.is_valid()) {
+            continue;
+        }
+
+        for (auto& stream : reader.streams) {
+            if (stream.session.connection_address != dst_endpoint.address()) {
+                continue;
+            }
+            if (stream.session.rtcp_port != dst_endpoint.port()) {
+                continue;
+            }
+            if (!stream.compiled_filter.is_valid_source(dst_endpoint.address(), src_endpoint.address())) {
+                continue;
+            }
+            if (stream.remote_ssrc != packet.ssrc()) {
+                continue;  // Report from a different sender, or no RTP packets received yet
+            }
+
+            const auto ntp_timestamp = packet.ntp_timestamp();
+            stream.rtcp_stats.update_sender_report(ntp_timestamp, recv_time);
+            stream.rtcp_remote_endpoint = src_endpoint;
+
+            // When the sender report carries the send time in the PTP timescale, it gives the one-way latency once our own
+            // clock is locked to the same grandmaster. A sender which isn't locked reports its local wall clock instead,
+            // which shows as an RTP timestamp that doesn't match the wallclock on the PTP derived media clock.
+            if (local_clock.is_locked() && is_ptp_sender_report(stream, packet, reader.audio_format.sample_rate)) {
+                const auto arrival_ns = local_clock.get_adjusted_time(recv_time).to_nanoseconds();
+                const auto sent_ns = ntp_timestamp.to_unix_nanoseconds();
+                stream.one_way_latency_ms = static_cast<double>(static_cast<int64_t>(arrival_ns - sent_ns)) / 1'000'000.0;
+                TRACY_PLOT("RTCP one-way latency (ms)", stream.one_way_latency_ms);
+            }
+        }
+    }
+}
+
+/// Tells whether given SSRC is used by any of the senders we're receiving from.
+[[nodiscard]] bool is_remote_ssrc(rav::rtp::AudioReceiver& receiver, const uint32_t ssrc) {
+    for (auto& reader : receiver.readers) {
+        const auto reader_guard = reader.rw_lock.try_lock_shared();
+        if (!reader_guard || !reader.id.is_valid()) {
+            continue;
+        }
+        for (const auto& stream : reader.streams) {
+            if (stream.session.valid() && stream.remote_ssrc == ssrc) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/// Picks a new random SSRC for our receiver reports which doesn't collide with any of the senders we know of (RFC 3550
+/// section 8.2).
+void generate_rtcp_ssrc(rav::rtp::AudioReceiver& receiver) {
+    std::random_device rd;
+    std::mt19937 generator(rd());
+    std::uniform_int_distribution<uint32_t> distribution(1, std::numeric_limits<uint32_t>::max());
+    const auto previous_ssrc = receiver.rtcp_ssrc;
+    do {
+        receiver.rtcp_ssrc = distribution(generator);
+    } while (receiver.rtcp_ssrc == previous_ssrc || is_remote_ssrc(receiver, receiver.rtcp_ssrc));
+}
+
+void read_incoming_rtcp_packets(rav::rtp::AudioReceiver& receiver) {
+    TRACY_ZONE_SCOPED;
+
+    std::array<uint8_t, rav::aes67::constants::k_mtu> receive_buffer {};
+
+    for (auto& ctx : receiver.rtcp_sockets) {
+        const auto socket_guard = ctx.rw_lock.try_lock_shared();
+        if (!socket_guard) {
+            continue;
+        }
+
+        if (!ctx.socket.is_open()) {
+            continue;
+        }
+
+        while (true) {
+            boost::system::error_code ec;
+            boost::asio::ip::udp::endpoint src_endpoint;
+            boost::asio::ip::udp::endpoint dst_endpoint;
+            uint64_t recv_time = 0;
+            const auto bytes_received =
+                rav::receive_from_socket(ctx.socket, receive_buffer, src_endpoint, dst_endpoint, recv_time, ec);
+
+            if (ec || bytes_received == 0) {
+                break;  // Includes boost::asio::error::try_again
+            }
+
+            // Walk the compound packet. We're only interested in sender reports, our own (and other receivers')
+            // receiver reports are ignored.
+            for (auto packet = rav::rtcp::PacketView(receive_buffer.data(), bytes_received); packet.validate();
+                 packet = packet.get_next_packet()) {
+                if (packet.type() == rav::rtcp::PacketView::PacketType::sender_report_report) {
+                    handle_rtcp_sender_report(receiver, packet, src_endpoint, dst_endpoint, recv_time);
+                }
+            }
+        }
+    }
+}
+
+void send_rtcp_receiver_reports(rav::rtp::AudioReceiver& receiver, const uint64_t now) {
+    TRACY_ZONE_SCOPED;
+
+    if (is_remote_ssrc(receiver, receiver.rtcp_ssrc)) {
+        RAV_LOG_WARNING("RTCP SSRC {} collides with a sender, picking a new one", receiver.rtcp_ssrc);
+        generate_rtcp_ssrc(receiver);
+    }
+
+    for (auto& reader : receiver.readers) {
+        const auto reader_guard = reader.rw_lock.try_lock_shared();
+        if (!reader_guard) {
+            continue;
+        }
+
+        if (!reader.id.is_valid()) {
+            continue;
+        }
+
+        for (auto& stream : reader.streams) {
+            if (!stream.session.valid() || !stream.rtcp_stats.has_received()) {
+                continue;
+            }
+
+            if (stream.last_rtcp_report_time_ns + rav::rtp::AudioReceiver::k_rtcp_report_interval_ms * 1'000'000 > now) {
+                continue;
+            }
+
+            stream.last_rtcp_report_time_ns = now;
+
+            // Multicast reports go to the group so that the sender and other receivers can see them, unicast reports go
+            // back to the sender.
+            boost::asio::ip::udp::endpoint destination;
+            if (stream.session.connection_address.is_multicast()) {
+                destination = {stream.session.connection_address, stream.session.rtcp_port};
+            } else if (stream.rtcp_remote_endpoint.has_value()) {
+                destination = *stream.rtcp_remote_endpoint;
+            } else {
+                destination = {stream.remote_address, stream.session.rtcp_port};
+            }
+
+            if (destination.address().is_unspecified()) {
+                continue;
+            }
+
+            for (auto& ctx : receiver.rtcp_sockets) {
+                if (ctx.port != stream.session.rtcp_port) {
+                    continue;
+                }
+
+                const auto socket_guard = ctx.rw_lock.try_lock_shared();
+                if (!socket_guard || !ctx.socket.is_open()) {
+                    break;
+                }
+
+                boost::system::error_code ec;
+                if (stream.session.connection_address.is_multicast() && !stream.interface.is_unspecified()) {
+                    ctx.socket.set_option(boost::asio::ip::multicast::outbound_interface(stream.interface), ec);
+                    if (ec) {
+                        break;
+                    }
+                }
+
+                rav::rtcp::ReceiverReport report;
+                report.ssrc = receiver.rtcp_ssrc;
+                report.report_blocks.push_back(stream.rtcp_stats.make_report_block(stream.remote_ssrc, now));
+
+                receiver.rtcp_send_buffer.clear();
+                report.encode(receiver.rtcp_send_buffer);
+                ctx.socket.send_to(
+                    boost::asio::buffer(receiver.rtcp_send_buffer.data(), receiver.rtcp_send_buffer.size()), destination, 0, ec
+                );
+                break;
+            }
+        }
+    }
+}
+
 void do_realtime_maintenance(rav::rtp::AudioReceiver::Reader& reader) {
     TRACY_ZONE_SCOPED;
 
-    RAV_ASSERT_DEBUG(reader.rw_lock.is_locked_shared(), "Reader must be shared locked");
+    RAV_ASSERT_DEBUG(reader.published_id.load(std::memory_order_relaxed).is_valid(), "Reader must be published");
 
     for (auto& stream : reader.streams) {
         if (stream.state.load(std::memory_order_relaxed) == rav::rtp::AudioReceiver::StreamState::no_consumer) {
@@ -320,11 +773,10 @@ void do_realtime_maintenance(rav::rtp::AudioReceiver::Reader& reader) {
             continue;
         }
 
-        for (size_t i = 0; i < stream.packets.size(); ++i) {
-            auto rtp_packet = stream.packets.pop();
-            if (!rtp_packet.has_value()) {
-                break;
-            }
+        // Process everything the network thread has published so far as one batch
+        const auto packets = stream.packets.read_available();
+        for (size_t i = 0; i < packets.size(); ++i) {
+            const auto* rtp_packet = &packets[i];
 
             rav::WrappingUint32 packet_timestamp(rtp_packet->timestamp);
             const auto num_frames = static_cast<uint32_t>(rtp_packet->data_len) / reader.audio_format.bytes_per_frame();
@@ -357,6 +809,29 @@ void do_realtime_maintenance(rav::rtp::AudioReceiver::Reader& reader) {
             reader.receive_buffer.clear_until(rtp_packet->timestamp);
             reader.receive_buffer.write(rtp_packet->timestamp, {rtp_packet->payload.data(), rtp_packet->data_len});
         }
+        stream.packets.commit_read(packets.size());
+    }
+}
+
+/// Continues reading where the reader which is being replaced left off, including the audio which hasn't been read yet if
+/// the format allows. Called from the audio thread, which owns the read state of both readers. Data is placed in the buffer
+/// by RTP timestamp, so the switch doesn't need to fall on a packet boundary: frames up to the most recent timestamp of the
+/// previous reader come from its buffer, and packets of the new reader fill in the frames after that, a packet which
+/// straddles the read position included.
+void take_over_read_position(rav::rtp::AudioReceiver::Reader& reader, const rav::rtp::AudioReceiver::Reader& previous) {
+    if (!previous.most_recent_ts.has_value() || previous.audio_format.sample_rate != reader.audio_format.sample_rate) {
+        return;  // Nothing to take over, or the timestamps are not comparable
+    }
+
+    reader.most_recent_ts = previous.most_recent_ts;
+    reader.next_ts_to_read = previous.next_ts_to_read;
+    reader.receive_buffer.set_next_ts(previous.next_ts_to_read.value());
+
+    const auto num_unread_frames = previous.next_ts_to_read.diff(*previous.most_recent_ts) + 1;
+    if (previous.audio_format == reader.audio_format && num_unread_frames > 0) {
+        std::ignore = reader.receive_buffer.copy_from(
+            previous.receive_buffer, previous.next_ts_to_read.value(), static_cast<uint32_t>(num_unread_frames)
+        );
     }
 }
 
@@ -366,7 +841,13 @@ std::optional<uint32_t> read_data_from_reader_realtime(
 ) {
     TRACY_ZONE_SCOPED;
 
-    RAV_ASSERT_DEBUG(reader.rw_lock.is_locked_shared(), "Reader must be shared locked");
+    RAV_ASSERT_DEBUG(reader.published_id.load(std::memory_order_relaxed).is_valid(), "Reader must be published");
+
+    if (reader.takeover_from.load(std::memory_order_relaxed) != nullptr) {
+        if (const auto* previous = reader.takeover_from.exchange(nullptr, std::memory_order_acq_rel)) {
+            take_over_read_position(reader, *previous);
+        }
+    }
 
     if (at_timestamp.has_value()) {
         reader.next_ts_to_read = *at_timestamp;  // Updating before do_realtime_maintenance to have the most accurate next_to_to_read
@@ -406,7 +887,7 @@ void update_stream_active_state(rav::rtp::AudioReceiver::StreamContext& stream,
 
 }  // namespace
 
-rav::rtp::AudioReceiver::AudioReceiver(boost::asio::io_context& io_context) {
+rav::rtp::AudioReceiver::AudioReceiver(boost::asio::io_context& io_context) : switchover_timer(io_context) {
     join_multicast_group = [](boost::asio::ip::udp::socket& socket, const boost::asio::ip::address_v4& multicast_group,
                               const boost::asio::ip::address_v4& interface_address) {
         RAV_ASSERT(socket.is_open(), "Socket should be open");
@@ -449,6 +930,12 @@ rav::rtp::AudioReceiver::AudioReceiver(boost::asio::io_context& io_context) {
         sockets.emplace_back(io_context);
     }
 
+    for (size_t i = rtcp_sockets.size(); i < decltype(rtcp_sockets)::capacity(); i++) {
+        rtcp_sockets.emplace_back(io_context);
+    }
+
+    generate_rtcp_ssrc(*this);
+
     for (size_t i = readers.size(); i < decltype(readers)::capacity(); i++) {
         readers.emplace_back();
     }
@@ -461,6 +948,9 @@ rav::rtp::AudioReceiver::~AudioReceiver() {
     for (auto& socket : sockets) {
         RAV_ASSERT_NO_THROW(!socket.socket.is_open(), "There should be no active socket at this point");
     }
+    for (auto& socket : rtcp_sockets) {
+        RAV_ASSERT_NO_THROW(!socket.socket.is_open(), "There should be no active RTCP socket at this point");
+    }
 }
 
 bool rav::rtp::AudioReceiver::set_interfaces(const ArrayOfAddresses& interfaces) {
@@ -483,6 +973,9 @@ bool rav::rtp::AudioReceiver::set_interfaces(const ArrayOfAddresses& interfaces)
                         *this, reader.streams[i].session.connection_address.to_v4(), reader.streams[i].interface,
                         reader.streams[i].session.rtp_port
                     );
+                    if (rtcp_enabled) {
+                        leave_rtcp_multicast_group_if_last(*this, reader.streams[i]);
+                    }
                 }
             }
             reader.streams[i].interface = {};
@@ -492,7 +985,7 @@ bool rav::rtp::AudioReceiver::set_interfaces(const ArrayOfAddresses& interfaces)
                         *this, reader.streams[i].session.connection_address.to_v4(), interfaces[i], reader.streams[i].session.rtp_port
                     );
                     if (count == 0) {
-                        auto* socket = find_socket(*this, reader.streams[i].session.rtp_port);
+                        auto* socket = find_socket(sockets, reader.streams[i].session.rtp_port);
                         RAV_ASSERT(socket != nullptr, "Socket not found");
                         if (!join_multicast_group(*socket, reader.streams[i].session.connection_address.to_v4(), interfaces[i])) {
                             RAV_LOG_ERROR("Failed to join multicast group");
@@ -501,6 +994,9 @@ bool rav::rtp::AudioReceiver::set_interfaces(const ArrayOfAddresses& interfaces)
                 }
             }
             reader.streams[i].interface = interfaces[i];
+            if (rtcp_enabled && reader.streams[i].session.valid()) {
+                join_rtcp_multicast_group_if_first(*this, reader.streams[i]);
+            }
         }
     }
 
@@ -529,32 +1025,107 @@ bool rav::rtp::AudioReceiver::add_reader(const Id id, const ReaderParameters& pa
             continue;  // Used already
         }
 
-        return setup_reader(*this, reader, id, parameters, interfaces);
+        if (!setup_reader(*this, reader, id, parameters, interfaces)) {
+            return false;
+        }
+
+        reader.published_id.store(id, std::memory_order_release);
+        return true;
     }
 
     return false;
 }
 
+bool rav::rtp::AudioReceiver::update_reader(const Id id, const ReaderParameters& parameters, const ArrayOfAddresses& interfaces) {
+    RAV_ASSERT(parameters.streams.size() == interfaces.size(), "Should be equal");
+
+    finish_switchover_now(*this, id);
+
+    Reader* current = find_reader(*this, id);
+
+    if (current == nullptr) {
+        return add_reader(id, parameters, interfaces);
+    }
+
+    if (is_same_data_path(*current, parameters, interfaces)) {
+        const auto guard = current->rw_lock.lock_exclusive();
+        if (!guard) {
+            RAV_LOG_ERROR("Failed to exclusively lock reader");
+            return false;
+        }
+
+        const Arena::Scope arena_scope(Arena::get_default(), "rtp_receiver");
+        for (size_t i = 0; i < current->streams.size(); ++i) {
+            current->streams[i].filter = parameters.streams[i].filter;
+            current->streams[i].compiled_filter = CompiledFilter(parameters.streams[i].filter);
+            current->streams[i].ptp_media_clock_offset = parameters.streams[i].ptp_media_clock_offset;
+        }
+        return true;
+    }
+
+    Reader* shadow = nullptr;
+    for (auto& reader : readers) {
+        if (!reader.id.is_valid()) {
+            shadow = &reader;
+            break;
+        }
+    }
+
+    if (shadow == nullptr) {
+        RAV_LOG_WARNING("No free slot to reconfigure the reader without interruption, replacing it instead");
+        std::ignore = remove_reader(id);
+        return add_reader(id, parameters, interfaces);
+    }
+
+    {
+        // New multicast groups get joined here. Groups used by both readers stay joined because they are counted twice.
+        const auto guard = shadow->rw_lock.lock_exclusive();
+        if (!guard) {
+            RAV_LOG_ERROR("Failed to exclusively lock reader");
+            return false;
+        }
+
+        if (!setup_reader(*this, *shadow, id, parameters, interfaces)) {
+            return false;
+        }
+
+        shadow->takeover_from.store(current, std::memory_order_release);
+    }
+
+    Switchover switchover {current, shadow, has_receiving_stream(*current), false, 0};
+
+    // Nobody is reading from the current reader, so there is nothing to wait for.
+    if (!switchover.is_consumed) {
+        return finish_switchover(*this, switchover);
+    }
+
+    // Otherwise the shadow reader gets time to receive its first packets, and the audio thread time to switch over, on the
+    // io_context.
+    switchover.deadline_ns = clock::now_monotonic_high_resolution_ns() + k_reconfigure_timeout_ms * 1'000'000;
+    switchovers.push_back(switchover);
+    schedule_switchover_poll(*this);
+    return true;
+}
+
 bool rav::rtp::AudioReceiver::remove_reader(const Id id) {
+    finish_switchover_now(*this, id);
+
     for (auto& reader : readers) {
         if (reader.id == id) {
+            // Take the reader away from the audio thread first, and wait until it's no longer using it
+            reader.published_id.store({}, std::memory_order_release);
+            if (!realtime_epoch.synchronize()) {
+                RAV_LOG_ERROR("Failed to wait for the audio thread to release the reader");
+                return false;
+            }
+
             const auto guard = reader.rw_lock.lock_exclusive();
             if (!guard) {
                 RAV_LOG_ERROR("Failed to exclusively lock reader");
                 return false;
             }
 
-            for (auto& stream : reader.streams) {
-                if (stream.session.valid() && stream.session.connection_address.is_multicast() && !stream.interface.is_unspecified()) {
-                    std::ignore = leave_multicast_group_if_last(
-                        *this, stream.session.connection_address.to_v4(), stream.interface, stream.session.rtp_port
-                    );
-                }
-            }
-
-            reset_reader(reader);
-            close_unused_sockets(*this);
-
+            retire_reader(*this, reader);
             return true;
         }
     }
@@ -630,7 +1201,7 @@ void rav::rtp::AudioReceiver::read_incoming_packets() {
                 if (stream.session.rtp_port != dst_endpoint.port()) {
                     continue;
                 }
-                if (!stream.filter.is_valid_source(dst_endpoint.address(), src_endpoint.address())) {
+                if (!stream.compiled_filter.is_valid_source(dst_endpoint.address(), src_endpoint.address())) {
                     continue;
                 }
 
@@ -641,15 +1212,16 @@ void rav::rtp::AudioReceiver::read_incoming_packets() {
                     stream.prev_packet_time_ns = recv_time;
                 }
 
-                PacketBuffer packet {};
-                packet.timestamp = view.timestamp();
-                packet.seq = view.sequence_number();
-                packet.data_len = static_cast<uint16_t>(payload.size_bytes());
-                packet.recv_time = recv_time;
-                std::memcpy(packet.payload.data(), payload.data(), payload.size_bytes());
-
+                // Write straight into the slot of the fifo, saving a copy of the packet
                 auto state = stream.state.load(std::memory_order_relaxed);
-                if (stream.packets.push(packet)) {
+                if (const auto slot = stream.packets.write_reserve(1); !slot.empty()) {
+                    auto& packet = slot[0];
+                    packet.timestamp = view.timestamp();
+                    packet.seq = view.sequence_number();
+                    packet.data_len = static_cast<uint16_t>(payload.size_bytes());
+                    packet.recv_time = recv_time;
+                    std::memcpy(packet.payload.data(), payload.data(), payload.size_bytes());
+                    stream.packets.commit_write(1);
                     stream.state.store(StreamState::receiving, std::memory_order_relaxed);
                 } else if (state != StreamState::no_consumer) {
                     stream.state.store(StreamState::no_consumer, std::memory_order_relaxed);
@@ -660,14 +1232,16 @@ void rav::rtp::AudioReceiver::read_incoming_packets() {
                     const auto& local_clock = ptp_instance_subscriber.get_local_clock();
                     if (local_clock.is_locked()) {
                         auto ptp_time = local_clock.get_adjusted_time(recv_time);
-                        [[maybe_unused]] auto rtp_time = ptp_time.from_rtp_timestamp32(packet.timestamp, reader.audio_format.sample_rate);
+                        [[maybe_unused]] auto rtp_time = ptp_time.from_rtp_timestamp32(view.timestamp(), reader.audio_format.sample_rate);
                         TRACY_PLOT("receive latency (ms)", ptp_time.to_milliseconds_double() - rtp_time.to_milliseconds_double());
                     }
                 }
 
-                while (auto seq = stream.packets_too_old.pop()) {
-                    stream.packet_stats.mark_packet_too_late(*seq);
+                const auto too_old = stream.packets_too_old.read_available();
+                for (size_t i = 0; i < too_old.size(); ++i) {
+                    stream.packet_stats.mark_packet_too_late(too_old[i]);
                 }
+                stream.packets_too_old.commit_read(too_old.size());
 
                 if (const auto interval = stream.prev_packet_time_ns.update(recv_time)) {
                     if (stream.packet_interval_stats.initialized || *interval != 0) {
@@ -675,15 +1249,25 @@ void rav::rtp::AudioReceiver::read_incoming_packets() {
                             stream.packet_interval_stats.max_deviation = {};
                         }
                         stream.packet_interval_stats.update(static_cast<double>(*interval) / 1'000'000.0);
+                        stream.packet_interval_histogram.record(*interval);
                         TRACY_PLOT("packet interval (ms)", static_cast<double>(*interval) / 1'000'000.0);
                         TRACY_PLOT("packet interval EMA (ms)", stream.packet_interval_stats.interval);
                         TRACY_PLOT("packet interval MAX (ms)", stream.packet_interval_stats.max_deviation);
                     }
                 }
 
+                if (rtcp_enabled) {
+                    stream.remote_ssrc = view.ssrc();
+                    stream.remote_address = src_endpoint.address();
+                    stream.rtcp_stats.update(
+                        view.sequence_number(), view.timestamp(), nanoseconds_to_rtp_units(recv_time, reader.audio_format.sample_rate)
+                    );
+                }
+
                 std::ignore = stream.packet_stats.update(view.sequence_number());
                 auto stats = stream.packet_stats.get_total_counts();
                 stats.jitter = stream.packet_interval_stats.max_deviation;
+                stats.one_way_latency_ms = stream.one_way_latency_ms;
                 stream.packet_stats_counters.write(stats);
             }
         }
@@ -691,6 +1275,11 @@ void rav::rtp::AudioReceiver::read_incoming_packets() {
         last_time_maintenance = now;
     }
 
+    if (rtcp_enabled) {
+        read_incoming_rtcp_packets(*this);
+        send_rtcp_receiver_reports(*this, now);
+    }
+
     // Do maintenance if not done for a while
     if (last_time_maintenance + k_receive_timeout_ms * 1'000'000 < now) {
         for (auto& reader : readers) {
@@ -717,13 +1306,9 @@ std::optional<uint32_t> rav::rtp::AudioReceiver::read_data_realtime(
 ) {
     TRACY_ZONE_SCOPED;
 
+    const auto guard = realtime_epoch.enter();
     for (auto& reader : readers) {
-        const auto guard = reader.rw_lock.try_lock_shared();
-        if (!guard) {
-            TRACY_MESSAGE("Failed to lock reader");
-            continue;
-        }
-        if (reader.id != id) {
+        if (reader.published_id.load(std::memory_order_acquire) != id) {
             continue;
         }
         return read_data_from_reader_realtime(reader, buffer, buffer_size, at_timestamp, require_delay);
@@ -741,12 +1326,9 @@ std::optional<uint32_t> rav::rtp::AudioReceiver::read_audio_data_realtime(
     RAV_ASSERT_DEBUG(id.is_valid(), "Id should be valid");
     RAV_ASSERT_DEBUG(output_buffer.is_valid(), "Buffer must be valid");
 
+    const auto guard = realtime_epoch.enter();
     for (auto& reader : readers) {
-        const auto guard = reader.rw_lock.try_lock_shared();
-        if (!guard) {
-            continue;
-        }
-        if (reader.id != id) {
+        if (reader.published_id.load(std::memory_order_acquire) != id) {
             continue;
         }
 
@@ -783,39 +1365,64 @@ std::optional<uint32_t> rav::rtp::AudioReceiver::read_audio_data_realtime(
 }
 
 std::optional<rav::rtp::PacketStats::Counters> rav::rtp::AudioReceiver::get_packet_stats(const Id reader_id, const size_t stream_index) {
-    for (auto& reader : readers) {
-        if (reader.id != reader_id) {
-            continue;
-        }
-        const auto guard = reader.rw_lock.try_lock_shared();
-        if (!guard) {
-            continue;
-        }
+    uint32_t last_update = 0;  // Never matches a published value, which always has a non-zero sequence
+    return get_packet_stats_if_updated(reader_id, stream_index, last_update);
+}
 
-        if (stream_index >= reader.streams.size()) {
-            RAV_ASSERT_FALSE("Index out of bounds");
-            return std::nullopt;
-        }
+std::optional<rav::rtp::PacketStats::Counters>
+rav::rtp::AudioReceiver::get_packet_stats_if_updated(const Id reader_id, const size_t stream_index, uint32_t& last_update) {
+    auto* reader = find_reader(*this, reader_id);
+    if (reader == nullptr) {
+        return std::nullopt;
+    }
+
+    const auto guard = reader->rw_lock.try_lock_shared();
+    if (!guard) {
+        return std::nullopt;
+    }
 
-        auto& stream = reader.streams[stream_index];
+    if (stream_index >= reader->streams.size()) {
+        RAV_ASSERT_FALSE("Index out of bounds");
+        return std::nullopt;
+    }
+
+    auto& stream = reader->streams[stream_index];
+    auto stats = stream.packet_stats_counters.read_if_changed(last_update);
+    if (stats) {
         stream.reset_max_values.store(true, std::memory_order_release);
-        return stream.packet_stats_counters.read(boost::lockfree::uses_optional);
     }
+    return stats;
+}
 
+std::optional<rav::AtomicRwLock::ContentionCounters> rav::rtp::AudioReceiver::get_lock_contention_counters(const Id reader_id) const {
+    if (const auto* reader = find_reader(*this, reader_id)) {
+        return reader->rw_lock.get_contention_counters();
+    }
     return std::nullopt;
 }
 
+std::optional<rav::Histogram::Snapshot>
+rav::rtp::AudioReceiver::get_packet_interval_histogram(const Id reader_id, const size_t stream_index) const {
+    if (const auto* reader = find_reader(*this, reader_id)) {
+        if (stream_index >= reader->streams.size()) {
+            RAV_ASSERT_FALSE("Index out of bounds");
+            return {};
+        }
+
+        return reader->streams[stream_index].packet_interval_histogram.snapshot();
+    }
+    return {};
+}
+
 std::optional<rav::rtp::AudioReceiver::StreamState>
 rav::rtp::AudioReceiver::get_stream_state(const Id reader_id, const size_t stream_index) const {
-    for (auto& reader : readers) {
-        if (reader.id == reader_id) {
-            if (stream_index >= reader.streams.size()) {
-                RAV_ASSERT_FALSE("Index out of bounds");
-                return {};
-            }
-
-            return reader.streams[stream_index].state.load(std::memory_order_relaxed);
+    if (const auto* reader = find_reader(*this, reader_id)) {
+        if (stream_index >= reader->streams.size()) {
+            RAV_ASSERT_FALSE("Index out of bounds");
+            return {};
         }
+
+        return reader->streams[stream_index].state.load(std::memory_order_relaxed);
     }
     return {};
 }
@@ -25,14 +25,22 @@
 #include "ravennakit/rtp/detail/rtp_audio_sender.hpp"
 #include "ravennakit/rtp/detail/rtp_audio_sender.hpp"
 
-#include "ravennakit/core/random.hpp"
+#include "ravennakit/core/clock.hpp"
 #include "ravennakit/core/audio/audio_data.hpp"
+#include "ravennakit/rtp/rtcp_packet.hpp"
+#include "ravennakit/rtp/rtcp_packet_view.hpp"
 #include "ravennakit/core/util/stl_helpers.hpp"
 #include "ravennakit/core/util/todo.hpp"
 #include "ravennakit/core/util/tracy.hpp"
 
+#include <chrono>
+#include <random>
+
 namespace {
 
+/// The size of the RTP header as encoded by rav::rtp::Packet (no CSRCs or extensions).
+constexpr size_t k_rtp_header_size = 12;
+
 boost::system::error_code setup_socket(rav::udp_socket& socket) {
     boost::system::error_code ec;
     socket.open(boost::asio::ip::udp::v4(), ec);
@@ -65,8 +73,94 @@ bool set_socket_ttl(rav::udp_socket& socket, const uint8_t ttl) {
     return true;
 }
 
+/// Opens an RTCP socket on the port following the RTP port of given destination, joining the multicast group if needed.
+boost::system::error_code setup_rtcp_socket(
+    rav::udp_socket& socket, const rav::udp_endpoint& destination, const boost::asio::ip::address_v4& interface_address
+) {
+    boost::system::error_code ec;
+    socket.open(boost::asio::ip::udp::v4(), ec);
+    if (ec) {
+        return ec;
+    }
+
+    // Multicast reports are addressed to the group, which other members listen to on the same port. Unicast reports are
+    // addressed to our interface, binding to it exclusively makes sure they're not delivered to another socket.
+    auto bind_address = interface_address;
+    if (destination.address().is_multicast()) {
+        socket.set_option(boost::asio::ip::udp::socket::reuse_address(true), ec);
+        if (ec) {
+            return ec;
+        }
+        bind_address = boost::asio::ip::address_v4::any();
+    }
+    socket.bind({bind_address, static_cast<uint16_t>(destination.port() + 1)}, ec);
+    if (ec) {
+        return ec;
+    }
+    socket.non_blocking(true, ec);
+    if (ec) {
+        return ec;
+    }
+    if (destination.address().is_multicast() && !interface_address.is_unspecified()) {
+        socket.set_option(boost::asio::ip::multicast::join_group(destination.address().to_v4(), interface_address), ec);
+        if (ec) {
+            return ec;
+        }
+        socket.set_option(boost::asio::ip::multicast::outbound_interface(interface_address), ec);
+        if (ec) {
+            return ec;
+        }
+    }
+    return {};
+}
+
+void close_rtcp_sockets(rav::rtp::AudioSender::Writer& writer) {
+    for (auto& socket : writer.rtcp_sockets) {
+        if (socket.is_open()) {
+            boost::system::error_code ec;
+            socket.close(ec);
+            if (ec) {
+                RAV_LOG_ERROR("Failed to close RTCP socket: {}", ec.message());
+            }
+        }
+    }
+}
+
+void setup_rtcp_sockets(rav::rtp::AudioSender::Writer& writer, const rav::rtp::AudioSender::ArrayOfAddresses& interfaces) {
+    close_rtcp_sockets(writer);
+
+    for (size_t i = 0; i < writer.rtcp_sockets.size(); ++i) {
+        const auto& destination = writer.destinations[i];
+        if (destination.address().is_unspecified() || destination.port() == 0) {
+            continue;
+        }
+        if (const auto ec = setup_rtcp_socket(writer.rtcp_sockets[i], destination, interfaces[i])) {
+            RAV_LOG_ERROR("Failed to setup RTCP socket: {}", ec.message());
+            boost::system::error_code ignored;
+            writer.rtcp_sockets[i].close(ignored);
+        }
+    }
+}
+
+/// Picks a random SSRC (RFC 3550 section 8.1) which isn't used by any of the other writers of the sender. Only to be called
+/// from the thread which adds and removes writers.
+uint32_t generate_ssrc(const rav::rtp::AudioSender& sender) {
+    std::random_device rd;
+    std::mt19937 generator(rd());
+    std::uniform_int_distribution<uint32_t> distribution(1, std::numeric_limits<uint32_t>::max());
+    while (true) {
+        const auto ssrc = distribution(generator);
+        const auto in_use = std::any_of(sender.writers.begin(), sender.writers.end(), [ssrc](const auto& writer) {
+            return writer.id.is_valid() && writer.ssrc == ssrc;
+        });
+        if (!in_use) {
+            return ssrc;
+        }
+    }
+}
+
 bool setup_writer(
-    rav::rtp::AudioSender::Writer& writer, const rav::Id id, const rav::rtp::AudioSender::WriterParameters& parameters,
+    rav::rtp::AudioSender::Writer& writer, const rav::Id id, const uint32_t ssrc, const rav::rtp::AudioSender::WriterParameters& parameters,
     const rav::rtp::AudioSender::ArrayOfAddresses& interfaces
 ) {
     RAV_ASSERT(writer.rw_lock.is_locked_exclusively(), "Expecting the writer to be locked exclusively");
@@ -90,15 +184,16 @@ bool setup_writer(
         }
     }
 
-    // TODO: Implement proper SSRC generation (RAV-1)
-    const auto ssrc = static_cast<uint32_t>(rav::Random().get_random_int(0, std::numeric_limits<int>::max()));
-
     const auto audio_format = parameters.audio_format;
     const auto packet_size_bytes = parameters.packet_time_frames * audio_format.bytes_per_frame();
     writer.audio_format = audio_format;
     writer.packet_time_frames = parameters.packet_time_frames;
     writer.rtp_packet.payload_type(parameters.payload_type);
     writer.rtp_packet.ssrc(ssrc);
+
+    // Buffers touched by the audio and network threads live in the (locked, pre-faulted) arena.
+    const rav::Arena::Scope arena_scope(rav::Arena::get_default(), "rtp_sender");
+
     writer.outgoing_data.resize(rav::rtp::AudioSender::k_buffer_num_packets);
     writer.intermediate_audio_buffer.resize(rav::rtp::AudioSender::k_max_num_frames * audio_format.bytes_per_frame());
     writer.rtp_packet_buffer = rav::ByteBuffer(packet_size_bytes);
@@ -106,6 +201,7 @@ bool setup_writer(
     writer.rtp_buffer.resize(rav::rtp::AudioSender::k_max_num_frames, audio_format.bytes_per_frame());
     writer.rtp_buffer.set_ground_value(audio_format.ground_value());
     writer.destinations = parameters.destinations;
+    writer.ssrc = ssrc;
     writer.id = id;
 
     return true;
@@ -123,6 +219,18 @@ void reset_writer(rav::rtp::AudioSender::Writer& writer) {
     writer.audio_format = {};
     writer.rtp_buffer = rav::rtp::Ringbuffer {};
     writer.outgoing_data.reset();
+    writer.ssrc = {};
+    writer.packet_count = {};
+    writer.octet_count = {};
+    writer.last_rtp_timestamp = {};
+    writer.last_sender_report_time_ns = {};
+    writer.rtcp_buffer.clear();
+    writer.sent_sender_reports = {};
+    writer.remote_receivers = {};
+    writer.packet_stats_counters.write({});
+    writer.send_delay_histogram.reset();
+
+    close_rtcp_sockets(writer);
 
     for (auto& socket : writer.sockets) {
         if (socket.is_open()) {
@@ -160,45 +268,226 @@ bool schedule_data_for_sending_realtime(
     rtp_buffer.clear_until(timestamp);
     rtp_buffer.write(timestamp, buffer);
 
-    const auto next_ts = rtp_buffer.get_next_ts();
+    // The number of complete packets available, which are all scheduled as one batch
+    const auto frames_available = rtp_packet.get_timestamp().diff(rtp_buffer.get_next_ts());
+    const auto num_packets = frames_available > static_cast<int32_t>(packet_time_frames)
+        ? (static_cast<uint32_t>(frames_available) - 1) / packet_time_frames
+        : 0u;
 
-    while (rtp_packet.get_timestamp() + packet_time_frames < next_ts) {
-        TRACY_ZONE_SCOPED;
+    if (num_packets == 0) {
+        return true;
+    }
 
-        rtp_buffer.read(rtp_packet.get_timestamp().value(), writer.intermediate_send_buffer.data(), size_per_packet);
+    // Schedule as many packets as fit, only the ones which don't fit are dropped. Only the consumer frees up space, so
+    // the free space seen here is available for sure.
+    const auto num_free = writer.outgoing_data.capacity() - writer.outgoing_data.size();
+    const auto slots = writer.outgoing_data.write_reserve(std::min<size_t>(num_packets, num_free));
+    if (slots.size() < num_packets) {
+        writer.num_packets_failed_to_schedule.fetch_add(num_packets - slots.size(), std::memory_order_relaxed);
+    }
 
-        writer.rtp_packet_buffer.clear();
-        rtp_packet.encode(writer.intermediate_send_buffer.data(), size_per_packet, writer.rtp_packet_buffer);
+    const auto scheduled_time_ns = rav::clock::now_monotonic_high_resolution_ns();
 
-        RAV_ASSERT_DEBUG(writer.rtp_packet_buffer.size() <= rav::aes67::constants::k_max_payload, "Packet payload overflow");
+    for (size_t i = 0; i < num_packets; ++i) {
+        TRACY_ZONE_SCOPED;
 
-        if (writer.rtp_packet_buffer.size() > rav::aes67::constants::k_max_payload) {
-            return false;
-        }
+        if (i < slots.size()) {
+            rtp_buffer.read(rtp_packet.get_timestamp().value(), writer.intermediate_send_buffer.data(), size_per_packet);
+
+            writer.rtp_packet_buffer.clear();
+            rtp_packet.encode(writer.intermediate_send_buffer.data(), size_per_packet, writer.rtp_packet_buffer);
 
-        rav::rtp::AudioSender::FifoPacket packet;
-        packet.rtp_timestamp = rtp_packet.get_timestamp().value();
-        packet.payload_size_bytes = static_cast<uint32_t>(writer.rtp_packet_buffer.size());
-        std::memcpy(packet.payload.data(), writer.rtp_packet_buffer.data(), writer.rtp_packet_buffer.size());
+            RAV_ASSERT_DEBUG(writer.rtp_packet_buffer.size() <= rav::aes67::constants::k_max_payload, "Packet payload overflow");
 
-        if (!writer.outgoing_data.push(packet)) {
-            writer.num_packets_failed_to_schedule.fetch_add(1, std::memory_order_relaxed);
+            if (writer.rtp_packet_buffer.size() > rav::aes67::constants::k_max_payload) {
+                writer.outgoing_data.commit_write(i);
+                return false;
+            }
+
+            auto& packet = slots[i];
+            packet.rtp_timestamp = rtp_packet.get_timestamp().value();
+            packet.payload_size_bytes = static_cast<uint32_t>(writer.rtp_packet_buffer.size());
+            packet.scheduled_time_ns = scheduled_time_ns;
+            std::memcpy(packet.payload.data(), writer.rtp_packet_buffer.data(), writer.rtp_packet_buffer.size());
         }
 
         rtp_packet.sequence_number_inc(1);
         rtp_packet.inc_timestamp(packet_time_frames);
     }
 
+    writer.outgoing_data.commit_write(slots.size());
+
     return true;
 }
 
+void send_rtcp_sender_report(rav::rtp::AudioSender& sender, rav::rtp::AudioSender::Writer& writer, const uint64_t now) {
+    TRACY_ZONE_SCOPED;
+
+    rav::rtcp::SenderReport report;
+    report.ssrc = writer.ssrc;
+    report.packet_count = writer.packet_count;
+    report.octet_count = writer.octet_count;
+
+    // Use the PTP timescale for the wallclock when available (AES67, RFC 7273), so that receivers locked to the same
+    // grandmaster can derive the one-way latency. Otherwise, fall back to the local wall clock which is still good for RTT.
+    // Receivers tell the two apart by whether the RTP timestamp of the report matches its wallclock on the media clock.
+    const auto& local_clock = sender.ptp_instance_subscriber.get_local_clock();
+    if (local_clock.is_locked()) {
+        const auto ptp_now = local_clock.get_adjusted_time(now);
+        report.ntp_timestamp = rav::ntp::Timestamp::from_unix_nanoseconds(ptp_now.to_nanoseconds());
+        report.rtp_timestamp = ptp_now.to_rtp_timestamp32(writer.audio_format.sample_rate);
+    } else {
+        const auto wallclock = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch());
+        report.ntp_timestamp = rav::ntp::Timestamp::from_unix_nanoseconds(static_cast<uint64_t>(wallclock.count()));
+        report.rtp_timestamp = writer.last_rtp_timestamp;
+    }
+
+    std::rotate(writer.sent_sender_reports.rbegin(), writer.sent_sender_reports.rbegin() + 1, writer.sent_sender_reports.rend());
+    writer.sent_sender_reports.front() = {report.ntp_timestamp.to_compact(), now};
+
+    writer.rtcp_buffer.clear();
+    report.encode(writer.rtcp_buffer);
+
+    for (size_t i = 0; i < writer.rtcp_sockets.size(); ++i) {
+        if (!writer.rtcp_sockets[i].is_open()) {
+            continue;
+        }
+        const rav::udp_endpoint destination(writer.destinations[i].address(), static_cast<uint16_t>(writer.destinations[i].port() + 1));
+        boost::system::error_code ec;
+        writer.rtcp_sockets[i].send_to(boost::asio::buffer(writer.rtcp_buffer.data(), writer.rtcp_buffer.size()), destination, 0, ec);
+        if (const auto error = set_error(sender, ec)) {
+            RAV_LOG_WARNING("Failed to send RTCP sender report: {}", error.message());
+        }
+    }
+}
+
+/// Returns the round trip time in nanoseconds for given report block, or nullopt when the LSR field doesn't match any of
+/// the recently sent sender reports.
+std::optional<uint64_t> get_round_trip_time(
+    const rav::rtp::AudioSender::Writer& writer, const rav::rtcp::ReportBlockView& block, const uint64_t now
+) {
+    const auto lsr = block.last_sr_timestamp().to_compact();
+    if (lsr == 0) {
+        return std::nullopt;
+    }
+    for (const auto& sent : writer.sent_sender_reports) {
+        if (sent.send_time_ns == 0 || sent.ntp_compact != lsr) {
+            continue;
+        }
+        const auto dlsr_ns = static_cast<uint64_t>(block.delay_since_last_sr()) * 1'000'000'000 >> 16;
+        const auto elapsed_ns = now - sent.send_time_ns;
+        if (dlsr_ns > elapsed_ns) {
+            return std::nullopt;  // Implausible
+        }
+        return elapsed_ns - dlsr_ns;
+    }
+    return std::nullopt;
+}
+
+void handle_rtcp_report_block(
+    rav::rtp::AudioSender::Writer& writer, const uint32_t reporter_ssrc, const rav::rtcp::ReportBlockView& block, const uint64_t now
+) {
+    rav::rtp::AudioSender::RemoteReceiver* remote = nullptr;
+    for (auto& r : writer.remote_receivers) {
+        if (r.last_report_time_ns != 0 && r.ssrc == reporter_ssrc) {
+            remote = &r;
+            break;
+        }
+    }
+    if (remote == nullptr) {
+        // Take the slot of the receiver which didn't report for the longest time
+        remote = &*std::min_element(writer.remote_receivers.begin(), writer.remote_receivers.end(), [](const auto& a, const auto& b) {
+            return a.last_report_time_ns < b.last_report_time_ns;
+        });
+        *remote = {};
+        remote->ssrc = reporter_ssrc;
+    }
+
+    remote->last_report_time_ns = now;
+
+    // The cumulative number of packets lost is a signed 24-bit value, which is negative when duplicates are received.
+    const auto lost = block.number_of_packets_lost() & 0xffffff;
+    remote->counters.dropped = lost & 0x800000 ? 0 : lost;
+
+    if (writer.audio_format.sample_rate > 0) {
+        remote->counters.jitter = static_cast<double>(block.inter_arrival_jitter()) * 1000.0 / writer.audio_format.sample_rate;
+    }
+
+    if (const auto rtt = get_round_trip_time(writer, block, now)) {
+        remote->counters.round_trip_time_ms = static_cast<double>(*rtt) / 1'000'000.0;
+        TRACY_PLOT("RTCP round trip time (ms)", remote->counters.round_trip_time_ms);
+    }
+}
+
+void read_incoming_rtcp_packets(rav::rtp::AudioSender::Writer& writer, const uint64_t now) {
+    TRACY_ZONE_SCOPED;
+
+    std::array<uint8_t, rav::aes67::constants::k_mtu> receive_buffer {};
+    bool received_report = false;
+
+    for (auto& socket : writer.rtcp_sockets) {
+        if (!socket.is_open()) {
+            continue;
+        }
+
+        while (true) {
+            boost::system::error_code ec;
+            rav::udp_endpoint src_endpoint;
+            const auto bytes_received = socket.receive_from(boost::asio::buffer(receive_buffer), src_endpoint, 0, ec);
+            if (ec || bytes_received == 0) {
+                break;  // Includes boost::asio::error::would_block
+            }
+
+            // Receiver reports for our stream can come in both RR and SR packets (when the receiver is also a sender).
+            for (auto packet = rav::rtcp::PacketView(receive_buffer.data(), bytes_received); packet.validate();
+                 packet = packet.get_next_packet()) {
+                const auto type = packet.type();
+                if (type != rav::rtcp::PacketView::PacketType::receiver_report_report
+                    && type != rav::rtcp::PacketView::PacketType::sender_report_report) {
+                    continue;
+                }
+                for (size_t i = 0; i < packet.reception_report_count(); ++i) {
+                    const auto block = packet.get_report_block(i);
+                    if (!block.validate() || block.ssrc() != writer.ssrc) {
+                        continue;
+                    }
+                    handle_rtcp_report_block(writer, packet.ssrc(), block, now);
+                    received_report = true;
+                }
+            }
+        }
+    }
+
+    if (!received_report) {
+        return;
+    }
+
+    // Publish the worst values of all receivers which reported recently
+    rav::rtp::PacketStats::Counters worst;
+    constexpr auto timeout_ns = rav::rtp::AudioSender::k_rtcp_report_interval_ms * rav::rtp::AudioSender::k_rtcp_receiver_timeout_intervals
+        * 1'000'000;
+    for (const auto& remote : writer.remote_receivers) {
+        if (remote.last_report_time_ns == 0 || remote.last_report_time_ns + timeout_ns < now) {
+            continue;
+        }
+        worst.dropped = std::max(worst.dropped, remote.counters.dropped);
+        worst.jitter = std::max(worst.jitter, remote.counters.jitter);
+        worst.round_trip_time_ms = std::max(worst.round_trip_time_ms, remote.counters.round_trip_time_ms);
+    }
+    writer.packet_stats_counters.write(worst);
+}
+
 }  // namespace
 
 rav::rtp::AudioSender::AudioSender(boost::asio::io_context& io_context) {
     for (size_t i = writers.size(); i < decltype(writers)::capacity(); i++) {
-        writers.emplace_back(generate_array<udp_socket, k_max_num_redundant_sessions>([&io_context](std::size_t) {
+        auto make_socket = [&io_context](std::size_t) {
             return udp_socket(io_context);
-        }));
+        };
+        writers.emplace_back(
+            generate_array<udp_socket, k_max_num_redundant_sessions>(make_socket),
+            generate_array<udp_socket, k_max_num_redundant_sessions>(make_socket)
+        );
     }
 }
 
@@ -228,7 +517,14 @@ bool rav::rtp::AudioSender::add_writer(const Id id, const WriterParameters& para
         }
 
         RAV_LOG_TRACE("Adding writer {}", id.value());
-        return setup_writer(writer, id, parameters, interfaces);
+        if (!setup_writer(writer, id, generate_ssrc(*this), parameters, interfaces)) {
+            return false;
+        }
+        if (rtcp_enabled) {
+            setup_rtcp_sockets(writer, interfaces);
+        }
+        writer.published_id.store(id, std::memory_order_release);
+        return true;
     }
 
     return true;
@@ -237,6 +533,13 @@ bool rav::rtp::AudioSender::add_writer(const Id id, const WriterParameters& para
 bool rav::rtp::AudioSender::remove_writer(const Id id) {
     for (auto& writer : writers) {
         if (writer.id == id) {
+            // Take the writer away from the audio thread first, and wait until it's no longer using it
+            writer.published_id.store({}, std::memory_order_release);
+            if (!realtime_epoch.synchronize()) {
+                RAV_LOG_ERROR("Failed to wait for the audio thread to release the writer");
+                return false;
+            }
+
             const auto guard = writer.rw_lock.lock_exclusive();
             if (!guard) {
                 RAV_LOG_ERROR("Failed to exclusively lock writer");
@@ -272,6 +575,10 @@ bool rav::rtp::AudioSender::set_interfaces(const ArrayOfAddresses& interfaces) {
                 RAV_LOG_ERROR("Failed to set interface: {}", ec.message());
             }
         }
+
+        if (rtcp_enabled) {
+            setup_rtcp_sockets(writer, interfaces);  // Reopening drops the memberships on the previous interfaces
+        }
     }
 
     return true;
@@ -298,25 +605,43 @@ bool rav::rtp::AudioSender::set_ttl(const Id id, const uint8_t ttl) {
     return false;
 }
 
+std::optional<rav::rtp::PacketStats::Counters> rav::rtp::AudioSender::get_packet_stats(const Id writer_id) {
+    for (auto& writer : writers) {
+        const auto guard = writer.rw_lock.try_lock_shared();
+        if (!guard) {
+            continue;
+        }
+        if (writer.id != writer_id) {
+            continue;
+        }
+        return writer.packet_stats_counters.read();
+    }
+
+    return std::nullopt;
+}
+
 void rav::rtp::AudioSender::send_outgoing_packets() {
     TRACY_ZONE_SCOPED;
 
+    const auto now = rtcp_enabled ? clock::now_monotonic_high_resolution_ns() : 0;
+
     for (auto& writer : writers) {
         const auto guard = writer.rw_lock.try_lock_shared();
         if (!guard) {
             continue;  // Exclusive locked, so it either just appeared or is about to go away.
         }
 
-        for (size_t i = 0; i < writer.outgoing_data.size(); ++i) {
-            const auto packet = writer.outgoing_data.pop();
-
-            if (!packet.has_value()) {
-                return;  // Nothing to do here
-            }
+        const auto packets = writer.outgoing_data.read_available();
+        for (size_t i = 0; i < packets.size(); ++i) {
+            const auto* packet = &packets[i];
 
             RAV_ASSERT_DEBUG(packet->payload_size_bytes <= aes67::constants::k_max_payload, "Payload size exceeds maximum");
             RAV_ASSERT_DEBUG(packet->payload_size_bytes > 0, "Packet is empty");
 
+            writer.packet_count++;
+            writer.octet_count += packet->payload_size_bytes - static_cast<uint32_t>(k_rtp_header_size);
+            writer.last_rtp_timestamp = packet->rtp_timestamp;
+
             for (size_t j = 0; j < writer.destinations.size(); j++) {
                 if (writer.destinations[j].address().is_unspecified()) {
                     continue;
@@ -335,19 +660,50 @@ void rav::rtp::AudioSender::send_outgoing_packets() {
 
                 RAV_ASSERT_DEBUG(PacketView(packet->payload.data(), packet->payload_size_bytes).validate(), "Packet validation failed");
             }
+
+            const auto sent_time_ns = clock::now_monotonic_high_resolution_ns();
+            if (sent_time_ns >= packet->scheduled_time_ns) {
+                writer.send_delay_histogram.record(sent_time_ns - packet->scheduled_time_ns);
+            }
+        }
+        writer.outgoing_data.commit_read(packets.size());
+
+        if (rtcp_enabled && writer.id.is_valid()) {
+            read_incoming_rtcp_packets(writer, now);
+
+            // Only report once packets were sent, to have a meaningful RTP timestamp
+            if (writer.packet_count > 0 && writer.last_sender_report_time_ns + k_rtcp_report_interval_ms * 1'000'000 <= now) {
+                writer.last_sender_report_time_ns = now;
+                send_rtcp_sender_report(*this, writer, now);
+            }
+        }
+    }
+}
+
+std::optional<rav::AtomicRwLock::ContentionCounters> rav::rtp::AudioSender::get_lock_contention_counters(const Id writer_id) const {
+    for (auto& writer : writers) {
+        if (writer.id == writer_id) {
+            return writer.rw_lock.get_contention_counters();
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<rav::Histogram::Snapshot> rav::rtp::AudioSender::get_send_delay_histogram(const Id writer_id) const {
+    for (auto& writer : writers) {
+        if (writer.id == writer_id) {
+            return writer.send_delay_histogram.snapshot();
         }
     }
+    return std::nullopt;
 }
 
 bool rav::rtp::AudioSender::send_data_realtime(const Id id, const BufferView<const uint8_t> buffer, const uint32_t timestamp) {
     TRACY_ZONE_SCOPED;
 
+    const auto guard = realtime_epoch.enter();
     for (auto& writer : writers) {
-        const auto guard = writer.rw_lock.lock_shared();
-        if (!guard) {
-            continue;
-        }
-        if (writer.id != id) {
+        if (writer.published_id.load(std::memory_order_acquire) != id) {
             continue;
         }
         return schedule_data_for_sending_realtime(writer, buffer, timestamp);
@@ -361,12 +717,9 @@ bool rav::rtp::AudioSender::send_audio_data_realtime(
 ) {
     TRACY_ZONE_SCOPED;
 
+    const auto guard = realtime_epoch.enter();
     for (auto& writer : writers) {
-        const auto guard = writer.rw_lock.lock_shared();
-        if (!guard) {
-            continue;
-        }
-        if (writer.id != id) {
+        if (writer.published_id.load(std::memory_order_acquire) != id) {
             continue;
         }
 
@@ -395,9 +748,9 @@ bool rav::rtp::AudioSender::send_audio_data_realtime(
             );
         }
 
+        const auto num_bytes = input_buffer.num_frames() * audio_format.bytes_per_frame();
         return schedule_data_for_sending_realtime(
-            writer, BufferView(intermediate_buffer).subview(0, input_buffer.num_frames() * audio_format.bytes_per_frame()).const_view(),
-            timestamp
+            writer, BufferView(intermediate_buffer.data(), intermediate_buffer.size()).subview(0, num_bytes).const_view(), timestamp
         );
     }
 
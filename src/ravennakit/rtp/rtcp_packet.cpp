@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/rtp/rtcp_packet.hpp"
+
+#include "ravennakit/core/assert.hpp"
+#include "ravennakit/rtp/rtcp_report_block_view.hpp"
+
+#include <algorithm>
+
+namespace {
+
+constexpr uint8_t k_packet_type_sender_report = 200;
+constexpr uint8_t k_packet_type_receiver_report = 201;
+constexpr size_t k_header_length_words = 2;  // Header including the SSRC of the sender
+constexpr size_t k_sender_info_length_words = 5;
+constexpr size_t k_report_block_length_words = rav::rtcp::ReportBlockView::k_report_block_length_length / 4;
+
+void encode_header(
+    const uint8_t packet_type, const size_t report_count, const size_t length_words, const uint32_t ssrc, rav::ByteBuffer& buffer
+) {
+    RAV_ASSERT(report_count <= rav::rtcp::k_max_num_report_blocks, "Too many report blocks");
+
+    uint8_t v_p_rc = 0;
+    v_p_rc |= 0b10000000;  // Version 2.
+    v_p_rc |= 0b00000000;  // No padding.
+    v_p_rc |= static_cast<uint8_t>(report_count) & 0b00011111;
+    buffer.write_be(v_p_rc);
+    buffer.write_be(packet_type);
+
+    // The length is encoded as the number of 32-bit words minus one
+    buffer.write_be(static_cast<uint16_t>(length_words - 1));
+    buffer.write_be(ssrc);
+}
+
+}  // namespace
+
+void rav::rtcp::ReportBlock::encode(ByteBuffer& buffer) const {
+    const auto packets_lost = std::clamp(number_of_packets_lost, -0x800000, 0x7fffff);
+    const auto packets_lost_24 = static_cast<uint32_t>(packets_lost) & 0x00ffffff;
+
+    buffer.write_be(ssrc);
+    buffer.write_be(fraction_lost);
+    buffer.write_be(static_cast<uint8_t>(packets_lost_24 >> 16));
+    buffer.write_be(static_cast<uint16_t>(packets_lost_24 & 0xffff));
+    buffer.write_be(extended_highest_sequence_number_received);
+    buffer.write_be(inter_arrival_jitter);
+    buffer.write_be(last_sr_timestamp);
+    buffer.write_be(delay_since_last_sr);
+}
+
+void rav::rtcp::SenderReport::encode(ByteBuffer& buffer) const {
+    const auto length_words = k_header_length_words + k_sender_info_length_words + report_blocks.size() * k_report_block_length_words;
+    encode_header(k_packet_type_sender_report, report_blocks.size(), length_words, ssrc, buffer);
+
+    // Sender info
+    buffer.write_be(ntp_timestamp.integer());
+    buffer.write_be(ntp_timestamp.fraction());
+    buffer.write_be(rtp_timestamp);
+    buffer.write_be(packet_count);
+    buffer.write_be(octet_count);
+
+    for (auto& block : report_blocks) {
+        block.encode(buffer);
+    }
+}
+
+void rav::rtcp::ReceiverReport::encode(ByteBuffer& buffer) const {
+    const auto length_words = k_header_length_words + report_blocks.size() * k_report_block_length_words;
+    encode_header(k_packet_type_receiver_report, report_blocks.size(), length_words, ssrc, buffer);
+
+    for (auto& block : report_blocks) {
+        block.encode(buffer);
+    }
+}
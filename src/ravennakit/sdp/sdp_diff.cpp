@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/sdp/sdp_diff.hpp"
+
+#include "ravennakit/core/string_parser.hpp"
+#include "ravennakit/sdp/detail/sdp_constants.hpp"
+#include "ravennakit/sdp/detail/sdp_source_filter.hpp"
+
+#include <optional>
+
+namespace {
+
+bool is_data_path_line(const std::string_view line) {
+    if (line.size() < 2 || line[1] != '=') {
+        return true;  // Not valid SDP, be conservative
+    }
+
+    switch (line.front()) {
+        case 'c':
+        case 'm':
+            return true;
+        case 'a': {
+            const auto attribute = line.substr(2);
+            const auto key = attribute.substr(0, attribute.find(':'));
+            return key == rav::sdp::k_sdp_rtp_map || key == rav::sdp::k_sdp_ptime || key == rav::sdp::k_sdp_framecount
+                || key == rav::sdp::SourceFilter::k_attribute_name || key == rav::sdp::k_sdp_mid || key == rav::sdp::k_sdp_group;
+        }
+        default:
+            return false;
+    }
+}
+
+/**
+ * Reads the non-empty lines of an SDP text, optionally only the ones which affect the data path.
+ */
+class LineReader {
+  public:
+    LineReader(const std::string_view text, const bool data_path_only) : parser_(text), data_path_only_(data_path_only) {}
+
+    std::optional<std::string_view> next() {
+        for (auto line = parser_.read_line(); line.has_value(); line = parser_.read_line()) {
+            if (line->empty()) {
+                continue;
+            }
+            if (data_path_only_ && !is_data_path_line(*line)) {
+                continue;
+            }
+            return line;
+        }
+        return std::nullopt;
+    }
+
+  private:
+    rav::StringParser parser_;
+    bool data_path_only_ {};
+};
+
+bool are_lines_equal(const std::string_view lhs, const std::string_view rhs, const bool data_path_only) {
+    LineReader lhs_reader(lhs, data_path_only);
+    LineReader rhs_reader(rhs, data_path_only);
+
+    while (true) {
+        const auto lhs_line = lhs_reader.next();
+        const auto rhs_line = rhs_reader.next();
+        if (lhs_line != rhs_line) {
+            return false;
+        }
+        if (!lhs_line.has_value()) {
+            return true;
+        }
+    }
+}
+
+}  // namespace
+
+const char* rav::sdp::to_string(const Difference difference) {
+    switch (difference) {
+        case Difference::none:
+            return "none";
+        case Difference::metadata:
+            return "metadata";
+        case Difference::data_path:
+            return "data_path";
+        default:
+            return "unknown";
+    }
+}
+
+rav::sdp::Difference rav::sdp::diff(const std::string_view previous_sdp_text, const std::string_view new_sdp_text) {
+    if (previous_sdp_text == new_sdp_text || are_lines_equal(previous_sdp_text, new_sdp_text, false)) {
+        return Difference::none;
+    }
+    if (are_lines_equal(previous_sdp_text, new_sdp_text, true)) {
+        return Difference::metadata;
+    }
+    return Difference::data_path;
+}
@@ -158,7 +158,7 @@ tl::expected<void, std::string> rav::sdp::MediaDescription::parse_attribute(cons
         } else {
             return tl::unexpected("media: failed to parse source-filter value");
         }
-    } else if (key == "framecount") {
+    } else if (key == k_sdp_framecount) {
         if (auto value = parser.read_int<uint16_t>()) {
             ravenna_framecount = *value;
         } else {
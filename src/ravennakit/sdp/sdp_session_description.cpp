@@ -111,7 +111,7 @@ tl::expected<void, std::string> rav::sdp::SessionDescription::parse_attribute(co
             if (!new_group.has_value()) {
                 return tl::unexpected(new_group.error());
             }
-            group = *new_group;
+            group = std::move(*new_group);
         }
     } else {
         // Store the attribute in the map of unknown attributes
@@ -149,6 +149,10 @@ tl::expected<rav::sdp::SessionDescription, std::string> rav::sdp::parse_session_
             continue;
         }
 
+        if (line->size() < 2 || (*line)[1] != '=') {
+            return tl::unexpected(fmt::format("Invalid line: {}", *line));
+        }
+
         switch (line->front()) {
             case 'v': {
                 auto result = parse_version(*line);
@@ -195,7 +199,7 @@ tl::expected<rav::sdp::SessionDescription, std::string> rav::sdp::parse_session_
                 if (!desc) {
                     return tl::unexpected(desc.error());
                 }
-                sd.media_descriptions.push_back(*desc);
+                sd.media_descriptions.push_back(std::move(*desc));
                 break;
             }
             case 'a': {
@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/async_logger.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Point {
+    int x;
+    int y;
+};
+
+/// Captures the output of the async logger for as long as it is alive.
+class CapturingSink {
+  public:
+    CapturingSink() {
+        rav::AsyncLogger::instance().flush();
+        rav::AsyncLogger::instance().set_sink([this](const LogLevel level, const std::string_view message) {
+            std::lock_guard lock(mutex_);
+            messages_.emplace_back(level, std::string(message));
+        });
+    }
+
+    ~CapturingSink() {
+        rav::AsyncLogger::instance().set_sink(nullptr);
+    }
+
+    std::vector<std::pair<LogLevel, std::string>> take() {
+        rav::AsyncLogger::instance().flush();
+        std::lock_guard lock(mutex_);
+        return std::exchange(messages_, {});
+    }
+
+  private:
+    std::mutex mutex_;
+    std::vector<std::pair<LogLevel, std::string>> messages_;
+};
+
+}  // namespace
+
+template<>
+struct fmt::formatter<Point>: fmt::formatter<std::string_view> {
+    auto format(const Point& p, fmt::format_context& ctx) const {
+        return fmt::format_to(ctx.out(), "({}, {})", p.x, p.y);
+    }
+};
+
+TEST_CASE("rav::AsyncLogger") {
+    auto& logger = rav::AsyncLogger::instance();
+
+    SECTION("Values and strings are formatted on the background thread") {
+        CapturingSink sink;
+        std::string str = "string";
+        const char* c_str = nullptr;
+        RAV_ASYNC_LOG(LogLevel::error, "{} {:.1f} {} {} {} {}", 42, 1.5, str, std::string_view("view"), c_str, 'c');
+        str = "modified";
+
+        const auto messages = sink.take();
+        REQUIRE(messages.size() == 1);
+        REQUIRE(messages[0].first == LogLevel::error);
+        REQUIRE(messages[0].second == "42 1.5 string view (null) c");
+    }
+
+    SECTION("Other types are formatted on the calling thread") {
+        CapturingSink sink;
+        RAV_ASYNC_LOG(LogLevel::critical, "Point: {}", Point {1, 2});
+
+        const auto messages = sink.take();
+        REQUIRE(messages.size() == 1);
+        REQUIRE(messages[0].first == LogLevel::critical);
+        REQUIRE(messages[0].second == "Point: (1, 2)");
+    }
+
+    SECTION("Long strings are truncated") {
+        CapturingSink sink;
+        const std::string long_string(rav::AsyncLogger::k_max_string_length * 2, 'x');
+        RAV_ASYNC_LOG(LogLevel::error, "{}", long_string);
+
+        const auto messages = sink.take();
+        REQUIRE(messages.size() == 1);
+        REQUIRE(messages[0].second == long_string.substr(0, rav::AsyncLogger::k_max_string_length));
+    }
+
+    SECTION("Messages below the log level are not logged") {
+        CapturingSink sink;
+        const auto previous_level = log_level.load();
+        log_level = LogLevel::error;
+        RAV_ASYNC_LOG(LogLevel::info, "Not logged");
+        RAV_ASYNC_LOG(LogLevel::error, "Logged");
+        log_level = previous_level;
+
+        const auto messages = sink.take();
+        REQUIRE(messages.size() == 1);
+        REQUIRE(messages[0].second == "Logged");
+    }
+
+    SECTION("Each call site is rate limited") {
+        CapturingSink sink;
+        const auto before = logger.get_counters();
+
+        constexpr uint32_t num_messages = rav::AsyncLogger::k_rate_limit_max_messages * 5;
+        for (uint32_t i = 0; i < num_messages; ++i) {
+            RAV_ASYNC_LOG(LogLevel::warning, "Rate limited {}", i);
+            RAV_ASYNC_LOG(LogLevel::warning, "Other call site {}", i);
+        }
+
+        auto messages = sink.take();
+        REQUIRE(messages.size() == rav::AsyncLogger::k_rate_limit_max_messages * 2);
+        REQUIRE(messages[0].second == "Rate limited 0");
+        REQUIRE(messages[1].second == "Other call site 0");
+
+        const auto after = logger.get_counters();
+        const auto num_suppressed = num_messages - rav::AsyncLogger::k_rate_limit_max_messages;
+        REQUIRE(after.rate_limited - before.rate_limited == num_suppressed * 2);
+        REQUIRE(after.logged - before.logged == rav::AsyncLogger::k_rate_limit_max_messages * 2);
+
+        // The next message after the window reports the number of suppressed messages.
+        std::this_thread::sleep_for(rav::AsyncLogger::k_rate_limit_window);
+        for (int i = 0; i < 2; ++i) {
+            RAV_ASYNC_LOG(LogLevel::warning, "Next window {}", i);
+        }
+        messages = sink.take();
+        REQUIRE(messages.size() == 2);
+        REQUIRE(messages[0].second == "Next window 0");
+        REQUIRE(messages[1].second == "Next window 1");
+    }
+
+    SECTION("Suppressed messages are reported with the next message of the call site") {
+        CapturingSink sink;
+        rav::AsyncLogger::CallSite site {LogLevel::warning};
+
+        for (uint32_t i = 0; i < rav::AsyncLogger::k_rate_limit_max_messages + 3; ++i) {
+            logger.log(site, "Message {}", i);
+        }
+
+        // Start a new window.
+        site.window_start_ns = 0;
+        logger.log(site, "After window");
+
+        const auto messages = sink.take();
+        REQUIRE(messages.size() == rav::AsyncLogger::k_rate_limit_max_messages + 1);
+        REQUIRE(messages.back().second == "After window (3 similar messages suppressed)");
+    }
+
+    SECTION("Errors and critical messages are not rate limited") {
+        CapturingSink sink;
+        const auto before = logger.get_counters();
+
+        constexpr uint32_t num_messages = rav::AsyncLogger::k_rate_limit_max_messages * 2;
+        for (uint32_t i = 0; i < num_messages; ++i) {
+            RAV_ASYNC_LOG(LogLevel::error, "Error {}", i);
+            RAV_ASYNC_LOG(LogLevel::critical, "Critical {}", i);
+        }
+
+        const auto messages = sink.take();
+        REQUIRE(messages.size() == num_messages * 2);
+        REQUIRE(logger.get_counters().rate_limited == before.rate_limited);
+    }
+
+    SECTION("Messages are dropped and reported when a ring is full") {
+        CapturingSink sink;
+        const auto before = logger.get_counters();
+
+        // Log from a separate thread which doesn't give the background thread a chance to drain in between.
+        std::vector<std::unique_ptr<rav::AsyncLogger::CallSite>> sites;
+        constexpr size_t num_messages = rav::AsyncLogger::k_ring_capacity / rav::AsyncLogger::k_max_string_length * 4;
+        for (size_t i = 0; i < num_messages; ++i) {
+            sites.push_back(std::make_unique<rav::AsyncLogger::CallSite>(LogLevel::error));
+        }
+
+        const std::string payload(rav::AsyncLogger::k_max_string_length, 'x');
+        std::thread thread([&] {
+            logger.prepare_thread();
+            for (auto& site : sites) {
+                logger.log(*site, "{}", payload);
+            }
+        });
+        thread.join();
+
+        const auto messages = sink.take();
+        const auto after = logger.get_counters();
+        REQUIRE(after.dropped > before.dropped);
+        REQUIRE(after.logged - before.logged + after.dropped - before.dropped == num_messages);
+
+        size_t num_received = 0;
+        bool drop_reported = false;
+        for (const auto& [level, message] : messages) {
+            if (message == payload) {
+                num_received++;
+            } else if (level == LogLevel::warning && message.find("dropped") != std::string::npos) {
+                drop_reported = true;
+            }
+        }
+        REQUIRE(num_received == after.logged - before.logged);
+        REQUIRE(drop_reported);
+    }
+
+    SECTION("Messages from multiple threads all arrive") {
+        CapturingSink sink;
+        // All threads share the call site, so stay within its rate limit.
+        constexpr int num_threads = 4;
+        constexpr int num_messages_per_thread = rav::AsyncLogger::k_rate_limit_max_messages / num_threads;
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < num_threads; ++t) {
+            threads.emplace_back([t] {
+                for (int i = 0; i < num_messages_per_thread; ++i) {
+                    RAV_ASYNC_LOG(LogLevel::error, "Thread {} message {}", t, i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        const auto messages = sink.take();
+        REQUIRE(messages.size() == num_threads * num_messages_per_thread);
+    }
+}
@@ -26,6 +26,8 @@
 #include "ravennakit/core/byte_order.hpp"
 
 #include <catch2/catch_all.hpp>
+#include <numeric>
+#include <vector>
 
 #include "ravennakit/core/util.hpp"
 
@@ -209,3 +211,69 @@ TEST_CASE("rav::ByteOrder") {
     REQUIRE(u64[6] == 0x34);
     REQUIRE(u64[7] == 0x12);
 }
+
+namespace {
+
+std::vector<uint8_t> reference_swap(const std::vector<uint8_t>& data, const size_t stride) {
+    auto result = data;
+    for (size_t i = 0; i + stride <= data.size(); i += stride) {
+        for (size_t j = 0; j < stride; ++j) {
+            result[i + j] = data[i + stride - j - 1];
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("rav::swap_bytes strided") {
+    SECTION("Sizes around the vector widths and unrolled loops, including incomplete trailing samples") {
+        for (const size_t stride : {2u, 3u, 4u, 5u, 8u}) {
+            for (size_t size = 0; size < 300; ++size) {
+                std::vector<uint8_t> data(size);
+                std::iota(data.begin(), data.end(), uint8_t {1});
+                const auto expected = reference_swap(data, stride);
+
+                // In place
+                auto swapped = data;
+                rav::swap_bytes(swapped.data(), swapped.size(), stride);
+                REQUIRE(swapped == expected);
+
+                // In place through the copying variant
+                swapped = data;
+                rav::swap_bytes_copy(swapped.data(), swapped.data(), swapped.size(), stride);
+                REQUIRE(swapped == expected);
+
+                // Copy, without writing past the end
+                swapped.assign(size + 1, 0xff);
+                rav::swap_bytes_copy(data.data(), swapped.data(), data.size(), stride);
+                REQUIRE(std::equal(expected.begin(), expected.end(), swapped.begin()));
+                REQUIRE(swapped.back() == 0xff);
+            }
+        }
+    }
+
+    SECTION("Unaligned") {
+        std::vector<uint8_t> data(1000);
+        std::iota(data.begin(), data.end(), uint8_t {0});
+        for (const size_t stride : {2u, 3u, 4u}) {
+            for (size_t offset = 1; offset < 16; ++offset) {
+                std::vector<uint8_t> src(data.begin() + static_cast<std::ptrdiff_t>(offset), data.end());
+                auto swapped = data;
+                rav::swap_bytes(swapped.data() + offset, swapped.size() - offset, stride);
+                const auto expected = reference_swap(src, stride);
+                REQUIRE(std::equal(swapped.begin() + static_cast<std::ptrdiff_t>(offset), swapped.end(), expected.begin()));
+                REQUIRE(std::equal(swapped.begin(), swapped.begin() + static_cast<std::ptrdiff_t>(offset), data.begin()));
+            }
+        }
+    }
+
+    SECTION("Stride of 1 or less") {
+        std::vector<uint8_t> data {1, 2, 3};
+        std::vector<uint8_t> copy(3);
+        rav::swap_bytes(data.data(), data.size(), 0);
+        rav::swap_bytes_copy(data.data(), copy.data(), data.size(), 1);
+        REQUIRE(data == std::vector<uint8_t> {1, 2, 3});
+        REQUIRE(copy == data);
+    }
+}
@@ -26,7 +26,10 @@
 #include <ravennakit/core/containers/fifo_buffer.hpp>
 #include <ravennakit/core/containers/detail/fifo.hpp>
 #include <ravennakit/core/log.hpp>
+#include <algorithm>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace {
 
@@ -68,6 +71,62 @@ void test_fifo_buffer_read_write() {
     REQUIRE(dst == src);
 }
 
+template<typename F>
+void test_fifo_buffer_batches() {
+    rav::FifoBuffer<int, F> buffer(4);
+    REQUIRE(buffer.capacity() == 4);
+    REQUIRE(buffer.read_available().empty());
+    REQUIRE(buffer.write_reserve(5).empty());
+    REQUIRE(buffer.write_reserve(0).empty());
+
+    auto slots = buffer.write_reserve(3);
+    REQUIRE(slots.size() == 3);
+    REQUIRE(slots.second.empty());
+    for (size_t i = 0; i < slots.size(); ++i) {
+        slots[i] = static_cast<int>(i + 1);
+    }
+
+    // Nothing is visible before committing
+    REQUIRE(buffer.read_available().empty());
+    buffer.commit_write(3);
+    REQUIRE(buffer.size() == 3);
+
+    auto available = buffer.read_available();
+    REQUIRE(available.size() == 3);
+    REQUIRE(available[0] == 1);
+    REQUIRE(available[2] == 3);
+
+    // Partial commit
+    buffer.commit_read(2);
+    REQUIRE(buffer.size() == 1);
+
+    // Wrap around
+    slots = buffer.write_reserve(3);
+    REQUIRE(slots.size() == 3);
+    REQUIRE(slots.first.size() == 1);
+    REQUIRE(slots.second.size() == 2);
+    slots[0] = 4;
+    slots[1] = 5;
+    slots[2] = 6;
+    buffer.commit_write(3);
+    REQUIRE(buffer.size() == buffer.capacity());
+    REQUIRE(buffer.write_reserve(1).empty());
+
+    available = buffer.read_available();
+    REQUIRE(available.size() == 4);
+    REQUIRE(available.first.size() == 2);
+    REQUIRE(available.second.size() == 2);
+    for (size_t i = 0; i < available.size(); ++i) {
+        REQUIRE(available[i] == static_cast<int>(i + 3));
+    }
+    buffer.commit_read(available.size());
+
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(buffer.read_available().empty());
+    buffer.commit_read(1);  // No-op on an empty buffer
+    REQUIRE(buffer.size() == 0);
+}
+
 }  // namespace
 
 TEST_CASE("rav::FifoBuffer") {
@@ -336,6 +395,234 @@ TEST_CASE("rav::FifoBuffer") {
 
         REQUIRE(total == expected_total);
     }
+
+    SECTION("Test lock-free strategies keep elements reserved until committed") {
+        rav::Fifo::Mpmc fifo;
+        fifo.resize(4);
+
+        auto first_write = fifo.prepare_for_write(2);
+        REQUIRE(first_write);
+        REQUIRE(first_write.position.index1 == 0);
+
+        // A second producer gets the next elements, while the first one is still busy
+        auto second_write = fifo.prepare_for_write(2);
+        REQUIRE(second_write);
+        REQUIRE(second_write.position.index1 == 2);
+        REQUIRE_FALSE(fifo.prepare_for_write(1));
+
+        // Nothing can be read until the first write is committed, even though the second write is
+        second_write.commit();
+        REQUIRE_FALSE(fifo.prepare_for_read(1));
+        first_write.commit();
+
+        auto read = fifo.prepare_for_read(3);
+        REQUIRE(read);
+        REQUIRE(read.position.index1 == 0);
+        REQUIRE(read.position.size1 == 3);
+
+        // Elements being read can't be written to yet
+        REQUIRE_FALSE(fifo.prepare_for_write(1));
+        read.commit();
+
+        // Wrap around
+        auto wrapping_write = fifo.prepare_for_write(3);
+        REQUIRE(wrapping_write);
+        REQUIRE(wrapping_write.position.index1 == 0);
+        REQUIRE(wrapping_write.position.size1 == 3);
+        REQUIRE(wrapping_write.position.size2 == 0);
+        REQUIRE(fifo.size() == 4);
+        wrapping_write.commit();
+
+        auto wrapping_read = fifo.prepare_for_read(4);
+        REQUIRE(wrapping_read);
+        REQUIRE(wrapping_read.position.index1 == 3);
+        REQUIRE(wrapping_read.position.size1 == 1);
+        REQUIRE(wrapping_read.position.size2 == 3);
+        wrapping_read.commit();
+        REQUIRE(fifo.size() == 0);
+    }
+
+    SECTION("Test multi producer single consumer keeps the order per producer") {
+        rav::FifoBuffer<std::pair<int, int>, rav::Fifo::Mpsc> buffer(16);
+
+        std::vector<std::thread> writers;
+        for (auto t = 0; t < num_writer_threads; t++) {
+            writers.emplace_back([&buffer, t] {
+                for (int i = 0; i < num_writes_per_thread; i++) {
+                    while (!buffer.push({t, i})) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        std::array<int, num_writer_threads> next {};
+        bool in_order = true;
+        for (int received = 0; received < num_writer_threads * num_writes_per_thread;) {
+            if (const auto* value = buffer.try_peek()) {
+                in_order &= value->second == next[static_cast<size_t>(value->first)]++;
+                buffer.consume();
+                received++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+        for (auto& t : writers) {
+            t.join();
+        }
+
+        REQUIRE(in_order);
+        REQUIRE(buffer.size() == 0);
+    }
+
+    SECTION("Test peek and consume") {
+        rav::FifoBuffer<std::string, rav::Fifo::Spsc> buffer(3);
+        REQUIRE(buffer.try_peek() == nullptr);
+        buffer.consume();  // No-op on an empty buffer
+        REQUIRE(buffer.size() == 0);
+
+        REQUIRE(buffer.push(std::string("one")));
+        REQUIRE(buffer.push(std::string("two")));
+
+        // Peeking doesn't remove the value
+        auto* value = buffer.try_peek();
+        REQUIRE(value != nullptr);
+        REQUIRE(*value == "one");
+        REQUIRE(buffer.try_peek() == value);
+        REQUIRE(buffer.size() == 2);
+
+        buffer.consume();
+        REQUIRE(buffer.size() == 1);
+        REQUIRE(*buffer.try_peek() == "two");
+
+        // Wrap around
+        REQUIRE(buffer.push(std::string("three")));
+        REQUIRE(buffer.push(std::string("four")));
+        REQUIRE_FALSE(buffer.push(std::string("five")));
+
+        for (const auto* expected : {"two", "three", "four"}) {
+            value = buffer.try_peek();
+            REQUIRE(value != nullptr);
+            REQUIRE(*value == expected);
+            buffer.consume();
+        }
+
+        REQUIRE(buffer.try_peek() == nullptr);
+        REQUIRE(buffer.size() == 0);
+    }
+
+    SECTION("Test emplace") {
+        rav::FifoBuffer<std::pair<int, std::string>, rav::Fifo::Single> buffer(2);
+        REQUIRE(buffer.emplace(1, "one"));
+        REQUIRE(buffer.emplace(2, "two"));
+        REQUIRE_FALSE(buffer.emplace(3, "three"));
+
+        auto value = buffer.pop();
+        REQUIRE(value.has_value());
+        REQUIRE(value->first == 1);
+        REQUIRE(value->second == "one");
+
+        REQUIRE(buffer.emplace(3, "three"));
+
+        value = buffer.pop();
+        REQUIRE(value.has_value());
+        REQUIRE(value->first == 2);
+        REQUIRE(value->second == "two");
+
+        value = buffer.pop();
+        REQUIRE(value.has_value());
+        REQUIRE(value->first == 3);
+        REQUIRE(value->second == "three");
+
+        REQUIRE_FALSE(buffer.pop().has_value());
+    }
+
+    SECTION("Test single producer single consumer with peek and consume") {
+        struct Packet {
+            uint64_t sequence_number {};
+            std::array<uint8_t, 1500> payload {};
+        };
+
+        rav::FifoBuffer<Packet, rav::Fifo::Spsc> buffer(16);
+
+        std::thread writer([&] {
+            for (uint64_t i = 0; i < num_writes_per_thread; i++) {
+                Packet packet;
+                packet.sequence_number = i;
+                packet.payload.fill(static_cast<uint8_t>(i));
+                while (!buffer.push(packet)) {}
+            }
+        });
+
+        uint64_t next_sequence_number = 0;
+        bool payload_intact = true;
+        while (next_sequence_number < num_writes_per_thread) {
+            const auto* packet = buffer.try_peek();
+            if (packet == nullptr) {
+                continue;
+            }
+            if (packet->sequence_number != next_sequence_number) {
+                break;
+            }
+            for (const auto byte : packet->payload) {
+                payload_intact &= byte == static_cast<uint8_t>(next_sequence_number);
+            }
+            buffer.consume();
+            next_sequence_number++;
+        }
+
+        writer.join();
+
+        REQUIRE(next_sequence_number == num_writes_per_thread);
+        REQUIRE(payload_intact);
+        REQUIRE(buffer.size() == 0);
+    }
+
+    SECTION("Test batch read and write") {
+        test_fifo_buffer_batches<rav::Fifo::Single>();
+        test_fifo_buffer_batches<rav::Fifo::Spsc>();
+    }
+
+    SECTION("Test single producer single consumer with batches") {
+        rav::FifoBuffer<uint64_t, rav::Fifo::Spsc> buffer(16);
+
+        std::thread writer([&] {
+            uint64_t next = 0;
+            while (next < num_writes_per_thread) {
+                const auto batch = std::min<uint64_t>(1 + next % 5, num_writes_per_thread - next);
+                const auto slots = buffer.write_reserve(batch);
+                if (slots.empty()) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                for (size_t i = 0; i < slots.size(); ++i) {
+                    slots[i] = next++;
+                }
+                buffer.commit_write(slots.size());
+            }
+        });
+
+        uint64_t next_expected = 0;
+        bool in_order = true;
+        while (next_expected < num_writes_per_thread && in_order) {
+            const auto available = buffer.read_available();
+            if (available.empty()) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (size_t i = 0; i < available.size(); ++i) {
+                in_order &= available[i] == next_expected++;
+            }
+            buffer.commit_read(available.size());
+        }
+
+        writer.join();
+
+        REQUIRE(in_order);
+        REQUIRE(next_expected == num_writes_per_thread);
+        REQUIRE(buffer.size() == 0);
+    }
 }
 
 static_assert(!std::is_move_constructible_v<rav::FifoBuffer<int, rav::Fifo::Single>>);
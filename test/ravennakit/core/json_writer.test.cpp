@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/json_writer.hpp"
+
+#include <boost/uuid/string_generator.hpp>
+#include <catch2/catch_all.hpp>
+
+#include <map>
+#include <vector>
+
+namespace {
+
+struct Point {
+    int x {};
+    int y {};
+    std::optional<std::string> name;
+};
+
+void tag_invoke(const rav::JsonWriteTag&, rav::JsonWriter& writer, const Point& point) {
+    writer.begin_object();
+    writer.member("x", point.x);
+    writer.member("y", point.y);
+    writer.member("name", point.name);
+    writer.end_object();
+}
+
+}  // namespace
+
+TEST_CASE("rav::JsonWriter") {
+    SECTION("Scalars") {
+        REQUIRE(rav::serialize_json(true) == "true");
+        REQUIRE(rav::serialize_json(false) == "false");
+        REQUIRE(rav::serialize_json(0) == "0");
+        REQUIRE(rav::serialize_json(-42) == "-42");
+        REQUIRE(rav::serialize_json(uint8_t {255}) == "255");
+        REQUIRE(rav::serialize_json(std::numeric_limits<int64_t>::min()) == "-9223372036854775808");
+        REQUIRE(rav::serialize_json(std::numeric_limits<uint64_t>::max()) == "18446744073709551615");
+        REQUIRE(rav::serialize_json(nullptr) == "null");
+        REQUIRE(rav::serialize_json(std::monostate {}) == "null");
+    }
+
+    SECTION("Floating point numbers are written like boost::json::serialize") {
+        REQUIRE(rav::serialize_json(0.5) == "5E-1");
+        REQUIRE(rav::serialize_json(1.5) == "1.5E0");
+        REQUIRE(rav::serialize_json(1.0) == "1E0");
+        REQUIRE(rav::serialize_json(100.0) == "1E2");
+        REQUIRE(rav::serialize_json(-123.456) == "-1.23456E2");
+        REQUIRE(rav::serialize_json(0.001) == "1E-3");
+        REQUIRE(rav::serialize_json(1.5e-7) == "1.5E-7");
+        REQUIRE(rav::serialize_json(1e22) == "1E22");
+        REQUIRE(rav::serialize_json(0.0) == "0E0");
+        REQUIRE(rav::serialize_json(-0.0) == "-0E0");
+        REQUIRE(rav::serialize_json(0.1f) == "1.0000000149011612E-1");
+        REQUIRE(rav::serialize_json(std::numeric_limits<double>::max()) == "1.7976931348623157E308");
+        REQUIRE(rav::serialize_json(std::numeric_limits<double>::denorm_min()) == "5E-324");
+        REQUIRE(rav::serialize_json(std::numeric_limits<double>::infinity()) == "1e99999");
+        REQUIRE(rav::serialize_json(-std::numeric_limits<double>::infinity()) == "-1e99999");
+        REQUIRE(rav::serialize_json(std::numeric_limits<double>::quiet_NaN()) == "null");
+
+        for (const double v : {0.5, 1.5, -123.456, 0.001, 1.5e-7, 1e22, 0.0, -0.0, 1.0 / 3.0, 48000.0, 6.02214076e23}) {
+            REQUIRE(rav::serialize_json(v) == boost::json::serialize(boost::json::value_from(v)));
+        }
+        REQUIRE(rav::serialize_json(0.1f) == boost::json::serialize(boost::json::value_from(0.1f)));
+    }
+
+    SECTION("Strings are escaped") {
+        REQUIRE(rav::serialize_json("") == R"("")");
+        REQUIRE(rav::serialize_json("abc") == R"("abc")");
+        REQUIRE(rav::serialize_json(std::string("a\"b\\c")) == R"("a\"b\\c")");
+        REQUIRE(rav::serialize_json(std::string_view("\b\f\n\r\t")) == R"("\b\f\n\r\t")");
+        REQUIRE(rav::serialize_json(std::string("\x01\x1f", 2)) == R"("\u0001\u001f")");
+        REQUIRE(rav::serialize_json(std::string("\0", 1)) == R"("\u0000")");
+        REQUIRE(rav::serialize_json("/ caf\xc3\xa9") == "\"/ caf\xc3\xa9\"");  // No escaping of solidus or UTF-8
+    }
+
+    SECTION("Optional and variant") {
+        REQUIRE(rav::serialize_json(std::optional<int>()) == "null");
+        REQUIRE(rav::serialize_json(std::optional<int>(5)) == "5");
+        REQUIRE(rav::serialize_json(std::variant<std::monostate, int, std::string>()) == "null");
+        REQUIRE(rav::serialize_json(std::variant<std::monostate, int, std::string>(5)) == "5");
+        REQUIRE(rav::serialize_json(std::variant<std::monostate, int, std::string>("5")) == R"("5")");
+    }
+
+    SECTION("Containers") {
+        REQUIRE(rav::serialize_json(std::vector<int>()) == "[]");
+        REQUIRE(rav::serialize_json(std::vector<int> {1, 2, 3}) == "[1,2,3]");
+        REQUIRE(rav::serialize_json(std::vector<std::vector<int>> {{}, {1}, {2, 3}}) == "[[],[1],[2,3]]");
+        REQUIRE(rav::serialize_json(std::array {"a/", "b/"}) == R"(["a/","b/"])");
+        REQUIRE(rav::serialize_json(std::map<std::string, int>()) == "{}");
+
+        const std::map<std::string, std::vector<std::string>> tags {{"a", {"1", "2"}}, {"b", {}}};
+        REQUIRE(rav::serialize_json(tags) == R"({"a":["1","2"],"b":[]})");
+    }
+
+    SECTION("Uuid") {
+        const auto uuid = boost::uuids::string_generator()("0123abcd-4567-89ef-0123-456789abcdef");
+        REQUIRE(rav::serialize_json(uuid) == R"("0123abcd-4567-89ef-0123-456789abcdef")");
+        REQUIRE(rav::serialize_json(boost::uuids::uuid {}) == R"("00000000-0000-0000-0000-000000000000")");
+    }
+
+    SECTION("Custom types") {
+        REQUIRE(rav::serialize_json(Point {1, 2, {}}) == R"({"x":1,"y":2,"name":null})");
+
+        const std::vector<Point> points {{1, 2, "a"}, {3, 4, {}}};
+        REQUIRE(rav::serialize_json(points) == R"([{"x":1,"y":2,"name":"a"},{"x":3,"y":4,"name":null}])");
+    }
+
+    SECTION("Objects, arrays and raw values") {
+        std::string output;
+        rav::JsonWriter writer(output);
+        writer.begin_object();
+        writer.member("a", 1);
+        writer.key("b");
+        writer.begin_array();
+        writer.raw(R"({"cached":true})");
+        writer.value("x");
+        writer.begin_object();
+        writer.end_object();
+        writer.end_array();
+        writer.key("c");
+        writer.null();
+        writer.end_object();
+
+        REQUIRE(writer.is_complete());
+        REQUIRE(output == R"({"a":1,"b":[{"cached":true},"x",{}],"c":null})");
+    }
+
+    SECTION("Appends to the output") {
+        std::string output = "[";
+        rav::serialize_json(1, output);
+        output.push_back(',');
+        rav::serialize_json("2", output);
+        output.push_back(']');
+        REQUIRE(output == R"([1,"2"])");
+
+        // Reusing the string keeps its capacity
+        const auto capacity = output.capacity();
+        output.clear();
+        rav::serialize_json(std::vector<int> {1, 2}, output);
+        REQUIRE(output == "[1,2]");
+        REQUIRE(output.capacity() == capacity);
+    }
+
+    SECTION("Matches boost::json::serialize") {
+        const std::map<std::string, std::vector<std::string>> tags {{"quote\"", {"\n", "\x7f", "caf\xc3\xa9"}}, {"empty", {}}};
+        REQUIRE(rav::serialize_json(tags) == boost::json::serialize(boost::json::value_from(tags)));
+
+        const std::vector<std::optional<int64_t>> numbers {std::nullopt, -1, std::numeric_limits<int64_t>::max()};
+        REQUIRE(rav::serialize_json(numbers) == boost::json::serialize(boost::json::value_from(numbers)));
+
+        const boost::json::value value = {{"a", 1}, {"b", boost::json::array {true, nullptr, "c"}}};
+        REQUIRE(rav::serialize_json(value) == boost::json::serialize(value));
+    }
+}
@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/math/histogram.hpp"
+#include "ravennakit/core/util.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+#include <vector>
+
+TEST_CASE("rav::Histogram") {
+    SECTION("Buckets cover all values with bounded relative error") {
+        constexpr auto max_relative_error = 1.0 / static_cast<double>(rav::Histogram::k_sub_bucket_half_count);
+
+        size_t previous_index = 0;
+        for (uint64_t value = 0; value < 1'000'000; value += 1 + value / 100) {
+            const auto index = rav::Histogram::bucket_index(value);
+            REQUIRE(index < rav::Histogram::k_num_buckets);
+            REQUIRE(index >= previous_index);
+            REQUIRE(rav::Histogram::lowest_equivalent_value(index) <= value);
+            REQUIRE(rav::Histogram::highest_equivalent_value(index) >= value);
+            const auto width = rav::Histogram::highest_equivalent_value(index) - rav::Histogram::lowest_equivalent_value(index);
+            REQUIRE(static_cast<double>(width) <= static_cast<double>(value) * max_relative_error);
+            previous_index = index;
+        }
+
+        // Adjacent buckets are contiguous.
+        for (size_t i = 1; i < rav::Histogram::k_num_buckets; ++i) {
+            REQUIRE(rav::Histogram::lowest_equivalent_value(i) == rav::Histogram::highest_equivalent_value(i - 1) + 1);
+        }
+
+        REQUIRE(rav::Histogram::bucket_index(rav::Histogram::k_max_value) == rav::Histogram::k_num_buckets - 1);
+        REQUIRE(rav::Histogram::bucket_index(UINT64_MAX) == rav::Histogram::k_num_buckets - 1);
+        REQUIRE(rav::Histogram::highest_equivalent_value(rav::Histogram::k_num_buckets - 1) == rav::Histogram::k_max_value);
+    }
+
+    SECTION("An empty histogram") {
+        const rav::Histogram histogram;
+        const auto snapshot = histogram.snapshot();
+        REQUIRE(snapshot.count() == 0);
+        REQUIRE(snapshot.min() == 0);
+        REQUIRE(snapshot.max() == 0);
+        REQUIRE(snapshot.mean() == 0.0);
+        REQUIRE(snapshot.value_at_percentile(99.0) == 0);
+    }
+
+    SECTION("Percentiles") {
+        rav::Histogram histogram;
+        for (uint64_t i = 1; i <= 100'000; ++i) {
+            histogram.record(i);
+        }
+
+        const auto snapshot = histogram.snapshot();
+        REQUIRE(snapshot.count() == 100'000);
+        REQUIRE(snapshot.min() == 1);
+        REQUIRE(snapshot.max() == 100'000);
+        REQUIRE(rav::is_within(snapshot.mean(), 50'000.5, 1e-6));
+
+        const auto tolerance = 1.0 / static_cast<double>(rav::Histogram::k_sub_bucket_half_count);
+        REQUIRE_THAT(static_cast<double>(snapshot.value_at_percentile(50.0)), Catch::Matchers::WithinRel(50'000.0, tolerance));
+        REQUIRE_THAT(static_cast<double>(snapshot.value_at_percentile(99.0)), Catch::Matchers::WithinRel(99'000.0, tolerance));
+        REQUIRE_THAT(static_cast<double>(snapshot.value_at_percentile(99.9)), Catch::Matchers::WithinRel(99'900.0, tolerance));
+        REQUIRE(snapshot.value_at_percentile(100.0) == 100'000);
+        REQUIRE(snapshot.value_at_percentile(0.0) == 1);
+    }
+
+    SECTION("A rare outlier shows in the tail") {
+        rav::Histogram histogram;
+        for (int i = 0; i < 9'999; ++i) {
+            histogram.record(1'000'000);  // 1 ms
+        }
+        histogram.record(20'000'000);  // 20 ms
+
+        const auto snapshot = histogram.snapshot();
+        REQUIRE_THAT(static_cast<double>(snapshot.value_at_percentile(99.9)), Catch::Matchers::WithinRel(1'000'000.0, 0.02));
+        REQUIRE(snapshot.value_at_percentile(100.0) == 20'000'000);
+        REQUIRE(snapshot.max() == 20'000'000);
+    }
+
+    SECTION("Values above the max are clamped") {
+        rav::Histogram histogram;
+        histogram.record(UINT64_MAX);
+        const auto snapshot = histogram.snapshot();
+        REQUIRE(snapshot.count() == 1);
+        REQUIRE(snapshot.max() == rav::Histogram::k_max_value);
+    }
+
+    SECTION("Reset") {
+        rav::Histogram histogram(2);
+        histogram.record(10, 0);
+        histogram.record(20, 1);
+        histogram.reset();
+        const auto snapshot = histogram.snapshot();
+        REQUIRE(snapshot.count() == 0);
+        REQUIRE(snapshot.max() == 0);
+        histogram.record(5, 1);
+        REQUIRE(histogram.snapshot().min() == 5);
+    }
+
+    SECTION("Shards written by different threads are merged") {
+        constexpr size_t num_threads = 4;
+        constexpr uint64_t num_values = 10'000;
+        rav::Histogram histogram(num_threads);
+        REQUIRE(histogram.num_shards() == num_threads);
+
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&histogram, t] {
+                for (uint64_t i = 0; i < num_values; ++i) {
+                    histogram.record(t * 1000 + i % 100, t);
+                }
+            });
+        }
+
+        // Reading while writing is allowed.
+        while (histogram.snapshot().count() < num_threads * num_values / 2) {
+            std::this_thread::yield();
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        const auto snapshot = histogram.snapshot();
+        REQUIRE(snapshot.count() == num_threads * num_values);
+        REQUIRE(snapshot.min() == 0);
+        REQUIRE(snapshot.max() == (num_threads - 1) * 1000 + 99);
+    }
+
+    SECTION("Merging snapshots") {
+        rav::Histogram a;
+        rav::Histogram b;
+        a.record(100);
+        b.record(200);
+        b.record(300);
+
+        auto snapshot = a.snapshot();
+        snapshot.merge(b.snapshot());
+        REQUIRE(snapshot.count() == 3);
+        REQUIRE(snapshot.min() == 100);
+        REQUIRE(snapshot.max() == 300);
+        REQUIRE(rav::is_within(snapshot.mean(), 200.0, 1e-9));
+    }
+
+    SECTION("To json") {
+        rav::Histogram histogram;
+        histogram.record(10);
+        histogram.record(10);
+        histogram.record(1000);
+
+        const auto json = boost::json::value_from(histogram.snapshot());
+        REQUIRE(json.at("count").to_number<uint64_t>() == 3);
+        REQUIRE(json.at("min").to_number<uint64_t>() == 10);
+        REQUIRE(json.at("max").to_number<uint64_t>() == 1000);
+        REQUIRE(json.at("p50").to_number<uint64_t>() == 10);
+        const auto& buckets = json.at("buckets").as_array();
+        REQUIRE(buckets.size() == 2);
+        REQUIRE(buckets[0].as_array()[0].to_number<uint64_t>() == 10);
+        REQUIRE(buckets[0].as_array()[1].to_number<uint64_t>() == 2);
+    }
+}
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <ravennakit/core/memory/arena.hpp>
+
+#include <algorithm>
+
+namespace {
+
+const rav::Arena::Usage* find_usage(const std::vector<rav::Arena::Usage>& usage, const std::string_view subsystem) {
+    const auto it = std::find_if(usage.begin(), usage.end(), [subsystem](const rav::Arena::Usage& u) {
+        return u.subsystem == subsystem;
+    });
+    return it == usage.end() ? nullptr : &*it;
+}
+
+}  // namespace
+
+TEST_CASE("rav::Arena") {
+    rav::Arena::Options options;
+    options.size = 1024 * 1024;
+    options.use_huge_pages = false;
+    options.lock_memory = false;
+
+    SECTION("Reserve region") {
+        rav::Arena arena(options);
+        const auto info = arena.get_info();
+        REQUIRE(info.capacity >= options.size);
+        REQUIRE(info.used == 0);
+        REQUIRE_FALSE(info.huge_pages);
+        REQUIRE(arena.get_usage().empty());
+    }
+
+    SECTION("Try huge pages and locking") {
+        // Whether either succeeds depends on the system, the arena must be usable regardless.
+        options.use_huge_pages = true;
+        options.lock_memory = true;
+        rav::Arena arena(options);
+        REQUIRE(arena.get_info().capacity >= options.size);
+        auto* ptr = arena.try_allocate(1000, "test");
+        REQUIRE(ptr != nullptr);
+        rav::Arena::deallocate(ptr);
+    }
+
+    SECTION("Blocks are cache line aligned and accounted per subsystem") {
+        rav::Arena arena(options);
+
+        auto* a = arena.try_allocate(1, "a");
+        auto* b = arena.try_allocate(100, "b");
+        auto* c = arena.try_allocate(1000, "a");
+        REQUIRE(a != nullptr);
+        REQUIRE(b != nullptr);
+        REQUIRE(c != nullptr);
+
+        for (const auto* ptr : {a, b, c}) {
+            REQUIRE(reinterpret_cast<uintptr_t>(ptr) % rav::Arena::k_alignment == 0);
+            REQUIRE(arena.contains(ptr));
+        }
+
+        auto usage = arena.get_usage();
+        REQUIRE(usage.size() == 2);
+        REQUIRE(find_usage(usage, "a")->allocations == 2);
+        REQUIRE(find_usage(usage, "a")->bytes >= 1001);
+        REQUIRE(find_usage(usage, "b")->allocations == 1);
+        REQUIRE(find_usage(usage, "b")->bytes >= 100);
+        REQUIRE(arena.get_info().used == find_usage(usage, "a")->bytes + find_usage(usage, "b")->bytes);
+
+        rav::Arena::deallocate(a);
+        rav::Arena::deallocate(c);
+        usage = arena.get_usage();
+        REQUIRE(find_usage(usage, "a")->allocations == 0);
+        REQUIRE(find_usage(usage, "a")->bytes == 0);
+
+        rav::Arena::deallocate(b);
+        REQUIRE(arena.get_info().used == 0);
+    }
+
+    SECTION("Freed blocks are coalesced") {
+        rav::Arena arena(options);
+        const auto capacity = arena.get_info().capacity;
+
+        std::vector<void*> blocks;
+        while (auto* ptr = arena.try_allocate(1000, "test")) {
+            blocks.push_back(ptr);
+        }
+        REQUIRE(blocks.size() > 100);
+        REQUIRE(arena.try_allocate(capacity / 2, "test") == nullptr);
+
+        // Free in an order which requires coalescing with both neighbours
+        for (size_t i = 0; i < blocks.size(); i += 2) {
+            rav::Arena::deallocate(blocks[i]);
+        }
+        for (size_t i = 1; i < blocks.size(); i += 2) {
+            rav::Arena::deallocate(blocks[i]);
+        }
+
+        REQUIRE(arena.get_info().used == 0);
+        auto* ptr = arena.try_allocate(capacity / 2, "test");
+        REQUIRE(ptr != nullptr);
+        rav::Arena::deallocate(ptr);
+    }
+
+    SECTION("ArenaVector allocates from the active scope") {
+        rav::Arena arena(options);
+
+        rav::ArenaVector<uint8_t> outside(100);
+        REQUIRE_FALSE(arena.contains(outside.data()));
+
+        rav::ArenaVector<uint8_t> inside;
+        {
+            const rav::Arena::Scope scope(arena, "vector");
+            inside.resize(10'000);
+        }
+        REQUIRE(arena.contains(inside.data()));
+        REQUIRE(reinterpret_cast<uintptr_t>(inside.data()) % rav::Arena::k_alignment == 0);
+        REQUIRE(find_usage(arena.get_usage(), "vector")->allocations == 1);
+
+        // Freeing works without a scope
+        inside = {};
+        inside.shrink_to_fit();
+        REQUIRE(find_usage(arena.get_usage(), "vector")->allocations == 0);
+        REQUIRE(arena.get_info().used == 0);
+    }
+
+    SECTION("Nested scopes") {
+        rav::Arena arena1(options);
+        rav::Arena arena2(options);
+
+        rav::ArenaVector<uint32_t> v1, v2, v3;
+        {
+            const rav::Arena::Scope scope1(arena1, "one");
+            v1.resize(10);
+            {
+                const rav::Arena::Scope scope2(arena2, "two");
+                v2.resize(10);
+            }
+            v3.resize(10);
+        }
+
+        REQUIRE(arena1.contains(v1.data()));
+        REQUIRE(arena2.contains(v2.data()));
+        REQUIRE(arena1.contains(v3.data()));
+    }
+
+    SECTION("Overflow to the heap when exhausted") {
+        rav::Arena arena(options);
+        const auto capacity = arena.get_info().capacity;
+
+        rav::ArenaVector<uint8_t> vector;
+        {
+            const rav::Arena::Scope scope(arena, "big");
+            vector.resize(capacity * 2);
+        }
+        REQUIRE_FALSE(arena.contains(vector.data()));
+
+        auto usage = find_usage(arena.get_usage(), "big");
+        REQUIRE(usage->allocations == 0);
+        REQUIRE(usage->overflow_allocations == 1);
+        REQUIRE(usage->overflow_bytes >= capacity * 2);
+
+        vector = {};
+        vector.shrink_to_fit();
+        usage = find_usage(arena.get_usage(), "big");
+        REQUIRE(usage->overflow_allocations == 0);
+        REQUIRE(usage->overflow_bytes == 0);
+    }
+
+    SECTION("Default arena") {
+        auto& arena = rav::Arena::get_default();
+        REQUIRE(&arena == &rav::Arena::get_default());
+        REQUIRE(arena.get_info().capacity >= rav::Arena::k_default_size);
+    }
+}
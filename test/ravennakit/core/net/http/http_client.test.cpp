@@ -24,6 +24,7 @@
 
 #include "ravennakit/core/json.hpp"
 #include "ravennakit/core/net/http/http_client.hpp"
+#include "ravennakit/core/net/http/http_server.hpp"
 
 #include <iostream>
 #include <catch2/catch_all.hpp>
@@ -125,4 +126,194 @@ TEST_CASE("rav::HttpClient") {
 
         REQUIRE(counter == 1);
     }
+
+    SECTION("Requests reuse a persistent connection") {
+        boost::asio::io_context io_context;
+        rav::HttpServer server(io_context);
+        REQUIRE(!server.start("127.0.0.1", 0).has_error());
+
+        server.get("/", [](const rav::HttpServer::Request&, rav::HttpServer::Response& response, rav::PathMatcher::Parameters&) {
+            response.result(boost::beast::http::status::ok);
+            response.body() = "ok";
+            response.prepare_payload();
+        });
+
+        static constexpr auto num_requests = 10;
+        int counter = 0;
+
+        rav::HttpClient client(io_context, server.get_local_endpoint());
+        for (auto i = 0; i < num_requests; ++i) {
+            client.get_async("/", [&](auto response) {
+                REQUIRE(response.has_value());
+                REQUIRE(response->result() == boost::beast::http::status::ok);
+                if (++counter == num_requests) {
+                    io_context.stop();
+                }
+            });
+        }
+
+        io_context.run();
+
+        REQUIRE(counter == num_requests);
+        REQUIRE(client.get_connection_count() == 1);
+
+        const auto& metrics = client.get_metrics();
+        REQUIRE(metrics.num_connects == 1);
+        REQUIRE(metrics.num_resolves == 1);
+        REQUIRE(metrics.num_responses == num_requests);
+        REQUIRE(metrics.num_failures == 0);
+        REQUIRE(metrics.response_time_ms.count() == num_requests);
+        REQUIRE(metrics.queue_time_ms.count() == num_requests);
+    }
+
+    SECTION("High priority requests overtake normal requests") {
+        boost::asio::io_context io_context;
+        rav::HttpServer server(io_context);
+        REQUIRE(!server.start("127.0.0.1", 0).has_error());
+
+        std::vector<std::string> received;
+        server.get(
+            "**",
+            [&received](const rav::HttpServer::Request& request, rav::HttpServer::Response& response, rav::PathMatcher::Parameters&) {
+                received.emplace_back(request.target());
+                response.result(boost::beast::http::status::ok);
+                response.prepare_payload();
+            }
+        );
+
+        static constexpr auto num_requests = 4;
+        int counter = 0;
+        auto callback = [&](auto response) {
+            REQUIRE(response.has_value());
+            if (++counter == num_requests) {
+                io_context.stop();
+            }
+        };
+
+        rav::HttpClient client(io_context, server.get_local_endpoint());
+        client.get_async("/normal/1", callback);
+        client.get_async("/normal/2", callback);
+        client.get_async("/normal/3", callback);
+        client.request_with_priority_async(
+            boost::beast::http::verb::get, "/high", {}, {}, callback, rav::HttpClientBase::Priority::high
+        );
+
+        io_context.run();
+
+        REQUIRE(counter == num_requests);
+        REQUIRE(received.size() == num_requests);
+        // The high priority request doesn't wait for the normal requests, but gets sent on an extra connection. When it
+        // arrives depends on how fast that connection is made, the normal requests arrive in order.
+        REQUIRE(std::find(received.begin(), received.end(), "/high") != received.end());
+        received.erase(std::remove(received.begin(), received.end(), "/high"), received.end());
+        REQUIRE(received == std::vector<std::string> {"/normal/1", "/normal/2", "/normal/3"});
+        REQUIRE(client.get_connection_count() == 2);  // One extra connection for the high priority request
+        REQUIRE(client.get_metrics().num_connects == 2);
+    }
+
+    SECTION("Normal requests stay in order behind a high priority request") {
+        boost::asio::io_context io_context;
+        rav::HttpServer server(io_context);
+        REQUIRE(!server.start("127.0.0.1", 0).has_error());
+
+        std::vector<std::string> received;
+        auto handler =
+            [&received](const rav::HttpServer::Request& request, rav::HttpServer::Response& response, rav::PathMatcher::Parameters&) {
+                received.emplace_back(request.target());
+                response.result(boost::beast::http::status::ok);
+                response.prepare_payload();
+            };
+        server.get("**", handler);
+        server.post("**", handler);
+
+        static constexpr auto num_posts = 8;
+        int counter = 0;
+        auto callback = [&](auto response) {
+            REQUIRE(response.has_value());
+            if (++counter == num_posts + 1) {
+                io_context.stop();
+            }
+        };
+
+        rav::HttpClient client(io_context, server.get_local_endpoint());
+        client.set_max_connections(1);
+        client.request_with_priority_async(
+            boost::beast::http::verb::get, "/heartbeat", {}, {}, callback, rav::HttpClientBase::Priority::high
+        );
+        for (auto i = 0; i < num_posts; ++i) {
+            client.post_async(fmt::format("/post/{}", i), "{}", callback, {});
+        }
+
+        io_context.run();
+
+        REQUIRE(counter == num_posts + 1);
+        REQUIRE(received.size() == num_posts + 1);
+        REQUIRE(received.front() == "/heartbeat");
+        for (auto i = 0; i < num_posts; ++i) {
+            REQUIRE(received[static_cast<size_t>(i) + 1] == fmt::format("/post/{}", i));
+        }
+        REQUIRE(client.get_connection_count() == 1);
+        REQUIRE(client.get_metrics().num_connects == 1);
+    }
+
+    SECTION("set_max_connections") {
+        boost::asio::io_context io_context;
+        rav::HttpServer server(io_context);
+        REQUIRE(!server.start("127.0.0.1", 0).has_error());
+
+        server.get("/", [](const rav::HttpServer::Request&, rav::HttpServer::Response& response, rav::PathMatcher::Parameters&) {
+            response.result(boost::beast::http::status::ok);
+            response.prepare_payload();
+        });
+
+        static constexpr auto num_requests = 8;
+        int counter = 0;
+
+        rav::HttpClient client(io_context, server.get_local_endpoint());
+        client.set_max_connections(0);  // Clamped to 1
+        client.set_max_connections(3);
+        for (auto i = 0; i < num_requests; ++i) {
+            client.get_async("/", [&](auto response) {
+                REQUIRE(response.has_value());
+                if (++counter == num_requests) {
+                    io_context.stop();
+                }
+            });
+        }
+        REQUIRE(client.get_connection_count() == 3);
+
+        io_context.run();
+
+        REQUIRE(counter == num_requests);
+        REQUIRE(client.get_connection_count() == 3);
+        REQUIRE(client.get_metrics().num_connects <= 3);
+        REQUIRE(client.get_metrics().num_resolves <= 3);
+        REQUIRE(client.get_metrics().num_responses == num_requests);
+    }
+
+    SECTION("Connection failures are reported to the request") {
+        boost::asio::io_context io_context;
+
+        // Find a port nobody listens on
+        boost::asio::ip::tcp::acceptor acceptor(io_context, {boost::asio::ip::make_address("127.0.0.1"), 0});
+        const auto endpoint = acceptor.local_endpoint();
+        acceptor.close();
+
+        int errors = 0;
+        rav::HttpClient client(io_context, endpoint);
+        client.get_async("/", [&errors](auto response) {
+            REQUIRE(response.has_error());
+            errors++;
+        });
+        client.get_async("/", [&errors](auto response) {
+            REQUIRE(response.has_error());
+            errors++;
+        });
+
+        io_context.run();
+
+        REQUIRE(errors == 2);
+        REQUIRE(client.get_metrics().num_failures == 2);
+        REQUIRE(client.get_metrics().num_responses == 0);
+    }
 }
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/net/http/http_router.hpp"
+
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+using Handler = std::function<int()>;
+using verb = boost::beast::http::verb;
+
+Handler make_handler(const int id) {
+    return [id] {
+        return id;
+    };
+}
+
+int match(rav::HttpRouter<Handler>& router, const verb method, const std::string_view path, rav::PathMatcher::Parameters* params = nullptr) {
+    auto* handler = router.match(method, path, params);
+    return handler != nullptr ? (*handler)() : 0;
+}
+
+}  // namespace
+
+TEST_CASE("rav::HttpRouter") {
+    SECTION("Static routes") {
+        rav::HttpRouter<Handler> router;
+        router.insert(verb::get, "/", make_handler(1));
+        router.insert(verb::get, "/x-nmos", make_handler(2));
+        router.insert(verb::get, "/x-nmos/node", make_handler(3));
+        router.insert(verb::post, "/x-nmos/node", make_handler(4));
+
+        REQUIRE(match(router, verb::get, "/") == 1);
+        REQUIRE(match(router, verb::get, "/x-nmos") == 2);
+        REQUIRE(match(router, verb::get, "/x-nmos/") == 2);
+        REQUIRE(match(router, verb::get, "/x-nmos/node") == 3);
+        REQUIRE(match(router, verb::post, "/x-nmos/node") == 4);
+        REQUIRE(match(router, verb::patch, "/x-nmos/node") == 0);
+        REQUIRE(match(router, verb::get, "/x-nmos/nod") == 0);
+        REQUIRE(match(router, verb::get, "/x-nmos/node/extra") == 0);
+        REQUIRE(match(router, verb::get, "") == 0);
+    }
+
+    SECTION("Existing route is updated") {
+        rav::HttpRouter<Handler> router;
+        router.insert(verb::get, "/a/{id}", make_handler(1));
+        router.insert(verb::get, "/a/{id}", make_handler(2));
+        REQUIRE(match(router, verb::get, "/a/5") == 2);
+    }
+
+    SECTION("Parameters") {
+        rav::HttpRouter<Handler> router;
+        router.insert(verb::get, "/x-nmos/node/{version}/devices/{device_id}", make_handler(1));
+        router.insert(verb::get, "/x-nmos/node/{version}/devices", make_handler(2));
+        router.insert(verb::get, "/files/v{version}.json", make_handler(3));
+
+        rav::PathMatcher::Parameters params;
+        REQUIRE(match(router, verb::get, "/x-nmos/node/v1.3/devices/abc", &params) == 1);
+        REQUIRE(params.get_all().size() == 2);
+        REQUIRE(*params.get("version") == "v1.3");
+        REQUIRE(*params.get("device_id") == "abc");
+
+        params.clear();
+        REQUIRE(match(router, verb::get, "/x-nmos/node/v1.2/devices", &params) == 2);
+        REQUIRE(params.get_all().size() == 1);
+        REQUIRE(*params.get("version") == "v1.2");
+
+        params.clear();
+        REQUIRE(match(router, verb::get, "/files/v42.json", &params) == 3);
+        REQUIRE(*params.get_as<int>("version") == 42);
+        REQUIRE(match(router, verb::get, "/files/42.json") == 0);
+        REQUIRE(match(router, verb::get, "/files/v42.txt") == 0);
+
+        // Matching without parameters is allowed
+        REQUIRE(match(router, verb::get, "/x-nmos/node/v1.3/devices/abc") == 1);
+    }
+
+    SECTION("Precedence") {
+        rav::HttpRouter<Handler> router;
+        router.insert(verb::get, "/**", make_handler(1));
+        router.insert(verb::get, "/a/*", make_handler(2));
+        router.insert(verb::get, "/a/{id}", make_handler(3));
+        router.insert(verb::get, "/a/b", make_handler(4));
+        router.insert(verb::get, "/a/b/**", make_handler(5));
+
+        REQUIRE(match(router, verb::get, "/a/b") == 4);
+        REQUIRE(match(router, verb::get, "/a/c") == 3);
+        REQUIRE(match(router, verb::get, "/a/b/c/d") == 5);
+        REQUIRE(match(router, verb::get, "/a/c/d") == 1);
+        REQUIRE(match(router, verb::get, "/") == 1);
+        REQUIRE(match(router, verb::get, "/z") == 1);
+    }
+
+    SECTION("Backtracking discards parameters of failed branches") {
+        rav::HttpRouter<Handler> router;
+        router.insert(verb::get, "/a/{first}/x", make_handler(1));
+        router.insert(verb::get, "/a/*/y", make_handler(2));
+
+        rav::PathMatcher::Parameters params;
+        REQUIRE(match(router, verb::get, "/a/b/y", &params) == 2);
+        REQUIRE(params.empty());
+    }
+
+    SECTION("Method without a route falls back to other branches") {
+        rav::HttpRouter<Handler> router;
+        router.insert(verb::post, "/a/b", make_handler(1));
+        router.insert(verb::get, "/a/{id}", make_handler(2));
+        REQUIRE(match(router, verb::get, "/a/b") == 2);
+        REQUIRE(match(router, verb::post, "/a/b") == 1);
+    }
+
+    SECTION("Agrees with PathMatcher") {
+        const std::vector<std::string_view> patterns {
+            "/user/{id}", "/user/{id}/items/{item}", "/user/*/profile", "/files/**", "/user/{name}.json",
+        };
+        const std::vector<std::string_view> paths {
+            "/user/5",        "/user/5/",          "/user/5/items/6", "/user/5/profile", "/files",
+            "/files/a/b/c",   "/user/john.json",   "/user",           "/user/5/items",   "/other",
+        };
+
+        for (const auto& pattern : patterns) {
+            rav::HttpRouter<Handler> router;
+            router.insert(verb::get, pattern, make_handler(1));
+
+            for (const auto& path : paths) {
+                rav::PathMatcher::Parameters expected_params;
+                const auto expected = rav::PathMatcher::match(path, pattern, &expected_params).value();
+                rav::PathMatcher::Parameters params;
+                INFO(pattern << " " << path);
+                REQUIRE((match(router, verb::get, path, &params) == 1) == expected);
+                if (expected) {
+                    // PathMatcher leaves partial parameters behind when it fails, so only compare on a match
+                    REQUIRE(params.get_all() == expected_params.get_all());
+                }
+            }
+        }
+    }
+}
@@ -25,6 +25,7 @@
 #include "ravennakit/core/net/http/http_server.hpp"
 #include "ravennakit/core/net/http/http_client.hpp"
 
+#include <boost/beast/websocket.hpp>
 #include <catch2/catch_all.hpp>
 
 TEST_CASE("rav::HttpServer") {
@@ -118,4 +119,130 @@ TEST_CASE("rav::HttpServer") {
 
         io_context.run();
     }
+
+    SECTION("WebSocket upgrade") {
+        boost::asio::io_context io_context;
+        rav::HttpServer server(io_context);
+        const auto start_result = server.start("127.0.0.1", 0);
+        REQUIRE(!start_result.has_error());
+        const auto endpoint = server.get_local_endpoint();
+
+        std::shared_ptr<rav::HttpServer::WebSocketConnection> connection;
+        bool connection_closed = false;
+
+        server.websocket(
+            "/ws/{name}",
+            [&](const rav::HttpServer::Request&, std::shared_ptr<rav::HttpServer::WebSocketConnection> conn,
+                rav::PathMatcher::Parameters& params) {
+                const auto* name = params.get("name");
+                REQUIRE(name != nullptr);
+                conn->send(fmt::format("hello {}", *name));
+                conn->send("second");
+                conn->on_close = [&connection_closed] {
+                    connection_closed = true;
+                };
+                connection = std::move(conn);
+            }
+        );
+
+        boost::beast::websocket::stream<boost::asio::ip::tcp::socket> client(io_context);
+        boost::beast::flat_buffer buffer;
+        std::vector<std::string> received;
+
+        client.next_layer().async_connect(endpoint, [&](const boost::system::error_code& ec) {
+            REQUIRE_FALSE(ec);
+            client.async_handshake("127.0.0.1", "/ws/client", [&](const boost::system::error_code& handshake_ec) {
+                REQUIRE_FALSE(handshake_ec);
+                client.async_read(buffer, [&](const boost::system::error_code& read_ec, size_t) {
+                    REQUIRE_FALSE(read_ec);
+                    received.push_back(boost::beast::buffers_to_string(buffer.data()));
+                    buffer.consume(buffer.size());
+                    client.async_read(buffer, [&](const boost::system::error_code& read_ec2, size_t) {
+                        REQUIRE_FALSE(read_ec2);
+                        received.push_back(boost::beast::buffers_to_string(buffer.data()));
+                        client.async_close(boost::beast::websocket::close_code::normal, [&](const boost::system::error_code&) {});
+                    });
+                });
+            });
+        });
+
+        io_context.run_for(std::chrono::seconds(5));
+
+        REQUIRE(received == std::vector<std::string> {"hello client", "second"});
+        REQUIRE(connection_closed);
+        REQUIRE(connection != nullptr);
+        REQUIRE_FALSE(connection->is_open());
+        REQUIRE(server.get_websocket_count() == 0);
+    }
+
+    SECTION("Worker threads") {
+        boost::asio::io_context io_context;
+        rav::HttpServer server(io_context);
+
+        const auto io_thread_id = std::this_thread::get_id();
+        std::atomic<int> handler_calls_off_io_thread {0};
+
+        server.get(
+            "/echo/{value}",
+            [&](const rav::HttpServer::Request&, rav::HttpServer::Response& response, rav::PathMatcher::Parameters& params) {
+                if (std::this_thread::get_id() != io_thread_id) {
+                    ++handler_calls_off_io_thread;
+                }
+                response.result(boost::beast::http::status::ok);
+                response.body() = std::string(*params.get("value"));
+                response.prepare_payload();
+            }
+        );
+
+        server.set_worker_threads(2);
+        const auto start_result = server.start("127.0.0.1", 0);
+        REQUIRE(!start_result.has_error());
+        REQUIRE(server.get_worker_threads() == 2);
+        const auto endpoint = server.get_local_endpoint();
+
+        // Synchronous clients on their own threads, the io_context is run by this thread
+        constexpr int k_num_clients = 4;
+        constexpr int k_num_requests = 25;
+        std::atomic<int> num_ok {0};
+        std::vector<std::thread> clients;
+        for (int c = 0; c < k_num_clients; ++c) {
+            clients.emplace_back([&endpoint, &num_ok, c] {
+                boost::asio::io_context client_context;
+                boost::beast::tcp_stream stream(client_context);
+                boost::system::error_code ec;
+                stream.connect(endpoint, ec);
+                if (ec) {
+                    return;
+                }
+                for (int i = 0; i < k_num_requests; ++i) {
+                    const auto value = fmt::format("{}-{}", c, i);
+                    rav::HttpServer::Request request {boost::beast::http::verb::get, "/echo/" + value, 11};
+                    request.set(boost::beast::http::field::host, "127.0.0.1");
+                    boost::beast::http::write(stream, request, ec);
+                    boost::beast::flat_buffer buffer;
+                    rav::HttpServer::Response response;
+                    boost::beast::http::read(stream, buffer, response, ec);
+                    if (!ec && response.result() == boost::beast::http::status::ok && response.body() == value) {
+                        ++num_ok;
+                    }
+                }
+            });
+        }
+
+        const auto work_guard = boost::asio::make_work_guard(io_context);
+        for (int i = 0; i < 500 && num_ok < k_num_clients * k_num_requests; ++i) {
+            io_context.run_for(std::chrono::milliseconds(10));
+        }
+
+        for (auto& client : clients) {
+            client.join();
+        }
+
+        REQUIRE(num_ok == k_num_clients * k_num_requests);
+        REQUIRE(handler_calls_off_io_thread == 0);
+
+        server.stop();
+        REQUIRE(server.get_worker_threads() == 0);
+        REQUIRE(server.get_client_count() == 0);
+    }
 }
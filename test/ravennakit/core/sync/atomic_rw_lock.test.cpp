@@ -226,4 +226,32 @@ TEST_CASE("rav::AtomicRwLock") {
 
         REQUIRE_FALSE(failure);
     }
+    SECTION("Failed lock attempts are counted") {
+        rav::AtomicRwLock lock;
+        REQUIRE(lock.get_contention_counters().failed_shared_locks == 0);
+        REQUIRE(lock.get_contention_counters().failed_exclusive_locks == 0);
+
+        {
+            const auto guard = lock.try_lock_exclusive();
+            REQUIRE(guard);
+            REQUIRE_FALSE(lock.try_lock_shared());
+            REQUIRE_FALSE(lock.try_lock_shared());
+            REQUIRE_FALSE(lock.try_lock_exclusive());
+        }
+
+        auto counters = lock.get_contention_counters();
+        REQUIRE(counters.failed_shared_locks == 2);
+        REQUIRE(counters.failed_exclusive_locks == 1);
+
+        {
+            const auto guard = lock.try_lock_shared();
+            REQUIRE(guard);
+            REQUIRE_FALSE(lock.try_lock_exclusive());
+            REQUIRE(lock.try_lock_shared());
+        }
+
+        counters = lock.get_contention_counters();
+        REQUIRE(counters.failed_shared_locks == 2);
+        REQUIRE(counters.failed_exclusive_locks == 2);
+    }
 }
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/sync/epoch.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+static_assert(!std::is_copy_constructible_v<rav::Epoch>);
+static_assert(!std::is_move_constructible_v<rav::Epoch>);
+static_assert(!std::is_copy_assignable_v<rav::Epoch>);
+static_assert(!std::is_move_assignable_v<rav::Epoch>);
+
+TEST_CASE("rav::Epoch") {
+    SECTION("Test basic operation") {
+        rav::Epoch epoch;
+        REQUIRE_FALSE(epoch.has_readers());
+        REQUIRE(epoch.generation() == 0);
+
+        {
+            const auto guard = epoch.enter();
+            REQUIRE(epoch.has_readers());
+
+            const auto nested_guard = epoch.enter();
+            REQUIRE(epoch.has_readers());
+        }
+
+        REQUIRE_FALSE(epoch.has_readers());
+        REQUIRE(epoch.synchronize());
+        REQUIRE(epoch.generation() == 2);
+    }
+
+    SECTION("Moving a guard keeps the read section open") {
+        rav::Epoch epoch;
+        std::optional<rav::Epoch::ReadGuard> outer;
+
+        {
+            auto guard = epoch.enter();
+            outer.emplace(std::move(guard));
+        }
+
+        REQUIRE(epoch.has_readers());
+        outer.reset();
+        REQUIRE_FALSE(epoch.has_readers());
+    }
+
+    SECTION("Synchronize waits for readers which entered before") {
+        rav::Epoch epoch;
+        std::atomic reader_entered {false};
+        std::atomic release_reader {false};
+        std::atomic reader_left {false};
+
+        std::thread reader([&] {
+            const auto guard = epoch.enter();
+            reader_entered = true;
+            while (!release_reader) {
+                std::this_thread::yield();
+            }
+            reader_left = true;
+        });
+
+        while (!reader_entered) {
+            std::this_thread::yield();
+        }
+
+        std::thread releaser([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            release_reader = true;
+        });
+
+        REQUIRE(epoch.synchronize());
+        REQUIRE(reader_left);
+
+        reader.join();
+        releaser.join();
+    }
+
+    SECTION("Readers never see retired state") {
+        static constexpr size_t k_num_updates = 1'000;
+        static constexpr size_t k_num_readers = 4;
+
+        struct State {
+            std::atomic<bool> retired {false};
+        };
+
+        rav::Epoch epoch;
+        std::atomic<State*> published {new State()};
+        std::atomic stop {false};
+        std::atomic failure {false};
+
+        std::vector<std::thread> readers;
+        for (size_t i = 0; i < k_num_readers; ++i) {
+            readers.emplace_back([&] {
+                while (!stop) {
+                    const auto guard = epoch.enter();
+                    const auto* state = published.load(std::memory_order_acquire);
+                    std::this_thread::yield();
+                    if (state->retired.load()) {
+                        failure = true;
+                    }
+                }
+            });
+        }
+
+        for (size_t i = 0; i < k_num_updates; ++i) {
+            auto* previous = published.exchange(new State(), std::memory_order_acq_rel);
+            REQUIRE(epoch.synchronize());
+            previous->retired = true;
+            delete previous;
+        }
+
+        stop = true;
+        for (auto& reader : readers) {
+            reader.join();
+        }
+
+        delete published.load();
+        REQUIRE_FALSE(failure);
+    }
+}
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/sync/multi_version_realtime_shared_object.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+static_assert(!std::is_copy_constructible_v<rav::MultiVersionRealtimeSharedObject<int>>);
+static_assert(!std::is_move_constructible_v<rav::MultiVersionRealtimeSharedObject<int>>);
+static_assert(!std::is_copy_assignable_v<rav::MultiVersionRealtimeSharedObject<int>>);
+static_assert(!std::is_move_assignable_v<rav::MultiVersionRealtimeSharedObject<int>>);
+
+static_assert(!std::is_copy_constructible_v<rav::MultiVersionRealtimeSharedObject<int>::RealtimeAccessGuard>);
+static_assert(!std::is_move_constructible_v<rav::MultiVersionRealtimeSharedObject<int>::RealtimeAccessGuard>);
+
+TEST_CASE("rav::MultiVersionRealtimeSharedObject") {
+    SECTION("Default state") {
+        rav::MultiVersionRealtimeSharedObject<std::string> obj;
+        const auto guard = obj.access_realtime();
+        REQUIRE(guard.get() != nullptr);
+        REQUIRE(guard->empty());
+    }
+
+    SECTION("Initial value") {
+        rav::MultiVersionRealtimeSharedObject<std::string> obj("A");
+        const auto guard = obj.access_realtime();
+        REQUIRE(*guard == "A");
+    }
+
+    SECTION("Updates don't wait for readers, which keep seeing the version they started with") {
+        rav::MultiVersionRealtimeSharedObject<std::string> obj("A");
+
+        auto guard_a = obj.access_realtime();
+        REQUIRE(obj.update("B"));
+        auto guard_b = obj.access_realtime();
+        REQUIRE(obj.update("C"));
+        auto guard_c = obj.access_realtime();
+
+        REQUIRE(*guard_a == "A");
+        REQUIRE(*guard_b == "B");
+        REQUIRE(*guard_c == "C");
+
+        // All versions other than the current one are in use
+        REQUIRE(obj.reclaim() == 2);
+        REQUIRE(obj.update("D"));
+        REQUIRE_FALSE(obj.update("E"));
+
+        guard_a.reset();
+        REQUIRE(guard_a.get() == nullptr);
+        REQUIRE(obj.update("E"));
+
+        const auto guard_e = obj.access_realtime();
+        REQUIRE(*guard_e == "E");
+        REQUIRE(*guard_b == "B");
+    }
+
+    SECTION("Multiple readers can access the same version") {
+        rav::MultiVersionRealtimeSharedObject<int> obj(1);
+        const auto guard1 = obj.access_realtime();
+        const auto guard2 = obj.access_realtime();
+        REQUIRE(guard1.get() == guard2.get());
+        REQUIRE(*guard1 == 1);
+    }
+
+    SECTION("Retired values are destroyed once no longer read") {
+        auto value = std::make_shared<int>(1);
+        std::weak_ptr<int> weak_value = value;
+
+        rav::MultiVersionRealtimeSharedObject<std::shared_ptr<int>> obj(std::move(value));
+
+        {
+            const auto guard = obj.access_realtime();
+            REQUIRE(obj.update(std::make_shared<int>(2)));
+            REQUIRE(obj.reclaim() == 1);
+            REQUIRE_FALSE(weak_value.expired());
+            REQUIRE(**guard == 1);
+        }
+
+        REQUIRE(obj.reclaim() == 0);
+        REQUIRE(weak_value.expired());
+    }
+
+    SECTION("Reset") {
+        rav::MultiVersionRealtimeSharedObject<std::string> obj("A");
+        REQUIRE(obj.reset());
+        REQUIRE(obj.access_realtime()->empty());
+    }
+
+    SECTION("Updating and reading from multiple threads should be thread safe") {
+        static constexpr size_t k_num_readers = 3;
+        static constexpr size_t k_num_updates = 10'000;
+
+        // Every value is a pair of a number and its string representation, which must always be consistent
+        rav::MultiVersionRealtimeSharedObject<std::pair<size_t, std::string>, k_num_readers + 2> obj(std::make_pair(0, "0"));
+
+        std::atomic keep_going {true};
+        std::vector<std::future<bool>> readers;
+        for (size_t i = 0; i < k_num_readers; ++i) {
+            readers.emplace_back(std::async(std::launch::async, [&obj, &keep_going] {
+                size_t previous = 0;
+                while (keep_going) {
+                    const auto guard = obj.access_realtime();
+                    if (guard->second != std::to_string(guard->first) || guard->first < previous) {
+                        return false;
+                    }
+                    previous = guard->first;
+                }
+                return true;
+            }));
+        }
+
+        for (size_t i = 1; i <= k_num_updates; ++i) {
+            while (!obj.update(std::make_pair(i, std::to_string(i)))) {
+                std::this_thread::yield();
+            }
+        }
+
+        keep_going = false;
+        for (auto& reader : readers) {
+            REQUIRE(reader.get());
+        }
+
+        REQUIRE(obj.access_realtime()->first == k_num_updates);
+    }
+}
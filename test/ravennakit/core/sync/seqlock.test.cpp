@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/sync/seqlock.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+
+static_assert(!std::is_copy_constructible_v<rav::SeqLock<int>>);
+static_assert(!std::is_move_constructible_v<rav::SeqLock<int>>);
+
+namespace {
+
+struct Values {
+    uint64_t a {};
+    uint64_t b {};
+    uint32_t c {};
+};
+
+}  // namespace
+
+TEST_CASE("rav::SeqLock") {
+    SECTION("Default value") {
+        const rav::SeqLock<Values> lock;
+        const auto value = lock.read();
+        REQUIRE(value.has_value());
+        REQUIRE(value->a == 0);
+        REQUIRE(value->b == 0);
+        REQUIRE(value->c == 0);
+    }
+
+    SECTION("Write and read") {
+        rav::SeqLock<Values> lock;
+        lock.write({1, 2, 3});
+        auto value = lock.read();
+        REQUIRE(value.has_value());
+        REQUIRE(value->a == 1);
+        REQUIRE(value->b == 2);
+        REQUIRE(value->c == 3);
+
+        // Reading doesn't consume the value
+        value = lock.read();
+        REQUIRE(value.has_value());
+        REQUIRE(value->a == 1);
+    }
+
+    SECTION("Read if changed") {
+        rav::SeqLock<Values> lock;
+        uint32_t last_sequence = 0;
+        REQUIRE(lock.read_if_changed(last_sequence).has_value());  // The initial value
+        REQUIRE_FALSE(lock.read_if_changed(last_sequence).has_value());
+
+        lock.write({1, 2, 3});
+        const auto value = lock.read_if_changed(last_sequence);
+        REQUIRE(value.has_value());
+        REQUIRE(value->a == 1);
+        REQUIRE_FALSE(lock.read_if_changed(last_sequence).has_value());
+
+        // Writing the same value again is an update as well
+        lock.write({1, 2, 3});
+        REQUIRE(lock.read_if_changed(last_sequence).has_value());
+
+        // Each reader keeps track of its own sequence
+        uint32_t other_sequence = 0;
+        REQUIRE(lock.read_if_changed(other_sequence).has_value());
+        REQUIRE_FALSE(lock.read_if_changed(last_sequence).has_value());
+    }
+
+    SECTION("Values which are not a multiple of 8 bytes") {
+        rav::SeqLock<uint8_t> lock;
+        lock.write(42);
+        REQUIRE(lock.read() == 42);
+    }
+
+    SECTION("Readers never observe a torn value") {
+        rav::SeqLock<Values> lock;
+        std::atomic_bool keep_going {true};
+
+        std::thread writer([&] {
+            for (uint64_t i = 1; keep_going.load(std::memory_order_relaxed); ++i) {
+                lock.write({i, i, static_cast<uint32_t>(i)});
+            }
+        });
+
+        size_t num_reads = 0;
+        for (size_t i = 0; i < 100'000; ++i) {
+            if (const auto value = lock.read()) {
+                REQUIRE(value->a == value->b);
+                REQUIRE(static_cast<uint32_t>(value->a) == value->c);
+                num_reads++;
+            }
+        }
+
+        keep_going = false;
+        writer.join();
+
+        REQUIRE(num_reads > 0);
+    }
+}
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/util/tracer.hpp"
+#include "ravennakit/core/json.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Enables the tracer for as long as it is alive, starting from a clean state.
+class ScopedTracing {
+  public:
+    ScopedTracing() {
+        rav::Tracer::clear();
+        rav::Tracer::set_enabled(true);
+    }
+
+    ~ScopedTracing() {
+        rav::Tracer::set_enabled(false);
+        rav::Tracer::clear();
+    }
+};
+
+std::vector<rav::Tracer::Event> events_of_this_thread(const char* marker) {
+    // Find the thread id by looking for the marker.
+    const auto events = rav::Tracer::get_events();
+    uint32_t thread_id = 0;
+    for (const auto& event : events) {
+        if (event.name == marker) {
+            thread_id = event.thread_id;
+        }
+    }
+    std::vector<rav::Tracer::Event> result;
+    for (const auto& event : events) {
+        if (event.thread_id == thread_id) {
+            result.push_back(event);
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("rav::Tracer") {
+    SECTION("Nothing is recorded when disabled") {
+        rav::Tracer::set_enabled(false);
+        rav::Tracer::clear();
+        {
+            RAV_TRACE_ZONE("zone");
+            RAV_TRACE_PLOT("plot", 1.0);
+            RAV_TRACE_MESSAGE("message");
+        }
+        REQUIRE(rav::Tracer::get_events().empty());
+    }
+
+    SECTION("Plot and counter values are only evaluated when enabled") {
+        rav::Tracer::set_enabled(false);
+        int evaluations = 0;
+        const auto value = [&evaluations] {
+            return ++evaluations;
+        };
+        RAV_TRACE_PLOT("plot", value());
+        RAV_TRACE_COUNTER("counter", value());
+        REQUIRE(evaluations == 0);
+
+        ScopedTracing tracing;
+        RAV_TRACE_PLOT("plot", value());
+        RAV_TRACE_COUNTER("counter", value());
+        REQUIRE(evaluations == 2);
+    }
+
+    SECTION("Zones, plots, counters and messages") {
+        ScopedTracing tracing;
+        static constexpr auto k_marker = "marker";
+        {
+            RAV_TRACE_ZONE("outer");
+            RAV_TRACE_PLOT("plot", 1.5);
+            {
+                RAV_TRACE_ZONE("inner");
+                RAV_TRACE_COUNTER("counter", -3);
+            }
+            RAV_TRACE_MESSAGE(k_marker);
+        }
+
+        const auto events = events_of_this_thread(k_marker);
+        REQUIRE(events.size() == 7);
+        REQUIRE(events[0].type == rav::Tracer::EventType::zone_begin);
+        REQUIRE(std::string(events[0].name) == "outer");
+        REQUIRE(events[1].type == rav::Tracer::EventType::plot);
+        REQUIRE(events[1].value == 1.5);
+        REQUIRE(events[2].type == rav::Tracer::EventType::zone_begin);
+        REQUIRE(std::string(events[2].name) == "inner");
+        REQUIRE(events[3].type == rav::Tracer::EventType::counter);
+        REQUIRE(events[3].value == -3.0);
+        REQUIRE(events[4].type == rav::Tracer::EventType::zone_end);
+        REQUIRE(std::string(events[4].name) == "inner");
+        REQUIRE(events[5].type == rav::Tracer::EventType::message);
+        REQUIRE(events[6].type == rav::Tracer::EventType::zone_end);
+        REQUIRE(std::string(events[6].name) == "outer");
+
+        for (size_t i = 1; i < events.size(); ++i) {
+            REQUIRE(events[i].timestamp_ns >= events[i - 1].timestamp_ns);
+        }
+    }
+
+    SECTION("A zone which started while disabled doesn't record its end") {
+        rav::Tracer::clear();
+        rav::Tracer::set_enabled(false);
+        {
+            RAV_TRACE_ZONE("zone");
+            rav::Tracer::set_enabled(true);
+        }
+        REQUIRE(rav::Tracer::get_events().empty());
+        rav::Tracer::set_enabled(false);
+    }
+
+    SECTION("The ring keeps the most recent events") {
+        ScopedTracing tracing;
+        static constexpr auto k_marker = "marker";
+        const auto num_events = rav::Tracer::k_events_per_thread * 2 + 10;
+        for (size_t i = 0; i < num_events; ++i) {
+            RAV_TRACE_COUNTER("counter", i);
+        }
+        RAV_TRACE_MESSAGE(k_marker);
+
+        // The oldest event might be left out, as it could be in the middle of being overwritten.
+        const auto events = events_of_this_thread(k_marker);
+        REQUIRE(events.size() >= rav::Tracer::k_events_per_thread - 1);
+        REQUIRE(events.size() <= rav::Tracer::k_events_per_thread);
+        REQUIRE(events.back().type == rav::Tracer::EventType::message);
+        REQUIRE(events[events.size() - 2].value == static_cast<double>(num_events - 1));
+        bool consecutive = true;
+        for (size_t i = 1; i < events.size() - 1; ++i) {
+            consecutive &= events[i].value == events[i - 1].value + 1.0;
+        }
+        REQUIRE(consecutive);
+    }
+
+    SECTION("Events of multiple threads") {
+        ScopedTracing tracing;
+        constexpr int num_threads = 4;
+        std::vector<std::thread> threads;
+        for (int i = 0; i < num_threads; ++i) {
+            threads.emplace_back([] {
+                rav::Tracer::set_thread_name("worker");
+                RAV_TRACE_ZONE("work");
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        const auto events = rav::Tracer::get_events();
+        REQUIRE(events.size() == num_threads * 2);
+    }
+
+    SECTION("Export to the Chrome trace format") {
+        ScopedTracing tracing;
+        rav::Tracer::set_thread_name("main \"thread\"");
+        {
+            RAV_TRACE_ZONE("zone");
+            RAV_TRACE_PLOT("plot", 2.0);
+            RAV_TRACE_MESSAGE("message");
+        }
+
+        const auto json = boost::json::parse(rav::Tracer::export_chrome_trace());
+        const auto& trace_events = json.at("traceEvents").as_array();
+
+        size_t num_begin = 0, num_end = 0, num_counter = 0, num_instant = 0;
+        bool has_thread_name = false;
+        for (const auto& event : trace_events) {
+            const auto ph = event.at("ph").as_string();
+            if (ph == "B") {
+                num_begin++;
+            } else if (ph == "E") {
+                num_end++;
+            } else if (ph == "C") {
+                num_counter++;
+                REQUIRE(event.at("args").at("value").to_number<double>() == 2.0);
+            } else if (ph == "i") {
+                num_instant++;
+            } else if (ph == "M" && event.at("args").at("name").as_string() == "main \"thread\"") {
+                has_thread_name = true;
+            }
+        }
+        REQUIRE(num_begin == 1);
+        REQUIRE(num_end == 1);
+        REQUIRE(num_counter == 1);
+        REQUIRE(num_instant == 1);
+        REQUIRE(has_thread_name);
+    }
+}
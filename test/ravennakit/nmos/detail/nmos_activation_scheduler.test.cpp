@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/nmos/detail/nmos_activation_scheduler.hpp"
+
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+rav::nmos::ActivationScheduler::ScheduledActivation make_activation(const uint8_t id, const rav::nmos::Timestamp& time) {
+    rav::nmos::ActivationScheduler::ScheduledActivation scheduled;
+    scheduled.resource_id = boost::uuids::uuid {{id}};
+    scheduled.activation.mode = rav::nmos::Activation::Mode::activate_scheduled_absolute;
+    scheduled.activation.requested_time = time;
+    scheduled.activation.activation_time = time;
+    return scheduled;
+}
+
+}  // namespace
+
+TEST_CASE("rav::nmos::ActivationScheduler") {
+    using Scheduler = rav::nmos::ActivationScheduler;
+
+    SECTION("Activations are taken in order of activation time") {
+        Scheduler scheduler;
+        CHECK_FALSE(scheduler.next_activation_time().has_value());
+
+        scheduler.schedule(make_activation(1, {100, 500}));
+        scheduler.schedule(make_activation(2, {100, 100}));
+        scheduler.schedule(make_activation(3, {101, 0}));
+        CHECK(scheduler.size() == 3);
+        CHECK(scheduler.next_activation_time() == rav::nmos::Timestamp(100, 100));
+
+        CHECK(scheduler.take_due({100, 99}).empty());
+
+        const auto due = scheduler.take_due({100, 500});
+        REQUIRE(due.size() == 2);
+        CHECK(due[0].resource_id == boost::uuids::uuid {{2}});
+        CHECK(due[1].resource_id == boost::uuids::uuid {{1}});
+        CHECK(scheduler.size() == 1);
+        CHECK(scheduler.find(boost::uuids::uuid {{1}}) == nullptr);
+        CHECK(scheduler.next_activation_time() == rav::nmos::Timestamp(101, 0));
+    }
+
+    SECTION("Scheduling again replaces the pending activation of a resource") {
+        Scheduler scheduler;
+        scheduler.schedule(make_activation(1, {100, 0}));
+        scheduler.schedule(make_activation(1, {200, 0}));
+        CHECK(scheduler.size() == 1);
+        CHECK(scheduler.next_activation_time() == rav::nmos::Timestamp(200, 0));
+        CHECK(scheduler.take_due({150, 0}).empty());
+    }
+
+    SECTION("Cancel") {
+        Scheduler scheduler;
+        scheduler.schedule(make_activation(1, {100, 0}));
+        scheduler.schedule(make_activation(2, {100, 0}));
+        CHECK(scheduler.cancel(boost::uuids::uuid {{1}}));
+        CHECK_FALSE(scheduler.cancel(boost::uuids::uuid {{1}}));
+
+        const auto due = scheduler.take_due({100, 0});
+        REQUIRE(due.size() == 1);
+        CHECK(due[0].resource_id == boost::uuids::uuid {{2}});
+        CHECK_FALSE(scheduler.next_activation_time().has_value());
+    }
+
+    SECTION("Resolve activation time") {
+        const rav::nmos::Timestamp now {1000, 900'000'000};
+
+        rav::nmos::Activation activation;
+        CHECK_FALSE(Scheduler::resolve_activation_time(activation, now).has_value());
+
+        activation.mode = rav::nmos::Activation::Mode::activate_immediate;
+        CHECK(Scheduler::resolve_activation_time(activation, now) == now);
+
+        activation.mode = rav::nmos::Activation::Mode::activate_scheduled_absolute;
+        CHECK_FALSE(Scheduler::resolve_activation_time(activation, now).has_value());
+        activation.requested_time = rav::nmos::Timestamp {2000, 1};
+        CHECK(Scheduler::resolve_activation_time(activation, now) == rav::nmos::Timestamp(2000, 1));
+
+        activation.mode = rav::nmos::Activation::Mode::activate_scheduled_relative;
+        activation.requested_time = rav::nmos::Timestamp {1, 200'000'000};
+        CHECK(Scheduler::resolve_activation_time(activation, now) == rav::nmos::Timestamp(1002, 100'000'000));
+    }
+
+    SECTION("Align to packet boundary") {
+        // 48 kHz with 48 frames per packet (1 ms)
+        CHECK(Scheduler::align_to_packet_boundary({10, 0}, 48000, 48, 0) == rav::nmos::Timestamp(10, 0));
+        CHECK(Scheduler::align_to_packet_boundary({10, 1}, 48000, 48, 0) == rav::nmos::Timestamp(10, 1'000'000));
+        CHECK(Scheduler::align_to_packet_boundary({10, 999'000'001}, 48000, 48, 0) == rav::nmos::Timestamp(11, 0));
+
+        // With a media clock offset of 12 frames, packets start 36 frames (750 us) into each millisecond
+        CHECK(Scheduler::align_to_packet_boundary({10, 0}, 48000, 48, 12) == rav::nmos::Timestamp(10, 750'000));
+        CHECK(Scheduler::align_to_packet_boundary({10, 0}, 48000, 48, -12) == rav::nmos::Timestamp(10, 250'000));
+
+        // 44.1 kHz with 6 frames per packet: boundaries don't fall on whole nanoseconds, round up
+        const auto aligned = Scheduler::align_to_packet_boundary({10, 1}, 44100, 6, 0);
+        CHECK(aligned == rav::nmos::Timestamp(10, 136'055));
+
+        // Without packet timing the time is returned as is
+        CHECK(Scheduler::align_to_packet_boundary({10, 1}, 48000, 0, 0) == rav::nmos::Timestamp(10, 1));
+    }
+}
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/nmos/detail/nmos_resource_cache.hpp"
+#include "ravennakit/nmos/models/nmos_resource_core.hpp"
+
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+rav::nmos::ResourceCore make_resource(const uint8_t id, std::string label) {
+    rav::nmos::ResourceCore resource;
+    resource.id = boost::uuids::uuid {{id}};
+    resource.version = {1, 0};
+    resource.label = std::move(label);
+    return resource;
+}
+
+}  // namespace
+
+TEST_CASE("rav::nmos::ResourceCache") {
+    SECTION("A resource is serialized once per version") {
+        rav::nmos::ResourceCache cache;
+        auto resource = make_resource(1, "label 1");
+
+        const auto& entry = cache.get(resource);
+        CHECK(entry.json == boost::json::serialize(boost::json::value_from(resource)));
+        CHECK(entry.etag.size() == 18);
+        CHECK(entry.etag.front() == '"');
+        CHECK(entry.etag.back() == '"');
+
+        // Changing the resource without updating its version serves the cached representation
+        resource.label = "label 2";
+        CHECK(cache.get(resource).json.find("label 1") != std::string::npos);
+
+        const auto etag = entry.etag;
+        resource.version.inc();
+        CHECK(cache.get(resource).json.find("label 2") != std::string::npos);
+        CHECK(cache.get(resource).etag != etag);
+        CHECK(cache.size() == 1);
+
+        cache.erase(resource.id);
+        CHECK(cache.size() == 0);
+    }
+
+    SECTION("A collection is rebuilt when it changes") {
+        rav::nmos::ResourceCache cache;
+        auto resource1 = make_resource(1, "label 1");
+        auto resource2 = make_resource(2, "label 2");
+        std::vector<rav::nmos::ResourceCore*> resources;
+
+        CHECK(cache.get_collection("resources", resources).json == "[]");
+
+        resources.push_back(&resource1);
+        resources.push_back(&resource2);
+
+        const boost::json::array expected {boost::json::value_from(resource1), boost::json::value_from(resource2)};
+        const auto& entry = cache.get_collection("resources", resources);
+        CHECK(entry.json == boost::json::serialize(expected));
+
+        const auto etag = entry.etag;
+        CHECK(cache.get_collection("resources", resources).etag == etag);
+
+        resource2.label = "label 3";
+        resource2.version.inc();
+        CHECK(cache.get_collection("resources", resources).json.find("label 3") != std::string::npos);
+        CHECK(cache.get_collection("resources", resources).etag != etag);
+
+        resources.pop_back();
+        CHECK(cache.get_collection("resources", resources).json == "[" + cache.get(resource1).json + "]");
+
+        // Other collections are independent
+        CHECK(cache.get_collection("other", std::vector<rav::nmos::ResourceCore*> {}).json == "[]");
+        CHECK(cache.get_collection("resources", resources).json == "[" + cache.get(resource1).json + "]");
+    }
+
+    SECTION("etag_matches") {
+        const std::string etag = "\"0123456789abcdef\"";
+        CHECK(rav::nmos::ResourceCache::etag_matches(etag, etag));
+        CHECK(rav::nmos::ResourceCache::etag_matches("*", etag));
+        CHECK(rav::nmos::ResourceCache::etag_matches("W/\"0123456789abcdef\"", etag));
+        CHECK(rav::nmos::ResourceCache::etag_matches("\"abc\", \"0123456789abcdef\"", etag));
+        CHECK(rav::nmos::ResourceCache::etag_matches(" \"abc\" ,\t\"0123456789abcdef\"\t", etag));
+        CHECK_FALSE(rav::nmos::ResourceCache::etag_matches("", etag));
+        CHECK_FALSE(rav::nmos::ResourceCache::etag_matches("\"abc\"", etag));
+        CHECK_FALSE(rav::nmos::ResourceCache::etag_matches("0123456789abcdef", etag));
+        CHECK_FALSE(rav::nmos::ResourceCache::etag_matches(",", etag));
+    }
+}
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/nmos/detail/nmos_resource_store.hpp"
+#include "ravennakit/nmos/models/nmos_resource_core.hpp"
+
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+using Store = rav::nmos::ResourceStore<rav::nmos::ResourceCore>;
+
+rav::nmos::ResourceCore make_resource(const uint8_t id) {
+    rav::nmos::ResourceCore resource;
+    resource.id = boost::uuids::uuid {{id}};
+    return resource;
+}
+
+}  // namespace
+
+TEST_CASE("rav::nmos::ResourceStore") {
+    auto r1 = make_resource(1);
+    auto r2 = make_resource(2);
+    auto r3 = make_resource(3);
+
+    SECTION("Insert and find") {
+        Store store;
+        CHECK(store.empty());
+        CHECK(store.find(r1.id) == nullptr);
+
+        CHECK(store.insert(&r1) == Store::InsertResult::inserted);
+        CHECK(store.insert(&r2) == Store::InsertResult::inserted);
+        CHECK(store.insert(&r1) == Store::InsertResult::exists);
+        CHECK(store.size() == 2);
+
+        CHECK(store.find(r1.id) == &r1);
+        CHECK(store.find(r2.id) == &r2);
+        CHECK(store.find(r3.id) == nullptr);
+        CHECK(store.contains(&r1));
+        CHECK_FALSE(store.contains(&r3));
+    }
+
+    SECTION("A different resource with the same id is rejected") {
+        Store store;
+        auto duplicate = make_resource(1);
+        CHECK(store.insert(&r1) == Store::InsertResult::inserted);
+        CHECK(store.insert(&duplicate) == Store::InsertResult::conflict);
+        CHECK(store.size() == 1);
+        CHECK(store.find(r1.id) == &r1);
+        CHECK_FALSE(store.contains(&duplicate));
+    }
+
+    SECTION("The list keeps insertion order across removals") {
+        Store store;
+        std::ignore = store.insert(&r1);
+        std::ignore = store.insert(&r2);
+        std::ignore = store.insert(&r3);
+        CHECK(store.list() == std::vector<rav::nmos::ResourceCore*> {&r1, &r2, &r3});
+
+        CHECK(store.erase(&r2));
+        CHECK_FALSE(store.erase(&r2));
+        CHECK(store.list() == std::vector<rav::nmos::ResourceCore*> {&r1, &r3});
+        CHECK(store.find(r2.id) == nullptr);
+
+        std::ignore = store.insert(&r2);
+        CHECK(store.list() == std::vector<rav::nmos::ResourceCore*> {&r1, &r3, &r2});
+    }
+
+    SECTION("Erase if") {
+        Store store;
+        std::ignore = store.insert(&r1);
+        std::ignore = store.insert(&r2);
+        std::ignore = store.insert(&r3);
+
+        const auto count = store.erase_if([&](const rav::nmos::ResourceCore* resource) {
+            return resource != &r2;
+        });
+        CHECK(count == 2);
+        CHECK(store.list() == std::vector<rav::nmos::ResourceCore*> {&r2});
+        CHECK(store.find(r1.id) == nullptr);
+        CHECK(store.find(r3.id) == nullptr);
+        CHECK_FALSE(store.contains(&r1));
+        CHECK(store.insert(&r1) == Store::InsertResult::inserted);
+    }
+
+    SECTION("Changing the id of a stored resource") {
+        Store store;
+        std::ignore = store.insert(&r1);
+        std::ignore = store.insert(&r2);
+
+        const auto old_id = r1.id;
+        r1.id = boost::uuids::uuid {{4}};
+        CHECK(store.rekey(&r1));
+        CHECK(store.find(old_id) == nullptr);
+        CHECK(store.find(r1.id) == &r1);
+
+        // Inserting an existing resource also picks up a changed id
+        r1.id = boost::uuids::uuid {{5}};
+        CHECK(store.insert(&r1) == Store::InsertResult::exists);
+        CHECK(store.find(r1.id) == &r1);
+
+        // Unless the new id is taken
+        r1.id = r2.id;
+        CHECK(store.insert(&r1) == Store::InsertResult::conflict);
+        CHECK(store.find(r2.id) == &r2);
+        CHECK_FALSE(store.rekey(&r3));
+    }
+}
@@ -43,6 +43,11 @@ TEST_CASE("rav::nmos::ApiError") {
         REQUIRE(j == R"({"code":404,"error":"Not found","debug":"The requested resource was not found"})");
     }
 
+    SECTION("Write json") {
+        const rav::nmos::ApiError error {boost::beast::http::status::not_found, "Not \"found\""};
+        REQUIRE(rav::serialize_json(error) == R"({"code":404,"error":"Not \"found\"","debug":"error: Not \"found\""})");
+    }
+
     SECTION("From json") {
         SECTION("All fields are present") {
             auto error = boost::json::value_to<rav::nmos::ApiError>(
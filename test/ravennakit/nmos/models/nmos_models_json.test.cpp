@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/json_writer.hpp"
+#include "ravennakit/nmos/models/nmos_device.hpp"
+#include "ravennakit/nmos/models/nmos_flow_audio_raw.hpp"
+#include "ravennakit/nmos/models/nmos_receiver_audio.hpp"
+#include "ravennakit/nmos/models/nmos_self.hpp"
+#include "ravennakit/nmos/models/nmos_sender.hpp"
+#include "ravennakit/nmos/models/nmos_source.hpp"
+#include "ravennakit/nmos/models/nmos_subscription.hpp"
+
+#include <boost/json/serialize.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+template<class T>
+std::string serialize_with_boost_json(const T& value) {
+    return boost::json::serialize(boost::json::value_from(value));
+}
+
+void fill_resource_core(rav::nmos::ResourceCore& resource) {
+    resource.id = boost::uuids::random_generator()();
+    resource.version = {1700000000, 123456789};
+    resource.label = "Label with \"quotes\"";
+    resource.description = "Description\nwith a newline";
+    resource.tags = {{"location", {"Studio 1", "Rack 2"}}, {"empty", {}}};
+}
+
+}  // namespace
+
+TEST_CASE("rav::nmos models JsonWriter") {
+    SECTION("Resources are written exactly like boost::json::serialize(boost::json::value_from())") {
+        rav::nmos::Self self;
+        fill_resource_core(self);
+        self.href = "http://192.168.1.1:8080/";
+        self.api.versions = {"v1.2", "v1.3"};
+        self.api.endpoints = {{"192.168.1.1", 8080, "http", false}};
+        self.clocks.emplace_back(rav::nmos::ClockInternal {"clk0"});
+        rav::nmos::ClockPtp ptp_clock;
+        ptp_clock.name = "clk1";
+        ptp_clock.gmid = "00-11-22-ff-fe-33-44-55";
+        ptp_clock.locked = true;
+        self.clocks.emplace_back(ptp_clock);
+        self.interfaces = {{std::nullopt, "00-1a-2b-3c-4d-5e", "eth0"}, {"00-1a-2b-3c-4d-5f", "00-1a-2b-3c-4d-5f", "eth1"}};
+        REQUIRE(rav::serialize_json(self) == serialize_with_boost_json(self));
+
+        rav::nmos::Device device;
+        fill_resource_core(device);
+        device.node_id = self.id;
+        device.controls = {{"http://192.168.1.1:8080/x-nmos/connection/v1.1", "urn:x-nmos:control:sr-ctrl/v1.1", std::nullopt}};
+        device.controls.push_back({"ws://192.168.1.1:8081", "urn:x-nmos:control:ncp/v1.0", true});
+        device.senders = {boost::uuids::random_generator()(), boost::uuids::random_generator()()};
+        device.receivers = {boost::uuids::random_generator()()};
+        REQUIRE(rav::serialize_json(device) == serialize_with_boost_json(device));
+
+        rav::nmos::SourceAudio source_audio;
+        fill_resource_core(source_audio);
+        source_audio.device_id = device.id;
+        source_audio.parents = {boost::uuids::random_generator()()};
+        source_audio.clock_name = "clk1";
+        source_audio.channels = {{"Left"}, {"Right"}};
+        const rav::nmos::Source source {source_audio};
+        REQUIRE(rav::serialize_json(source_audio) == serialize_with_boost_json(source_audio));
+        REQUIRE(rav::serialize_json(source) == serialize_with_boost_json(source));
+
+        rav::nmos::FlowAudioRaw flow;
+        fill_resource_core(flow);
+        flow.source_id = source_audio.id;
+        flow.device_id = device.id;
+        flow.sample_rate = {48000, 1};
+        flow.media_type = "audio/L24";
+        flow.bit_depth = 24;
+        REQUIRE(rav::serialize_json(flow) == serialize_with_boost_json(flow));
+
+        rav::nmos::Sender sender;
+        fill_resource_core(sender);
+        sender.device_id = device.id;
+        sender.transport = "urn:x-nmos:transport:rtp.mcast";
+        sender.interface_bindings = {"eth0", "eth1"};
+        REQUIRE(rav::serialize_json(sender) == serialize_with_boost_json(sender));
+        sender.flow_id = flow.id;
+        sender.manifest_href = "http://192.168.1.1:8080/x-nmos/node/v1.3/senders/manifest";
+        sender.subscription = {boost::uuids::random_generator()(), true};
+        REQUIRE(rav::serialize_json(sender) == serialize_with_boost_json(sender));
+
+        rav::nmos::ReceiverAudio receiver;
+        fill_resource_core(receiver);
+        receiver.device_id = device.id;
+        receiver.transport = "urn:x-nmos:transport:rtp";
+        receiver.interface_bindings = {"eth0"};
+        receiver.caps.media_types = {"audio/L16", "audio/L24"};
+        REQUIRE(rav::serialize_json(receiver) == serialize_with_boost_json(receiver));
+        receiver.subscription = {sender.id, true};
+        REQUIRE(rav::serialize_json(receiver) == serialize_with_boost_json(receiver));
+    }
+
+    SECTION("Uuids in parents are written as strings") {
+        rav::nmos::FlowAudioRaw flow;
+        flow.parents = {boost::uuids::uuid {{0x01}}};
+        const auto json = rav::serialize_json(flow);
+        REQUIRE(json.find(R"("parents":["01000000-0000-0000-0000-000000000000"])") != std::string::npos);
+    }
+
+    SECTION("Subscription") {
+        rav::nmos::Subscription subscription;
+        subscription.id = boost::uuids::random_generator()();
+        subscription.ws_href = "ws://192.168.1.1:8080/x-nmos/query/v1.3/subscriptions/ws";
+        subscription.resource_path = "/senders";
+        subscription.params = {{"label", "Player"}};
+        REQUIRE(rav::serialize_json(subscription) == serialize_with_boost_json(subscription));
+    }
+}
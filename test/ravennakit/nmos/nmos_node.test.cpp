@@ -25,6 +25,7 @@
 #include "ravennakit/nmos/nmos_node.hpp"
 #include "nmos_node.test.hpp"
 
+#include <boost/beast/websocket.hpp>
 #include <catch2/catch_all.hpp>
 
 namespace {
@@ -110,6 +111,92 @@ class NodeTestHttpClient final: public rav::HttpClientBase {
     }
 };
 
+/**
+ * Stands in for a registry: answers requests asynchronously and records the types of the posted resources.
+ */
+class NodeTestRegistryClient final: public rav::HttpClientBase {
+  public:
+    std::vector<std::string> posted_types;
+    size_t posts_in_flight = 0;
+    size_t max_posts_in_flight = 0;
+    int failures_to_inject = 0;  // The number of resource posts to answer with 503 Service Unavailable
+
+    explicit NodeTestRegistryClient(boost::asio::io_context& io_context) : io_context_(io_context) {}
+
+    void set_host(const boost::urls::url& url) override {
+        std::ignore = url;
+    }
+
+    void set_host(std::string_view url) override {
+        std::ignore = url;
+    }
+
+    void set_host(std::string_view host, std::string_view service) override {
+        std::ignore = host;
+        std::ignore = service;
+    }
+
+    void request_async(
+        const rav::http::verb method, const std::string_view target, std::string body,
+        const std::string_view content_type, ResponseCallback callback
+    ) override {
+        std::ignore = content_type;
+        auto status = rav::http::status::ok;
+
+        const bool is_resource_post =
+            method == rav::http::verb::post && target.find("/resource") != std::string_view::npos;
+        if (is_resource_post) {
+            posts_in_flight++;
+            max_posts_in_flight = std::max(max_posts_in_flight, posts_in_flight);
+            if (failures_to_inject > 0) {
+                failures_to_inject--;
+                status = rav::http::status::service_unavailable;
+            } else {
+                status = rav::http::status::created;
+                posted_types.emplace_back(boost::json::parse(body).at("type").as_string());
+            }
+        }
+
+        boost::asio::post(io_context_, [this, is_resource_post, status, callback = std::move(callback)] {
+            if (is_resource_post) {
+                posts_in_flight--;
+            }
+            rav::http::response<rav::http::string_body> res;
+            res.result(status);
+            callback({res});
+        });
+    }
+
+    void get_async(std::string_view target, ResponseCallback callback) override {
+        request_async(rav::http::verb::get, target, {}, {}, std::move(callback));
+    }
+
+    void post_async(
+        std::string_view target, std::string body, ResponseCallback callback, std::string_view content_type
+    ) override {
+        request_async(rav::http::verb::post, target, std::move(body), content_type, std::move(callback));
+    }
+
+    void delete_async(std::string_view target, ResponseCallback callback) override {
+        request_async(rav::http::verb::delete_, target, {}, {}, std::move(callback));
+    }
+
+    void cancel_outstanding_requests() override {}
+
+    [[nodiscard]] const std::string& get_host() const override {
+        static const std::string host = "mock_host";
+        return host;
+    }
+
+    [[nodiscard]] const std::string& get_service() const override {
+        static const std::string service = "mock_service";
+        return service;
+    }
+
+  private:
+    boost::asio::io_context& io_context_;
+};
+
 }  // namespace
 
 TEST_CASE("rav::nmos::Node") {
@@ -342,6 +429,416 @@ TEST_CASE("rav::nmos::Node") {
         }
     }
 
+    SECTION("Registry updates are coalesced and posted in dependency order") {
+        boost::asio::io_context io_context;
+        rav::ptp::Instance ptp_instance(io_context);
+
+        auto registry_client = std::make_unique<NodeTestRegistryClient>(io_context);
+        auto* registry = registry_client.get();
+        rav::nmos::Node node(io_context, ptp_instance, std::make_unique<NodeTestRegistryBrowser>(), std::move(registry_client));
+
+        const auto run_until = [&io_context](const std::function<bool()>& condition) {
+            for (int i = 0; i < 10'000 && !condition(); ++i) {
+                io_context.run_one_for(std::chrono::milliseconds(100));
+            }
+            return condition();
+        };
+
+        rav::nmos::Device device;
+        device.id = boost::uuids::random_generator()();
+        REQUIRE(node.add_or_update_device(&device));
+
+        rav::nmos::Node::Configuration config;
+        config.id = boost::uuids::random_generator()();
+        config.operation_mode = rav::nmos::OperationMode::manual;
+        config.registry_address = "http://127.0.0.1:8080";
+        config.enabled = true;
+        REQUIRE(node.set_configuration(config, true));
+
+        REQUIRE(run_until([&node] {
+            return node.get_status() == rav::nmos::Node::Status::registered;
+        }));
+        REQUIRE(registry->posted_types == std::vector<std::string> {"node", "device"});
+        registry->posted_types.clear();
+
+        // Add resources in reverse dependency order and update them a couple of times
+        std::vector<std::unique_ptr<rav::nmos::ReceiverAudio>> receivers;
+        for (int i = 0; i < 5; ++i) {
+            auto& receiver = receivers.emplace_back(std::make_unique<rav::nmos::ReceiverAudio>());
+            receiver->id = boost::uuids::random_generator()();
+            receiver->device_id = device.id;
+            REQUIRE(node.add_or_update_receiver(receiver.get()));
+        }
+
+        rav::nmos::SourceAudio source;
+        source.id = boost::uuids::random_generator()();
+        source.device_id = device.id;
+
+        rav::nmos::FlowAudioRaw flow;
+        flow.id = boost::uuids::random_generator()();
+        flow.device_id = device.id;
+        flow.source_id = source.id;
+
+        std::vector<std::unique_ptr<rav::nmos::Sender>> senders;
+        for (int i = 0; i < 20; ++i) {
+            auto& sender = senders.emplace_back(std::make_unique<rav::nmos::Sender>());
+            sender->id = boost::uuids::random_generator()();
+            sender->device_id = device.id;
+            sender->flow_id = flow.id;
+            REQUIRE(node.add_or_update_sender(sender.get()));
+        }
+
+        REQUIRE(node.add_or_update_flow(&flow));
+        REQUIRE(node.add_or_update_source(&source));
+
+        for (int i = 0; i < 10; ++i) {
+            for (auto& sender : senders) {
+                REQUIRE(node.add_or_update_sender(sender.get()));
+            }
+        }
+
+        REQUIRE(registry->posted_types.empty());  // Nothing is posted before the coalescing window has passed
+
+        std::vector<std::string> expected {"device", "source", "flow"};
+        expected.insert(expected.end(), senders.size(), "sender");
+        expected.insert(expected.end(), receivers.size(), "receiver");
+
+        REQUIRE(run_until([&] {
+            return registry->posted_types.size() >= expected.size();
+        }));
+        io_context.run_for(std::chrono::milliseconds(50));  // Give duplicate posts a chance to show up
+
+        REQUIRE(registry->posted_types == expected);
+        REQUIRE(registry->max_posts_in_flight <= 4);
+
+        // Failed posts are retried
+        registry->posted_types.clear();
+        registry->failures_to_inject = 2;
+        REQUIRE(node.add_or_update_sender(senders.front().get()));
+        REQUIRE(run_until([&] {
+            return !registry->posted_types.empty();
+        }));
+        REQUIRE(registry->posted_types == std::vector<std::string> {"sender"});
+        REQUIRE(node.get_status() == rav::nmos::Node::Status::registered);
+
+        node.stop();
+    }
+
+    SECTION("Query API subscriptions stream incremental changes over WebSocket") {
+        boost::asio::io_context io_context;
+        rav::ptp::Instance ptp_instance(io_context);
+        rav::nmos::Node node(io_context, ptp_instance, std::make_unique<NodeTestRegistryBrowser>(), std::make_unique<NodeTestHttpClient>());
+
+        const auto run_until = [&io_context](const std::function<bool()>& condition) {
+            for (int i = 0; i < 10'000 && !condition(); ++i) {
+                io_context.run_one_for(std::chrono::milliseconds(100));
+            }
+            return condition();
+        };
+
+        rav::nmos::Device device;
+        device.id = boost::uuids::random_generator()();
+        REQUIRE(node.add_or_update_device(&device));
+
+        rav::nmos::Node::Configuration config;
+        config.id = boost::uuids::random_generator()();
+        config.operation_mode = rav::nmos::OperationMode::mdns_p2p;
+        config.api_port = 0;
+        config.enabled = true;
+        REQUIRE(node.set_configuration(config, true));
+
+        const boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address("127.0.0.1"), node.get_local_endpoint().port());
+
+        // Create the subscription
+        rav::HttpClient client(io_context, endpoint);
+        boost::json::value subscription;
+        client.post_async(
+            "/x-nmos/query/v1.3/subscriptions",
+            R"({"max_update_rate_ms":0,"resource_path":"/senders","params":{},"persist":false})",
+            [&](const boost::system::result<rav::http::response<rav::http::string_body>>& response) {
+                REQUIRE(response.has_value());
+                REQUIRE(response->result() == rav::http::status::created);
+                subscription = boost::json::parse(response->body());
+            },
+            "application/json"
+        );
+        REQUIRE(run_until([&] {
+            return subscription.is_object();
+        }));
+        const std::string subscription_id(subscription.at("id").as_string());
+
+        // Connect to the subscription
+        boost::beast::websocket::stream<boost::asio::ip::tcp::socket> ws(io_context);
+        boost::beast::flat_buffer buffer;
+        std::vector<boost::json::value> grains;
+
+        std::function<void()> read_next = [&] {
+            ws.async_read(buffer, [&](const boost::system::error_code& ec, size_t) {
+                if (ec) {
+                    return;
+                }
+                grains.push_back(boost::json::parse(boost::beast::buffers_to_string(buffer.data())));
+                buffer.consume(buffer.size());
+                read_next();
+            });
+        };
+
+        ws.next_layer().async_connect(endpoint, [&](const boost::system::error_code& ec) {
+            REQUIRE_FALSE(ec);
+            const auto target = fmt::format("/x-nmos/query/v1.3/subscriptions/{}/ws", subscription_id);
+            ws.async_handshake("127.0.0.1", target, [&](const boost::system::error_code& handshake_ec) {
+                REQUIRE_FALSE(handshake_ec);
+                read_next();
+            });
+        });
+
+        // The first grain is a sync grain of the (empty) collection
+        REQUIRE(run_until([&] {
+            return grains.size() == 1;
+        }));
+        REQUIRE(grains[0].at("grain_type") == "event");
+        REQUIRE(grains[0].at("grain").at("topic") == "/senders/");
+        REQUIRE(grains[0].at("grain").at("data").as_array().empty());
+
+        // Adding a sender results in a grain without pre
+        rav::nmos::Sender sender;
+        sender.id = boost::uuids::random_generator()();
+        sender.device_id = device.id;
+        REQUIRE(node.add_or_update_sender(&sender));
+        REQUIRE(run_until([&] {
+            return grains.size() == 2;
+        }));
+        const auto& added = grains[1].at("grain").at("data").as_array();
+        REQUIRE(added.size() == 1);
+        REQUIRE(added[0].at("path") == boost::uuids::to_string(sender.id));
+        REQUIRE(added[0].at("pre").is_null());
+        REQUIRE(added[0].at("post").at("id") == boost::uuids::to_string(sender.id));
+
+        // Updating only sends the changed resource, with pre and post
+        sender.label = "Updated";
+        REQUIRE(node.add_or_update_sender(&sender));
+        REQUIRE(run_until([&] {
+            return grains.size() == 3;
+        }));
+        const auto& modified = grains[2].at("grain").at("data").as_array();
+        REQUIRE(modified.size() == 1);
+        REQUIRE(modified[0].at("pre").at("label") == "");
+        REQUIRE(modified[0].at("post").at("label") == "Updated");
+
+        // Removing results in a grain without post
+        REQUIRE(node.remove_sender(&sender));
+        REQUIRE(run_until([&] {
+            return grains.size() == 4;
+        }));
+        const auto& removed = grains[3].at("grain").at("data").as_array();
+        REQUIRE(removed.size() == 1);
+        REQUIRE(removed[0].at("pre").at("id") == boost::uuids::to_string(sender.id));
+        REQUIRE(removed[0].at("post").is_null());
+
+        ws.async_close(boost::beast::websocket::close_code::normal, [](const boost::system::error_code&) {});
+        io_context.run_for(std::chrono::milliseconds(100));
+        node.stop();
+    }
+
+    SECTION("Persistent query API subscriptions can be deleted") {
+        boost::asio::io_context io_context;
+        rav::ptp::Instance ptp_instance(io_context);
+        rav::nmos::Node node(io_context, ptp_instance, std::make_unique<NodeTestRegistryBrowser>(), std::make_unique<NodeTestHttpClient>());
+
+        rav::nmos::Node::Configuration config;
+        config.id = boost::uuids::random_generator()();
+        config.operation_mode = rav::nmos::OperationMode::mdns_p2p;
+        config.api_port = 0;
+        config.enabled = true;
+        REQUIRE(node.set_configuration(config, true));
+
+        const boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address("127.0.0.1"), node.get_local_endpoint().port());
+        rav::HttpClient client(io_context, endpoint);
+
+        const auto request = [&](const rav::http::verb method, const std::string& target, std::string body) {
+            std::optional<rav::http::response<rav::http::string_body>> result;
+            client.request_async(
+                method, target, std::move(body), "application/json",
+                [&result](const boost::system::result<rav::http::response<rav::http::string_body>>& response) {
+                    REQUIRE(response.has_value());
+                    result = *response;
+                }
+            );
+            for (int i = 0; i < 10'000 && !result.has_value(); ++i) {
+                io_context.run_one_for(std::chrono::milliseconds(100));
+            }
+            REQUIRE(result.has_value());
+            return *result;
+        };
+
+        const auto create = [&](const bool persist) {
+            const auto response = request(
+                rav::http::verb::post, "/x-nmos/query/v1.3/subscriptions",
+                fmt::format(R"({{"max_update_rate_ms":0,"resource_path":"/senders","params":{{}},"persist":{}}})", persist)
+            );
+            REQUIRE(response.result() == rav::http::status::created);
+            return fmt::format("/x-nmos/query/v1.3/subscriptions/{}", boost::json::parse(response.body()).at("id").as_string().c_str());
+        };
+
+        const auto persistent = create(true);
+        REQUIRE(request(rav::http::verb::get, persistent, {}).result() == rav::http::status::ok);
+        REQUIRE(request(rav::http::verb::delete_, persistent, {}).result() == rav::http::status::no_content);
+        REQUIRE(request(rav::http::verb::get, persistent, {}).result() == rav::http::status::not_found);
+        REQUIRE(request(rav::http::verb::delete_, persistent, {}).result() == rav::http::status::not_found);
+
+        // Non-persistent subscriptions are managed by the node
+        const auto non_persistent = create(false);
+        REQUIRE(request(rav::http::verb::delete_, non_persistent, {}).result() == rav::http::status::forbidden);
+
+        node.stop();
+    }
+
+    SECTION("Served manifest href follows the api port") {
+        boost::asio::io_context io_context;
+        rav::ptp::Instance ptp_instance(io_context);
+        rav::nmos::Node node(io_context, ptp_instance, std::make_unique<NodeTestRegistryBrowser>(), std::make_unique<NodeTestHttpClient>());
+
+        rav::nmos::Device device;
+        device.id = boost::uuids::random_generator()();
+        REQUIRE(node.add_or_update_device(&device));
+
+        rav::nmos::Sender sender;
+        sender.id = boost::uuids::random_generator()();
+        sender.device_id = device.id;
+        REQUIRE(node.add_or_update_sender(&sender));
+
+        rav::nmos::Node::Configuration config;
+        config.id = boost::uuids::random_generator()();
+        config.operation_mode = rav::nmos::OperationMode::mdns_p2p;
+        config.api_port = 0;
+        config.enabled = true;
+        REQUIRE(node.set_configuration(config, true));
+
+        const auto get_manifest_hrefs = [&](const uint16_t port) {
+            const boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address("127.0.0.1"), port);
+            rav::HttpClient client(io_context, endpoint);
+            std::vector<std::string> hrefs;
+            for (const auto& target : {fmt::format("/x-nmos/node/v1.3/senders/{}", boost::uuids::to_string(sender.id)),
+                                       std::string("/x-nmos/node/v1.3/senders")}) {
+                std::optional<rav::http::response<rav::http::string_body>> result;
+                client.get_async(target, [&result](const boost::system::result<rav::http::response<rav::http::string_body>>& response) {
+                    REQUIRE(response.has_value());
+                    result = *response;
+                });
+                for (int i = 0; i < 10'000 && !result.has_value(); ++i) {
+                    io_context.run_one_for(std::chrono::milliseconds(100));
+                }
+                REQUIRE(result.has_value());
+                REQUIRE(result->result() == rav::http::status::ok);
+                auto json = boost::json::parse(result->body());
+                const auto& resource = json.is_array() ? json.as_array().at(0) : json;
+                hrefs.emplace_back(resource.at("manifest_href").as_string());
+            }
+            return hrefs;
+        };
+
+        const auto first_port = node.get_local_endpoint().port();
+        for (const auto& href : get_manifest_hrefs(first_port)) {
+            REQUIRE(href.find(fmt::format(":{}/", first_port)) != std::string::npos);
+        }
+
+        // Find a free port to move the api to
+        uint16_t second_port = 0;
+        {
+            boost::asio::ip::tcp::acceptor acceptor(io_context, {boost::asio::ip::make_address("127.0.0.1"), 0});
+            second_port = acceptor.local_endpoint().port();
+        }
+        REQUIRE(second_port != first_port);
+
+        const auto version = sender.version;
+        config.api_port = second_port;
+        REQUIRE(node.set_configuration(config));
+        REQUIRE(node.get_local_endpoint().port() == second_port);
+        REQUIRE(sender.version != version);
+
+        for (const auto& href : get_manifest_hrefs(second_port)) {
+            REQUIRE(href.find(fmt::format(":{}/", second_port)) != std::string::npos);
+        }
+
+        node.stop();
+    }
+
+    SECTION("Scheduled activations") {
+        boost::asio::io_context io_context;
+        rav::ptp::Instance ptp_instance(io_context);
+        rav::nmos::Node node(io_context, ptp_instance, std::make_unique<NodeTestRegistryBrowser>(), std::make_unique<NodeTestHttpClient>());
+
+        rav::nmos::Device device;
+        device.id = boost::uuids::random_generator()();
+        REQUIRE(node.add_or_update_device(&device));
+
+        int patch_requests = 0;
+        rav::nmos::Sender sender;
+        sender.id = boost::uuids::random_generator()();
+        sender.device_id = device.id;
+        sender.on_patch_request = [&](const boost::json::value&) -> tl::expected<void, rav::nmos::ApiError> {
+            patch_requests++;
+            return {};
+        };
+        sender.on_validate_patch_request = [](const boost::json::value& patch_request) -> tl::expected<void, rav::nmos::ApiError> {
+            if (patch_request.as_object().contains("transport_params")) {
+                return tl::unexpected(rav::nmos::ApiError {rav::http::status::bad_request, "Invalid transport params"});
+            }
+            return {};
+        };
+        sender.get_transport_file = []() -> tl::expected<rav::sdp::SessionDescription, rav::nmos::ApiError> {
+            return rav::sdp::SessionDescription {};
+        };
+        REQUIRE(node.add_or_update_sender(&sender));
+
+        rav::nmos::Node::Configuration config;
+        config.id = boost::uuids::random_generator()();
+        config.operation_mode = rav::nmos::OperationMode::mdns_p2p;
+        config.api_port = 0;
+        config.enabled = true;
+        REQUIRE(node.set_configuration(config, true));
+
+        const boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address("127.0.0.1"), node.get_local_endpoint().port());
+        rav::HttpClient client(io_context, endpoint);
+
+        const auto patch_staged = [&](std::string body) {
+            std::optional<rav::http::status> status;
+            client.request_async(
+                rav::http::verb::patch, fmt::format("/x-nmos/connection/v1.1/single/senders/{}/staged", boost::uuids::to_string(sender.id)),
+                std::move(body), "application/json",
+                [&status](const boost::system::result<rav::http::response<rav::http::string_body>>& response) {
+                    REQUIRE(response.has_value());
+                    status = response->result();
+                }
+            );
+            for (int i = 0; i < 10'000 && !status.has_value(); ++i) {
+                io_context.run_one_for(std::chrono::milliseconds(100));
+            }
+            REQUIRE(status.has_value());
+            return *status;
+        };
+
+        constexpr auto k_scheduled = R"("activation":{"mode":"activate_scheduled_relative","requested_time":"60:0"})";
+
+        // Invalid staged parameters are rejected when staged, not when the activation is due
+        REQUIRE(patch_staged(fmt::format(R"({{"transport_params":[{{}}],{}}})", k_scheduled)) == rav::http::status::bad_request);
+
+        // A valid scheduled activation is accepted, but not applied yet
+        REQUIRE(patch_staged(fmt::format(R"({{"master_enable":true,{}}})", k_scheduled)) == rav::http::status::accepted);
+        REQUIRE(patch_requests == 0);
+
+        // The resource is locked while the activation is pending
+        REQUIRE(patch_staged(R"({"master_enable":false})") == rav::http::status::locked);
+        REQUIRE(patch_staged(fmt::format("{{{}}}", k_scheduled)) == rav::http::status::locked);
+        REQUIRE(patch_requests == 0);
+
+        // Setting the mode to null cancels the pending activation, which unlocks the resource
+        REQUIRE(patch_staged(R"({"activation":{"mode":null}})") == rav::http::status::ok);
+        REQUIRE(patch_staged(R"({"master_enable":false})") == rav::http::status::ok);
+
+        node.stop();
+    }
+
     SECTION("JSON") {
         rav::nmos::Node::Configuration config;
         config.id = boost::uuids::random_generator()();
@@ -350,6 +847,7 @@ TEST_CASE("rav::nmos::Node") {
         config.registry_address = "http://127.0.0.1:8080";
         config.enabled = false;
         config.api_port = 1234;
+        config.api_worker_threads = 2;
         config.label = "label";
         config.description = "description";
 
@@ -371,6 +869,7 @@ void rav::nmos::test_nmos_node_configuration_json(const Node::Configuration& con
     REQUIRE(json.at("registry_address").as_string() == config.registry_address);
     REQUIRE(json.at("enabled") == config.enabled);
     REQUIRE(json.at("api_port") == config.api_port);
+    REQUIRE(json.at("api_worker_threads") == config.api_worker_threads);
     REQUIRE(json.at("label").as_string() == config.label);
     REQUIRE(json.at("description").as_string() == config.description);
 }
@@ -47,6 +47,27 @@ TEST_CASE("rav::ntp::Timestamp") {
         REQUIRE(ts.fraction() == 0x45670000);
     }
 
+    SECTION("timestamp::to_compact()") {
+        const rav::ntp::Timestamp ts {0x01234567, 0x89abcdef};
+        REQUIRE(ts.to_compact() == 0x456789ab);
+        REQUIRE(rav::ntp::Timestamp::from_compact(ts.to_compact()).to_compact() == ts.to_compact());
+    }
+
+    SECTION("timestamp::from_unix_nanoseconds()") {
+        const auto ts = rav::ntp::Timestamp::from_unix_nanoseconds(1'500'000'000);
+        REQUIRE(ts.integer() == rav::ntp::Timestamp::k_seconds_from_ntp_epoch_to_unix_epoch + 1);
+        REQUIRE(ts.fraction() == 0x80000000);
+    }
+
+    SECTION("timestamp::to_unix_nanoseconds()") {
+        REQUIRE(rav::ntp::Timestamp(0, 0).to_unix_nanoseconds() == 0);
+
+        const auto nanos = uint64_t {1'700'000'000'123'456'789};
+        const auto ts = rav::ntp::Timestamp::from_unix_nanoseconds(nanos);
+        REQUIRE(ts.to_unix_nanoseconds() <= nanos);
+        REQUIRE(nanos - ts.to_unix_nanoseconds() <= 1);  // Rounding
+    }
+
     SECTION("timestamp::operator==()") {
         SECTION("Equal") {
             const rav::ntp::Timestamp ts1 {0x01234567, 0x89abcdef};
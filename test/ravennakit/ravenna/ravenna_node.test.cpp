@@ -133,5 +133,172 @@ TEST_CASE("rav::RavennaNode") {
         rav::test_ravenna_receiver_configuration_json(receiver2, json_receivers.at(1).at("configuration"));
     }
 
+    SECTION("json string") {
+        const auto json = ravenna_node.to_json_string().get();
+        REQUIRE(json == boost::json::serialize(ravenna_node.to_boost_json().get()));
+    }
+
+    SECTION("json patch") {
+        const auto base = ravenna_node.to_boost_json().get();
+        const auto revision = base.at("revision").to_number<uint64_t>();
+
+        auto patch = ravenna_node.to_boost_json_patch(revision).get();
+        REQUIRE(patch.at("base_revision").to_number<uint64_t>() == revision);
+        REQUIRE(patch.at("revision").to_number<uint64_t>() == revision);
+        REQUIRE(patch.at("senders").as_array().empty());
+        REQUIRE(patch.at("receivers").as_array().empty());
+        REQUIRE(patch.at("sender_ids").as_array().size() == 2);
+        REQUIRE(patch.at("receiver_ids").as_array().size() == 2);
+
+        auto updated = sender2;
+        updated.ttl = 32;
+        REQUIRE(ravenna_node.update_sender_configuration(id4, updated).get().has_value());
+
+        patch = ravenna_node.to_boost_json_patch(revision).get();
+        REQUIRE(patch.at("revision").to_number<uint64_t>() > revision);
+        REQUIRE(patch.at("senders").as_array().size() == 1);
+        REQUIRE(patch.at("senders").at(0).at("nmos_sender_uuid") == base.at("senders").at(1).at("nmos_sender_uuid"));
+        REQUIRE(patch.at("receivers").as_array().empty());
+
+        auto last_revision = patch.at("revision").to_number<uint64_t>();
+        ravenna_node.remove_receiver(id1).get();
+        patch = ravenna_node.to_boost_json_patch(revision).get();
+        REQUIRE(patch.at("receivers").as_array().empty());
+        REQUIRE(patch.at("receiver_ids").as_array().size() == 1);
+        REQUIRE(patch.at("receiver_ids").at(0) == base.at("receivers").at(1).at("nmos_receiver_uuid"));
+        REQUIRE(patch.at("revision").to_number<uint64_t>() > last_revision);
+
+        // Removing the sender with the highest revision doesn't take the revision back
+        last_revision = patch.at("revision").to_number<uint64_t>();
+        ravenna_node.remove_sender(id4).get();
+        REQUIRE(ravenna_node.to_boost_json().get().at("revision").to_number<uint64_t>() > last_revision);
+
+        // Configuration changes bump the revision
+        last_revision = ravenna_node.to_boost_json().get().at("revision").to_number<uint64_t>();
+        auto updated_node_config = node_config;
+        updated_node_config.label = "Updated node label";
+        REQUIRE(ravenna_node.set_nmos_configuration(updated_node_config).get().has_value());
+        REQUIRE(ravenna_node.to_boost_json().get().at("revision").to_number<uint64_t>() > last_revision);
+
+        last_revision = ravenna_node.to_boost_json().get().at("revision").to_number<uint64_t>();
+        auto updated_network_interface_config = network_interface_config;
+        updated_network_interface_config.set_interface(1, "en2-not-valid");
+        ravenna_node.set_network_interface_config(updated_network_interface_config).get();
+        REQUIRE(ravenna_node.to_boost_json().get().at("revision").to_number<uint64_t>() > last_revision);
+    }
+
+    SECTION("Restore rejects identity changes of existing senders") {
+        const auto base = ravenna_node.to_boost_json().get();
+
+        auto json = base;
+        json.at("senders").at(1).at("configuration").at("ttl") = 32;
+        json.at("senders").at(1).at("session_id") = 1234;
+        auto result = ravenna_node.restore_from_boost_json(json).get();
+        REQUIRE_FALSE(result.has_value());
+        REQUIRE(ravenna_node.to_boost_json().get().at("senders") == base.at("senders"));
+
+        json = base;
+        json.at("senders").at(1).at("nmos_flow_uuid") = boost::uuids::to_string(boost::uuids::random_generator()());
+        result = ravenna_node.restore_from_boost_json(json).get();
+        REQUIRE_FALSE(result.has_value());
+        REQUIRE(ravenna_node.to_boost_json().get().at("senders") == base.at("senders"));
+    }
+
+    SECTION("Restore only applies changes") {
+        struct Subscriber: rav::RavennaNode::Subscriber {
+            int senders_added = 0;
+            int senders_removed = 0;
+            int receivers_added = 0;
+            int receivers_removed = 0;
+
+            void ravenna_sender_added(const rav::RavennaSender&) override {
+                senders_added++;
+            }
+
+            void ravenna_sender_removed(const rav::Id) override {
+                senders_removed++;
+            }
+
+            void ravenna_receiver_added(const rav::RavennaReceiver&) override {
+                receivers_added++;
+            }
+
+            void ravenna_receiver_removed(const rav::Id) override {
+                receivers_removed++;
+            }
+        };
+
+        const auto base = ravenna_node.to_boost_json().get();
+        const auto revision = base.at("revision").to_number<uint64_t>();
+
+        auto updated = sender2;
+        updated.ttl = 32;
+        REQUIRE(ravenna_node.update_sender_configuration(id4, updated).get().has_value());
+        ravenna_node.remove_receiver(id2).get();
+        const auto patch = ravenna_node.to_boost_json_patch(revision).get();
+
+        Subscriber subscriber;
+        ravenna_node.subscribe(&subscriber).get();
+        subscriber.senders_added = 0;
+        subscriber.receivers_added = 0;
+
+        // Restoring the current state changes nothing.
+        REQUIRE(ravenna_node.restore_from_boost_json(ravenna_node.to_boost_json().get()).get().has_value());
+        REQUIRE(subscriber.senders_added == 0);
+        REQUIRE(subscriber.senders_removed == 0);
+        REQUIRE(subscriber.receivers_added == 0);
+        REQUIRE(subscriber.receivers_removed == 0);
+
+        // Going back to the base updates sender 2 in place and only adds receiver 2.
+        REQUIRE(ravenna_node.restore_from_boost_json(base).get().has_value());
+        REQUIRE(subscriber.senders_added == 0);
+        REQUIRE(subscriber.senders_removed == 0);
+        REQUIRE(subscriber.receivers_added == 1);
+        REQUIRE(subscriber.receivers_removed == 0);
+
+        auto json = ravenna_node.to_boost_json().get();
+        REQUIRE(json.at("senders").at(1).at("configuration").at("ttl") == base.at("senders").at(1).at("configuration").at("ttl"));
+        REQUIRE(json.at("receivers").as_array().size() == 2);
+        REQUIRE(json.at("receivers").at(1).at("nmos_receiver_uuid") == base.at("receivers").at(1).at("nmos_receiver_uuid"));
+
+        // Applying the patch on top of the base brings back the changes.
+        REQUIRE(ravenna_node.restore_from_boost_json(patch).get().has_value());
+        REQUIRE(subscriber.senders_added == 0);
+        REQUIRE(subscriber.senders_removed == 0);
+        REQUIRE(subscriber.receivers_added == 1);
+        REQUIRE(subscriber.receivers_removed == 1);
+
+        json = ravenna_node.to_boost_json().get();
+        REQUIRE(json.at("senders").at(1).at("configuration").at("ttl") == 32);
+        REQUIRE(json.at("receivers").as_array().size() == 1);
+
+        ravenna_node.unsubscribe(&subscriber).get();
+    }
+
+    SECTION("Restore rejects patches which are not based on the last restored revision") {
+        const auto base = ravenna_node.to_boost_json().get();
+        const auto revision = base.at("revision").to_number<uint64_t>();
+
+        auto updated = sender2;
+        updated.ttl = 32;
+        REQUIRE(ravenna_node.update_sender_configuration(id4, updated).get().has_value());
+        const auto patch = ravenna_node.to_boost_json_patch(revision).get();
+        const auto current = ravenna_node.to_boost_json().get();
+
+        // Nothing was restored yet
+        REQUIRE_FALSE(ravenna_node.restore_from_boost_json(patch).get().has_value());
+        REQUIRE(ravenna_node.to_boost_json().get().at("senders") == current.at("senders"));
+
+        // Restored from a different revision
+        REQUIRE(ravenna_node.restore_from_boost_json(current).get().has_value());
+        REQUIRE_FALSE(ravenna_node.restore_from_boost_json(patch).get().has_value());
+
+        // Restored from the base, the patch applies once
+        REQUIRE(ravenna_node.restore_from_boost_json(base).get().has_value());
+        REQUIRE(ravenna_node.restore_from_boost_json(patch).get().has_value());
+        REQUIRE(ravenna_node.to_boost_json().get().at("senders").at(1).at("configuration").at("ttl") == 32);
+        REQUIRE_FALSE(ravenna_node.restore_from_boost_json(patch).get().has_value());
+    }
+
 #endif
 }
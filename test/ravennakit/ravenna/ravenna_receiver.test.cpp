@@ -144,6 +144,7 @@ TEST_CASE("rav::RavennaReceiver") {
             rav::sdp::parse_session_description("v=0\r\no=- 1731086923289383 0 IN IP4 192.168.4.8\r\n").value();
 
         rav::test_ravenna_receiver_configuration_json(config, boost::json::value_from(config));
+        REQUIRE(rav::serialize_json(config) == boost::json::serialize(boost::json::value_from(config)));
 
 #if !RAV_LINUX
         // On Linux there is no implementation for the dnssd browser which makes the next code error out. Until the
@@ -155,6 +156,11 @@ TEST_CASE("rav::RavennaReceiver") {
         rav::RavennaReceiver receiver(rtsp_client, rtp_receiver, rav::Id(1), {});
         REQUIRE(receiver.set_configuration(config));
         rav::test_ravenna_receiver_json(receiver, receiver.to_boost_json());
+
+        std::string receiver_json_string;
+        rav::JsonWriter writer(receiver_json_string);
+        receiver.write_json(writer);
+        REQUIRE(receiver_json_string == boost::json::serialize(receiver.to_boost_json()));
 #endif
     }
 
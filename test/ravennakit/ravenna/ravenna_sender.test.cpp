@@ -47,6 +47,7 @@ TEST_CASE("rav::RavennaSender") {
     audio_format.ordering = rav::AudioFormat::ChannelOrdering::interleaved;
 
     test_audio_format_json(audio_format, boost::json::value_from(audio_format));
+    REQUIRE(rav::serialize_json(audio_format) == boost::json::serialize(boost::json::value_from(audio_format)));
 
     rav::RavennaSender::Configuration config;
     config.enabled = false;
@@ -58,6 +59,7 @@ TEST_CASE("rav::RavennaSender") {
     config.destinations = destinations;
 
     test_ravenna_sender_configuration_json(config, boost::json::value_from(config));
+    REQUIRE(rav::serialize_json(config) == boost::json::serialize(boost::json::value_from(config)));
 
     boost::asio::io_context io_context;
     const auto advertiser = rav::dnssd::Advertiser::create(io_context);
@@ -70,6 +72,11 @@ TEST_CASE("rav::RavennaSender") {
     rav::test_ravenna_sender_json(sender, sender_json);
     rav::test_ravenna_sender_json(sender, sender.to_boost_json());
 
+    std::string sender_json_string;
+    rav::JsonWriter writer(sender_json_string);
+    sender.write_json(writer);
+    REQUIRE(sender_json_string == boost::json::serialize(sender_json));
+
     rav::RavennaSender sender2(rtp_audio_sender, advertiser.get(), rtsp_server, ptp_instance, rav::Id {2}, 2, {});
     REQUIRE(sender2.restore_from_json(sender_json));
     rav::test_ravenna_sender_json(sender2, sender_json);
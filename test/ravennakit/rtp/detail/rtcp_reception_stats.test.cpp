@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/core/util.hpp"
+#include "ravennakit/rtp/detail/rtcp_reception_stats.hpp"
+
+#include <catch2/catch_all.hpp>
+
+TEST_CASE("rav::rtcp::ReceptionStats") {
+    rav::rtcp::ReceptionStats stats;
+
+    SECTION("Empty report block before receiving packets") {
+        REQUIRE_FALSE(stats.has_received());
+        const auto block = stats.make_report_block(0x1234, 0);
+        REQUIRE(block.ssrc == 0x1234);
+        REQUIRE(block.fraction_lost == 0);
+        REQUIRE(block.number_of_packets_lost == 0);
+        REQUIRE(block.extended_highest_sequence_number_received == 0);
+    }
+
+    SECTION("No loss") {
+        for (uint16_t i = 10; i < 20; ++i) {
+            stats.update(i, i * 48u, i * 48u);
+        }
+        REQUIRE(stats.has_received());
+        const auto block = stats.make_report_block(1, 0);
+        REQUIRE(block.fraction_lost == 0);
+        REQUIRE(block.number_of_packets_lost == 0);
+        REQUIRE(block.extended_highest_sequence_number_received == 19);
+        REQUIRE(block.inter_arrival_jitter == 0);
+    }
+
+    SECTION("Loss and fraction lost per interval") {
+        for (uint16_t i = 0; i < 8; ++i) {
+            if (i == 3 || i == 5) {
+                continue;
+            }
+            stats.update(i, 0, 0);
+        }
+        auto block = stats.make_report_block(1, 0);
+        REQUIRE(block.number_of_packets_lost == 2);
+        REQUIRE(block.fraction_lost == 2 * 256 / 8);
+
+        // Next interval without loss
+        for (uint16_t i = 8; i < 16; ++i) {
+            stats.update(i, 0, 0);
+        }
+        block = stats.make_report_block(1, 0);
+        REQUIRE(block.number_of_packets_lost == 2);  // Cumulative
+        REQUIRE(block.fraction_lost == 0);
+    }
+
+    SECTION("Duplicates make the cumulative loss negative") {
+        stats.update(0, 0, 0);
+        stats.update(1, 0, 0);
+        stats.update(1, 0, 0);
+        const auto block = stats.make_report_block(1, 0);
+        REQUIRE(block.number_of_packets_lost == -1);
+        REQUIRE(block.fraction_lost == 0);
+    }
+
+    SECTION("Sequence number wrap around extends the highest sequence number") {
+        stats.update(0xfffe, 0, 0);
+        stats.update(0xffff, 0, 0);
+        stats.update(0x0000, 0, 0);
+        stats.update(0x0001, 0, 0);
+        const auto block = stats.make_report_block(1, 0);
+        REQUIRE(block.extended_highest_sequence_number_received == 0x00010001);
+        REQUIRE(block.number_of_packets_lost == 0);
+    }
+
+    SECTION("A large jump restarts the statistics") {
+        stats.update(0, 0, 0);
+        stats.update(1, 0, 0);
+        stats.update(10000, 0, 0);
+        stats.update(10001, 0, 0);
+        const auto block = stats.make_report_block(1, 0);
+        REQUIRE(block.extended_highest_sequence_number_received == 10001);
+        REQUIRE(block.number_of_packets_lost == 0);
+    }
+
+    SECTION("Jitter converges to the transit time variation") {
+        // Packets are sent every 48 samples but arrive alternating 10 samples early and late
+        for (uint16_t i = 0; i < 1000; ++i) {
+            const auto ts = i * 48u;
+            stats.update(i, ts, ts + (i % 2 == 0 ? 0u : 20u));
+        }
+        REQUIRE(rav::is_within(stats.get_jitter(), 20.0, 0.01));
+        REQUIRE(stats.make_report_block(1, 0).inter_arrival_jitter == 19);
+    }
+
+    SECTION("LSR and DLSR") {
+        stats.update(0, 0, 0);
+
+        auto block = stats.make_report_block(1, 0);
+        REQUIRE(block.last_sr_timestamp == 0);
+        REQUIRE(block.delay_since_last_sr == 0);
+
+        stats.update_sender_report(rav::ntp::Timestamp(0x12345678, 0x9abcdef0), 1'000'000'000);
+        block = stats.make_report_block(1, 1'500'000'000);
+        REQUIRE(block.last_sr_timestamp == 0x56789abc);
+        REQUIRE(block.delay_since_last_sr == 0x8000);  // 0.5 seconds in units of 1/65536 seconds
+    }
+
+    SECTION("Reset") {
+        stats.update(0, 0, 0);
+        stats.reset();
+        REQUIRE_FALSE(stats.has_received());
+    }
+}
@@ -76,6 +76,12 @@ void setup_receiver_multicast_hooks(rav::rtp::AudioReceiver& receiver, Multicast
     return count;
 }
 
+/// Runs the io_context until the switchovers of the receiver are done.
+void run_switchovers(boost::asio::io_context& io_context, const rav::rtp::AudioReceiver& receiver) {
+    io_context.restart();
+    while (!receiver.switchovers.empty() && io_context.run_one() > 0) {}
+}
+
 [[nodiscard]] size_t count_open_sockets(rav::rtp::AudioReceiver& receiver) {
     size_t count = 0;
     for (auto& socket : receiver.sockets) {
@@ -492,4 +498,220 @@ TEST_CASE("rav::rtp::Receiver") {
 
         REQUIRE(receiver->remove_reader(rav::Id(1)));
     }
+    SECTION("Readers are published to the audio thread once set up, and unpublished before being removed") {
+        const auto multicast_addr = boost::asio::ip::make_address_v4("239.1.2.3");
+        const auto src_addr = boost::asio::ip::make_address_v4("192.168.1.1");
+        rav::rtp::AudioReceiver::ArrayOfAddresses interface_addresses {boost::asio::ip::address_v4::loopback()};
+
+        auto receiver = std::make_unique<rav::rtp::AudioReceiver>(io_context);
+
+        rav::rtp::AudioReceiver::StreamInfo stream {
+            rav::rtp::Session {multicast_addr, 5004, 5005},
+            rav::rtp::Filter {multicast_addr, src_addr, rav::sdp::FilterMode::include},
+        };
+
+        rav::rtp::AudioReceiver::ReaderParameters parameters {audio_format, {stream}};
+        parameters.streams[0] = stream;
+
+        REQUIRE_FALSE(receiver->get_lock_contention_counters(rav::Id(1)).has_value());
+
+        REQUIRE(receiver->add_reader(rav::Id(1), parameters, interface_addresses));
+        REQUIRE(receiver->readers[0].published_id.load() == rav::Id(1));
+
+        const auto counters = receiver->get_lock_contention_counters(rav::Id(1));
+        REQUIRE(counters.has_value());
+        REQUIRE(counters->failed_shared_locks == 0);
+        REQUIRE(counters->failed_exclusive_locks == 0);
+
+        std::vector<uint8_t> buffer(audio_format.bytes_per_frame() * 32);
+        REQUIRE_FALSE(receiver->read_data_realtime(rav::Id(1), buffer.data(), buffer.size(), {}, {}).has_value());
+
+        REQUIRE(receiver->remove_reader(rav::Id(1)));
+        REQUIRE_FALSE(receiver->readers[0].published_id.load().is_valid());
+        REQUIRE_FALSE(receiver->realtime_epoch.has_readers());
+        REQUIRE(receiver->realtime_epoch.generation() == 2);
+    }
+
+    SECTION("Packet interval histogram") {
+        const auto multicast_addr = boost::asio::ip::make_address_v4("239.1.2.3");
+        const auto src_addr = boost::asio::ip::make_address_v4("192.168.1.1");
+        rav::rtp::AudioReceiver::ArrayOfAddresses interface_addresses {boost::asio::ip::address_v4::loopback()};
+
+        auto receiver = std::make_unique<rav::rtp::AudioReceiver>(io_context);
+
+        rav::rtp::AudioReceiver::StreamInfo stream {
+            rav::rtp::Session {multicast_addr, 5004, 5005},
+            rav::rtp::Filter {multicast_addr, src_addr, rav::sdp::FilterMode::include},
+        };
+
+        rav::rtp::AudioReceiver::ReaderParameters parameters {audio_format, {stream}};
+        parameters.streams[0] = stream;
+
+        REQUIRE_FALSE(receiver->get_packet_interval_histogram(rav::Id(1), 0).has_value());
+        REQUIRE(receiver->add_reader(rav::Id(1), parameters, interface_addresses));
+
+        receiver->readers[0].streams[0].packet_interval_histogram.record(1'000'000);
+        const auto histogram = receiver->get_packet_interval_histogram(rav::Id(1), 0);
+        REQUIRE(histogram.has_value());
+        REQUIRE(histogram->count() == 1);
+        REQUIRE(histogram->max() == 1'000'000);
+
+        REQUIRE(receiver->remove_reader(rav::Id(1)));
+        REQUIRE(receiver->readers[0].streams[0].packet_interval_histogram.snapshot().count() == 0);
+    }
+
+    SECTION("Update reader") {
+        const auto multicast_addr = boost::asio::ip::make_address_v4("239.1.2.3");
+        const auto other_multicast_addr = boost::asio::ip::make_address_v4("239.1.2.4");
+        const auto src_addr = boost::asio::ip::make_address_v4("192.168.1.1");
+        const auto interface_address = boost::asio::ip::address_v4::loopback();
+        rav::rtp::AudioReceiver::ArrayOfAddresses interface_addresses {interface_address};
+
+        auto receiver = std::make_unique<rav::rtp::AudioReceiver>(io_context);
+        MulticastMembershipChangesVector changes;
+        setup_receiver_multicast_hooks(*receiver, changes);
+
+        rav::rtp::AudioReceiver::StreamInfo stream {
+            rav::rtp::Session {multicast_addr, 5004, 5005},
+            rav::rtp::Filter {multicast_addr, src_addr, rav::sdp::FilterMode::include},
+            48,
+        };
+
+        rav::rtp::AudioReceiver::ReaderParameters parameters {audio_format, {stream}};
+        parameters.streams[0] = stream;
+
+        SECTION("Adds a reader if there is none") {
+            REQUIRE(receiver->update_reader(rav::Id(1), parameters, interface_addresses));
+            REQUIRE(count_valid_readers(*receiver) == 1);
+            REQUIRE(receiver->readers[0].published_id.load() == rav::Id(1));
+            REQUIRE(receiver->remove_reader(rav::Id(1)));
+        }
+
+        SECTION("Filter changes are applied in place") {
+            REQUIRE(receiver->add_reader(rav::Id(1), parameters, interface_addresses));
+
+            auto updated = parameters;
+            updated.streams[0].filter = rav::rtp::Filter {multicast_addr, src_addr, rav::sdp::FilterMode::exclude};
+            REQUIRE(receiver->update_reader(rav::Id(1), updated, interface_addresses));
+
+            REQUIRE(count_valid_readers(*receiver) == 1);
+            REQUIRE(receiver->readers[0].published_id.load() == rav::Id(1));
+            REQUIRE(receiver->readers[0].streams[0].filter == updated.streams[0].filter);
+            REQUIRE(receiver->realtime_epoch.generation() == 0);
+            REQUIRE(changes.size() == 1);
+
+            REQUIRE(receiver->remove_reader(rav::Id(1)));
+        }
+
+        SECTION("Data path changes join the new group before leaving the old one") {
+            REQUIRE(receiver->add_reader(rav::Id(1), parameters, interface_addresses));
+
+            auto updated = parameters;
+            updated.streams[0].session.connection_address = other_multicast_addr;
+            updated.streams[0].filter = rav::rtp::Filter {other_multicast_addr, src_addr, rav::sdp::FilterMode::include};
+            REQUIRE(receiver->update_reader(rav::Id(1), updated, interface_addresses));
+
+            REQUIRE(count_valid_readers(*receiver) == 1);
+            REQUIRE_FALSE(receiver->readers[0].id.is_valid());
+            REQUIRE_FALSE(receiver->readers[0].published_id.load().is_valid());
+            REQUIRE(receiver->readers[1].id == rav::Id(1));
+            REQUIRE(receiver->readers[1].published_id.load() == rav::Id(1));
+            REQUIRE(receiver->readers[1].streams[0].session == updated.streams[0].session);
+            REQUIRE(receiver->readers[1].takeover_from.load() == nullptr);
+            REQUIRE(count_open_sockets(*receiver) == 1);
+
+            REQUIRE(changes.size() == 3);
+            REQUIRE(changes[0] == std::tuple(true, 5004, multicast_addr, interface_address));
+            REQUIRE(changes[1] == std::tuple(true, 5004, other_multicast_addr, interface_address));
+            REQUIRE(changes[2] == std::tuple(false, 5004, multicast_addr, interface_address));
+
+            REQUIRE(receiver->remove_reader(rav::Id(1)));
+            REQUIRE(count_valid_readers(*receiver) == 0);
+        }
+
+        SECTION("Groups used before and after stay joined") {
+            REQUIRE(receiver->add_reader(rav::Id(1), parameters, interface_addresses));
+
+            auto updated = parameters;
+            updated.streams[0].packet_time_frames = 96;
+            REQUIRE(receiver->update_reader(rav::Id(1), updated, interface_addresses));
+
+            REQUIRE(count_valid_readers(*receiver) == 1);
+            REQUIRE(receiver->readers[1].streams[0].packet_time_frames == 96);
+            REQUIRE(changes.size() == 1);
+
+            REQUIRE(receiver->remove_reader(rav::Id(1)));
+            REQUIRE(changes.size() == 2);
+        }
+
+        SECTION("The audio thread takes over the read position") {
+            REQUIRE(receiver->add_reader(rav::Id(1), parameters, interface_addresses));
+
+            // Pretend data has been received and is being consumed.
+            auto& reader = receiver->readers[0];
+            std::vector<uint8_t> frames(audio_format.bytes_per_frame() * 32, 0x55);
+            reader.receive_buffer.write(1000, rav::BufferView<const uint8_t>(frames.data(), frames.size()));
+            reader.most_recent_ts = rav::WrappingUint32(1000 + 31);
+            reader.next_ts_to_read = rav::WrappingUint32(1000);
+            reader.streams[0].state = rav::rtp::AudioReceiver::StreamState::receiving;
+
+            std::atomic<bool> keep_going {true};
+            std::vector<std::optional<uint32_t>> timestamps;
+            std::thread audio_thread([&] {
+                std::vector<uint8_t> buffer(frames.size());
+                while (keep_going) {
+                    timestamps.push_back(receiver->read_data_realtime(rav::Id(1), buffer.data(), buffer.size(), {}, {}));
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            });
+
+            auto updated = parameters;
+            updated.streams[0].packet_time_frames = 96;
+            REQUIRE(receiver->update_reader(rav::Id(1), updated, interface_addresses));
+
+            // The switchover continues on the io_context: the shadow reader waits for its first packets before it's published
+            REQUIRE(receiver->switchovers.size() == 1);
+            REQUIRE(receiver->readers[0].published_id.load() == rav::Id(1));
+            REQUIRE_FALSE(receiver->readers[1].published_id.load().is_valid());
+            REQUIRE(receiver->get_stream_state(rav::Id(1), 0) == receiver->readers[1].streams[0].state.load());
+
+            run_switchovers(io_context, *receiver);
+            REQUIRE(receiver->switchovers.empty());
+
+            keep_going = false;
+            audio_thread.join();
+
+            REQUIRE_FALSE(receiver->readers[0].id.is_valid());
+            REQUIRE(receiver->readers[1].published_id.load() == rav::Id(1));
+            REQUIRE(receiver->readers[1].most_recent_ts.has_value());
+
+            // Reading continued without a gap: every read succeeded at the position following the previous one.
+            REQUIRE(timestamps.size() > 1);
+            for (size_t i = 0; i < timestamps.size(); ++i) {
+                REQUIRE(timestamps[i].has_value());
+                REQUIRE(*timestamps[i] == 1000 + i * 32);
+            }
+
+            REQUIRE(receiver->remove_reader(rav::Id(1)));
+        }
+
+        SECTION("Removing a reader finishes its switchover") {
+            REQUIRE(receiver->add_reader(rav::Id(1), parameters, interface_addresses));
+            receiver->readers[0].streams[0].state = rav::rtp::AudioReceiver::StreamState::receiving;
+
+            auto updated = parameters;
+            updated.streams[0].packet_time_frames = 96;
+            REQUIRE(receiver->update_reader(rav::Id(1), updated, interface_addresses));
+            REQUIRE(receiver->switchovers.size() == 1);
+            REQUIRE(count_valid_readers(*receiver) == 2);
+
+            REQUIRE(receiver->remove_reader(rav::Id(1)));
+            REQUIRE(receiver->switchovers.empty());
+            REQUIRE(count_valid_readers(*receiver) == 0);
+            REQUIRE(count_open_sockets(*receiver) == 0);
+
+            run_switchovers(io_context, *receiver);  // The pending poll finds nothing to do
+            REQUIRE(count_valid_readers(*receiver) == 0);
+        }
+    }
 }
@@ -138,4 +138,29 @@ TEST_CASE("rav::rtp::Ringbuffer") {
         buffer.read(2, output.data(), output.size(), true);
         REQUIRE(output == std::array<uint8_t, 8> {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
     }
+
+    SECTION("Copy a range from another buffer") {
+        rav::rtp::Ringbuffer source;
+        source.resize(4, 2);
+
+        std::array<const uint8_t, 8> input = {0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8};
+        source.write(3, rav::BufferView(input.data(), input.size()));
+
+        // Frames 3 to 5 wrap around the end of the source buffer
+        rav::rtp::Ringbuffer buffer;
+        buffer.resize(8, 2);
+        REQUIRE(buffer.copy_from(source, 3, 3));
+        REQUIRE(buffer.get_next_ts().value() == 6);
+
+        std::array<uint8_t, 10> output = {};
+        buffer.read(2, output.data(), output.size());
+        REQUIRE(output == std::array<uint8_t, 10> {0x0, 0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x0, 0x0});
+
+        REQUIRE(buffer.copy_from(source, 4, 0));
+        REQUIRE_FALSE(buffer.copy_from(source, 4, 5));
+
+        rav::rtp::Ringbuffer other_frame_size;
+        other_frame_size.resize(4, 4);
+        REQUIRE_FALSE(other_frame_size.copy_from(source, 4, 2));
+    }
 }
@@ -95,3 +95,72 @@ TEST_CASE("rav::rtp::Filter") {
         ));
     }
 }
+
+TEST_CASE("rav::rtp::CompiledFilter") {
+    const auto connection_address = boost::asio::ip::make_address("239.3.8.1");
+    const auto address = [](const uint32_t value) {
+        return boost::asio::ip::address(boost::asio::ip::address_v4(value));
+    };
+
+    SECTION("Default constructed filter only matches the unspecified connection address") {
+        const rav::rtp::CompiledFilter compiled;
+        REQUIRE(compiled.is_valid_source({}, address(1)));
+        REQUIRE_FALSE(compiled.is_valid_source(connection_address, address(1)));
+    }
+
+    SECTION("Connection address must match") {
+        const rav::rtp::CompiledFilter compiled(rav::rtp::Filter {connection_address});
+        REQUIRE(compiled.connection_address() == connection_address);
+        REQUIRE(compiled.is_valid_source(connection_address, address(1)));
+        REQUIRE_FALSE(compiled.is_valid_source(boost::asio::ip::make_address("239.3.8.2"), address(1)));
+        REQUIRE_FALSE(compiled.is_valid_source(boost::asio::ip::make_address("ff02::1"), address(1)));
+    }
+
+    SECTION("Exclude takes priority over include") {
+        rav::rtp::Filter filter(connection_address);
+        filter.add_filter(address(1), rav::sdp::FilterMode::include);
+        filter.add_filter(address(2), rav::sdp::FilterMode::include);
+        filter.add_filter(address(2), rav::sdp::FilterMode::exclude);
+        const rav::rtp::CompiledFilter compiled(filter);
+        REQUIRE(compiled.is_valid_source(connection_address, address(1)));
+        REQUIRE_FALSE(compiled.is_valid_source(connection_address, address(2)));
+        REQUIRE_FALSE(compiled.is_valid_source(connection_address, address(3)));
+    }
+
+    SECTION("All included addresses excluded") {
+        rav::rtp::Filter filter(connection_address);
+        filter.add_filter(address(1), rav::sdp::FilterMode::include);
+        filter.add_filter(address(1), rav::sdp::FilterMode::exclude);
+        const rav::rtp::CompiledFilter compiled(filter);
+        REQUIRE_FALSE(compiled.is_valid_source(connection_address, address(1)));
+        REQUIRE_FALSE(compiled.is_valid_source(connection_address, address(2)));
+    }
+
+    SECTION("IPv6 sources") {
+        rav::rtp::Filter filter(connection_address);
+        filter.add_filter(boost::asio::ip::make_address("fe80::1"), rav::sdp::FilterMode::exclude);
+        const rav::rtp::CompiledFilter compiled(filter);
+        REQUIRE_FALSE(compiled.is_valid_source(connection_address, boost::asio::ip::make_address("fe80::1")));
+        REQUIRE(compiled.is_valid_source(connection_address, boost::asio::ip::make_address("fe80::2")));
+        REQUIRE(compiled.is_valid_source(connection_address, address(1)));
+    }
+
+    SECTION("Gives the same results as Filter for 1 to 64 entries") {
+        for (uint32_t num_entries = 1; num_entries <= 64; ++num_entries) {
+            rav::rtp::Filter filter(connection_address);
+            for (uint32_t i = 0; i < num_entries; ++i) {
+                // Mix include and exclude entries, with some overlap
+                const auto mode = i % 3 == 0 ? rav::sdp::FilterMode::exclude : rav::sdp::FilterMode::include;
+                filter.add_filter(address(0xc0a80000 + i * 7 % 50), mode);
+            }
+            const rav::rtp::CompiledFilter compiled(filter);
+            for (uint32_t i = 0; i < 60; ++i) {
+                INFO("num_entries: " << num_entries << ", i: " << i);
+                REQUIRE(
+                    compiled.is_valid_source(connection_address, address(0xc0a80000 + i))
+                    == filter.is_valid_source(connection_address, address(0xc0a80000 + i))
+                );
+            }
+        }
+    }
+}
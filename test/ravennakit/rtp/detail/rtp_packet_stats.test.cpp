@@ -275,6 +275,38 @@ TEST_CASE("rav::rtp::PacketStats") {
         REQUIRE(totals.too_late == 0);
     }
 
+    SECTION("Reset clears the dropped packets") {
+        rav::rtp::PacketStats stats;
+        stats.update(10);
+        stats.update(12);
+        stats.reset();
+        stats.update(10);
+        stats.update(11);  // Would be out of order if the dropped packet was remembered
+        auto totals = stats.get_total_counts();
+        REQUIRE(totals.dropped == 0);
+        REQUIRE(totals.out_of_order == 0);
+    }
+
+    SECTION("Dropped packets spanning multiple words of the window") {
+        rav::rtp::PacketStats stats;
+        stats.update(60);
+        stats.update(200);
+        auto totals = stats.get_total_counts();
+        REQUIRE(totals.dropped == 139);
+
+        for (uint16_t i = 61; i < 200; ++i) {
+            stats.update(i);
+        }
+        totals = stats.get_total_counts();
+        REQUIRE(totals.dropped == 0);
+        REQUIRE(totals.out_of_order == 139);
+        REQUIRE(totals.duplicates == 0);
+
+        stats.update(100);
+        totals = stats.get_total_counts();
+        REQUIRE(totals.duplicates == 1);
+    }
+
     SECTION("Reset with new window size") {
         rav::rtp::PacketStats stats;
         stats.update(1);
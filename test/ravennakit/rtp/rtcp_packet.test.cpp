@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/rtp/rtcp_packet.hpp"
+#include "ravennakit/rtp/rtcp_packet_view.hpp"
+
+#include <catch2/catch_all.hpp>
+
+TEST_CASE("rav::rtcp::SenderReport") {
+    rav::rtcp::SenderReport report;
+    report.ssrc = 0x01020304;
+    report.ntp_timestamp = rav::ntp::Timestamp(0x05060708, 0x090a0b0c);
+    report.rtp_timestamp = 0x0d0e0f10;
+    report.packet_count = 0x11121314;
+    report.octet_count = 0x15161718;
+
+    SECTION("Without report blocks") {
+        rav::ByteBuffer buffer;
+        report.encode(buffer);
+        REQUIRE(buffer.size() == 28);
+
+        const rav::rtcp::PacketView view(buffer.data(), buffer.size());
+        REQUIRE(view.validate());
+        REQUIRE(view.version() == 2);
+        REQUIRE_FALSE(view.padding());
+        REQUIRE(view.type() == rav::rtcp::PacketView::PacketType::sender_report_report);
+        REQUIRE(view.reception_report_count() == 0);
+        REQUIRE(view.length() == 7);
+        REQUIRE(view.ssrc() == 0x01020304);
+        REQUIRE(view.ntp_timestamp() == rav::ntp::Timestamp(0x05060708, 0x090a0b0c));
+        REQUIRE(view.rtp_timestamp() == 0x0d0e0f10);
+        REQUIRE(view.packet_count() == 0x11121314);
+        REQUIRE(view.octet_count() == 0x15161718);
+    }
+
+    SECTION("With report blocks") {
+        rav::rtcp::ReportBlock block;
+        block.ssrc = 0xaabbccdd;
+        block.fraction_lost = 64;
+        block.number_of_packets_lost = 1000;
+        block.extended_highest_sequence_number_received = 0x00012345;
+        block.inter_arrival_jitter = 48;
+        block.last_sr_timestamp = 0x12345678;
+        block.delay_since_last_sr = 0x00010000;
+        report.report_blocks.push_back(block);
+        report.report_blocks.push_back(block);
+
+        rav::ByteBuffer buffer;
+        report.encode(buffer);
+        REQUIRE(buffer.size() == 28 + 2 * 24);
+
+        const rav::rtcp::PacketView view(buffer.data(), buffer.size());
+        REQUIRE(view.validate());
+        REQUIRE(view.reception_report_count() == 2);
+        REQUIRE(view.length() == 19);
+
+        const auto block_view = view.get_report_block(1);
+        REQUIRE(block_view.validate());
+        REQUIRE(block_view.ssrc() == 0xaabbccdd);
+        REQUIRE(block_view.fraction_lost() == 64);
+        REQUIRE(block_view.number_of_packets_lost() == 1000);
+        REQUIRE(block_view.extended_highest_sequence_number_received() == 0x00012345);
+        REQUIRE(block_view.inter_arrival_jitter() == 48);
+        REQUIRE(block_view.last_sr_timestamp().to_compact() == 0x12345678);
+        REQUIRE(block_view.delay_since_last_sr() == 0x00010000);
+    }
+}
+
+TEST_CASE("rav::rtcp::ReceiverReport") {
+    rav::rtcp::ReceiverReport report;
+    report.ssrc = 0x01020304;
+
+    rav::rtcp::ReportBlock block;
+    block.ssrc = 0xaabbccdd;
+    block.number_of_packets_lost = -1;
+    report.report_blocks.push_back(block);
+
+    rav::ByteBuffer buffer;
+    report.encode(buffer);
+    REQUIRE(buffer.size() == 8 + 24);
+
+    const rav::rtcp::PacketView view(buffer.data(), buffer.size());
+    REQUIRE(view.validate());
+    REQUIRE(view.type() == rav::rtcp::PacketView::PacketType::receiver_report_report);
+    REQUIRE(view.reception_report_count() == 1);
+    REQUIRE(view.length() == 8);
+    REQUIRE(view.ssrc() == 0x01020304);
+
+    const auto block_view = view.get_report_block(0);
+    REQUIRE(block_view.ssrc() == 0xaabbccdd);
+    REQUIRE(block_view.number_of_packets_lost() == 0xffffff);  // 24-bit two's complement
+    REQUIRE_FALSE(view.get_next_packet().validate());
+}
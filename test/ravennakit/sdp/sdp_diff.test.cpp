@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+/*
+ * Project: RAVENNAKIT (RAVENNA / AES67 / ST2110-30 SDK)
+ * Copyright (c) 2024-2025 Sound on Digital
+ *
+ * This file is part of RAVENNAKIT.
+ *
+ * RAVENNAKIT is dual-licensed:
+ *   1) Under the terms of the GNU Affero General Public License as published by
+ *      the Free Software Foundation, either version 3 of the License, or
+ *      (at your option) any later version (the "AGPL License"); and
+ *   2) Under a commercial license from Sound on Digital, for customers who
+ *      cannot (or do not wish to) comply with the AGPL License terms.
+ *
+ * If you obtained this file under the AGPL License, you may redistribute it
+ * and/or modify it under the terms of the AGPL License. See the LICENSE
+ * file in the project root for details.
+ *
+ * For commercial licensing, support, and other inquiries, please visit:
+ *
+ *     https://ravennakit.com
+ *
+ */
+
+#include "ravennakit/sdp/sdp_diff.hpp"
+
+#include "ravennakit/core/string.hpp"
+#include "ravennakit/sdp/sdp_session_description.hpp"
+
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+constexpr auto k_sdp =
+    "v=0\r\n"
+    "o=- 13 0 IN IP4 192.168.16.51\r\n"
+    "s=Anubis Combo LR\r\n"
+    "c=IN IP4 239.1.16.51/15\r\n"
+    "t=0 0\r\n"
+    "a=clock-domain:PTPv2 0\r\n"
+    "a=ts-refclk:ptp=IEEE1588-2008:30-D6-59-FF-FE-01-DB-72:0\r\n"
+    "a=mediaclk:direct=0\r\n"
+    "m=audio 5004 RTP/AVP 98\r\n"
+    "c=IN IP4 239.1.16.51/15\r\n"
+    "a=rtpmap:98 L16/48000/2\r\n"
+    "a=source-filter: incl IN IP4 239.1.16.51 192.168.16.51\r\n"
+    "a=clock-domain:PTPv2 0\r\n"
+    "a=sync-time:0\r\n"
+    "a=framecount:48\r\n"
+    "a=palign:0\r\n"
+    "a=ptime:1\r\n"
+    "a=ts-refclk:ptp=IEEE1588-2008:30-D6-59-FF-FE-01-DB-72:0\r\n"
+    "a=mediaclk:direct=0\r\n"
+    "a=recvonly\r\n";
+
+rav::sdp::Difference diff_with(const std::string_view to_replace, const std::string_view replacement) {
+    return rav::sdp::diff(k_sdp, rav::string_replace(k_sdp, to_replace, replacement));
+}
+
+}  // namespace
+
+TEST_CASE("rav::sdp::diff") {
+    SECTION("Equal texts") {
+        REQUIRE(rav::sdp::diff(k_sdp, k_sdp) == rav::sdp::Difference::none);
+        REQUIRE(rav::sdp::diff("", "") == rav::sdp::Difference::none);
+    }
+
+    SECTION("Line endings and blank lines are not a difference") {
+        REQUIRE(diff_with("\r\n", "\n") == rav::sdp::Difference::none);
+        REQUIRE(diff_with("t=0 0\r\n", "t=0 0\r\n\r\n") == rav::sdp::Difference::none);
+    }
+
+    SECTION("Metadata changes") {
+        REQUIRE(diff_with("o=- 13 0", "o=- 13 1") == rav::sdp::Difference::metadata);
+        REQUIRE(diff_with("s=Anubis Combo LR", "s=Anubis Combo") == rav::sdp::Difference::metadata);
+        REQUIRE(diff_with("a=sync-time:0", "a=sync-time:48") == rav::sdp::Difference::metadata);
+        REQUIRE(diff_with("a=clock-domain:PTPv2 0", "a=clock-domain:PTPv2 1") == rav::sdp::Difference::metadata);
+        REQUIRE(diff_with("a=recvonly\r\n", "") == rav::sdp::Difference::metadata);
+        REQUIRE(diff_with("a=palign:0\r\n", "a=palign:0\r\ni=Information\r\n") == rav::sdp::Difference::metadata);
+    }
+
+    SECTION("Data path changes") {
+        REQUIRE(diff_with("239.1.16.51/15", "239.1.16.52/15") == rav::sdp::Difference::data_path);
+        REQUIRE(diff_with("m=audio 5004", "m=audio 5006") == rav::sdp::Difference::data_path);
+        REQUIRE(diff_with("L16/48000/2", "L24/48000/2") == rav::sdp::Difference::data_path);
+        REQUIRE(diff_with("a=ptime:1", "a=ptime:0.125") == rav::sdp::Difference::data_path);
+        REQUIRE(diff_with("a=framecount:48", "a=framecount:6") == rav::sdp::Difference::data_path);
+        REQUIRE(diff_with("incl IN IP4", "excl IN IP4") == rav::sdp::Difference::data_path);
+        REQUIRE(diff_with("a=recvonly\r\n", "a=recvonly\r\na=mid:primary\r\n") == rav::sdp::Difference::data_path);
+        REQUIRE(diff_with("t=0 0\r\n", "t=0 0\r\na=group:DUP primary secondary\r\n") == rav::sdp::Difference::data_path);
+    }
+
+    SECTION("Moving a data path line to another section is a data path change") {
+        const auto previous = "v=0\r\nm=audio 5004 RTP/AVP 98\r\nc=IN IP4 239.1.16.51/15\r\n";
+        const auto next = "v=0\r\nc=IN IP4 239.1.16.51/15\r\nm=audio 5004 RTP/AVP 98\r\n";
+        REQUIRE(rav::sdp::diff(previous, next) == rav::sdp::Difference::data_path);
+    }
+
+    SECTION("Malformed input") {
+        // Feed every truncation of the reference text, and variants with a single byte replaced, through both the parser
+        // and the diff. This doesn't verify the result, only that malformed input is handled gracefully.
+        const std::string sdp = k_sdp;
+        for (size_t i = 0; i <= sdp.size(); ++i) {
+            const auto truncated = sdp.substr(0, i);
+            std::ignore = rav::sdp::parse_session_description(truncated);
+            REQUIRE(rav::sdp::diff(truncated, truncated) == rav::sdp::Difference::none);
+            if (i + 2 < sdp.size()) {  // Only dropping the final line ending is not a difference
+                REQUIRE(rav::sdp::diff(sdp, truncated) != rav::sdp::Difference::none);
+            }
+
+            for (const char c : {'\0', '\n', '=', ':', ' ', '/'}) {
+                if (i == sdp.size() || sdp[i] == c) {
+                    continue;
+                }
+                auto mutated = sdp;
+                mutated[i] = c;
+                std::ignore = rav::sdp::parse_session_description(mutated);
+                std::ignore = rav::sdp::diff(sdp, mutated);
+            }
+        }
+    }
+
+    SECTION("To string") {
+        REQUIRE(std::string(rav::sdp::to_string(rav::sdp::Difference::none)) == "none");
+        REQUIRE(std::string(rav::sdp::to_string(rav::sdp::Difference::metadata)) == "metadata");
+        REQUIRE(std::string(rav::sdp::to_string(rav::sdp::Difference::data_path)) == "data_path");
+    }
+}
@@ -55,6 +55,11 @@ TEST_CASE("rav::sdp::SessionDescription") {
         REQUIRE_FALSE(result);
     }
 
+    SECTION("Test line without value") {
+        REQUIRE_FALSE(rav::sdp::parse_session_description("v=0\r\ns\r\n"));
+        REQUIRE_FALSE(rav::sdp::parse_session_description("v=0\r\ns:Session\r\n"));
+    }
+
     SECTION("session_description | description from anubis") {
         constexpr auto k_anubis_sdp =
             "v=0\r\n"